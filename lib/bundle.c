@@ -0,0 +1,262 @@
+/*
+ * bundle.c --
+ *
+ *      Access to modules stored in bundle files.
+ *
+ * Copyright (c) 1999 Frank Strauss, Technical University of Braunschweig.
+ *
+ * See the file "COPYING" for information on usage and redistribution
+ * of this file, and for a DISCLAIMER OF ALL WARRANTIES.
+ */
+
+/*
+ * A bundle that appears in the module search path is opened and its
+ * index is read at the first lookup. The bundle is mapped into memory
+ * by readModuleText() and stays open until smiExit(), so that modules
+ * are handed to the parsers straight from the mapping without any
+ * further file system access.
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_WIN_H
+#include "win.h"
+#endif
+
+#include "common.h"
+#include "bundle.h"
+
+#ifdef HAVE_DMALLOC_H
+#include <dmalloc.h>
+#endif
+
+
+
+typedef struct BundleEntry {
+    char		*name;
+    const char		*data;
+    size_t		len;
+} BundleEntry;
+
+typedef struct Bundle {
+    char		*path;
+    ModuleText		text;
+    int			count;
+    BundleEntry		*entries;
+    struct Bundle	*nextPtr;
+} Bundle;
+
+
+
+static unsigned long
+getUInt32(const unsigned char *p)
+{
+    return ((unsigned long) p[0] << 24) | ((unsigned long) p[1] << 16)
+	| ((unsigned long) p[2] << 8) | (unsigned long) p[3];
+}
+
+
+
+static int
+cmpEntries(const void *a, const void *b)
+{
+    return strcmp(((const BundleEntry *) a)->name,
+		  ((const BundleEntry *) b)->name);
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * readIndex --
+ *
+ *      Read the index of a mapped bundle into a table sorted by
+ *	module names. Every offset and length is checked against the
+ *	size of the bundle.
+ *
+ * Results:
+ *      0 on success or -1 if the bundle is malformed.
+ *
+ *----------------------------------------------------------------------
+ */
+
+static int
+readIndex(Bundle *bundlePtr)
+{
+    const unsigned char *map = (const unsigned char *) bundlePtr->text.data;
+    size_t size = bundlePtr->text.len, pos, offset, len, nameLen;
+    unsigned long i, count;
+
+    if (size < BUNDLE_HEADER_LEN
+	|| memcmp(map, BUNDLE_MAGIC, BUNDLE_MAGIC_LEN)) {
+	return -1;
+    }
+    count = getUInt32(map + BUNDLE_MAGIC_LEN);
+    if (count > (size - BUNDLE_HEADER_LEN) / BUNDLE_ENTRY_LEN) {
+	return -1;
+    }
+    if (!count) {
+	return 0;
+    }
+
+    bundlePtr->entries = smiMalloc(count * sizeof(BundleEntry));
+    for (i = 0, pos = BUNDLE_HEADER_LEN; i < count; i++) {
+	if (size - pos < BUNDLE_ENTRY_LEN) {
+	    return -1;
+	}
+	offset = getUInt32(map + pos);
+	len = getUInt32(map + pos + 4);
+	nameLen = map[pos + 9];
+	if (size - pos - BUNDLE_ENTRY_LEN < nameLen
+	    || offset > size || len > size - offset) {
+	    return -1;
+	}
+	if (map[pos + 8] == BUNDLE_ENCODING_STORED && nameLen) {
+	    BundleEntry *entryPtr = &bundlePtr->entries[bundlePtr->count++];
+	    entryPtr->name = smiStrndup((const char *) map + pos
+					+ BUNDLE_ENTRY_LEN, nameLen);
+	    entryPtr->data = (const char *) map + offset;
+	    entryPtr->len = len;
+	}
+	pos += BUNDLE_ENTRY_LEN + nameLen;
+    }
+
+    qsort(bundlePtr->entries, bundlePtr->count, sizeof(BundleEntry),
+	  cmpEntries);
+    return 0;
+}
+
+
+
+static void
+freeIndex(Bundle *bundlePtr)
+{
+    int i;
+
+    for (i = 0; i < bundlePtr->count; i++) {
+	smiFree(bundlePtr->entries[i].name);
+    }
+    smiFree(bundlePtr->entries);
+    bundlePtr->entries = NULL;
+    bundlePtr->count = 0;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * openBundle --
+ *
+ *      Return the bundle at the given path, opening it at the first
+ *	call. A bundle that cannot be read is remembered as an empty
+ *	one, so that it is tried only once.
+ *
+ * Results:
+ *      A pointer to the bundle.
+ *
+ * Side effects:
+ *      Reports a malformed bundle.
+ *
+ *----------------------------------------------------------------------
+ */
+
+static Bundle *
+openBundle(const char *path)
+{
+    Bundle *bundlePtr;
+
+    for (bundlePtr = smiHandle->firstBundlePtr; bundlePtr;
+	 bundlePtr = bundlePtr->nextPtr) {
+	if (!strcmp(bundlePtr->path, path)) {
+	    return bundlePtr;
+	}
+    }
+
+    bundlePtr = smiMalloc(sizeof(Bundle));
+    bundlePtr->path = smiStrdup(path);
+    bundlePtr->nextPtr = smiHandle->firstBundlePtr;
+    smiHandle->firstBundlePtr = bundlePtr;
+
+    if (readModuleText(path, &bundlePtr->text) < 0) {
+	return bundlePtr;
+    }
+    if (readIndex(bundlePtr) < 0) {
+	smiPrintError(NULL, ERR_ILLEGAL_INPUTFILE, path);
+	freeIndex(bundlePtr);
+	closeModuleText(&bundlePtr->text);
+    }
+    return bundlePtr;
+}
+
+
+
+int
+isBundlePath(const char *path)
+{
+    size_t len = strlen(path), suffixLen = strlen(BUNDLE_SUFFIX);
+
+    return len > suffixLen && !strcmp(path + len - suffixLen, BUNDLE_SUFFIX);
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * findBundleModule --
+ *
+ *      Look up a module in the bundle at the given path. The data
+ *	remains valid until smiExit() is called.
+ *
+ * Results:
+ *      1 and the module text in data and len if the bundle contains
+ *	the module, 0 otherwise.
+ *
+ *----------------------------------------------------------------------
+ */
+
+int
+findBundleModule(const char *path, const char *modulename,
+		 const char **data, size_t *len)
+{
+    Bundle *bundlePtr;
+    BundleEntry key, *entryPtr;
+
+    bundlePtr = openBundle(path);
+    if (!bundlePtr->count) {
+	return 0;
+    }
+
+    key.name = (char *) modulename;
+    entryPtr = bsearch(&key, bundlePtr->entries, bundlePtr->count,
+		       sizeof(BundleEntry), cmpEntries);
+    if (!entryPtr) {
+	return 0;
+    }
+    *data = entryPtr->data;
+    *len = entryPtr->len;
+    return 1;
+}
+
+
+
+void
+freeBundles(void)
+{
+    Bundle *bundlePtr, *nextBundlePtr;
+
+    for (bundlePtr = smiHandle->firstBundlePtr; bundlePtr;
+	 bundlePtr = nextBundlePtr) {
+	nextBundlePtr = bundlePtr->nextPtr;
+	freeIndex(bundlePtr);
+	closeModuleText(&bundlePtr->text);
+	smiFree(bundlePtr->path);
+	smiFree(bundlePtr);
+    }
+    smiHandle->firstBundlePtr = NULL;
+}
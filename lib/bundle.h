@@ -0,0 +1,49 @@
+/*
+ * bundle.h --
+ *
+ *      Definitions for module bundles.
+ *
+ * Copyright (c) 1999 Frank Strauss, Technical University of Braunschweig.
+ *
+ * See the file "COPYING" for information on usage and redistribution
+ * of this file, and for a DISCLAIMER OF ALL WARRANTIES.
+ */
+
+#ifndef _BUNDLE_H
+#define _BUNDLE_H
+
+#include <stddef.h>
+
+/*
+ * A bundle is a single file holding many modules. All integers are
+ * unsigned and in network byte order:
+ *
+ *   header:  magic (8 octets), number of entries (4 octets)
+ *   index:   per entry: offset (4), length (4), encoding (1),
+ *            name length (1) and the name without a terminating NUL
+ *   data:    the module texts, at the offsets given in the index,
+ *            which count from the start of the file
+ *
+ * A bundle is recognized by its suffix when it appears in the module
+ * search path. Only stored (uncompressed) entries are defined so far;
+ * entries with another encoding are ignored.
+ */
+
+#define BUNDLE_MAGIC		"SMIBNDL1"
+#define BUNDLE_MAGIC_LEN	8
+#define BUNDLE_HEADER_LEN	12
+#define BUNDLE_ENTRY_LEN	10
+#define BUNDLE_SUFFIX		".smib"
+
+#define BUNDLE_ENCODING_STORED	0
+
+
+
+extern int isBundlePath(const char *path);
+
+extern int findBundleModule(const char *path, const char *modulename,
+			    const char **data, size_t *len);
+
+extern void freeBundles(void);
+
+#endif /* _BUNDLE_H */
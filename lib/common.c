@@ -23,13 +23,27 @@
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
 #ifdef HAVE_WIN_H
 #include "win.h"
 #endif
 
 #include "common.h"
+#include "bundle.h"
 
-char* getModulePath(const char *modulename) {
+/*
+ * Locate a module along the path. If data is not NULL, bundles in the
+ * path are searched as well and a module found in a bundle is returned
+ * in data and len, along with a path made of the bundle's path and the
+ * module name. Otherwise, and for modules found in files, data is set
+ * to NULL.
+ */
+
+char* locateModule(const char *modulename, const char **data, size_t *len) {
     char	    *path = NULL, *dir, *smipath;
     char	    sep[2];
     int         i;
@@ -38,6 +52,10 @@ char* getModulePath(const char *modulename) {
         "", ".my", ".smiv1", ".smiv2", ".sming", ".mib", ".txt", ".yang", NULL
     };
     
+    if (data) {
+        *data = NULL;
+    }
+
     if ((!modulename) || !strlen(modulename)) {
         return NULL;
     }
@@ -54,6 +72,14 @@ char* getModulePath(const char *modulename) {
         sep[0] = PATH_SEPARATOR; sep[1] = 0;
         for (dir = strtok(smipath, sep);
              dir; dir = strtok(NULL, sep)) {
+            if (isBundlePath(dir)) {
+                if (data && findBundleModule(dir, modulename, data, len)) {
+                    smiAsprintf(&path, "%s%c%s", dir, DIR_SEPARATOR,
+                                modulename);
+                    break;
+                }
+                continue;
+            }
             for (i = 0; ext[i]; i++) {
                 smiAsprintf(&path, "%s%c%s%s", dir, DIR_SEPARATOR, modulename, ext[i]);
                 if (! access(path, R_OK)) {
@@ -119,51 +145,195 @@ char* getModulePath(const char *modulename) {
 }
 
 
-SmiLanguage getLanguage(FILE *file) {
-    int		    ret = 0;
+char* getModulePath(const char *modulename) {
+    return locateModule(modulename, NULL, NULL);
+}
+
+
+/*
+ * Sniff the module language from the first bytes of the module text.
+ */
+
+SmiLanguage getLanguage(const char *data, size_t len) {
+    const unsigned char *p = (const unsigned char *) data;
+    const unsigned char *end = p + len;
     int         i, c;    
-    while ((c = fgetc(file))) {
+
+    for (; p < end && *p; p++) {
+        c = *p;
         if (c == '-' || isupper(c)) {
-            ret = SMI_LANGUAGE_SMIV2;
-            break;
+            return SMI_LANGUAGE_SMIV2;
         } else if (c == '/' || c == 'm' || c == 's')  {
-            i = c;
-            while(c = fgetc(file)) { 	   //check for statement termination
-                if(i == '}' && c == ';') { //"};" means sming "}" means yang
-                    ret = SMI_LANGUAGE_SMING;
-                    break;
-                } else if(i == '}' && c != ';') {
-                    ret = SMI_LANGUAGE_YANG; //yang
-                    break;
-                } else if (c == EOF) {
-                       return SMI_LANGUAGE_UNKNOWN;
+            for (i = c, p++; p < end && *p; i = *p, p++) {
+                //check for statement termination
+                if (i == '}') {
+                    //"};" means sming "}" means yang
+                    return *p == ';' ? SMI_LANGUAGE_SMING : SMI_LANGUAGE_YANG;
                 }
-                i = c;
             }
-            break;
-        } else if (c == EOF || ! isspace(c)) {
+            if (p < end) {
+                return 0;
+            }
+            return i == '}' ? SMI_LANGUAGE_YANG : SMI_LANGUAGE_UNKNOWN;
+        } else if (! isspace(c)) {
             return SMI_LANGUAGE_UNKNOWN;
         }
     }
+    return p < end ? 0 : SMI_LANGUAGE_UNKNOWN;
+}
+
+
+
+/*
+ * Read the text of a module file. Where possible the file is mapped
+ * into memory instead of being read. The text is followed by two NUL
+ * bytes and may be modified (a private mapping), so that the flex
+ * scanners can work on it in place. Returns 0 on success or -1 with
+ * errno set.
+ */
+
+int readModuleText(const char *path, ModuleText *text) {
+    FILE        *file;
+    long        size;
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+    int         fd;
+    struct stat st;
+    long        pagesize;
+    void        *map;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return -1;
+    }
+    pagesize = sysconf(_SC_PAGESIZE);
+    if (st.st_size > 0 && pagesize > 0
+        && st.st_size % pagesize && pagesize - st.st_size % pagesize >= 2) {
+        /*
+         * The two NUL bytes fit into the last page, where the bytes
+         * behind the end of the file read as zero.
+         */
+        map = mmap(NULL, st.st_size + 2, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            close(fd);
+            text->data = map;
+            text->len = st.st_size;
+            text->storage = MODULE_TEXT_MAPPED;
+            return 0;
+        }
+    }
+    file = fdopen(fd, "rb");
+    if (! file) {
+        close(fd);
+        return -1;
+    }
+#else
+    file = fopen(path, "rb");
+    if (! file) {
+        return -1;
+    }
+#endif
+    if (fseek(file, 0, SEEK_END) < 0 || (size = ftell(file)) < 0) {
+        fclose(file);
+        return -1;
+    }
     rewind(file);
-    return ret;
+    text->data = smiMalloc(size + 2);
+    if (fread(text->data, 1, size, file) != (size_t) size) {
+        smiFree(text->data);
+        text->data = NULL;
+        fclose(file);
+        errno = EIO;
+        return -1;
+    }
+    fclose(file);
+    text->len = size;
+    text->storage = MODULE_TEXT_ALLOCATED;
+    return 0;
 }
 
 
-SmiLanguage guessLanguage(const char *modulename) {
-    char	    *path = NULL;    
-    FILE	    *file;    
-    
-    path = getModulePath(modulename);
-    
+
+/*
+ * Locate a module along the path and get its text, either from a
+ * bundle or by reading the file. Returns the path, or NULL if the
+ * module cannot be located. If the file cannot be read, the path is
+ * returned with a NULL text and errno set.
+ */
+
+char *openModuleText(const char *modulename, ModuleText *text) {
+    char        *path;
+    const char  *data;
+    size_t      len;
+
+    memset(text, 0, sizeof(ModuleText));
+    path = locateModule(modulename, &data, &len);
     if (!path) {
-        return SMI_LANGUAGE_UNKNOWN;
+        return NULL;
     }
-    
-    file = fopen(path, "r");
-    if (! file) {
-        return SMI_LANGUAGE_UNKNOWN;
+    if (data) {
+        text->data = (char *) data;
+        text->len = len;
+        text->storage = MODULE_TEXT_BORROWED;
+    } else {
+        readModuleText(path, text);
+    }
+    return path;
+}
+
+
+
+void closeModuleText(ModuleText *text) {
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+    if (text->storage == MODULE_TEXT_MAPPED) {
+        munmap(text->data, text->len + 2);
+    }
+#endif
+    if (text->storage == MODULE_TEXT_ALLOCATED) {
+        smiFree(text->data);
     }
+    text->data = NULL;
+    text->len = 0;
+}
+
+
 
-    return getLanguage(file);    
+/*
+ * Ask the module resolver installed by smiSetModuleResolver() for the
+ * contents of a module given by its plain name. Returns 1 and fills in
+ * data and len if the resolver supplied the module, 0 if the module
+ * has to be searched along the path.
+ */
+
+int resolveModule(const char *modulename, const char **data, size_t *len) {
+    if (!smiHandle->moduleResolver || smiIsPath(modulename)) {
+        return 0;
+    }
+    *data = NULL;
+    *len = 0;
+    if (smiHandle->moduleResolver(modulename, data, len,
+                                  smiHandle->moduleResolverData) != 0
+        || !*data) {
+        return 0;
+    }
+    return 1;
+}
+
+
+SmiLanguage guessLanguage(const char *modulename) {
+    char	    *path;    
+    ModuleText  text;
+    SmiLanguage lang = SMI_LANGUAGE_UNKNOWN;
+    
+    path = openModuleText(modulename, &text);
+    if (text.data) {
+        lang = getLanguage(text.data, text.len);
+    }
+    closeModuleText(&text);
+    smiFree(path);
+    return lang;
 }
@@ -17,8 +17,30 @@
 #include "util.h"
 #include "error.h"
 
+/*
+ * The text of a module. Unless it is borrowed from a bundle or from a
+ * module resolver, it is followed by two NUL bytes and writable, as
+ * required by the flex scanners to scan it in place.
+ */
+
+#define MODULE_TEXT_BORROWED	0
+#define MODULE_TEXT_MAPPED	1
+#define MODULE_TEXT_ALLOCATED	2
+
+typedef struct ModuleText {
+    char	*data;
+    size_t	len;
+    int		storage;
+} ModuleText;
+
 char* getModulePath(const char *modulename);
-SmiLanguage getLanguage(FILE *file);
+char* locateModule(const char *modulename, const char **data, size_t *len);
+SmiLanguage getLanguage(const char *data, size_t len);
+int readModuleText(const char *path, ModuleText *text);
+char *openModuleText(const char *modulename, ModuleText *text);
+void closeModuleText(ModuleText *text);
+int resolveModule(const char *modulename, const char **data, size_t *len);
+SmiModuleSummary *scanModuleText(const ModuleText *text, int required);
 SmiLanguage guessLanguage(const char *modulename);
 
 #endif /* _COMMON_H */
\ No newline at end of file
@@ -64,6 +64,38 @@ static Handle   *firstHandlePtr = NULL;
 static Handle   *lastHandlePtr  = NULL;
 
 
+
+/*
+ * The worklist of a module load. The modules required by a module,
+ * that is the modules it imports from or names in MODULE and SUPPORTS
+ * clauses, are found by a scan of its text and pushed on a stack of
+ * pending modules, so that each module is parsed only after the ones
+ * it requires. The parsers never load a module themselves. They
+ * record the modules they require and the imported descriptors are
+ * resolved when they are used or after the module has been parsed.
+ */
+
+typedef struct Pending {
+    char	     *name;
+    char	     *path;
+    ModuleText	     text;
+    SmiLanguage	     lang;
+    SmiModuleSummary *summaryPtr;
+    int		     next;		/* next import to be scheduled */
+    int		     keepText;		/* the text belongs to the caller */
+} Pending;
+
+typedef struct Worklist {
+    Pending	     *pending;
+    int		     numPending;
+    int		     maxPending;
+    char	     **failed;		/* modules that did not load */
+    int		     numFailed;
+} Worklist;
+
+static int isPending(Worklist *worklistPtr, const char *modulename);
+
+
 /*
  *----------------------------------------------------------------------
  *
@@ -593,7 +625,7 @@ void setRevisionLine(Revision *revisionPtr, int line, Parser *parserPtr)
  * addImport --
  *
  *      Adds a descriptor to the actual module's list of imported
- *      descriptors. This list may be checked by checkImports()
+ *      descriptors. This list is resolved by resolveImports()
  *	afterwards.
  *
  * Results:
@@ -621,6 +653,7 @@ Import *addImport(char *name, Parser *parserPtr)
     importPtr->use			 = 0;
     importPtr->flags			 = 0;
     importPtr->line			 = parserPtr ? parserPtr->line : -1;
+    importPtr->moduleLine		 = importPtr->line;
     
     importPtr->nextPtr			 = NULL;
     importPtr->prevPtr			 = modulePtr->lastImportPtr;
@@ -687,14 +720,14 @@ void setImportModulename(Import *importPtr, char *modulename)
 /*
  *----------------------------------------------------------------------
  *
- * checkImports --
+ * recordImports --
  *
- *      Check wheather all descriptors in the actual module's list
- *	are imported by a given Module. Implicitly set all Imports'
- *	module names.
+ *      Record the module the descriptors added by the last IMPORTS
+ *	clause are imported from. The module is required, but it is
+ *	not loaded and the descriptors are not resolved yet.
  *
  * Results:
- *      0 on success or -1 on an error or number of descriptors not found.
+ *	None.
  *
  * Side effects:
  *      None.
@@ -702,52 +735,104 @@ void setImportModulename(Import *importPtr, char *modulename)
  *----------------------------------------------------------------------
  */
 
-int checkImports(Module *modulePtr, Parser *parserPtr)
+void recordImports(const char *modulename, Parser *parserPtr)
+{
+    Import      *importPtr;
+
+    for (importPtr = parserPtr->modulePtr->lastImportPtr;
+	 importPtr && !importPtr->export.module;
+	 importPtr = importPtr->prevPtr) {
+	importPtr->export.module = smiStrdup(modulename);
+	importPtr->moduleLine = parserPtr->line;
+    }
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * resolveImport --
+ *
+ *      Resolve an imported descriptor in the module it is imported
+ *	from, which has been loaded before the importing module, unless
+ *	it is part of an import cycle or it has failed to load.
+ *
+ * Results:
+ *	None.
+ *
+ * Side effects:
+ *      Sets the kind of the Import.
+ *
+ *----------------------------------------------------------------------
+ */
+
+static void resolveImport(Import *importPtr, Parser *parserPtr)
+{
+    Module	*modulePtr;
+
+    modulePtr = findModuleByName(importPtr->export.module);
+    if (!modulePtr) {
+	/*
+	 * A module that cannot be found or read has been reported
+	 * where it is required, one that has failed to load has
+	 * reported its own errors.
+	 */
+	if (isPending(smiHandle->worklistPtr, importPtr->export.module)) {
+	    smiPrintErrorAtLine(parserPtr, ERR_IDENTIFIER_NOT_IN_MODULE,
+				importPtr->moduleLine, importPtr->export.name,
+				importPtr->export.module);
+	}
+	importPtr->kind = KIND_NOTFOUND;
+    } else if (smiGetNode(&modulePtr->export, importPtr->export.name)) {
+	importPtr->kind = KIND_OBJECT;
+    } else if (smiGetType(&modulePtr->export, importPtr->export.name)) {
+	importPtr->kind = KIND_TYPE;
+    } else if (smiGetMacro(&modulePtr->export, importPtr->export.name)) {
+	importPtr->kind = KIND_MACRO;
+    } else {
+	smiPrintErrorAtLine(parserPtr, ERR_IDENTIFIER_NOT_IN_MODULE,
+			    importPtr->moduleLine, importPtr->export.name,
+			    importPtr->export.module);
+	importPtr->kind = KIND_NOTFOUND;
+    }
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * resolveImports --
+ *
+ *      Resolve all descriptors in the actual module's list of
+ *	imported descriptors that have not been resolved when they
+ *	have been used. This is the fixup of the imports after the
+ *	module has been parsed.
+ *
+ * Results:
+ *	None.
+ *
+ * Side effects:
+ *      Sets the kind of the Imports.
+ *
+ *----------------------------------------------------------------------
+ */
+
+void resolveImports(Parser *parserPtr)
 {
-    int         n = 0;
     Import      *importPtr;
-    SmiNode	*smiNode;
-    SmiType	*smiType;
-    SmiMacro	*smiMacro;
+
+    if (!parserPtr->modulePtr) {
+	return;
+    }
     
     for (importPtr = parserPtr->modulePtr->firstImportPtr;
 	 importPtr; importPtr = importPtr->nextPtr) {
-
-	if (importPtr->kind == KIND_UNKNOWN) {
-	    if (modulePtr) {
-		if ((smiNode = smiGetNode(&modulePtr->export,
-					  importPtr->export.name))) {
-		    importPtr->export.module =
-			smiStrdup(modulePtr->export.name);
-		    importPtr->kind	= KIND_OBJECT;
-		} else if ((smiType = smiGetType(&modulePtr->export,
-						 importPtr->export.name))) {
-		    importPtr->export.module =
-			smiStrdup(modulePtr->export.name);
-		    importPtr->kind	= KIND_TYPE;
-		} else if ((smiMacro = smiGetMacro(&modulePtr->export,
-						   importPtr->export.name))) {
-		    importPtr->export.module =
-			smiStrdup(modulePtr->export.name);
-		    importPtr->kind = KIND_MACRO;
-		} else {
-		    n++;
-		    importPtr->export.module =
-			smiStrdup(modulePtr->export.name);
-		    smiPrintError(parserPtr, ERR_IDENTIFIER_NOT_IN_MODULE,
-				  importPtr->export.name,
-				  modulePtr->export.name);
-		    importPtr->kind   = KIND_NOTFOUND;
-		}
-	    } else {
-		    n++;
-		    importPtr->export.module = smiStrdup("");
-		    importPtr->kind   = KIND_NOTFOUND;
-	    }
+	if (importPtr->kind == KIND_UNKNOWN && importPtr->export.module) {
+	    resolveImport(importPtr, parserPtr);
 	}
     }
-
-    return (n);
 }
 
 
@@ -764,7 +849,7 @@ int checkImports(Module *modulePtr, Parser *parserPtr)
  *	NULL if it is not found.
  *
  * Side effects:
- *      None.
+ *      Resolves the import descriptor if it is used the first time.
  *
  *----------------------------------------------------------------------
  */
@@ -780,7 +865,10 @@ Import *findImportByName(const char *name, Module *modulePtr)
 	 importPtr = importPtr->nextPtr) {
 	if ((!strcmp(importPtr->export.name, name)) &&
 	    (!(importPtr->flags & FLAG_INCOMPLIANCE))) {
-		return (importPtr);
+	    if (importPtr->kind == KIND_UNKNOWN && importPtr->export.module) {
+		resolveImport(importPtr, smiHandle->parserPtr);
+	    }
+	    return (importPtr);
 	}
     }
 
@@ -803,7 +891,7 @@ Import *findImportByName(const char *name, Module *modulePtr)
  *	NULL if it is not found.
  *
  * Side effects:
- *      None.
+ *      Resolves the import descriptor if it is used the first time.
  *
  *----------------------------------------------------------------------
  */
@@ -816,7 +904,11 @@ Import *findImportByModulenameAndName(const char *modulename,
     for (importPtr = modulePtr->firstImportPtr; importPtr;
 	 importPtr = importPtr->nextPtr) {
 	if ((!strcmp(importPtr->export.name, name)) &&
+	    importPtr->export.module &&
 	    (!strcmp(importPtr->export.module, modulename))) {
+	    if (importPtr->kind == KIND_UNKNOWN) {
+		resolveImport(importPtr, smiHandle->parserPtr);
+	    }
 	    return (importPtr);
 	}
     }
@@ -4199,6 +4291,8 @@ int smiInitData()
     smiHandle->firstViewPtr = NULL;
     smiHandle->lastViewPtr = NULL;
     smiHandle->firstYangModulePtr = NULL;
+    smiHandle->lastYangModulePtr = NULL;
+    smiHandle->yangModuleIndexPtr = NULL;
     
     /*
      * Initialize a root Node for the main MIB tree.
@@ -4566,14 +4660,14 @@ void smiFreeData()
 /*
  *----------------------------------------------------------------------
  *
- * loadModule --
+ * parseModule --
  *
- *      Load a MIB module. If modulename is a plain name, the file is
- *	search along the SMIPATH environment variable. If modulename
- *	contains a `.' or DIR_SEPARATOR it is assumed to be the path.
+ *      Parse a SMIv1/SMIv2 or SMIng module from its text in the
+ *	given language. The path is consumed, the text is left to the
+ *	caller.
  *
  * Results:
- *      0 on success or -1 on an error.
+ *      A pointer to the module or NULL on an error.
  *
  * Side effects:
  *      None.
@@ -4581,41 +4675,15 @@ void smiFreeData()
  *----------------------------------------------------------------------
  */
 
-Module *loadModule(const char *modulename, Parser *parserPtr)
+static Module *parseModule(char *path, ModuleText *text, SmiLanguage lang,
+			   Parser *parserPtr)
 {
     Parser	    parser;
     Parser      *parentParserPtr;
-    char	    *path = NULL;
-    SmiLanguage lang = 0;
-    FILE	    *file;
-    path = getModulePath(modulename);
-    
-    if (!path) {
-        smiPrintError(parserPtr, ERR_MODULE_NOT_FOUND, modulename);
-        return NULL;
-    }
-
-    parser.path			= path;
-    /*
-     * Look into the file to determine whether it contains
-     * SMIv1/SMIv2 or SMIng definitions.
-     */
-    
-    file = fopen(path, "r");
-    if (! file) {        
-        smiPrintError(parserPtr, ERR_OPENING_INPUTFILE, path, strerror(errno));
-        smiFree(path);
-        return NULL;
-    }
+    void	    *outerBuffer;
+    int		    inPlace;
 
-    lang = getLanguage(file);
-
-    if (lang != SMI_LANGUAGE_SMIV2 && lang != SMI_LANGUAGE_SMING) {
-        smiPrintError(parserPtr, ERR_ILLEGAL_INPUTFILE, path);
-        smiFree(path);
-        fclose(file);
-        return NULL;
-    }
+    inPlace = text->storage != MODULE_TEXT_BORROWED;
 
     if (lang == SMI_LANGUAGE_SMIV2) {
 #ifdef BACKEND_SMI
@@ -4630,32 +4698,28 @@ Module *loadModule(const char *modulename, Parser *parserPtr)
 	parser.firstStatementLine       = 0;
 	parser.firstNestedStatementLine = 0;
 	parser.firstRevisionLine        = 0;
-	parser.file			= file;
+	parser.file			= NULL;
 
 	/*
 	 * Initialize a root Node for pending (forward referenced) nodes.
 	 */
 	parser.pendingNodePtr = addNode(NULL, 0, NODE_FLAG_ROOT, NULL);
     
-	if (smiEnterLexRecursion(parser.file) < 0) {
-	    smiPrintError(&parser, ERR_MAX_LEX_DEPTH);
-	    fclose(parser.file);
-	}
+	outerBuffer = smiEnterLexBuffer(text->data, text->len, inPlace);
 	smiDepth++;
 	parser.line			= 1;
 	smiparse((void *)&parser);
+	resolveImports(&parser);	/* if the parser has been aborted */
 	freeNodeTree(parser.pendingNodePtr);
 	smiFree(parser.pendingNodePtr);
-	smiLeaveLexRecursion();
+	smiLeaveLexBuffer(outerBuffer);
 	smiDepth--;
-	fclose(parser.file);
 	smiFree(path);
 	smiHandle->parserPtr = parentParserPtr;
 	return parser.modulePtr;
 #else
 	smiPrintError(parserPtr, ERR_SMI_NOT_SUPPORTED, path);
 	smiFree(path);
-        fclose(file);
 	return NULL;
 #endif
     }
@@ -4673,37 +4737,435 @@ Module *loadModule(const char *modulename, Parser *parserPtr)
 	parser.firstStatementLine       = 0;
 	parser.firstNestedStatementLine = 0;
 	parser.firstRevisionLine        = 0;
-	parser.file			= file;
+	parser.file			= NULL;
 
 	/*
 	 * Initialize a root Node for pending (forward referenced) nodes.
 	 */
 	parser.pendingNodePtr = addNode(NULL, 0, NODE_FLAG_ROOT, NULL);
     
-	if (smingEnterLexRecursion(parser.file) < 0) {
-	    smiPrintError(&parser, ERR_MAX_LEX_DEPTH);
-	    fclose(parser.file);
-	}
+	outerBuffer = smingEnterLexBuffer(text->data, text->len, inPlace);
 	smiDepth++;
 	parser.line			= 1;
 	smingparse((void *)&parser);
+	resolveImports(&parser);	/* if the parser has been aborted */
 	freeNodeTree(parser.pendingNodePtr);
 	smiFree(parser.pendingNodePtr);
-	smingLeaveLexRecursion();
+	smingLeaveLexBuffer(outerBuffer);
 	smiDepth--;
-	fclose(parser.file);
 	smiFree(path);
 	smiHandle->parserPtr = parentParserPtr;
 	return parser.modulePtr;
 #else
 	smiPrintError(parserPtr, ERR_SMING_NOT_SUPPORTED, path);
 	smiFree(path);
-        fclose(file);
 	return NULL;
 #endif
     }
 
     smiFree(path);
-    fclose(file);
     return NULL;
 }
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * openModule --
+ *
+ *      Open the text of a module given by its name, asking the
+ *	module resolver first.
+ *
+ * Results:
+ *      The path of the module, which has to be freed by the caller,
+ *	or NULL if the module cannot be found. The text data is NULL
+ *	if the module has been found but cannot be read.
+ *
+ * Side effects:
+ *      None.
+ *
+ *----------------------------------------------------------------------
+ */
+
+static char *openModule(const char *modulename, ModuleText *text)
+{
+    const char	    *data;
+    size_t	    len;
+
+    if (resolveModule(modulename, &data, &len)) {
+	text->data = (char *) data;
+	text->len = len;
+	text->storage = MODULE_TEXT_BORROWED;
+	return smiStrdup(modulename);
+    }
+    return openModuleText(modulename, text);
+}
+
+
+
+static int isPending(Worklist *worklistPtr, const char *modulename)
+{
+    int i;
+
+    if (!worklistPtr) {
+	return 0;
+    }
+    for (i = 0; i < worklistPtr->numPending; i++) {
+	if (worklistPtr->pending[i].name
+	    && !strcmp(worklistPtr->pending[i].name, modulename)) {
+	    return 1;
+	}
+    }
+    return 0;
+}
+
+
+
+static int hasFailed(Worklist *worklistPtr, const char *modulename)
+{
+    int i;
+
+    if (!worklistPtr) {
+	return 0;
+    }
+    for (i = 0; i < worklistPtr->numFailed; i++) {
+	if (!strcmp(worklistPtr->failed[i], modulename)) {
+	    return 1;
+	}
+    }
+    return 0;
+}
+
+
+
+static void pushPending(Worklist *worklistPtr, char *modulename, char *path,
+			ModuleText *text, SmiLanguage lang,
+			SmiModuleSummary *summaryPtr, int keepText)
+{
+    Pending *pendingPtr;
+
+    if (worklistPtr->numPending == worklistPtr->maxPending) {
+	worklistPtr->maxPending = worklistPtr->maxPending
+	    ? 2 * worklistPtr->maxPending : 16;
+	worklistPtr->pending = smiRealloc(worklistPtr->pending,
+				  worklistPtr->maxPending * sizeof(Pending));
+    }
+    pendingPtr = &worklistPtr->pending[worklistPtr->numPending++];
+    pendingPtr->name = modulename;
+    pendingPtr->path = path;
+    pendingPtr->text = *text;
+    pendingPtr->lang = lang;
+    pendingPtr->summaryPtr = summaryPtr;
+    pendingPtr->next = 0;
+    pendingPtr->keepText = keepText;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * scheduleModule --
+ *
+ *      Open and scan the text of a module and push it on the
+ *	worklist. Unless report is set, modules that cannot be found
+ *	or read are skipped silently; the parser of the module that
+ *	requires them reports them.
+ *
+ * Results:
+ *      1 if the module has been pushed, 0 otherwise.
+ *
+ * Side effects:
+ *      None.
+ *
+ *----------------------------------------------------------------------
+ */
+
+static int scheduleModule(Worklist *worklistPtr, const char *modulename,
+			  Parser *parserPtr, int report)
+{
+    ModuleText	     text;
+    SmiLanguage	     lang;
+    char	     *path;
+
+    path = openModule(modulename, &text);
+    if (!path) {
+	if (report) {
+	    smiPrintError(parserPtr, ERR_MODULE_NOT_FOUND, modulename);
+	}
+	return 0;
+    }
+    if (!text.data) {
+	if (report) {
+	    smiPrintError(parserPtr, ERR_OPENING_INPUTFILE, path,
+			  strerror(errno));
+	}
+	smiFree(path);
+	return 0;
+    }
+    lang = getLanguage(text.data, text.len);
+    if (lang != SMI_LANGUAGE_SMIV2 && lang != SMI_LANGUAGE_SMING) {
+	if (report) {
+	    smiPrintError(parserPtr, ERR_ILLEGAL_INPUTFILE, path);
+	}
+	closeModuleText(&text);
+	smiFree(path);
+	return 0;
+    }
+    pushPending(worklistPtr, smiStrdup(modulename), path, &text, lang,
+		scanModuleText(&text, 1), 0);
+    return 1;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * loadPending --
+ *
+ *      Load the modules on the worklist. The modules required by the
+ *	module on top of the worklist are pushed on top of it, so that
+ *	each module is parsed after the modules it requires. Modules
+ *	required by a parser that have been missed by the scan are
+ *	pushed while it is running and loaded afterwards.
+ *
+ * Results:
+ *      A pointer to the module whose text belongs to the caller or
+ *	NULL if it cannot be parsed.
+ *
+ * Side effects:
+ *      Modules are added to the loaded data.
+ *
+ *----------------------------------------------------------------------
+ */
+
+static Module *loadPending(Worklist *worklistPtr, Parser *parserPtr)
+{
+    Pending	     *topPtr, pending;
+    Module	     *modulePtr, *readModulePtr = NULL;
+    char	     *modulename;
+
+    while (worklistPtr->numPending) {
+	topPtr = &worklistPtr->pending[worklistPtr->numPending - 1];
+
+	if (topPtr->summaryPtr
+	    && topPtr->next < topPtr->summaryPtr->numImports) {
+	    modulename = topPtr->summaryPtr->imports[topPtr->next++];
+	    if (!findModuleByName(modulename)
+		&& !isPending(worklistPtr, modulename)
+		&& !hasFailed(worklistPtr, modulename)) {
+		scheduleModule(worklistPtr, modulename, parserPtr, 0);
+	    }
+	    continue;
+	}
+
+	/*
+	 * All modules required by the top module are loaded, unless
+	 * they have failed or are pending below in an import cycle.
+	 * A module required under another name than its own may have
+	 * been loaded meanwhile.
+	 */
+
+	pending = *topPtr;
+	worklistPtr->numPending--;
+	if (!pending.keepText
+	    && (findModuleByName(pending.name)
+		|| (pending.summaryPtr
+		    && findModuleByName(pending.summaryPtr->name)))) {
+	    smiFree(pending.path);
+	} else {
+	    modulePtr = parseModule(pending.path, &pending.text, pending.lang,
+				    parserPtr);
+	    if (pending.keepText) {
+		readModulePtr = modulePtr;
+	    } else if (!modulePtr) {
+		worklistPtr->failed = smiRealloc(worklistPtr->failed,
+				 (worklistPtr->numFailed + 1) * sizeof(char *));
+		worklistPtr->failed[worklistPtr->numFailed++] = pending.name;
+		pending.name = NULL;
+	    }
+	}
+	if (!pending.keepText) {
+	    closeModuleText(&pending.text);
+	}
+	smiFreeModuleSummary(pending.summaryPtr);
+	smiFree(pending.name);
+    }
+
+    return readModulePtr;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * requireModule --
+ *
+ *      Get a module required by the module being parsed, that is a
+ *	module it imports from or names in a MODULE or SUPPORTS
+ *	clause. The module is never loaded here. It has been loaded
+ *	from the worklist before, unless it has failed to load or it
+ *	is part of an import cycle. A module missed by the scan of the
+ *	module text is pushed on the worklist and loaded afterwards.
+ *
+ * Results:
+ *      A pointer to the module or NULL if it is not loaded.
+ *
+ * Side effects:
+ *      Modules that cannot be found or read are reported.
+ *
+ *----------------------------------------------------------------------
+ */
+
+Module *requireModule(const char *modulename, Parser *parserPtr)
+{
+    Worklist	    *worklistPtr = smiHandle->worklistPtr;
+    Module	    *modulePtr;
+
+    modulePtr = findModuleByName(modulename);
+    if (!modulePtr && worklistPtr
+	&& !isPending(worklistPtr, modulename)
+	&& !hasFailed(worklistPtr, modulename)) {
+	scheduleModule(worklistPtr, modulename, parserPtr, 1);
+    }
+    return modulePtr;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * readModule --
+ *
+ *      Parse a SMIv1/SMIv2 or SMIng module from its text. The
+ *	language is identified by the text. The modules it requires
+ *	are loaded from a worklist first. The path is consumed, the
+ *	text is left to the caller.
+ *
+ * Results:
+ *      A pointer to the module or NULL on an error.
+ *
+ * Side effects:
+ *      None.
+ *
+ *----------------------------------------------------------------------
+ */
+
+Module *readModule(char *path, ModuleText *text, Parser *parserPtr)
+{
+    Worklist	     worklist, *outerWorklistPtr;
+    SmiModuleSummary *summaryPtr;
+    SmiLanguage	     lang;
+    Module	     *modulePtr;
+    int		     i;
+
+    lang = getLanguage(text->data, text->len);
+    if (lang != SMI_LANGUAGE_SMIV2 && lang != SMI_LANGUAGE_SMING) {
+        smiPrintError(parserPtr, ERR_ILLEGAL_INPUTFILE, path);
+        smiFree(path);
+        return NULL;
+    }
+
+    /*
+     * A module may be read while another one is loaded, e.g. by an
+     * error handler. It gets a worklist of its own.
+     */
+
+    outerWorklistPtr = smiHandle->worklistPtr;
+    memset(&worklist, 0, sizeof(worklist));
+    smiHandle->worklistPtr = &worklist;
+
+    summaryPtr = scanModuleText(text, 1);
+    pushPending(&worklist, summaryPtr ? smiStrdup(summaryPtr->name) : NULL,
+		path, text, lang, summaryPtr, 1);
+    modulePtr = loadPending(&worklist, parserPtr);
+
+    for (i = 0; i < worklist.numFailed; i++) {
+	smiFree(worklist.failed[i]);
+    }
+    smiFree(worklist.failed);
+    smiFree(worklist.pending);
+    smiHandle->worklistPtr = outerWorklistPtr;
+    return modulePtr;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * loadModuleFromBuffer --
+ *
+ *      Load a SMIv1/SMIv2 or SMIng module from a memory buffer. The
+ *	name is used in place of a path in error messages and as the
+ *	path of the module.
+ *
+ * Results:
+ *      A pointer to the module or NULL on an error.
+ *
+ * Side effects:
+ *      None.
+ *
+ *----------------------------------------------------------------------
+ */
+
+Module *loadModuleFromBuffer(const char *name, const char *data, size_t len,
+			     Parser *parserPtr)
+{
+    ModuleText	    text;
+
+    text.data = (char *) data;
+    text.len = len;
+    text.storage = MODULE_TEXT_BORROWED;
+    return readModule(smiStrdup(name), &text, parserPtr);
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * loadModule --
+ *
+ *      Load a MIB module. The module resolver, if any, is asked
+ *	first. Otherwise, if modulename is a plain name, the file or
+ *	bundle entry is search along the SMIPATH environment variable.
+ *	If modulename contains a `.' or DIR_SEPARATOR it is assumed to
+ *	be the path.
+ *
+ * Results:
+ *      A pointer to the module or NULL on an error.
+ *
+ * Side effects:
+ *      None.
+ *
+ *----------------------------------------------------------------------
+ */
+
+Module *loadModule(const char *modulename, Parser *parserPtr)
+{
+    char	    *path = NULL;
+    ModuleText	    text;
+    Module	    *modulePtr;
+
+    path = openModule(modulename, &text);
+    
+    if (!path) {
+        smiPrintError(parserPtr, ERR_MODULE_NOT_FOUND, modulename);
+        return NULL;
+    }
+
+    if (!text.data) {
+        smiPrintError(parserPtr, ERR_OPENING_INPUTFILE, path, strerror(errno));
+        smiFree(path);
+        return NULL;
+    }
+
+    modulePtr = readModule(path, &text, parserPtr);
+    closeModuleText(&text);
+    return modulePtr;
+}
@@ -122,6 +122,7 @@ typedef struct Import {
     Kind	   kind;
     int		   use;
     int		   line;
+    int		   moduleLine;	/* line of the FROM clause */
 } Import;
 
 
@@ -323,6 +324,8 @@ typedef struct Handle {
     Module   	    *firstModulePtr;
     Module   	    *lastModulePtr;
     _YangNode       *firstYangModulePtr; /* List of YANG modules*/
+    _YangNode       *lastYangModulePtr;
+    _YangIndex      *yangModuleIndexPtr; /* YANG modules by name */
     Node     	    *rootNodePtr;
     Type     	    *typeOctetStringPtr;
     Type     	    *typeObjectIdentifierPtr;
@@ -342,14 +345,28 @@ typedef struct Handle {
     char     	    *cacheProg;
     int      	    errorLevel;
     SmiErrorHandler *errorHandler;
+    SmiModuleResolver *moduleResolver;
+    void            *moduleResolverData;
+    struct Bundle   *firstBundlePtr;	/* opened bundles, see bundle.c */
     Parser          *parserPtr;
+    struct Worklist *worklistPtr;	/* modules to be loaded, see data.c */
+    int             diagnostics;	/* collect diagnostics, see error.c */
+    struct Diagnostic *firstDiagnosticPtr;
+    struct Diagnostic *lastDiagnosticPtr;
+    struct DiagnosticChunk *diagnosticChunkPtr;
 } Handle;
 
 
 
 extern int	 smiDepth;	/* SMI parser recursion depth */
 
-extern Handle    *smiHandle;    /* The current handle */
+#ifdef HAVE_THREAD_LOCAL
+#define SMI_THREAD_LOCAL __thread
+#else
+#define SMI_THREAD_LOCAL
+#endif
+
+extern SMI_THREAD_LOCAL Handle *smiHandle; /* The current handle */
 
 
 
@@ -414,8 +431,10 @@ extern void addImportFlags(Import *importPtr, ImportFlags flags);
 extern void setImportModulename(Import *importPtr,
 				char *modulename);
 
-extern int checkImports(Module *modulePtr,
-			Parser *parserPtr);
+extern void recordImports(const char *modulename,
+			  Parser *parserPtr);
+
+extern void resolveImports(Parser *parserPtr);
 
 extern Import *findImportByName(const char *name,
 				Module *modulePtr);
@@ -757,5 +776,15 @@ extern SmiLanguage guessLanguage(const char *modulename);
 
 extern Module *loadModule(const char *modulename, Parser *parserPtr);
 
+extern Module *requireModule(const char *modulename, Parser *parserPtr);
+
+struct ModuleText;
+
+extern Module *readModule(char *path, struct ModuleText *text,
+			  Parser *parserPtr);
+
+extern Module *loadModuleFromBuffer(const char *name, const char *data,
+				    size_t len, Parser *parserPtr);
+
 
 #endif /* _DATA_H */
@@ -59,6 +59,40 @@ typedef struct Error {
 
 
 
+/*
+ * Structures to hold the collected diagnostics. The arguments of a
+ * diagnostic are captured when it is reported and the message is
+ * formatted only when it is retrieved. The diagnostics, their
+ * arguments and their messages are allocated from chunks of memory
+ * which are released all at once by smiClearDiagnostics().
+ */
+
+typedef union DiagnosticArg {
+    char     *s;
+    int      i;
+    unsigned u;
+} DiagnosticArg;
+
+typedef struct Diagnostic {
+    SmiDiagnostic     export;
+    char	      *fmt;
+    int		      argc;
+    DiagnosticArg     *argv;
+    char	      *message;
+    struct Diagnostic *nextPtr;
+} Diagnostic;
+
+typedef struct DiagnosticChunk {
+    struct DiagnosticChunk *nextPtr;
+    size_t	      size;
+    size_t	      used;
+} DiagnosticChunk;
+
+#define DIAGNOSTIC_CHUNK_SIZE	16384
+#define DIAGNOSTIC_MAX_ARGS	8
+
+
+
 /*
  * Note: The Makefile produces a list of error macros for every `ERR...'
  * pattern in this file (error.c). This list is written to errormacros.h.
@@ -74,12 +108,14 @@ static Error errors[] = {
       "libsmi mailing list at <libsmi@ibr.cs.tu-bs.de>."},
     { 0, ERR_MAX_LEX_DEPTH, "import-depth", 
       "maximum IMPORTS nesting, probably a loop?",
-      "A new parser instance is created whenever a module imports from\n"
-      "another module that has not yet been parsed. This might lead to\n"
-      "recursive creation of parser instances in case of recursive imports.\n"
-      "The maximum depth of these recursive imports is limited (30).\n"
-      "Usually this limit should never be reached. However, this error\n"
-      "might occur when modules illegally import definitions in a loop."},
+      "A new parser instance is created whenever a YANG module imports\n"
+      "from another module that has not yet been parsed. This might lead\n"
+      "to recursive creation of parser instances in case of recursive\n"
+      "imports. The maximum depth of these recursive imports is limited\n"
+      "(30). Usually this limit should never be reached. However, this\n"
+      "error might occur when modules illegally import definitions in a\n"
+      "loop. SMIv1/v2 and SMIng modules are loaded one after the other\n"
+      "and are not subject to this limit."},
     { 0, ERR_OUT_OF_MEMORY, "internal-memory", 
       "out of memory",
       "Libsmi needs to allocate memory dynamically during runtime, but\n"
@@ -818,6 +854,8 @@ static Error errors[] = {
     { 0, 0, NULL, NULL, NULL }
 };
 
+#define NUM_ERRORS	((int) (sizeof(errors) / sizeof(Error)) - 1)
+
 
 
 /*
@@ -1036,6 +1074,405 @@ smiErrorHandler(char *path, int line, int severity, char *msg, char *tag)
 
 
 
+/*
+ *----------------------------------------------------------------------
+ *
+ * allocDiagnostic --
+ *
+ *      Allocate memory for collected diagnostics from the chunks of
+ *	the current handle.
+ *
+ * Results:
+ *      A pointer to size bytes of memory.
+ *
+ * Side effects:
+ *      May add a new chunk to the current handle.
+ *
+ *----------------------------------------------------------------------
+ */
+
+static void *
+allocDiagnostic(size_t size)
+{
+    DiagnosticChunk *chunkPtr = smiHandle->diagnosticChunkPtr;
+    size_t hdr, align = sizeof(double);
+    char *p;
+
+    hdr = (sizeof(DiagnosticChunk) + align - 1) & ~(align - 1);
+    size = (size + align - 1) & ~(align - 1);
+    if (! chunkPtr || chunkPtr->used + size > chunkPtr->size) {
+	chunkPtr = smiMalloc(hdr + (size > DIAGNOSTIC_CHUNK_SIZE
+				    ? size : DIAGNOSTIC_CHUNK_SIZE));
+	chunkPtr->size = size > DIAGNOSTIC_CHUNK_SIZE
+	    ? size : DIAGNOSTIC_CHUNK_SIZE;
+	chunkPtr->used = 0;
+	chunkPtr->nextPtr = smiHandle->diagnosticChunkPtr;
+	smiHandle->diagnosticChunkPtr = chunkPtr;
+    }
+    p = (char *) chunkPtr + hdr + chunkPtr->used;
+    chunkPtr->used += size;
+    return p;
+}
+
+
+
+static char *
+strdupDiagnostic(const char *s)
+{
+    char *p;
+
+    if (! s) {
+	return NULL;
+    }
+    p = allocDiagnostic(strlen(s) + 1);
+    strcpy(p, s);
+    return p;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * nextConversion --
+ *
+ *      Find the next conversion of a format string, skipping
+ *	literal text and `%%'.
+ *
+ * Results:
+ *      A pointer to the `%' of the next conversion or NULL. The
+ *	conversion character is stored in conv.
+ *
+ * Side effects:
+ *      None.
+ *
+ *----------------------------------------------------------------------
+ */
+
+static const char *
+nextConversion(const char *p, char *conv)
+{
+    const char *q;
+
+    for (; (p = strchr(p, '%')); p = q + 1) {
+	for (q = p + 1; *q && strchr("-+ #0123456789.", *q); q++) ;
+	if (*q != '%') {
+	    *conv = *q;
+	    return *q ? p : NULL;
+	}
+    }
+    return NULL;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * formatDiagnostic --
+ *
+ *      Format the message of a collected diagnostic into buf. Like
+ *	snprintf(), the output is truncated to size bytes.
+ *
+ * Results:
+ *      The length of the complete message.
+ *
+ * Side effects:
+ *      None.
+ *
+ *----------------------------------------------------------------------
+ */
+
+static size_t
+formatDiagnostic(Diagnostic *diagPtr, char *buf, size_t size)
+{
+    const char *p, *q, *end;
+    char spec[16], conv;
+    size_t len = 0, n;
+    int a = 0, r;
+
+    for (p = diagPtr->fmt; *p; p = end) {
+	q = nextConversion(p, &conv);
+	if (! q || a >= diagPtr->argc) {
+	    q = p + strlen(p);
+	}
+	/* copy the literal text, collapsing `%%' */
+	for (; p < q; p++) {
+	    if (*p == '%' && p[1] == '%') {
+		p++;
+	    }
+	    if (len + 1 < size) {
+		buf[len] = *p;
+	    }
+	    len++;
+	}
+	if (! *q) {
+	    break;
+	}
+	for (end = q + 1; *end != conv; end++) ;
+	end++;
+	n = end - q;
+	if (n >= sizeof(spec)) {
+	    n = sizeof(spec) - 1;
+	}
+	memcpy(spec, q, n);
+	spec[n] = 0;
+	switch (conv) {
+	case 's':
+	    r = snprintf(len < size ? buf + len : NULL, len < size ? size - len : 0,
+			 spec, diagPtr->argv[a].s ? diagPtr->argv[a].s : "(null)");
+	    break;
+	case 'd':
+	case 'i':
+	case 'c':
+	    r = snprintf(len < size ? buf + len : NULL, len < size ? size - len : 0,
+			 spec, diagPtr->argv[a].i);
+	    break;
+	default:
+	    r = snprintf(len < size ? buf + len : NULL, len < size ? size - len : 0,
+			 spec, diagPtr->argv[a].u);
+	    break;
+	}
+	len += (r > 0) ? r : 0;
+	a++;
+    }
+    if (size) {
+	buf[len < size ? len : size - 1] = 0;
+    }
+    return len;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * addDiagnostic --
+ *
+ *      Record a diagnostic and capture the arguments of its format.
+ *	Only the conversions %s, %d, %i, %c, %u, %x and %o are
+ *	captured, which covers all messages of the error table.
+ *
+ * Results:
+ *      The collected diagnostic.
+ *
+ * Side effects:
+ *      Appends the diagnostic to the current handle.
+ *
+ *----------------------------------------------------------------------
+ */
+
+static Diagnostic *
+addDiagnostic(Parser *parser, Error *errorPtr, int line, va_list ap)
+{
+    Diagnostic *diagPtr, *lastPtr = smiHandle->lastDiagnosticPtr;
+    DiagnosticArg args[DIAGNOSTIC_MAX_ARGS];
+    const char *p;
+    char conv, *path = NULL, *module = NULL;
+    int i, argc;
+
+    diagPtr = allocDiagnostic(sizeof(Diagnostic));
+
+    for (p = errorPtr->fmt, argc = 0;
+	 argc < DIAGNOSTIC_MAX_ARGS && (p = nextConversion(p, &conv)); p++) {
+	if (conv == 's') {
+	    args[argc++].s = strdupDiagnostic(va_arg(ap, char *));
+	} else if (conv == 'd' || conv == 'i' || conv == 'c') {
+	    args[argc++].i = va_arg(ap, int);
+	} else if (conv == 'u' || conv == 'x' || conv == 'X' || conv == 'o') {
+	    args[argc++].u = va_arg(ap, unsigned);
+	} else {
+	    break;
+	}
+    }
+    diagPtr->argc = argc;
+    diagPtr->argv = argc ? allocDiagnostic(argc * sizeof(DiagnosticArg)) : NULL;
+    for (i = 0; i < argc; i++) {
+	diagPtr->argv[i] = args[i];
+    }
+
+    /*
+     * Consecutive diagnostics mostly refer to the same module, so
+     * share the copies of the path and the module name.
+     */
+
+    if (parser) {
+	path = parser->path;
+	module = parser->modulePtr ? parser->modulePtr->export.name : NULL;
+    }
+    diagPtr->export.path = (lastPtr && path && lastPtr->export.path
+			    && ! strcmp(lastPtr->export.path, path))
+	? lastPtr->export.path : strdupDiagnostic(path);
+    diagPtr->export.module = (lastPtr && module && lastPtr->export.module
+			      && ! strcmp(lastPtr->export.module, module))
+	? lastPtr->export.module : strdupDiagnostic(module);
+    diagPtr->export.id = errorPtr->id;
+    diagPtr->export.tag = errorPtr->tag;
+    diagPtr->export.severity = errorPtr->level;
+    diagPtr->export.line = line;
+    diagPtr->fmt = errorPtr->fmt;
+    diagPtr->message = NULL;
+    diagPtr->nextPtr = NULL;
+
+    if (lastPtr) {
+	lastPtr->nextPtr = diagPtr;
+    } else {
+	smiHandle->firstDiagnosticPtr = diagPtr;
+    }
+    smiHandle->lastDiagnosticPtr = diagPtr;
+    return diagPtr;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * smiCollectDiagnostics --
+ *
+ *      Enable or disable the collection of diagnostics. Collected
+ *	diagnostics are subject to the same error level as printed
+ *	ones, but they do not depend on the SMI_FLAG_ERRORS flag or
+ *	on an error handler being set. While diagnostics are collected,
+ *	the error handler is only called for fatal errors.
+ *
+ * Results:
+ *      None.
+ *
+ * Side effects:
+ *      Changes the collection state of the current handle.
+ *
+ *----------------------------------------------------------------------
+ */
+
+void
+smiCollectDiagnostics(int enable)
+{
+    if (!smiHandle) smiInit(NULL);
+
+    smiHandle->diagnostics = enable;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * smiGetFirstDiagnostic, smiGetNextDiagnostic --
+ *
+ *      Iterate over the collected diagnostics in the order in
+ *	which they have been reported.
+ *
+ * Results:
+ *      The diagnostic or NULL.
+ *
+ * Side effects:
+ *      None.
+ *
+ *----------------------------------------------------------------------
+ */
+
+SmiDiagnostic *
+smiGetFirstDiagnostic(void)
+{
+    if (! smiHandle || ! smiHandle->firstDiagnosticPtr) {
+	return NULL;
+    }
+    return &smiHandle->firstDiagnosticPtr->export;
+}
+
+
+
+SmiDiagnostic *
+smiGetNextDiagnostic(SmiDiagnostic *smiDiagnosticPtr)
+{
+    Diagnostic *diagPtr = (Diagnostic *) smiDiagnosticPtr;
+
+    if (! diagPtr || ! diagPtr->nextPtr) {
+	return NULL;
+    }
+    return &diagPtr->nextPtr->export;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * smiGetDiagnosticMessage --
+ *
+ *      Return the message of a collected diagnostic. The message
+ *	is formatted on the first call.
+ *
+ * Results:
+ *      The message, which is valid until smiClearDiagnostics().
+ *
+ * Side effects:
+ *      Allocates the message from the diagnostic chunks.
+ *
+ *----------------------------------------------------------------------
+ */
+
+char *
+smiGetDiagnosticMessage(SmiDiagnostic *smiDiagnosticPtr)
+{
+    Diagnostic *diagPtr = (Diagnostic *) smiDiagnosticPtr;
+    char buf[256];
+    size_t len;
+
+    if (! diagPtr) {
+	return NULL;
+    }
+    if (! diagPtr->message) {
+	len = formatDiagnostic(diagPtr, buf, sizeof(buf));
+	diagPtr->message = allocDiagnostic(len + 1);
+	if (len < sizeof(buf)) {
+	    memcpy(diagPtr->message, buf, len + 1);
+	} else {
+	    formatDiagnostic(diagPtr, diagPtr->message, len + 1);
+	}
+    }
+    return diagPtr->message;
+}
+
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * smiClearDiagnostics --
+ *
+ *      Release all diagnostics collected so far.
+ *
+ * Results:
+ *      None.
+ *
+ * Side effects:
+ *      Frees the diagnostic chunks of the current handle.
+ *
+ *----------------------------------------------------------------------
+ */
+
+void
+smiClearDiagnostics(void)
+{
+    DiagnosticChunk *chunkPtr, *nextPtr;
+
+    if (! smiHandle) {
+	return;
+    }
+    for (chunkPtr = smiHandle->diagnosticChunkPtr; chunkPtr;
+	 chunkPtr = nextPtr) {
+	nextPtr = chunkPtr->nextPtr;
+	smiFree(chunkPtr);
+    }
+    smiHandle->diagnosticChunkPtr = NULL;
+    smiHandle->firstDiagnosticPtr = NULL;
+    smiHandle->lastDiagnosticPtr = NULL;
+}
+
+
+
 /*
  *----------------------------------------------------------------------
  *
@@ -1044,7 +1481,8 @@ smiErrorHandler(char *path, int line, int severity, char *msg, char *tag)
  *      Internal error printer which is called by the varargs
  *	entry points (see below). If formats the error message
  *	and calls the error handling function that is currently
- *	registered.
+ *	registered. If diagnostics are collected, the message
+ *	is formatted from the collected diagnostic.
  *
  * Results:
  *      None.
@@ -1059,48 +1497,75 @@ smiErrorHandler(char *path, int line, int severity, char *msg, char *tag)
 static void
 printError(Parser *parser, int id, int line, va_list ap)
 {
-    char *buffer;
-    int i;
-    if (! smiHandle->errorHandler) {
+    Diagnostic *diagPtr = NULL;
+    Error *errorPtr;
+    char *buffer, *path = NULL;
+    int report, print;
+
+    if (! smiHandle->errorHandler && ! smiHandle->diagnostics) {
         return;
     }
 
     /*
-     * Search for the tag instead of just using the id as an index so
+     * The error macros are generated in the order of the error table,
+     * so the id is the index into the table. Check the id anyway so
      * that we do not run into trouble if the id is bogus.
      */
-    for (i = 0; errors[i].fmt; i++) {
-        if (errors[i].id == id) break;
+    if (id >= 0 && id < NUM_ERRORS && errors[id].id == id) {
+	errorPtr = &errors[id];
+    } else {
+	errorPtr = &errors[0];	/* assumes that 0 is the internal error */
     }
-    
-    if (! errors[i].fmt) {
-        i = 0;		/* assumes that 0 is the internal error */
+
+    if (parser && parser->modulePtr) {
+	if ((parser->modulePtr->export.conformance > errorPtr->level) ||
+	    (parser->modulePtr->export.conformance == 0)) {
+	    parser->modulePtr->export.conformance = errorPtr->level;
+	}
     }
 
+    /*
+     * Check the error level before anything is formatted. Ignored
+     * errors have a level of 128 or more and never pass.
+     */
+    if (errorPtr->level > smiHandle->errorLevel) {
+	return;
+    }
     if (parser) {
-        
-        if (parser->modulePtr) {
-            if ((parser->modulePtr->export.conformance > errors[i].level) ||
-            (parser->modulePtr->export.conformance == 0)) {
-                parser->modulePtr->export.conformance = errors[i].level;
-            }
-        } 
-
-
-        if ((errors[i].level <= smiHandle->errorLevel) &&
-            (parser->flags & SMI_FLAG_ERRORS) &&
-            ((smiDepth != 0) || (parser->flags & SMI_FLAG_RECURSIVE))) {
-
-                        smiVasprintf(&buffer, errors[i].fmt, ap);
-                        (smiHandle->errorHandler) (parser->path, line,
-                        errors[i].level, buffer, errors[i].tag);
-        }
+	report = (smiDepth != 0) || (parser->flags & SMI_FLAG_RECURSIVE);
+	print = report && (parser->flags & SMI_FLAG_ERRORS);
+	path = parser->path;
     } else {
-            if (errors[i].level <= smiHandle->errorLevel) {
-                smiVasprintf(&buffer, errors[i].fmt, ap);
-                (smiHandle->errorHandler) (NULL, 0, errors[i].level,
-                               buffer, errors[i].tag);
-            }
+	report = print = 1;
+    }
+    print = print && smiHandle->errorHandler;
+
+    /*
+     * Collected diagnostics are formatted when they are retrieved.
+     * Only fatal errors are passed to the handler right away.
+     */
+    if (smiHandle->diagnostics && errorPtr->level > 0) {
+	print = 0;
+    }
+    if (! report) {
+	return;
+    }
+
+    if (smiHandle->diagnostics) {
+	diagPtr = addDiagnostic(parser, errorPtr, line, ap);
+    }
+
+    if (print) {
+	if (diagPtr) {
+	    (smiHandle->errorHandler) (path, parser ? line : 0, errorPtr->level,
+			       smiGetDiagnosticMessage(&diagPtr->export),
+			       errorPtr->tag);
+	} else {
+	    smiVasprintf(&buffer, errorPtr->fmt, ap);
+	    (smiHandle->errorHandler) (path, parser ? line : 0, errorPtr->level,
+				       buffer, errorPtr->tag);
+	    smiFree(buffer);
+	}
     }
 }
 
@@ -0,0 +1,103 @@
+#
+# keywords.awk --
+#
+#      Generate the keyword slot table of a scanner from the keywords[]
+#      array in its lex file. The seed is searched upwards from the
+#      FNV-1a offset basis until no two keywords share a slot, using the
+#      same hash as hashKeyword() in util.c. Plain awk has no bitwise
+#      operators, so the 32 bit arithmetic is done on doubles and the
+#      exclusive or by a table.
+#
+#      usage: awk -v size=512 -f keywords.awk scanner-smi.l
+#
+# Copyright (c) 1999 Frank Strauss, Technical University of Braunschweig.
+#
+# See the file "COPYING" for information on usage and redistribution
+# of this file, and for a DISCLAIMER OF ALL WARRANTIES.
+#
+
+BEGIN {
+    for (a = 0; a < 256; a++) {
+	for (b = 0; b < 256; b++) {
+	    x = 0; p = 1; u = a; v = b
+	    while (u || v) {
+		if ((u % 2) != (v % 2)) x += p
+		u = int(u / 2); v = int(v / 2); p *= 2
+	    }
+	    xor[a, b] = x
+	}
+    }
+    for (i = 32; i < 127; i++) {
+	ord[sprintf("%c", i)] = i
+    }
+    n = 0
+}
+
+/^static const Keyword keywords\[\]/ {
+    inTable = 1
+    next
+}
+
+inTable && /^};/ {
+    inTable = 0
+    next
+}
+
+inTable {
+    line = $0
+    while (match(line, /\{ *"[^"]*"/)) {
+	s = substr(line, RSTART, RLENGTH)
+	sub(/^\{ *"/, "", s)
+	sub(/"$/, "", s)
+	name[++n] = s
+	line = substr(line, RSTART + RLENGTH)
+    }
+}
+
+function hash(s, seed,    h, i, lo, a, b) {
+    h = seed
+    for (i = 1; i <= length(s); i++) {
+	lo = h % 256
+	h = h - lo + xor[lo, ord[substr(s, i, 1)]]
+	h = ((h % 256) * 16777216 + h * 403) % 4294967296
+    }
+    a = h % 65536
+    b = int(h / 65536)
+    return (xor[a % 256, b % 256] \
+	    + 256 * xor[int(a / 256), int(b / 256)]) % size
+}
+
+END {
+    if (! n || ! size) {
+	print "keywords.awk: no keywords or no size" > "/dev/stderr"
+	exit 1
+    }
+    for (seed = 2166136261; ; seed++) {
+	for (i = 0; i < size; i++) slot[i] = 0
+	for (i = 1; i <= n; i++) {
+	    h = hash(name[i], seed)
+	    if (slot[h]) break
+	    slot[h] = i
+	}
+	if (i > n) break
+    }
+
+    print "/*"
+    print " * This file has been generated by keywords.awk from the keywords[]"
+    print " * array of " FILENAME ". Do not edit."
+    print " */"
+    print ""
+    printf "static const short keywordSlots[%d] = {\n", size
+    for (i = 0; i < size; i++) {
+	if (i % 16 == 0) printf "    "
+	printf "%3d", slot[i]
+	if (i == size - 1) printf "\n"
+	else if (i % 16 == 15) printf ",\n"
+	else printf ", "
+    }
+    print "};"
+    print ""
+    print "static const KeywordTable keywordTable = {"
+    printf "    keywords, %.0fUL, %d, keywordSlots\n", seed, size
+    print "};"
+}
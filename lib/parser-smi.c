@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton implementation for Bison's Yacc-like parsers in C
+/* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -36,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -43,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.3"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -55,221 +57,21 @@
 /* Pure parsers.  */
 #define YYPURE 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
 
 /* Substitute the variable and function names.  */
-#define yyparse smiparse
-#define yylex   smilex
-#define yyerror smierror
-#define yylval  smilval
-#define yychar  smichar
-#define yydebug smidebug
-#define yynerrs sminerrs
-
-
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     DOT_DOT = 258,
-     COLON_COLON_EQUAL = 259,
-     UPPERCASE_IDENTIFIER = 260,
-     LOWERCASE_IDENTIFIER = 261,
-     NUMBER = 262,
-     NEGATIVENUMBER = 263,
-     NUMBER64 = 264,
-     NEGATIVENUMBER64 = 265,
-     BIN_STRING = 266,
-     HEX_STRING = 267,
-     QUOTED_STRING = 268,
-     ACCESS = 269,
-     AGENT_CAPABILITIES = 270,
-     APPLICATION = 271,
-     AUGMENTS = 272,
-     BEGIN_ = 273,
-     BITS = 274,
-     CHOICE = 275,
-     CONTACT_INFO = 276,
-     CREATION_REQUIRES = 277,
-     COUNTER32 = 278,
-     COUNTER64 = 279,
-     DEFINITIONS = 280,
-     DEFVAL = 281,
-     DESCRIPTION = 282,
-     DISPLAY_HINT = 283,
-     END = 284,
-     ENTERPRISE = 285,
-     EXPORTS = 286,
-     EXTENDS = 287,
-     FROM = 288,
-     GROUP = 289,
-     GAUGE32 = 290,
-     IDENTIFIER = 291,
-     IMPLICIT = 292,
-     IMPLIED = 293,
-     IMPORTS = 294,
-     INCLUDES = 295,
-     INDEX = 296,
-     INSTALL_ERRORS = 297,
-     INTEGER = 298,
-     INTEGER32 = 299,
-     INTEGER64 = 300,
-     IPADDRESS = 301,
-     LAST_UPDATED = 302,
-     MACRO = 303,
-     MANDATORY_GROUPS = 304,
-     MAX_ACCESS = 305,
-     MIN_ACCESS = 306,
-     MODULE = 307,
-     MODULE_COMPLIANCE = 308,
-     MODULE_IDENTITY = 309,
-     NOT_ACCESSIBLE = 310,
-     NOTIFICATIONS = 311,
-     NOTIFICATION_GROUP = 312,
-     NOTIFICATION_TYPE = 313,
-     OBJECT = 314,
-     OBJECT_GROUP = 315,
-     OBJECT_IDENTITY = 316,
-     OBJECT_TYPE = 317,
-     OBJECTS = 318,
-     OCTET = 319,
-     OF = 320,
-     ORGANIZATION = 321,
-     OPAQUE = 322,
-     PIB_ACCESS = 323,
-     PIB_DEFINITIONS = 324,
-     PIB_INDEX = 325,
-     PIB_MIN_ACCESS = 326,
-     PIB_REFERENCES = 327,
-     PIB_TAG = 328,
-     POLICY_ACCESS = 329,
-     PRODUCT_RELEASE = 330,
-     REFERENCE = 331,
-     REVISION = 332,
-     SEQUENCE = 333,
-     SIZE = 334,
-     STATUS = 335,
-     STRING = 336,
-     SUBJECT_CATEGORIES = 337,
-     SUPPORTS = 338,
-     SYNTAX = 339,
-     TEXTUAL_CONVENTION = 340,
-     TIMETICKS = 341,
-     TRAP_TYPE = 342,
-     UNIQUENESS = 343,
-     UNITS = 344,
-     UNIVERSAL = 345,
-     UNSIGNED32 = 346,
-     UNSIGNED64 = 347,
-     VALUE = 348,
-     VARIABLES = 349,
-     VARIATION = 350,
-     WRITE_SYNTAX = 351
-   };
-#endif
-/* Tokens.  */
-#define DOT_DOT 258
-#define COLON_COLON_EQUAL 259
-#define UPPERCASE_IDENTIFIER 260
-#define LOWERCASE_IDENTIFIER 261
-#define NUMBER 262
-#define NEGATIVENUMBER 263
-#define NUMBER64 264
-#define NEGATIVENUMBER64 265
-#define BIN_STRING 266
-#define HEX_STRING 267
-#define QUOTED_STRING 268
-#define ACCESS 269
-#define AGENT_CAPABILITIES 270
-#define APPLICATION 271
-#define AUGMENTS 272
-#define BEGIN_ 273
-#define BITS 274
-#define CHOICE 275
-#define CONTACT_INFO 276
-#define CREATION_REQUIRES 277
-#define COUNTER32 278
-#define COUNTER64 279
-#define DEFINITIONS 280
-#define DEFVAL 281
-#define DESCRIPTION 282
-#define DISPLAY_HINT 283
-#define END 284
-#define ENTERPRISE 285
-#define EXPORTS 286
-#define EXTENDS 287
-#define FROM 288
-#define GROUP 289
-#define GAUGE32 290
-#define IDENTIFIER 291
-#define IMPLICIT 292
-#define IMPLIED 293
-#define IMPORTS 294
-#define INCLUDES 295
-#define INDEX 296
-#define INSTALL_ERRORS 297
-#define INTEGER 298
-#define INTEGER32 299
-#define INTEGER64 300
-#define IPADDRESS 301
-#define LAST_UPDATED 302
-#define MACRO 303
-#define MANDATORY_GROUPS 304
-#define MAX_ACCESS 305
-#define MIN_ACCESS 306
-#define MODULE 307
-#define MODULE_COMPLIANCE 308
-#define MODULE_IDENTITY 309
-#define NOT_ACCESSIBLE 310
-#define NOTIFICATIONS 311
-#define NOTIFICATION_GROUP 312
-#define NOTIFICATION_TYPE 313
-#define OBJECT 314
-#define OBJECT_GROUP 315
-#define OBJECT_IDENTITY 316
-#define OBJECT_TYPE 317
-#define OBJECTS 318
-#define OCTET 319
-#define OF 320
-#define ORGANIZATION 321
-#define OPAQUE 322
-#define PIB_ACCESS 323
-#define PIB_DEFINITIONS 324
-#define PIB_INDEX 325
-#define PIB_MIN_ACCESS 326
-#define PIB_REFERENCES 327
-#define PIB_TAG 328
-#define POLICY_ACCESS 329
-#define PRODUCT_RELEASE 330
-#define REFERENCE 331
-#define REVISION 332
-#define SEQUENCE 333
-#define SIZE 334
-#define STATUS 335
-#define STRING 336
-#define SUBJECT_CATEGORIES 337
-#define SUPPORTS 338
-#define SYNTAX 339
-#define TEXTUAL_CONVENTION 340
-#define TIMETICKS 341
-#define TRAP_TYPE 342
-#define UNIQUENESS 343
-#define UNITS 344
-#define UNIVERSAL 345
-#define UNSIGNED32 346
-#define UNSIGNED64 347
-#define VALUE 348
-#define VARIABLES 349
-#define VARIATION 350
-#define WRITE_SYNTAX 351
-
-
-
-
-/* Copy the first part of user declarations.  */
+#define yyparse         smiparse
+#define yylex           smilex
+#define yyerror         smierror
+#define yydebug         smidebug
+#define yynerrs         sminerrs
+
+/* First part of user prologue.  */
 #line 14 "parser-smi.y"
 
 
@@ -303,12 +105,6 @@
 
 
 
-/*
- * These arguments are passed to yyparse() and yylex().
- */
-#define YYPARSE_PARAM parserPtr
-#define YYLEX_PARAM   parserPtr
-
     
     
 #define thisParserPtr      ((Parser *)parserPtr)
@@ -1428,7 +1224,7 @@ checkImportsUsage(Parser *parserPtr, Module *modulePtr)
 					importPtr->export.module);
 		}
 	    }
-	    /* checkImports() handles KIND_NOTFOUND */
+	    /* resolveImports() has reported KIND_NOTFOUND */
 	    if (importPtr->use == 0 && importPtr->kind != KIND_NOTFOUND) {
 		smiPrintErrorAtLine(parserPtr, ERR_UNUSED_IMPORT,
 				    importPtr->line,
@@ -1538,95 +1334,456 @@ checkDate(Parser *parserPtr, char *date)
 }
 
 
+#line 1338 "parser-smi.c"
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 1300 "parser-smi.y"
+#include "parser-smi.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-    char           *text;	  		/* scanned quoted text       */
-    char           *id;				/* identifier name           */
-    int            err;				/* actually just a dummy     */
-    time_t	   date;			/* a date value              */
-    Object         *objectPtr;			/* object identifier         */
-    SmiStatus      status;			/* a STATUS value            */
-    SmiAccess      access;			/* an ACCESS value           */
-    Type           *typePtr;
-    List           *listPtr;			/* SEQUENCE and INDEX lists  */
-    NamedNumber    *namedNumberPtr;		/* BITS or enum item         */
-    Range          *rangePtr;			/* type restricting range    */
-    SmiValue	   *valuePtr;
-    SmiUnsigned32  unsigned32;			/*                           */
-    SmiInteger32   integer32;			/*                           */
-    SmiUnsigned64  unsigned64;			/*                           */
-    SmiInteger64   integer64;			/*                           */
-    struct Compl   compl;
-    struct Index   index;
-    Module	   *modulePtr;
-    SubjectCategories *subjectCategoriesPtr;
-}
-/* Line 187 of yacc.c.  */
-#line 1587 "parser-smi.c"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-# define YYSTYPE_IS_TRIVIAL 1
-#endif
-
-
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_DOT_DOT = 3,                    /* DOT_DOT  */
+  YYSYMBOL_COLON_COLON_EQUAL = 4,          /* COLON_COLON_EQUAL  */
+  YYSYMBOL_UPPERCASE_IDENTIFIER = 5,       /* UPPERCASE_IDENTIFIER  */
+  YYSYMBOL_LOWERCASE_IDENTIFIER = 6,       /* LOWERCASE_IDENTIFIER  */
+  YYSYMBOL_NUMBER = 7,                     /* NUMBER  */
+  YYSYMBOL_NEGATIVENUMBER = 8,             /* NEGATIVENUMBER  */
+  YYSYMBOL_NUMBER64 = 9,                   /* NUMBER64  */
+  YYSYMBOL_NEGATIVENUMBER64 = 10,          /* NEGATIVENUMBER64  */
+  YYSYMBOL_BIN_STRING = 11,                /* BIN_STRING  */
+  YYSYMBOL_HEX_STRING = 12,                /* HEX_STRING  */
+  YYSYMBOL_QUOTED_STRING = 13,             /* QUOTED_STRING  */
+  YYSYMBOL_ACCESS = 14,                    /* ACCESS  */
+  YYSYMBOL_AGENT_CAPABILITIES = 15,        /* AGENT_CAPABILITIES  */
+  YYSYMBOL_APPLICATION = 16,               /* APPLICATION  */
+  YYSYMBOL_AUGMENTS = 17,                  /* AUGMENTS  */
+  YYSYMBOL_BEGIN_ = 18,                    /* BEGIN_  */
+  YYSYMBOL_BITS = 19,                      /* BITS  */
+  YYSYMBOL_CHOICE = 20,                    /* CHOICE  */
+  YYSYMBOL_CONTACT_INFO = 21,              /* CONTACT_INFO  */
+  YYSYMBOL_CREATION_REQUIRES = 22,         /* CREATION_REQUIRES  */
+  YYSYMBOL_COUNTER32 = 23,                 /* COUNTER32  */
+  YYSYMBOL_COUNTER64 = 24,                 /* COUNTER64  */
+  YYSYMBOL_DEFINITIONS = 25,               /* DEFINITIONS  */
+  YYSYMBOL_DEFVAL = 26,                    /* DEFVAL  */
+  YYSYMBOL_DESCRIPTION = 27,               /* DESCRIPTION  */
+  YYSYMBOL_DISPLAY_HINT = 28,              /* DISPLAY_HINT  */
+  YYSYMBOL_END = 29,                       /* END  */
+  YYSYMBOL_ENTERPRISE = 30,                /* ENTERPRISE  */
+  YYSYMBOL_EXPORTS = 31,                   /* EXPORTS  */
+  YYSYMBOL_EXTENDS = 32,                   /* EXTENDS  */
+  YYSYMBOL_FROM = 33,                      /* FROM  */
+  YYSYMBOL_GROUP = 34,                     /* GROUP  */
+  YYSYMBOL_GAUGE32 = 35,                   /* GAUGE32  */
+  YYSYMBOL_IDENTIFIER = 36,                /* IDENTIFIER  */
+  YYSYMBOL_IMPLICIT = 37,                  /* IMPLICIT  */
+  YYSYMBOL_IMPLIED = 38,                   /* IMPLIED  */
+  YYSYMBOL_IMPORTS = 39,                   /* IMPORTS  */
+  YYSYMBOL_INCLUDES = 40,                  /* INCLUDES  */
+  YYSYMBOL_INDEX = 41,                     /* INDEX  */
+  YYSYMBOL_INSTALL_ERRORS = 42,            /* INSTALL_ERRORS  */
+  YYSYMBOL_INTEGER = 43,                   /* INTEGER  */
+  YYSYMBOL_INTEGER32 = 44,                 /* INTEGER32  */
+  YYSYMBOL_INTEGER64 = 45,                 /* INTEGER64  */
+  YYSYMBOL_IPADDRESS = 46,                 /* IPADDRESS  */
+  YYSYMBOL_LAST_UPDATED = 47,              /* LAST_UPDATED  */
+  YYSYMBOL_MACRO = 48,                     /* MACRO  */
+  YYSYMBOL_MANDATORY_GROUPS = 49,          /* MANDATORY_GROUPS  */
+  YYSYMBOL_MAX_ACCESS = 50,                /* MAX_ACCESS  */
+  YYSYMBOL_MIN_ACCESS = 51,                /* MIN_ACCESS  */
+  YYSYMBOL_MODULE = 52,                    /* MODULE  */
+  YYSYMBOL_MODULE_COMPLIANCE = 53,         /* MODULE_COMPLIANCE  */
+  YYSYMBOL_MODULE_IDENTITY = 54,           /* MODULE_IDENTITY  */
+  YYSYMBOL_NOT_ACCESSIBLE = 55,            /* NOT_ACCESSIBLE  */
+  YYSYMBOL_NOTIFICATIONS = 56,             /* NOTIFICATIONS  */
+  YYSYMBOL_NOTIFICATION_GROUP = 57,        /* NOTIFICATION_GROUP  */
+  YYSYMBOL_NOTIFICATION_TYPE = 58,         /* NOTIFICATION_TYPE  */
+  YYSYMBOL_OBJECT = 59,                    /* OBJECT  */
+  YYSYMBOL_OBJECT_GROUP = 60,              /* OBJECT_GROUP  */
+  YYSYMBOL_OBJECT_IDENTITY = 61,           /* OBJECT_IDENTITY  */
+  YYSYMBOL_OBJECT_TYPE = 62,               /* OBJECT_TYPE  */
+  YYSYMBOL_OBJECTS = 63,                   /* OBJECTS  */
+  YYSYMBOL_OCTET = 64,                     /* OCTET  */
+  YYSYMBOL_OF = 65,                        /* OF  */
+  YYSYMBOL_ORGANIZATION = 66,              /* ORGANIZATION  */
+  YYSYMBOL_OPAQUE = 67,                    /* OPAQUE  */
+  YYSYMBOL_PIB_ACCESS = 68,                /* PIB_ACCESS  */
+  YYSYMBOL_PIB_DEFINITIONS = 69,           /* PIB_DEFINITIONS  */
+  YYSYMBOL_PIB_INDEX = 70,                 /* PIB_INDEX  */
+  YYSYMBOL_PIB_MIN_ACCESS = 71,            /* PIB_MIN_ACCESS  */
+  YYSYMBOL_PIB_REFERENCES = 72,            /* PIB_REFERENCES  */
+  YYSYMBOL_PIB_TAG = 73,                   /* PIB_TAG  */
+  YYSYMBOL_POLICY_ACCESS = 74,             /* POLICY_ACCESS  */
+  YYSYMBOL_PRODUCT_RELEASE = 75,           /* PRODUCT_RELEASE  */
+  YYSYMBOL_REFERENCE = 76,                 /* REFERENCE  */
+  YYSYMBOL_REVISION = 77,                  /* REVISION  */
+  YYSYMBOL_SEQUENCE = 78,                  /* SEQUENCE  */
+  YYSYMBOL_SIZE = 79,                      /* SIZE  */
+  YYSYMBOL_STATUS = 80,                    /* STATUS  */
+  YYSYMBOL_STRING = 81,                    /* STRING  */
+  YYSYMBOL_SUBJECT_CATEGORIES = 82,        /* SUBJECT_CATEGORIES  */
+  YYSYMBOL_SUPPORTS = 83,                  /* SUPPORTS  */
+  YYSYMBOL_SYNTAX = 84,                    /* SYNTAX  */
+  YYSYMBOL_TEXTUAL_CONVENTION = 85,        /* TEXTUAL_CONVENTION  */
+  YYSYMBOL_TIMETICKS = 86,                 /* TIMETICKS  */
+  YYSYMBOL_TRAP_TYPE = 87,                 /* TRAP_TYPE  */
+  YYSYMBOL_UNIQUENESS = 88,                /* UNIQUENESS  */
+  YYSYMBOL_UNITS = 89,                     /* UNITS  */
+  YYSYMBOL_UNIVERSAL = 90,                 /* UNIVERSAL  */
+  YYSYMBOL_UNSIGNED32 = 91,                /* UNSIGNED32  */
+  YYSYMBOL_UNSIGNED64 = 92,                /* UNSIGNED64  */
+  YYSYMBOL_VALUE = 93,                     /* VALUE  */
+  YYSYMBOL_VARIABLES = 94,                 /* VARIABLES  */
+  YYSYMBOL_VARIATION = 95,                 /* VARIATION  */
+  YYSYMBOL_WRITE_SYNTAX = 96,              /* WRITE_SYNTAX  */
+  YYSYMBOL_97_ = 97,                       /* '{'  */
+  YYSYMBOL_98_ = 98,                       /* '}'  */
+  YYSYMBOL_99_ = 99,                       /* ';'  */
+  YYSYMBOL_100_ = 100,                     /* ','  */
+  YYSYMBOL_101_ = 101,                     /* '('  */
+  YYSYMBOL_102_ = 102,                     /* ')'  */
+  YYSYMBOL_103_ = 103,                     /* '['  */
+  YYSYMBOL_104_ = 104,                     /* ']'  */
+  YYSYMBOL_105_ = 105,                     /* '.'  */
+  YYSYMBOL_106_ = 106,                     /* '|'  */
+  YYSYMBOL_YYACCEPT = 107,                 /* $accept  */
+  YYSYMBOL_mibFile = 108,                  /* mibFile  */
+  YYSYMBOL_modules = 109,                  /* modules  */
+  YYSYMBOL_module = 110,                   /* module  */
+  YYSYMBOL_111_1 = 111,                    /* $@1  */
+  YYSYMBOL_moduleOid = 112,                /* moduleOid  */
+  YYSYMBOL_definitions = 113,              /* definitions  */
+  YYSYMBOL_linkagePart = 114,              /* linkagePart  */
+  YYSYMBOL_linkageClause = 115,            /* linkageClause  */
+  YYSYMBOL_exportsClause = 116,            /* exportsClause  */
+  YYSYMBOL_117_2 = 117,                    /* $@2  */
+  YYSYMBOL_importPart = 118,               /* importPart  */
+  YYSYMBOL_imports = 119,                  /* imports  */
+  YYSYMBOL_import = 120,                   /* import  */
+  YYSYMBOL_importIdentifiers = 121,        /* importIdentifiers  */
+  YYSYMBOL_importIdentifier = 122,         /* importIdentifier  */
+  YYSYMBOL_importedKeyword = 123,          /* importedKeyword  */
+  YYSYMBOL_importedSMIKeyword = 124,       /* importedSMIKeyword  */
+  YYSYMBOL_importedSPPIKeyword = 125,      /* importedSPPIKeyword  */
+  YYSYMBOL_moduleName = 126,               /* moduleName  */
+  YYSYMBOL_declarationPart = 127,          /* declarationPart  */
+  YYSYMBOL_declarations = 128,             /* declarations  */
+  YYSYMBOL_declaration = 129,              /* declaration  */
+  YYSYMBOL_macroClause = 130,              /* macroClause  */
+  YYSYMBOL_131_3 = 131,                    /* $@3  */
+  YYSYMBOL_132_4 = 132,                    /* $@4  */
+  YYSYMBOL_macroName = 133,                /* macroName  */
+  YYSYMBOL_choiceClause = 134,             /* choiceClause  */
+  YYSYMBOL_135_5 = 135,                    /* $@5  */
+  YYSYMBOL_fuzzy_lowercase_identifier = 136, /* fuzzy_lowercase_identifier  */
+  YYSYMBOL_valueDeclaration = 137,         /* valueDeclaration  */
+  YYSYMBOL_138_6 = 138,                    /* $@6  */
+  YYSYMBOL_typeDeclaration = 139,          /* typeDeclaration  */
+  YYSYMBOL_140_7 = 140,                    /* $@7  */
+  YYSYMBOL_typeName = 141,                 /* typeName  */
+  YYSYMBOL_typeSMI = 142,                  /* typeSMI  */
+  YYSYMBOL_typeSMIandSPPI = 143,           /* typeSMIandSPPI  */
+  YYSYMBOL_typeSMIonly = 144,              /* typeSMIonly  */
+  YYSYMBOL_typeSPPIonly = 145,             /* typeSPPIonly  */
+  YYSYMBOL_typeDeclarationRHS = 146,       /* typeDeclarationRHS  */
+  YYSYMBOL_147_8 = 147,                    /* $@8  */
+  YYSYMBOL_148_9 = 148,                    /* $@9  */
+  YYSYMBOL_conceptualTable = 149,          /* conceptualTable  */
+  YYSYMBOL_row = 150,                      /* row  */
+  YYSYMBOL_entryType = 151,                /* entryType  */
+  YYSYMBOL_sequenceItems = 152,            /* sequenceItems  */
+  YYSYMBOL_sequenceItem = 153,             /* sequenceItem  */
+  YYSYMBOL_Syntax = 154,                   /* Syntax  */
+  YYSYMBOL_sequenceSyntax = 155,           /* sequenceSyntax  */
+  YYSYMBOL_NamedBits = 156,                /* NamedBits  */
+  YYSYMBOL_NamedBit = 157,                 /* NamedBit  */
+  YYSYMBOL_158_10 = 158,                   /* $@10  */
+  YYSYMBOL_objectIdentityClause = 159,     /* objectIdentityClause  */
+  YYSYMBOL_160_11 = 160,                   /* $@11  */
+  YYSYMBOL_161_12 = 161,                   /* $@12  */
+  YYSYMBOL_162_13 = 162,                   /* $@13  */
+  YYSYMBOL_objectTypeClause = 163,         /* objectTypeClause  */
+  YYSYMBOL_164_14 = 164,                   /* $@14  */
+  YYSYMBOL_165_15 = 165,                   /* $@15  */
+  YYSYMBOL_descriptionClause = 166,        /* descriptionClause  */
+  YYSYMBOL_trapTypeClause = 167,           /* trapTypeClause  */
+  YYSYMBOL_168_16 = 168,                   /* $@16  */
+  YYSYMBOL_169_17 = 169,                   /* $@17  */
+  YYSYMBOL_VarPart = 170,                  /* VarPart  */
+  YYSYMBOL_VarTypes = 171,                 /* VarTypes  */
+  YYSYMBOL_VarType = 172,                  /* VarType  */
+  YYSYMBOL_DescrPart = 173,                /* DescrPart  */
+  YYSYMBOL_MaxOrPIBAccessPart = 174,       /* MaxOrPIBAccessPart  */
+  YYSYMBOL_PibAccessPart = 175,            /* PibAccessPart  */
+  YYSYMBOL_PibAccess = 176,                /* PibAccess  */
+  YYSYMBOL_SPPIPibReferencesPart = 177,    /* SPPIPibReferencesPart  */
+  YYSYMBOL_178_18 = 178,                   /* $@18  */
+  YYSYMBOL_SPPIPibTagPart = 179,           /* SPPIPibTagPart  */
+  YYSYMBOL_180_19 = 180,                   /* $@19  */
+  YYSYMBOL_SPPIUniquePart = 181,           /* SPPIUniquePart  */
+  YYSYMBOL_182_20 = 182,                   /* $@20  */
+  YYSYMBOL_UniqueTypesPart = 183,          /* UniqueTypesPart  */
+  YYSYMBOL_UniqueTypes = 184,              /* UniqueTypes  */
+  YYSYMBOL_UniqueType = 185,               /* UniqueType  */
+  YYSYMBOL_SPPIErrorsPart = 186,           /* SPPIErrorsPart  */
+  YYSYMBOL_187_21 = 187,                   /* $@21  */
+  YYSYMBOL_Errors = 188,                   /* Errors  */
+  YYSYMBOL_Error = 189,                    /* Error  */
+  YYSYMBOL_MaxAccessPart = 190,            /* MaxAccessPart  */
+  YYSYMBOL_191_22 = 191,                   /* $@22  */
+  YYSYMBOL_192_23 = 192,                   /* $@23  */
+  YYSYMBOL_notificationTypeClause = 193,   /* notificationTypeClause  */
+  YYSYMBOL_194_24 = 194,                   /* $@24  */
+  YYSYMBOL_195_25 = 195,                   /* $@25  */
+  YYSYMBOL_196_26 = 196,                   /* $@26  */
+  YYSYMBOL_moduleIdentityClause = 197,     /* moduleIdentityClause  */
+  YYSYMBOL_198_27 = 198,                   /* $@27  */
+  YYSYMBOL_199_28 = 199,                   /* $@28  */
+  YYSYMBOL_200_29 = 200,                   /* $@29  */
+  YYSYMBOL_201_30 = 201,                   /* $@30  */
+  YYSYMBOL_202_31 = 202,                   /* $@31  */
+  YYSYMBOL_203_32 = 203,                   /* $@32  */
+  YYSYMBOL_204_33 = 204,                   /* $@33  */
+  YYSYMBOL_205_34 = 205,                   /* $@34  */
+  YYSYMBOL_SubjectCategoriesPart = 206,    /* SubjectCategoriesPart  */
+  YYSYMBOL_SubjectCategories = 207,        /* SubjectCategories  */
+  YYSYMBOL_CategoryIDs = 208,              /* CategoryIDs  */
+  YYSYMBOL_CategoryID = 209,               /* CategoryID  */
+  YYSYMBOL_ObjectSyntax = 210,             /* ObjectSyntax  */
+  YYSYMBOL_typeTag = 211,                  /* typeTag  */
+  YYSYMBOL_sequenceObjectSyntax = 212,     /* sequenceObjectSyntax  */
+  YYSYMBOL_valueofObjectSyntax = 213,      /* valueofObjectSyntax  */
+  YYSYMBOL_SimpleSyntax = 214,             /* SimpleSyntax  */
+  YYSYMBOL_215_35 = 215,                   /* $@35  */
+  YYSYMBOL_216_36 = 216,                   /* $@36  */
+  YYSYMBOL_217_37 = 217,                   /* $@37  */
+  YYSYMBOL_218_38 = 218,                   /* $@38  */
+  YYSYMBOL_219_39 = 219,                   /* $@39  */
+  YYSYMBOL_valueofSimpleSyntax = 220,      /* valueofSimpleSyntax  */
+  YYSYMBOL_sequenceSimpleSyntax = 221,     /* sequenceSimpleSyntax  */
+  YYSYMBOL_ApplicationSyntax = 222,        /* ApplicationSyntax  */
+  YYSYMBOL_sequenceApplicationSyntax = 223, /* sequenceApplicationSyntax  */
+  YYSYMBOL_anySubType = 224,               /* anySubType  */
+  YYSYMBOL_integerSubType = 225,           /* integerSubType  */
+  YYSYMBOL_octetStringSubType = 226,       /* octetStringSubType  */
+  YYSYMBOL_ranges = 227,                   /* ranges  */
+  YYSYMBOL_range = 228,                    /* range  */
+  YYSYMBOL_value = 229,                    /* value  */
+  YYSYMBOL_enumSpec = 230,                 /* enumSpec  */
+  YYSYMBOL_enumItems = 231,                /* enumItems  */
+  YYSYMBOL_enumItem = 232,                 /* enumItem  */
+  YYSYMBOL_233_40 = 233,                   /* $@40  */
+  YYSYMBOL_enumNumber = 234,               /* enumNumber  */
+  YYSYMBOL_Status = 235,                   /* Status  */
+  YYSYMBOL_Status_Capabilities = 236,      /* Status_Capabilities  */
+  YYSYMBOL_DisplayPart = 237,              /* DisplayPart  */
+  YYSYMBOL_UnitsPart = 238,                /* UnitsPart  */
+  YYSYMBOL_Access = 239,                   /* Access  */
+  YYSYMBOL_IndexPart = 240,                /* IndexPart  */
+  YYSYMBOL_241_41 = 241,                   /* $@41  */
+  YYSYMBOL_242_42 = 242,                   /* $@42  */
+  YYSYMBOL_MibIndex = 243,                 /* MibIndex  */
+  YYSYMBOL_244_43 = 244,                   /* $@43  */
+  YYSYMBOL_IndexTypes = 245,               /* IndexTypes  */
+  YYSYMBOL_IndexType = 246,                /* IndexType  */
+  YYSYMBOL_Index = 247,                    /* Index  */
+  YYSYMBOL_Entry = 248,                    /* Entry  */
+  YYSYMBOL_DefValPart = 249,               /* DefValPart  */
+  YYSYMBOL_Value = 250,                    /* Value  */
+  YYSYMBOL_BitsValue = 251,                /* BitsValue  */
+  YYSYMBOL_BitNames = 252,                 /* BitNames  */
+  YYSYMBOL_ObjectName = 253,               /* ObjectName  */
+  YYSYMBOL_NotificationName = 254,         /* NotificationName  */
+  YYSYMBOL_ReferPart = 255,                /* ReferPart  */
+  YYSYMBOL_RevisionPart = 256,             /* RevisionPart  */
+  YYSYMBOL_Revisions = 257,                /* Revisions  */
+  YYSYMBOL_Revision = 258,                 /* Revision  */
+  YYSYMBOL_259_44 = 259,                   /* $@44  */
+  YYSYMBOL_NotificationObjectsPart = 260,  /* NotificationObjectsPart  */
+  YYSYMBOL_ObjectGroupObjectsPart = 261,   /* ObjectGroupObjectsPart  */
+  YYSYMBOL_Objects = 262,                  /* Objects  */
+  YYSYMBOL_Object = 263,                   /* Object  */
+  YYSYMBOL_NotificationsPart = 264,        /* NotificationsPart  */
+  YYSYMBOL_Notifications = 265,            /* Notifications  */
+  YYSYMBOL_Notification = 266,             /* Notification  */
+  YYSYMBOL_Text = 267,                     /* Text  */
+  YYSYMBOL_ExtUTCTime = 268,               /* ExtUTCTime  */
+  YYSYMBOL_objectIdentifier = 269,         /* objectIdentifier  */
+  YYSYMBOL_270_45 = 270,                   /* $@45  */
+  YYSYMBOL_subidentifiers = 271,           /* subidentifiers  */
+  YYSYMBOL_subidentifier = 272,            /* subidentifier  */
+  YYSYMBOL_objectIdentifier_defval = 273,  /* objectIdentifier_defval  */
+  YYSYMBOL_subidentifiers_defval = 274,    /* subidentifiers_defval  */
+  YYSYMBOL_subidentifier_defval = 275,     /* subidentifier_defval  */
+  YYSYMBOL_objectGroupClause = 276,        /* objectGroupClause  */
+  YYSYMBOL_277_46 = 277,                   /* $@46  */
+  YYSYMBOL_278_47 = 278,                   /* $@47  */
+  YYSYMBOL_279_48 = 279,                   /* $@48  */
+  YYSYMBOL_notificationGroupClause = 280,  /* notificationGroupClause  */
+  YYSYMBOL_281_49 = 281,                   /* $@49  */
+  YYSYMBOL_282_50 = 282,                   /* $@50  */
+  YYSYMBOL_283_51 = 283,                   /* $@51  */
+  YYSYMBOL_moduleComplianceClause = 284,   /* moduleComplianceClause  */
+  YYSYMBOL_285_52 = 285,                   /* $@52  */
+  YYSYMBOL_286_53 = 286,                   /* $@53  */
+  YYSYMBOL_287_54 = 287,                   /* $@54  */
+  YYSYMBOL_ComplianceModulePart = 288,     /* ComplianceModulePart  */
+  YYSYMBOL_ComplianceModules = 289,        /* ComplianceModules  */
+  YYSYMBOL_ComplianceModule = 290,         /* ComplianceModule  */
+  YYSYMBOL_291_55 = 291,                   /* $@55  */
+  YYSYMBOL_ComplianceModuleName = 292,     /* ComplianceModuleName  */
+  YYSYMBOL_MandatoryPart = 293,            /* MandatoryPart  */
+  YYSYMBOL_MandatoryGroups = 294,          /* MandatoryGroups  */
+  YYSYMBOL_MandatoryGroup = 295,           /* MandatoryGroup  */
+  YYSYMBOL_CompliancePart = 296,           /* CompliancePart  */
+  YYSYMBOL_Compliances = 297,              /* Compliances  */
+  YYSYMBOL_Compliance = 298,               /* Compliance  */
+  YYSYMBOL_ComplianceGroup = 299,          /* ComplianceGroup  */
+  YYSYMBOL_300_56 = 300,                   /* $@56  */
+  YYSYMBOL_ComplianceObject = 301,         /* ComplianceObject  */
+  YYSYMBOL_302_57 = 302,                   /* $@57  */
+  YYSYMBOL_SyntaxPart = 303,               /* SyntaxPart  */
+  YYSYMBOL_WriteSyntaxPart = 304,          /* WriteSyntaxPart  */
+  YYSYMBOL_WriteSyntax = 305,              /* WriteSyntax  */
+  YYSYMBOL_AccessPart = 306,               /* AccessPart  */
+  YYSYMBOL_agentCapabilitiesClause = 307,  /* agentCapabilitiesClause  */
+  YYSYMBOL_308_58 = 308,                   /* $@58  */
+  YYSYMBOL_309_59 = 309,                   /* $@59  */
+  YYSYMBOL_310_60 = 310,                   /* $@60  */
+  YYSYMBOL_ModulePart_Capabilities = 311,  /* ModulePart_Capabilities  */
+  YYSYMBOL_Modules_Capabilities = 312,     /* Modules_Capabilities  */
+  YYSYMBOL_Module_Capabilities = 313,      /* Module_Capabilities  */
+  YYSYMBOL_314_61 = 314,                   /* $@61  */
+  YYSYMBOL_CapabilitiesGroups = 315,       /* CapabilitiesGroups  */
+  YYSYMBOL_CapabilitiesGroup = 316,        /* CapabilitiesGroup  */
+  YYSYMBOL_ModuleName_Capabilities = 317,  /* ModuleName_Capabilities  */
+  YYSYMBOL_VariationPart = 318,            /* VariationPart  */
+  YYSYMBOL_Variations = 319,               /* Variations  */
+  YYSYMBOL_Variation = 320,                /* Variation  */
+  YYSYMBOL_321_62 = 321,                   /* $@62  */
+  YYSYMBOL_322_63 = 322,                   /* $@63  */
+  YYSYMBOL_323_64 = 323,                   /* $@64  */
+  YYSYMBOL_324_65 = 324,                   /* $@65  */
+  YYSYMBOL_325_66 = 325,                   /* $@66  */
+  YYSYMBOL_VariationAccessPart = 326,      /* VariationAccessPart  */
+  YYSYMBOL_VariationAccess = 327,          /* VariationAccess  */
+  YYSYMBOL_CreationPart = 328,             /* CreationPart  */
+  YYSYMBOL_Cells = 329,                    /* Cells  */
+  YYSYMBOL_Cell = 330                      /* Cell  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Copy the second part of user declarations.  */
 
 
-/* Line 216 of yacc.c.  */
-#line 1600 "parser-smi.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -1634,55 +1791,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
-# if YYENABLE_NLS
+# if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int i)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (i)
-    int i;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return i;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -1699,11 +1907,11 @@ YYID (i)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef _STDLIB_H
-#      define _STDLIB_H 1
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
 #     endif
 #    endif
 #   endif
@@ -1711,8 +1919,8 @@ YYID (i)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -1726,88 +1934,89 @@ YYID (i)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
 #   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
 #  endif
-#  if (defined __cplusplus && ! defined _STDLIB_H \
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef _STDLIB_H
-#    define _STDLIB_H 1
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
 #   endif
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss;
-  YYSTYPE yyvs;
-  };
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
-/* Copy COUNT objects from FROM to TO.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
-#  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
-#  endif
-# endif
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack)					\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack, Stack, yysize);				\
-	Stack = &yyptr->Stack;						\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  6
 /* YYLAST -- Last index in YYTABLE.  */
@@ -1819,18 +2028,23 @@ union yyalloc
 #define YYNNTS  224
 /* YYNRULES -- Number of rules.  */
 #define YYNRULES  427
-/* YYNRULES -- Number of states.  */
+/* YYNSTATES -- Number of states.  */
 #define YYNSTATES  712
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   351
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1871,238 +2085,70 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     5,     6,     8,    11,    12,    23,    27,
-      28,    30,    32,    34,    35,    39,    40,    41,    45,    47,
-      48,    50,    53,    57,    59,    63,    65,    67,    69,    71,
-      73,    75,    77,    79,    81,    83,    85,    87,    89,    91,
-      93,    95,    97,    99,   101,   103,   105,   107,   109,   111,
-     113,   115,   117,   119,   121,   122,   124,   127,   129,   131,
-     133,   135,   137,   139,   141,   143,   145,   147,   149,   151,
-     154,   155,   156,   162,   164,   166,   168,   170,   172,   174,
-     176,   178,   180,   182,   183,   187,   189,   191,   192,   201,
-     202,   207,   209,   211,   213,   215,   217,   219,   221,   223,
-     225,   227,   229,   231,   233,   235,   237,   239,   240,   241,
-     253,   255,   259,   261,   266,   268,   272,   275,   277,   282,
-     284,   286,   289,   291,   295,   296,   302,   303,   304,   305,
-     320,   321,   322,   346,   347,   350,   351,   352,   364,   369,
-     370,   372,   376,   378,   381,   382,   384,   386,   387,   390,
-     392,   394,   395,   401,   402,   403,   409,   410,   411,   417,
-     418,   420,   421,   423,   427,   429,   430,   436,   437,   439,
-     443,   448,   449,   453,   454,   458,   459,   460,   461,   477,
-     478,   479,   480,   481,   482,   483,   484,   485,   510,   515,
-     516,   518,   520,   524,   526,   531,   533,   536,   538,   540,
-     542,   544,   550,   556,   558,   560,   562,   564,   565,   569,
-     570,   574,   576,   577,   581,   582,   586,   591,   594,   599,
-     602,   603,   608,   611,   616,   620,   622,   624,   626,   628,
-     630,   632,   634,   636,   640,   643,   646,   650,   654,   657,
-     660,   663,   665,   668,   670,   673,   676,   678,   681,   684,
-     687,   689,   692,   694,   697,   700,   703,   706,   709,   712,
-     714,   717,   719,   721,   723,   725,   727,   728,   732,   739,
-     741,   745,   747,   751,   753,   755,   757,   759,   761,   763,
-     767,   769,   773,   774,   780,   782,   784,   786,   788,   791,
-     792,   795,   796,   798,   799,   805,   810,   811,   817,   818,
-     819,   825,   826,   828,   832,   835,   837,   839,   841,   846,
-     847,   849,   853,   855,   856,   858,   862,   864,   866,   869,
-     870,   872,   873,   875,   878,   879,   885,   890,   891,   896,
-     898,   902,   904,   909,   911,   915,   917,   919,   921,   922,
-     925,   927,   930,   932,   936,   938,   943,   950,   952,   954,
-     957,   962,   964,   965,   966,   967,   983,   984,   985,   986,
-    1002,  1003,  1004,  1005,  1021,  1023,  1025,  1028,  1029,  1035,
-    1038,  1040,  1041,  1046,  1047,  1049,  1053,  1055,  1057,  1058,
-    1060,  1063,  1065,  1067,  1068,  1074,  1075,  1084,  1087,  1088,
-    1091,  1092,  1094,  1097,  1100,  1101,  1102,  1103,  1104,  1122,
-    1124,  1125,  1127,  1130,  1131,  1140,  1142,  1146,  1148,  1151,
-    1153,  1155,  1156,  1158,  1161,  1162,  1163,  1164,  1165,  1166,
-    1181,  1184,  1185,  1187,  1192,  1193,  1195,  1199
+       0,  1598,  1598,  1603,  1608,  1610,  1619,  1618,  1681,  1684,
+    1687,  1689,  1698,  1701,  1704,  1719,  1721,  1720,  1741,  1744,
+    1748,  1750,  1754,  1800,  1802,  1810,  1816,  1822,  1838,  1848,
+    1854,  1855,  1856,  1857,  1858,  1859,  1860,  1861,  1862,  1863,
+    1864,  1865,  1866,  1869,  1870,  1871,  1872,  1873,  1874,  1875,
+    1878,  1879,  1882,  1894,  1897,  1901,  1903,  1907,  1912,  1917,
+    1922,  1927,  1932,  1937,  1942,  1947,  1952,  1957,  1962,  1967,
+    1982,  1994,  1981,  2027,  2028,  2029,  2030,  2031,  2032,  2033,
+    2034,  2035,  2036,  2040,  2039,  2069,  2074,  2090,  2089,  2130,
+    2129,  2295,  2299,  2323,  2337,  2338,  2347,  2348,  2349,  2350,
+    2351,  2354,  2355,  2356,  2359,  2360,  2363,  2380,  2411,  2379,
+    2447,  2455,  2469,  2514,  2522,  2528,  2548,  2631,  2637,  2659,
+    2663,  2668,  2701,  2707,  2721,  2720,  2756,  2766,  2791,  2755,
+    2819,  2829,  2818,  3125,  3134,  3142,  3152,  3141,  3224,  3229,
+    3234,  3244,  3266,  3272,  3278,  3281,  3285,  3294,  3297,  3301,
+    3305,  3310,  3309,  3317,  3321,  3320,  3328,  3333,  3332,  3340,
+    3343,  3346,  3349,  3355,  3369,  3374,  3373,  3381,  3384,  3390,
+    3404,  3426,  3425,  3437,  3436,  3450,  3460,  3480,  3449,  3511,
+    3521,  3546,  3550,  3554,  3561,  3568,  3572,  3510,  3618,  3625,
+    3632,  3639,  3645,  3660,  3681,  3704,  3708,  3728,  3733,  3738,
+    3743,  3760,  3762,  3770,  3775,  3792,  3801,  3815,  3814,  3834,
+    3833,  3848,  3875,  3874,  3906,  3905,  3959,  4006,  4061,  4111,
+    4117,  4116,  4128,  4174,  4215,  4222,  4229,  4235,  4242,  4249,
+    4275,  4298,  4318,  4335,  4368,  4372,  4397,  4401,  4407,  4435,
+    4461,  4498,  4524,  4557,  4581,  4608,  4636,  4674,  4720,  4746,
+    4783,  4809,  4846,  4872,  4915,  4943,  4969,  4995,  5019,  5047,
+    5087,  5113,  5138,  5165,  5182,  5199,  5218,  5225,  5235,  5247,
+    5253,  5267,  5274,  5284,  5290,  5296,  5302,  5308,  5331,  5358,
+    5364,  5370,  5384,  5383,  5405,  5420,  5429,  5488,  5504,  5514,
+    5519,  5529,  5534,  5601,  5600,  5618,  5629,  5628,  5642,  5648,
+    5647,  5681,  5686,  5692,  5706,  5711,  5717,  5727,  5733,  5748,
+    5752,  5754,  5762,  5765,  5768,  5774,  5787,  5793,  5799,  5809,
+    5812,  5815,  5818,  5820,  5825,  5824,  5855,  5860,  5865,  5871,
+    5877,  5890,  5902,  5908,  5914,  5927,  5938,  5949,  5955,  5955,
+    5970,  5974,  5983,  6077,  6181,  6205,  6265,  6334,  6338,  6340,
+    6344,  6346,  6351,  6361,  6380,  6350,  6411,  6421,  6443,  6410,
+    6475,  6485,  6503,  6474,  6567,  6573,  6577,  6613,  6612,  6637,
+    6643,  6650,  6655,  6660,  6665,  6671,  6684,  6707,  6714,  6721,
+    6725,  6792,  6798,  6807,  6806,  6840,  6839,  6886,  6895,  6900,
+    6912,  6917,  6923,  6929,  6938,  6944,  6954,  6976,  6943,  7011,
+    7014,  7017,  7019,  7024,  7023,  7046,  7056,  7073,  7079,  7085,
+    7092,  7095,  7098,  7100,  7105,  7113,  7120,  7128,  7135,  7104,
+    7158,  7161,  7164,  7229,  7232,  7235,  7237,  7241
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     108,     0,    -1,   109,    -1,    -1,   110,    -1,   109,   110,
-      -1,    -1,   126,   111,   112,   113,     4,    18,   116,   114,
-     127,    29,    -1,    97,   269,    98,    -1,    -1,    25,    -1,
-      69,    -1,   115,    -1,    -1,    39,   118,    99,    -1,    -1,
-      -1,    31,   117,    99,    -1,   119,    -1,    -1,   120,    -1,
-     119,   120,    -1,   121,    33,   126,    -1,   122,    -1,   121,
-     100,   122,    -1,     6,    -1,     5,    -1,   123,    -1,   124,
-      -1,   125,    -1,    19,    -1,    44,    -1,    46,    -1,    49,
-      -1,    53,    -1,    54,    -1,    60,    -1,    61,    -1,    62,
-      -1,    67,    -1,    85,    -1,    86,    -1,    91,    -1,    15,
-      -1,    23,    -1,    24,    -1,    35,    -1,    57,    -1,    58,
-      -1,    87,    -1,    45,    -1,    92,    -1,     5,    -1,   128,
-      -1,    -1,   129,    -1,   128,   129,    -1,   139,    -1,   137,
-      -1,   159,    -1,   163,    -1,   167,    -1,   193,    -1,   197,
-      -1,   284,    -1,   276,    -1,   280,    -1,   307,    -1,   130,
-      -1,     1,    98,    -1,    -1,    -1,   133,   131,    48,   132,
-      29,    -1,    54,    -1,    62,    -1,    87,    -1,    58,    -1,
-      61,    -1,    85,    -1,    60,    -1,    57,    -1,    53,    -1,
-      15,    -1,    -1,    20,   135,    98,    -1,     6,    -1,     5,
-      -1,    -1,   136,   138,    59,    36,     4,    97,   269,    98,
-      -1,    -1,   141,   140,     4,   146,    -1,     5,    -1,   142,
-      -1,   145,    -1,   143,    -1,   144,    -1,    46,    -1,    86,
-      -1,    67,    -1,    44,    -1,    91,    -1,    23,    -1,    35,
-      -1,    24,    -1,    45,    -1,    92,    -1,   154,    -1,    -1,
-      -1,    85,   147,   237,    80,   235,    27,   267,   148,   255,
-      84,   154,    -1,   134,    -1,    78,    65,   150,    -1,     5,
-      -1,    78,    97,   152,    98,    -1,   153,    -1,   152,   100,
-     153,    -1,     6,   155,    -1,   210,    -1,    19,    97,   156,
-      98,    -1,   212,    -1,    19,    -1,     5,   224,    -1,   157,
-      -1,   156,   100,   157,    -1,    -1,     6,   158,   101,     7,
-     102,    -1,    -1,    -1,    -1,     6,   160,    61,   161,    80,
-     235,    27,   267,   162,   255,     4,    97,   269,    98,    -1,
-      -1,    -1,     6,   164,    62,   165,    84,   154,   238,   174,
-     177,   179,    80,   235,   166,   186,   255,   240,   243,   181,
-     249,     4,    97,   253,    98,    -1,    -1,    27,   267,    -1,
-      -1,    -1,   136,   168,    87,   169,    30,   269,   170,   173,
-     255,     4,     7,    -1,    94,    97,   171,    98,    -1,    -1,
-     172,    -1,   171,   100,   172,    -1,   253,    -1,    27,   267,
-      -1,    -1,   190,    -1,   175,    -1,    -1,   176,   239,    -1,
-      74,    -1,    68,    -1,    -1,    72,   178,    97,   248,    98,
-      -1,    -1,    -1,    73,   180,    97,   253,    98,    -1,    -1,
-      -1,    88,   182,    97,   183,    98,    -1,    -1,   184,    -1,
-      -1,   185,    -1,   184,   100,   185,    -1,   253,    -1,    -1,
-      42,   187,    97,   188,    98,    -1,    -1,   189,    -1,   188,
-     100,   189,    -1,     6,   101,     7,   102,    -1,    -1,    50,
-     191,   239,    -1,    -1,    14,   192,   239,    -1,    -1,    -1,
-      -1,     6,   194,    58,   195,   260,    80,   235,    27,   267,
-     196,   255,     4,    97,   254,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,     6,   198,    54,   199,   206,
-     200,    47,   268,   201,    66,   267,   202,    21,   267,   203,
-      27,   267,   204,   256,   205,     4,    97,   269,    98,    -1,
-      82,    97,   207,    98,    -1,    -1,   208,    -1,   209,    -1,
-     208,   100,   209,    -1,     6,    -1,     6,   101,     7,   102,
-      -1,   214,    -1,   211,   214,    -1,   149,    -1,   150,    -1,
-     151,    -1,   222,    -1,   103,    16,     7,   104,    37,    -1,
-     103,    90,     7,   104,    37,    -1,   221,    -1,   223,    -1,
-     220,    -1,    43,    -1,    -1,    43,   215,   225,    -1,    -1,
-      43,   216,   230,    -1,    44,    -1,    -1,    44,   217,   225,
-      -1,    -1,     5,   218,   230,    -1,   126,   105,     5,   230,
-      -1,     5,   225,    -1,   126,   105,     5,   225,    -1,    64,
-      81,    -1,    -1,    64,    81,   219,   226,    -1,     5,   226,
-      -1,   126,   105,     5,   226,    -1,    59,    36,   224,    -1,
-       7,    -1,     8,    -1,     9,    -1,    10,    -1,    11,    -1,
-      12,    -1,     6,    -1,    13,    -1,    97,   273,    98,    -1,
-      43,   224,    -1,    44,   224,    -1,    64,    81,   224,    -1,
-      59,    36,   224,    -1,    46,   224,    -1,    23,   224,    -1,
-      23,   225,    -1,    35,    -1,    35,   225,    -1,    91,    -1,
-      91,   225,    -1,    86,   224,    -1,    67,    -1,    67,   226,
-      -1,    24,   224,    -1,    24,   225,    -1,    45,    -1,    45,
-     225,    -1,    92,    -1,    92,   225,    -1,    46,   224,    -1,
-      23,   224,    -1,    35,   224,    -1,    91,   224,    -1,    86,
-     224,    -1,    67,    -1,    24,   224,    -1,    45,    -1,    92,
-      -1,   225,    -1,   226,    -1,   230,    -1,    -1,   101,   227,
-     102,    -1,   101,    79,   101,   227,   102,   102,    -1,   228,
-      -1,   227,   106,   228,    -1,   229,    -1,   229,     3,   229,
-      -1,     8,    -1,     7,    -1,    10,    -1,     9,    -1,    12,
-      -1,    11,    -1,    97,   231,    98,    -1,   232,    -1,   231,
-     100,   232,    -1,    -1,     6,   233,   101,   234,   102,    -1,
-       7,    -1,     8,    -1,     6,    -1,     6,    -1,    28,   267,
-      -1,    -1,    89,   267,    -1,    -1,     6,    -1,    -1,    70,
-     241,    97,   248,    98,    -1,    17,    97,   248,    98,    -1,
-      -1,    32,   242,    97,   248,    98,    -1,    -1,    -1,    41,
-     244,    97,   245,    98,    -1,    -1,   246,    -1,   245,   100,
-     246,    -1,    38,   247,    -1,   247,    -1,   253,    -1,   253,
-      -1,    26,    97,   250,    98,    -1,    -1,   213,    -1,    97,
-     251,    98,    -1,   252,    -1,    -1,     6,    -1,   252,   100,
-       6,    -1,   269,    -1,   269,    -1,    76,   267,    -1,    -1,
-     257,    -1,    -1,   258,    -1,   257,   258,    -1,    -1,    77,
-     268,   259,    27,   267,    -1,    63,    97,   262,    98,    -1,
-      -1,    63,    97,   262,    98,    -1,   263,    -1,   262,   100,
-     263,    -1,   253,    -1,    56,    97,   265,    98,    -1,   266,
-      -1,   265,   100,   266,    -1,   254,    -1,    13,    -1,    13,
-      -1,    -1,   270,   271,    -1,   272,    -1,   271,   272,    -1,
-     136,    -1,   126,   105,     6,    -1,     7,    -1,     6,   101,
-       7,   102,    -1,   126,   105,     6,   101,     7,   102,    -1,
-     274,    -1,   275,    -1,   274,   275,    -1,     6,   101,     7,
-     102,    -1,     7,    -1,    -1,    -1,    -1,     6,   277,    60,
-     278,   261,    80,   235,    27,   267,   279,   255,     4,    97,
-     269,    98,    -1,    -1,    -1,    -1,     6,   281,    57,   282,
-     264,    80,   235,    27,   267,   283,   255,     4,    97,   269,
-      98,    -1,    -1,    -1,    -1,     6,   285,    53,   286,    80,
-     235,    27,   267,   287,   255,   288,     4,    97,   269,    98,
-      -1,   289,    -1,   290,    -1,   289,   290,    -1,    -1,    52,
-     292,   291,   293,   296,    -1,     5,   269,    -1,     5,    -1,
-      -1,    49,    97,   294,    98,    -1,    -1,   295,    -1,   294,
-     100,   295,    -1,   269,    -1,   297,    -1,    -1,   298,    -1,
-     297,   298,    -1,   299,    -1,   301,    -1,    -1,    34,   300,
-     269,    27,   267,    -1,    -1,    59,   302,   253,   303,   304,
-     306,    27,   267,    -1,    84,   154,    -1,    -1,    96,   305,
-      -1,    -1,   154,    -1,    51,   239,    -1,    71,   239,    -1,
-      -1,    -1,    -1,    -1,     6,   308,    15,   309,    75,   267,
-      80,   236,    27,   267,   310,   255,   311,     4,    97,   269,
-      98,    -1,   312,    -1,    -1,   313,    -1,   312,   313,    -1,
-      -1,    83,   317,   314,    40,    97,   315,    98,   318,    -1,
-     316,    -1,   315,   100,   316,    -1,   269,    -1,     5,   269,
-      -1,     5,    -1,   319,    -1,    -1,   320,    -1,   319,   320,
-      -1,    -1,    -1,    -1,    -1,    -1,    95,   253,   321,   303,
-     322,   304,   323,   326,   328,   324,   249,   325,    27,   267,
-      -1,    14,   327,    -1,    -1,     6,    -1,    22,    97,   329,
-      98,    -1,    -1,   330,    -1,   329,   100,   330,    -1,   253,
-      -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,  1598,  1598,  1603,  1608,  1610,  1619,  1618,  1680,  1683,
-    1686,  1688,  1697,  1700,  1703,  1718,  1720,  1719,  1740,  1743,
-    1747,  1749,  1753,  1798,  1800,  1808,  1814,  1820,  1836,  1846,
-    1852,  1853,  1854,  1855,  1856,  1857,  1858,  1859,  1860,  1861,
-    1862,  1863,  1864,  1867,  1868,  1869,  1870,  1871,  1872,  1873,
-    1876,  1877,  1880,  1892,  1895,  1899,  1901,  1905,  1910,  1915,
-    1920,  1925,  1930,  1935,  1940,  1945,  1950,  1955,  1960,  1965,
-    1980,  1992,  1979,  2025,  2026,  2027,  2028,  2029,  2030,  2031,
-    2032,  2033,  2034,  2038,  2037,  2067,  2072,  2088,  2087,  2128,
-    2127,  2293,  2297,  2321,  2335,  2336,  2345,  2346,  2347,  2348,
-    2349,  2352,  2353,  2354,  2357,  2358,  2361,  2378,  2409,  2377,
-    2445,  2453,  2467,  2512,  2520,  2526,  2546,  2629,  2635,  2657,
-    2661,  2666,  2699,  2705,  2719,  2718,  2754,  2764,  2789,  2753,
-    2817,  2827,  2816,  3123,  3132,  3140,  3150,  3139,  3222,  3227,
-    3232,  3242,  3264,  3270,  3276,  3279,  3283,  3292,  3295,  3299,
-    3303,  3308,  3307,  3315,  3319,  3318,  3326,  3331,  3330,  3338,
-    3341,  3344,  3347,  3353,  3367,  3372,  3371,  3379,  3382,  3388,
-    3402,  3424,  3423,  3435,  3434,  3448,  3458,  3478,  3447,  3509,
-    3519,  3544,  3548,  3552,  3559,  3566,  3570,  3508,  3616,  3623,
-    3630,  3637,  3643,  3658,  3679,  3702,  3706,  3726,  3731,  3736,
-    3741,  3758,  3760,  3768,  3773,  3790,  3799,  3813,  3812,  3832,
-    3831,  3846,  3873,  3872,  3904,  3903,  3957,  4004,  4059,  4109,
-    4115,  4114,  4126,  4172,  4213,  4220,  4227,  4233,  4240,  4247,
-    4273,  4296,  4316,  4333,  4366,  4370,  4395,  4399,  4405,  4433,
-    4459,  4496,  4522,  4555,  4579,  4606,  4634,  4672,  4718,  4744,
-    4781,  4807,  4844,  4870,  4913,  4941,  4967,  4993,  5017,  5045,
-    5085,  5111,  5136,  5163,  5180,  5197,  5216,  5223,  5233,  5245,
-    5251,  5265,  5272,  5282,  5288,  5294,  5300,  5306,  5329,  5356,
-    5362,  5368,  5382,  5381,  5403,  5418,  5427,  5486,  5502,  5512,
-    5517,  5527,  5532,  5599,  5598,  5616,  5627,  5626,  5640,  5646,
-    5645,  5679,  5684,  5690,  5704,  5709,  5715,  5725,  5731,  5746,
-    5750,  5752,  5760,  5763,  5766,  5772,  5785,  5791,  5797,  5807,
-    5810,  5813,  5816,  5818,  5823,  5822,  5853,  5858,  5863,  5869,
-    5875,  5888,  5900,  5906,  5912,  5925,  5936,  5947,  5953,  5953,
-    5968,  5972,  5981,  6075,  6179,  6203,  6263,  6332,  6336,  6338,
-    6342,  6344,  6349,  6359,  6378,  6348,  6409,  6419,  6441,  6408,
-    6473,  6483,  6501,  6472,  6565,  6571,  6575,  6611,  6610,  6639,
-    6648,  6658,  6663,  6668,  6673,  6679,  6692,  6715,  6722,  6729,
-    6733,  6800,  6806,  6815,  6814,  6848,  6847,  6894,  6903,  6908,
-    6920,  6925,  6931,  6937,  6946,  6952,  6962,  6984,  6951,  7019,
-    7022,  7025,  7027,  7032,  7031,  7058,  7068,  7085,  7091,  7100,
-    7110,  7113,  7116,  7118,  7123,  7131,  7138,  7146,  7153,  7122,
-    7176,  7179,  7182,  7247,  7250,  7253,  7255,  7259
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "DOT_DOT", "COLON_COLON_EQUAL",
-  "UPPERCASE_IDENTIFIER", "LOWERCASE_IDENTIFIER", "NUMBER",
-  "NEGATIVENUMBER", "NUMBER64", "NEGATIVENUMBER64", "BIN_STRING",
+  "\"end of file\"", "error", "\"invalid token\"", "DOT_DOT",
+  "COLON_COLON_EQUAL", "UPPERCASE_IDENTIFIER", "LOWERCASE_IDENTIFIER",
+  "NUMBER", "NEGATIVENUMBER", "NUMBER64", "NEGATIVENUMBER64", "BIN_STRING",
   "HEX_STRING", "QUOTED_STRING", "ACCESS", "AGENT_CAPABILITIES",
   "APPLICATION", "AUGMENTS", "BEGIN_", "BITS", "CHOICE", "CONTACT_INFO",
   "CREATION_REQUIRES", "COUNTER32", "COUNTER64", "DEFINITIONS", "DEFVAL",
@@ -2122,281 +2168,75 @@ static const char *const yytname[] =
   "UNIVERSAL", "UNSIGNED32", "UNSIGNED64", "VALUE", "VARIABLES",
   "VARIATION", "WRITE_SYNTAX", "'{'", "'}'", "';'", "','", "'('", "')'",
   "'['", "']'", "'.'", "'|'", "$accept", "mibFile", "modules", "module",
-  "@1", "moduleOid", "definitions", "linkagePart", "linkageClause",
-  "exportsClause", "@2", "importPart", "imports", "import",
+  "$@1", "moduleOid", "definitions", "linkagePart", "linkageClause",
+  "exportsClause", "$@2", "importPart", "imports", "import",
   "importIdentifiers", "importIdentifier", "importedKeyword",
   "importedSMIKeyword", "importedSPPIKeyword", "moduleName",
-  "declarationPart", "declarations", "declaration", "macroClause", "@3",
-  "@4", "macroName", "choiceClause", "@5", "fuzzy_lowercase_identifier",
-  "valueDeclaration", "@6", "typeDeclaration", "@7", "typeName", "typeSMI",
-  "typeSMIandSPPI", "typeSMIonly", "typeSPPIonly", "typeDeclarationRHS",
-  "@8", "@9", "conceptualTable", "row", "entryType", "sequenceItems",
-  "sequenceItem", "Syntax", "sequenceSyntax", "NamedBits", "NamedBit",
-  "@10", "objectIdentityClause", "@11", "@12", "@13", "objectTypeClause",
-  "@14", "@15", "descriptionClause", "trapTypeClause", "@16", "@17",
-  "VarPart", "VarTypes", "VarType", "DescrPart", "MaxOrPIBAccessPart",
-  "PibAccessPart", "PibAccess", "SPPIPibReferencesPart", "@18",
-  "SPPIPibTagPart", "@19", "SPPIUniquePart", "@20", "UniqueTypesPart",
-  "UniqueTypes", "UniqueType", "SPPIErrorsPart", "@21", "Errors", "Error",
-  "MaxAccessPart", "@22", "@23", "notificationTypeClause", "@24", "@25",
-  "@26", "moduleIdentityClause", "@27", "@28", "@29", "@30", "@31", "@32",
-  "@33", "@34", "SubjectCategoriesPart", "SubjectCategories",
+  "declarationPart", "declarations", "declaration", "macroClause", "$@3",
+  "$@4", "macroName", "choiceClause", "$@5", "fuzzy_lowercase_identifier",
+  "valueDeclaration", "$@6", "typeDeclaration", "$@7", "typeName",
+  "typeSMI", "typeSMIandSPPI", "typeSMIonly", "typeSPPIonly",
+  "typeDeclarationRHS", "$@8", "$@9", "conceptualTable", "row",
+  "entryType", "sequenceItems", "sequenceItem", "Syntax", "sequenceSyntax",
+  "NamedBits", "NamedBit", "$@10", "objectIdentityClause", "$@11", "$@12",
+  "$@13", "objectTypeClause", "$@14", "$@15", "descriptionClause",
+  "trapTypeClause", "$@16", "$@17", "VarPart", "VarTypes", "VarType",
+  "DescrPart", "MaxOrPIBAccessPart", "PibAccessPart", "PibAccess",
+  "SPPIPibReferencesPart", "$@18", "SPPIPibTagPart", "$@19",
+  "SPPIUniquePart", "$@20", "UniqueTypesPart", "UniqueTypes", "UniqueType",
+  "SPPIErrorsPart", "$@21", "Errors", "Error", "MaxAccessPart", "$@22",
+  "$@23", "notificationTypeClause", "$@24", "$@25", "$@26",
+  "moduleIdentityClause", "$@27", "$@28", "$@29", "$@30", "$@31", "$@32",
+  "$@33", "$@34", "SubjectCategoriesPart", "SubjectCategories",
   "CategoryIDs", "CategoryID", "ObjectSyntax", "typeTag",
-  "sequenceObjectSyntax", "valueofObjectSyntax", "SimpleSyntax", "@35",
-  "@36", "@37", "@38", "@39", "valueofSimpleSyntax",
+  "sequenceObjectSyntax", "valueofObjectSyntax", "SimpleSyntax", "$@35",
+  "$@36", "$@37", "$@38", "$@39", "valueofSimpleSyntax",
   "sequenceSimpleSyntax", "ApplicationSyntax", "sequenceApplicationSyntax",
   "anySubType", "integerSubType", "octetStringSubType", "ranges", "range",
-  "value", "enumSpec", "enumItems", "enumItem", "@40", "enumNumber",
+  "value", "enumSpec", "enumItems", "enumItem", "$@40", "enumNumber",
   "Status", "Status_Capabilities", "DisplayPart", "UnitsPart", "Access",
-  "IndexPart", "@41", "@42", "MibIndex", "@43", "IndexTypes", "IndexType",
-  "Index", "Entry", "DefValPart", "Value", "BitsValue", "BitNames",
-  "ObjectName", "NotificationName", "ReferPart", "RevisionPart",
-  "Revisions", "Revision", "@44", "NotificationObjectsPart",
-  "ObjectGroupObjectsPart", "Objects", "Object", "NotificationsPart",
-  "Notifications", "Notification", "Text", "ExtUTCTime",
-  "objectIdentifier", "@45", "subidentifiers", "subidentifier",
-  "objectIdentifier_defval", "subidentifiers_defval",
-  "subidentifier_defval", "objectGroupClause", "@46", "@47", "@48",
-  "notificationGroupClause", "@49", "@50", "@51", "moduleComplianceClause",
-  "@52", "@53", "@54", "ComplianceModulePart", "ComplianceModules",
-  "ComplianceModule", "@55", "ComplianceModuleName", "MandatoryPart",
-  "MandatoryGroups", "MandatoryGroup", "CompliancePart", "Compliances",
-  "Compliance", "ComplianceGroup", "@56", "ComplianceObject", "@57",
-  "SyntaxPart", "WriteSyntaxPart", "WriteSyntax", "AccessPart",
-  "agentCapabilitiesClause", "@58", "@59", "@60",
-  "ModulePart_Capabilities", "Modules_Capabilities", "Module_Capabilities",
-  "@61", "CapabilitiesGroups", "CapabilitiesGroup",
+  "IndexPart", "$@41", "$@42", "MibIndex", "$@43", "IndexTypes",
+  "IndexType", "Index", "Entry", "DefValPart", "Value", "BitsValue",
+  "BitNames", "ObjectName", "NotificationName", "ReferPart",
+  "RevisionPart", "Revisions", "Revision", "$@44",
+  "NotificationObjectsPart", "ObjectGroupObjectsPart", "Objects", "Object",
+  "NotificationsPart", "Notifications", "Notification", "Text",
+  "ExtUTCTime", "objectIdentifier", "$@45", "subidentifiers",
+  "subidentifier", "objectIdentifier_defval", "subidentifiers_defval",
+  "subidentifier_defval", "objectGroupClause", "$@46", "$@47", "$@48",
+  "notificationGroupClause", "$@49", "$@50", "$@51",
+  "moduleComplianceClause", "$@52", "$@53", "$@54", "ComplianceModulePart",
+  "ComplianceModules", "ComplianceModule", "$@55", "ComplianceModuleName",
+  "MandatoryPart", "MandatoryGroups", "MandatoryGroup", "CompliancePart",
+  "Compliances", "Compliance", "ComplianceGroup", "$@56",
+  "ComplianceObject", "$@57", "SyntaxPart", "WriteSyntaxPart",
+  "WriteSyntax", "AccessPart", "agentCapabilitiesClause", "$@58", "$@59",
+  "$@60", "ModulePart_Capabilities", "Modules_Capabilities",
+  "Module_Capabilities", "$@61", "CapabilitiesGroups", "CapabilitiesGroup",
   "ModuleName_Capabilities", "VariationPart", "Variations", "Variation",
-  "@62", "@63", "@64", "@65", "@66", "VariationAccessPart",
-  "VariationAccess", "CreationPart", "Cells", "Cell", 0
+  "$@62", "$@63", "$@64", "$@65", "$@66", "VariationAccessPart",
+  "VariationAccess", "CreationPart", "Cells", "Cell", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   123,   125,    59,
-      44,    40,    41,    91,    93,    46,   124
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
-{
-       0,   107,   108,   108,   109,   109,   111,   110,   112,   112,
-     113,   113,   114,   114,   115,   116,   117,   116,   118,   118,
-     119,   119,   120,   121,   121,   122,   122,   122,   123,   123,
-     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-     123,   123,   123,   124,   124,   124,   124,   124,   124,   124,
-     125,   125,   126,   127,   127,   128,   128,   129,   129,   129,
-     129,   129,   129,   129,   129,   129,   129,   129,   129,   129,
-     131,   132,   130,   133,   133,   133,   133,   133,   133,   133,
-     133,   133,   133,   135,   134,   136,   136,   138,   137,   140,
-     139,   141,   141,   141,   142,   142,   143,   143,   143,   143,
-     143,   144,   144,   144,   145,   145,   146,   147,   148,   146,
-     146,   149,   150,   151,   152,   152,   153,   154,   154,   155,
-     155,   155,   156,   156,   158,   157,   160,   161,   162,   159,
-     164,   165,   163,   166,   166,   168,   169,   167,   170,   170,
-     171,   171,   172,   173,   173,   174,   174,   174,   175,   176,
-     176,   178,   177,   177,   180,   179,   179,   182,   181,   181,
-     183,   183,   184,   184,   185,   187,   186,   186,   188,   188,
-     189,   191,   190,   192,   190,   194,   195,   196,   193,   198,
-     199,   200,   201,   202,   203,   204,   205,   197,   206,   206,
-     207,   208,   208,   209,   209,   210,   210,   210,   210,   210,
-     210,   211,   211,   212,   212,   213,   214,   215,   214,   216,
-     214,   214,   217,   214,   218,   214,   214,   214,   214,   214,
-     219,   214,   214,   214,   214,   220,   220,   220,   220,   220,
-     220,   220,   220,   220,   221,   221,   221,   221,   222,   222,
-     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
-     222,   222,   222,   222,   223,   223,   223,   223,   223,   223,
-     223,   223,   223,   224,   224,   224,   224,   225,   226,   227,
-     227,   228,   228,   229,   229,   229,   229,   229,   229,   230,
-     231,   231,   233,   232,   234,   234,   235,   236,   237,   237,
-     238,   238,   239,   241,   240,   240,   242,   240,   240,   244,
-     243,   243,   245,   245,   246,   246,   247,   248,   249,   249,
-     250,   250,   251,   251,   252,   252,   253,   254,   255,   255,
-     256,   256,   257,   257,   259,   258,   260,   260,   261,   262,
-     262,   263,   264,   265,   265,   266,   267,   268,   270,   269,
-     271,   271,   272,   272,   272,   272,   272,   273,   274,   274,
-     275,   275,   277,   278,   279,   276,   281,   282,   283,   280,
-     285,   286,   287,   284,   288,   289,   289,   291,   290,   292,
-     292,   292,   293,   293,   294,   294,   295,   296,   296,   297,
-     297,   298,   298,   300,   299,   302,   301,   303,   303,   304,
-     304,   305,   306,   306,   306,   308,   309,   310,   307,   311,
-     311,   312,   312,   314,   313,   315,   315,   316,   317,   317,
-     318,   318,   319,   319,   321,   322,   323,   324,   325,   320,
-     326,   326,   327,   328,   328,   329,   329,   330
-};
+#define YYPACT_NINF (-461)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     1,     0,     1,     2,     0,    10,     3,     0,
-       1,     1,     1,     0,     3,     0,     0,     3,     1,     0,
-       1,     2,     3,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     1,     2,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
-       0,     0,     5,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     0,     3,     1,     1,     0,     8,     0,
-       4,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     0,    11,
-       1,     3,     1,     4,     1,     3,     2,     1,     4,     1,
-       1,     2,     1,     3,     0,     5,     0,     0,     0,    14,
-       0,     0,    23,     0,     2,     0,     0,    11,     4,     0,
-       1,     3,     1,     2,     0,     1,     1,     0,     2,     1,
-       1,     0,     5,     0,     0,     5,     0,     0,     5,     0,
-       1,     0,     1,     3,     1,     0,     5,     0,     1,     3,
-       4,     0,     3,     0,     3,     0,     0,     0,    15,     0,
-       0,     0,     0,     0,     0,     0,     0,    24,     4,     0,
-       1,     1,     3,     1,     4,     1,     2,     1,     1,     1,
-       1,     5,     5,     1,     1,     1,     1,     0,     3,     0,
-       3,     1,     0,     3,     0,     3,     4,     2,     4,     2,
-       0,     4,     2,     4,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     3,     2,     2,     3,     3,     2,     2,
-       2,     1,     2,     1,     2,     2,     1,     2,     2,     2,
-       1,     2,     1,     2,     2,     2,     2,     2,     2,     1,
-       2,     1,     1,     1,     1,     1,     0,     3,     6,     1,
-       3,     1,     3,     1,     1,     1,     1,     1,     1,     3,
-       1,     3,     0,     5,     1,     1,     1,     1,     2,     0,
-       2,     0,     1,     0,     5,     4,     0,     5,     0,     0,
-       5,     0,     1,     3,     2,     1,     1,     1,     4,     0,
-       1,     3,     1,     0,     1,     3,     1,     1,     2,     0,
-       1,     0,     1,     2,     0,     5,     4,     0,     4,     1,
-       3,     1,     4,     1,     3,     1,     1,     1,     0,     2,
-       1,     2,     1,     3,     1,     4,     6,     1,     1,     2,
-       4,     1,     0,     0,     0,    15,     0,     0,     0,    15,
-       0,     0,     0,    15,     1,     1,     2,     0,     5,     2,
-       1,     0,     4,     0,     1,     3,     1,     1,     0,     1,
-       2,     1,     1,     0,     5,     0,     8,     2,     0,     2,
-       0,     1,     2,     2,     0,     0,     0,     0,    17,     1,
-       0,     1,     2,     0,     8,     1,     3,     1,     2,     1,
-       1,     0,     1,     2,     0,     0,     0,     0,     0,    14,
-       2,     0,     1,     4,     0,     1,     3,     1
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
-   STATE-NUM when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint16 yydefact[] =
-{
-       3,    52,     0,     2,     4,     6,     1,     5,     9,   338,
-       0,     0,     0,    10,    11,     0,     8,    86,    85,   344,
-       0,   342,   339,   340,     0,     0,     0,   341,    15,     0,
-     343,    16,    13,   345,     0,     0,    19,     0,    12,     0,
-      17,    26,    25,    43,    30,    44,    45,    46,    31,    50,
-      32,    33,    34,    35,    47,    48,    36,    37,    38,    39,
-      40,    41,    49,    42,    51,     0,    18,    20,     0,    23,
-      27,    28,    29,     0,    86,    85,    82,   101,   103,   102,
-      99,   104,    96,    81,    73,    80,    76,    79,    77,    74,
-      98,    78,    97,    75,   100,   105,     0,     0,    55,    68,
-      70,    87,    58,    57,    89,    92,    94,    95,    93,    59,
-      60,    61,    62,    63,    65,    66,    64,    67,   346,    14,
-      21,     0,     0,    69,     0,     0,     0,     0,     0,     0,
-       0,     0,     7,    56,     0,     0,     0,     0,    22,    24,
-     127,   131,   176,   180,   353,   357,   361,   396,    71,     0,
-     136,     0,     0,     0,   327,   189,     0,     0,     0,     0,
-       0,     0,     0,   112,     0,    83,   266,   266,   241,   206,
-     211,   250,   266,     0,     0,   246,     0,   107,   266,   243,
-     252,     0,     0,   110,    90,   197,   198,   199,   106,   117,
-       0,   195,   200,     0,     0,     0,     0,     0,   181,     0,
-       0,     0,     0,     0,     0,    72,     0,   338,     0,     0,
-     217,   222,     0,     0,     0,   239,   240,   264,   265,   248,
-     249,     0,   242,     0,     0,     0,   251,   238,   263,   266,
-     219,     0,   247,     0,     0,   289,   245,   244,   253,     0,
-       0,     0,    52,   196,   286,     0,   291,   338,     0,     0,
-       0,   338,     0,   338,     0,     0,   336,     0,   338,   139,
-     274,   273,   276,   275,   278,   277,     0,     0,   269,   271,
-     215,   124,     0,   122,    84,   282,     0,   280,   208,   210,
-     213,   224,     0,   112,   111,     0,     0,   114,     0,     0,
-       0,     0,     0,     0,     0,   147,   331,     0,   329,   316,
-       0,   193,     0,   190,   191,     0,     0,     0,   335,     0,
-     333,   317,     0,     0,     0,     0,     0,   144,     0,   267,
-       0,     0,     0,   118,     0,     0,   279,     0,   221,   266,
-     120,   266,   266,   266,   266,   266,   261,   266,     0,     0,
-     259,   266,   266,   262,   116,   119,   203,   204,   113,     0,
-     288,     0,     0,     0,   218,   223,   216,   128,   290,   173,
-     171,   150,   149,   153,   146,     0,   145,   326,   338,     0,
-       0,   188,     0,   337,   182,   328,     0,   332,   338,     0,
-     362,   287,     0,    88,   338,     0,   319,     0,   270,   272,
-       0,   123,     0,   281,   121,   255,   260,   256,   234,   235,
-     254,   266,   266,   258,   257,   115,     0,   201,   202,   319,
-       0,     0,   151,   156,   292,   148,   330,   177,     0,   192,
-       0,   354,   334,   358,   319,     0,     0,   140,   142,   143,
-       0,     0,     0,     0,   284,   285,     0,   237,   236,     0,
-       0,   174,   172,     0,   154,     0,   319,   194,     0,   319,
-     319,     0,   397,   138,   338,   318,     0,   268,   125,   283,
-     108,     0,   338,     0,     0,     0,   183,     0,     0,   371,
-       0,   364,   365,   319,   141,   137,   319,   338,     0,   307,
-     338,   133,     0,     0,     0,     0,   370,   367,     0,   366,
-     400,     0,     0,   152,     0,     0,   167,   338,     0,   338,
-     338,   369,   373,   338,     0,     0,   399,   401,     0,   129,
-     155,   134,   165,   319,     0,   184,     0,     0,     0,   378,
-       0,   338,   403,     0,   402,   109,     0,   298,   178,     0,
-     355,   359,   338,   383,   385,   368,   377,   379,   381,   382,
-     363,   408,     0,   338,     0,     0,   296,   293,   301,     0,
-     376,     0,   374,   338,   338,   380,     0,     0,     0,     0,
-     168,   338,     0,     0,   299,   159,   185,   372,   338,     0,
-     388,   338,   398,     0,   166,     0,     0,   338,   338,     0,
-     157,   309,   321,   375,     0,     0,   390,   407,     0,   405,
-       0,   169,   295,     0,     0,   338,     0,     0,     0,     0,
-     186,   320,   322,   384,   387,     0,   394,   411,   338,   170,
-     297,   294,   338,     0,   302,   305,   306,   338,     0,     0,
-     324,     0,   323,   391,   389,     0,     0,     0,   338,   404,
-     410,   412,   406,   304,   300,   338,     0,   160,   162,   164,
-     231,   225,   226,   227,   228,   229,   230,   232,   313,   310,
-     205,     0,   338,     0,     0,   392,   393,     0,   414,   413,
-     303,   158,   338,   314,   351,     0,   312,     0,   347,   348,
-     308,     0,     0,   338,   386,   388,   163,     0,   311,     0,
-     233,     0,   349,   132,   325,     0,   415,     0,   315,   187,
-     390,   350,   416,   421,     0,   424,   422,   420,     0,   417,
-     338,   309,   427,     0,   425,   418,   423,   338,     0,   426,
-       0,   419
-};
+#define YYTABLE_NINF (-410)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
-{
-      -1,     2,     3,     4,     8,    10,    15,    37,    38,    32,
-      35,    65,    66,    67,    68,    69,    70,    71,    72,   182,
-      96,    97,    98,    99,   134,   160,   100,   183,   213,    21,
-     102,   135,   103,   137,   104,   105,   106,   107,   108,   184,
-     235,   476,   185,   186,   187,   286,   287,   188,   344,   272,
-     273,   322,   109,   124,   152,   409,   110,   125,   153,   496,
-     111,   136,   162,   317,   426,   427,   386,   363,   364,   365,
-     413,   443,   445,   463,   581,   596,   636,   637,   638,   513,
-     526,   559,   560,   366,   411,   410,   112,   126,   154,   446,
-     113,   127,   155,   250,   420,   483,   529,   582,   621,   198,
-     302,   303,   304,   189,   190,   345,   649,   191,   223,   224,
-     225,   209,   282,   650,   346,   192,   347,   215,   228,   217,
-     267,   268,   269,   218,   276,   277,   325,   436,   245,   382,
-     289,   295,   415,   548,   563,   562,   565,   579,   613,   614,
-     615,   478,   598,   651,   665,   666,   479,   308,   431,   600,
-     601,   602,   653,   196,   200,   297,   298,   202,   309,   310,
-     257,   374,   299,    12,    22,    23,   667,   668,   669,   114,
-     128,   156,   449,   115,   129,   157,   450,   116,   130,   158,
-     424,   470,   471,   472,   502,   487,   519,   551,   552,   535,
-     536,   537,   538,   553,   539,   554,   586,   606,   624,   627,
-     117,   131,   159,   473,   505,   506,   507,   542,   588,   589,
-     522,   629,   630,   631,   675,   690,   693,   701,   708,   695,
-     697,   699,   703,   704
-};
+#define yytable_value_is_error(Yyn) \
+  0
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -461
 static const yytype_int16 yypact[] =
 {
       19,  -461,    36,    19,  -461,  -461,  -461,  -461,   -58,  -461,
@@ -2473,6 +2313,85 @@ static const yytype_int16 yypact[] =
      242,  -461
 };
 
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       3,    52,     0,     2,     4,     6,     1,     5,     9,   338,
+       0,     0,     0,    10,    11,     0,     8,    86,    85,   344,
+       0,   342,   339,   340,     0,     0,     0,   341,    15,     0,
+     343,    16,    13,   345,     0,     0,    19,     0,    12,     0,
+      17,    26,    25,    43,    30,    44,    45,    46,    31,    50,
+      32,    33,    34,    35,    47,    48,    36,    37,    38,    39,
+      40,    41,    49,    42,    51,     0,    18,    20,     0,    23,
+      27,    28,    29,     0,    86,    85,    82,   101,   103,   102,
+      99,   104,    96,    81,    73,    80,    76,    79,    77,    74,
+      98,    78,    97,    75,   100,   105,     0,     0,    55,    68,
+      70,    87,    58,    57,    89,    92,    94,    95,    93,    59,
+      60,    61,    62,    63,    65,    66,    64,    67,   346,    14,
+      21,     0,     0,    69,     0,     0,     0,     0,     0,     0,
+       0,     0,     7,    56,     0,     0,     0,     0,    22,    24,
+     127,   131,   176,   180,   353,   357,   361,   396,    71,     0,
+     136,     0,     0,     0,   327,   189,     0,     0,     0,     0,
+       0,     0,     0,   112,     0,    83,   266,   266,   241,   206,
+     211,   250,   266,     0,     0,   246,     0,   107,   266,   243,
+     252,     0,     0,   110,    90,   197,   198,   199,   106,   117,
+       0,   195,   200,     0,     0,     0,     0,     0,   181,     0,
+       0,     0,     0,     0,     0,    72,     0,   338,     0,     0,
+     217,   222,     0,     0,     0,   239,   240,   264,   265,   248,
+     249,     0,   242,     0,     0,     0,   251,   238,   263,   266,
+     219,     0,   247,     0,     0,   289,   245,   244,   253,     0,
+       0,     0,    52,   196,   286,     0,   291,   338,     0,     0,
+       0,   338,     0,   338,     0,     0,   336,     0,   338,   139,
+     274,   273,   276,   275,   278,   277,     0,     0,   269,   271,
+     215,   124,     0,   122,    84,   282,     0,   280,   208,   210,
+     213,   224,     0,   112,   111,     0,     0,   114,     0,     0,
+       0,     0,     0,     0,     0,   147,   331,     0,   329,   316,
+       0,   193,     0,   190,   191,     0,     0,     0,   335,     0,
+     333,   317,     0,     0,     0,     0,     0,   144,     0,   267,
+       0,     0,     0,   118,     0,     0,   279,     0,   221,   266,
+     120,   266,   266,   266,   266,   266,   261,   266,     0,     0,
+     259,   266,   266,   262,   116,   119,   203,   204,   113,     0,
+     288,     0,     0,     0,   218,   223,   216,   128,   290,   173,
+     171,   150,   149,   153,   146,     0,   145,   326,   338,     0,
+       0,   188,     0,   337,   182,   328,     0,   332,   338,     0,
+     362,   287,     0,    88,   338,     0,   319,     0,   270,   272,
+       0,   123,     0,   281,   121,   255,   260,   256,   234,   235,
+     254,   266,   266,   258,   257,   115,     0,   201,   202,   319,
+       0,     0,   151,   156,   292,   148,   330,   177,     0,   192,
+       0,   354,   334,   358,   319,     0,     0,   140,   142,   143,
+       0,     0,     0,     0,   284,   285,     0,   237,   236,     0,
+       0,   174,   172,     0,   154,     0,   319,   194,     0,   319,
+     319,     0,   397,   138,   338,   318,     0,   268,   125,   283,
+     108,     0,   338,     0,     0,     0,   183,     0,     0,   371,
+       0,   364,   365,   319,   141,   137,   319,   338,     0,   307,
+     338,   133,     0,     0,     0,     0,   370,   367,     0,   366,
+     400,     0,     0,   152,     0,     0,   167,   338,     0,   338,
+     338,   369,   373,   338,     0,     0,   399,   401,     0,   129,
+     155,   134,   165,   319,     0,   184,     0,     0,     0,   378,
+       0,   338,   403,     0,   402,   109,     0,   298,   178,     0,
+     355,   359,   338,   383,   385,   368,   377,   379,   381,   382,
+     363,   408,     0,   338,     0,     0,   296,   293,   301,     0,
+     376,     0,   374,   338,   338,   380,     0,     0,     0,     0,
+     168,   338,     0,     0,   299,   159,   185,   372,   338,     0,
+     388,   338,   398,     0,   166,     0,     0,   338,   338,     0,
+     157,   309,   321,   375,     0,     0,   390,   407,     0,   405,
+       0,   169,   295,     0,     0,   338,     0,     0,     0,     0,
+     186,   320,   322,   384,   387,     0,   394,   411,   338,   170,
+     297,   294,   338,     0,   302,   305,   306,   338,     0,     0,
+     324,     0,   323,   391,   389,     0,     0,     0,   338,   404,
+     410,   412,   406,   304,   300,   338,     0,   160,   162,   164,
+     231,   225,   226,   227,   228,   229,   230,   232,   313,   310,
+     205,     0,   338,     0,     0,   392,   393,     0,   414,   413,
+     303,   158,   338,   314,   351,     0,   312,     0,   347,   348,
+     308,     0,     0,   338,   386,   388,   163,     0,   311,     0,
+     233,     0,   349,   132,   325,     0,   415,     0,   315,   187,
+     390,   350,   416,   421,     0,   424,   422,   420,     0,   417,
+     338,   309,   427,     0,   425,   418,   423,   338,     0,   426,
+       0,   419
+};
+
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
@@ -2501,11 +2420,37 @@ static const yytype_int16 yypgoto[] =
     -461,  -461,  -461,  -169
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If zero, do what YYDEFACT says.
-   If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -410
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     2,     3,     4,     8,    10,    15,    37,    38,    32,
+      35,    65,    66,    67,    68,    69,    70,    71,    72,   182,
+      96,    97,    98,    99,   134,   160,   100,   183,   213,    21,
+     102,   135,   103,   137,   104,   105,   106,   107,   108,   184,
+     235,   476,   185,   186,   187,   286,   287,   188,   344,   272,
+     273,   322,   109,   124,   152,   409,   110,   125,   153,   496,
+     111,   136,   162,   317,   426,   427,   386,   363,   364,   365,
+     413,   443,   445,   463,   581,   596,   636,   637,   638,   513,
+     526,   559,   560,   366,   411,   410,   112,   126,   154,   446,
+     113,   127,   155,   250,   420,   483,   529,   582,   621,   198,
+     302,   303,   304,   189,   190,   345,   649,   191,   223,   224,
+     225,   209,   282,   650,   346,   192,   347,   215,   228,   217,
+     267,   268,   269,   218,   276,   277,   325,   436,   245,   382,
+     289,   295,   415,   548,   563,   562,   565,   579,   613,   614,
+     615,   478,   598,   651,   665,   666,   479,   308,   431,   600,
+     601,   602,   653,   196,   200,   297,   298,   202,   309,   310,
+     257,   374,   299,    12,    22,    23,   667,   668,   669,   114,
+     128,   156,   449,   115,   129,   157,   450,   116,   130,   158,
+     424,   470,   471,   472,   502,   487,   519,   551,   552,   535,
+     536,   537,   538,   553,   539,   554,   586,   606,   624,   627,
+     117,   131,   159,   473,   505,   506,   507,   542,   588,   589,
+     522,   629,   630,   631,   675,   690,   693,   701,   708,   695,
+     697,   699,   703,   704
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
       11,   296,   246,   350,   255,   296,   219,   211,   357,   358,
@@ -2648,9 +2593,9 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,   673
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
        0,     5,   108,   109,   110,   126,     0,   110,   111,    97,
      112,   269,   270,    25,    69,   113,    98,     5,     6,     7,
@@ -2726,95 +2671,137 @@ static const yytype_uint16 yystos[] =
       27,   267
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   107,   108,   108,   109,   109,   111,   110,   112,   112,
+     113,   113,   114,   114,   115,   116,   117,   116,   118,   118,
+     119,   119,   120,   121,   121,   122,   122,   122,   123,   123,
+     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
+     123,   123,   123,   124,   124,   124,   124,   124,   124,   124,
+     125,   125,   126,   127,   127,   128,   128,   129,   129,   129,
+     129,   129,   129,   129,   129,   129,   129,   129,   129,   129,
+     131,   132,   130,   133,   133,   133,   133,   133,   133,   133,
+     133,   133,   133,   135,   134,   136,   136,   138,   137,   140,
+     139,   141,   141,   141,   142,   142,   143,   143,   143,   143,
+     143,   144,   144,   144,   145,   145,   146,   147,   148,   146,
+     146,   149,   150,   151,   152,   152,   153,   154,   154,   155,
+     155,   155,   156,   156,   158,   157,   160,   161,   162,   159,
+     164,   165,   163,   166,   166,   168,   169,   167,   170,   170,
+     171,   171,   172,   173,   173,   174,   174,   174,   175,   176,
+     176,   178,   177,   177,   180,   179,   179,   182,   181,   181,
+     183,   183,   184,   184,   185,   187,   186,   186,   188,   188,
+     189,   191,   190,   192,   190,   194,   195,   196,   193,   198,
+     199,   200,   201,   202,   203,   204,   205,   197,   206,   206,
+     207,   208,   208,   209,   209,   210,   210,   210,   210,   210,
+     210,   211,   211,   212,   212,   213,   214,   215,   214,   216,
+     214,   214,   217,   214,   218,   214,   214,   214,   214,   214,
+     219,   214,   214,   214,   214,   220,   220,   220,   220,   220,
+     220,   220,   220,   220,   221,   221,   221,   221,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   223,   223,   223,   223,   223,   223,
+     223,   223,   223,   224,   224,   224,   224,   225,   226,   227,
+     227,   228,   228,   229,   229,   229,   229,   229,   229,   230,
+     231,   231,   233,   232,   234,   234,   235,   236,   237,   237,
+     238,   238,   239,   241,   240,   240,   242,   240,   240,   244,
+     243,   243,   245,   245,   246,   246,   247,   248,   249,   249,
+     250,   250,   251,   251,   252,   252,   253,   254,   255,   255,
+     256,   256,   257,   257,   259,   258,   260,   260,   261,   262,
+     262,   263,   264,   265,   265,   266,   267,   268,   270,   269,
+     271,   271,   272,   272,   272,   272,   272,   273,   274,   274,
+     275,   275,   277,   278,   279,   276,   281,   282,   283,   280,
+     285,   286,   287,   284,   288,   289,   289,   291,   290,   292,
+     292,   292,   293,   293,   294,   294,   295,   296,   296,   297,
+     297,   298,   298,   300,   299,   302,   301,   303,   303,   304,
+     304,   305,   306,   306,   306,   308,   309,   310,   307,   311,
+     311,   312,   312,   314,   313,   315,   315,   316,   317,   317,
+     318,   318,   319,   319,   321,   322,   323,   324,   325,   320,
+     326,   326,   327,   328,   328,   329,   329,   330
+};
 
-#define YYFAIL		goto yyerrlab
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     0,     1,     2,     0,    10,     3,     0,
+       1,     1,     1,     0,     3,     0,     0,     3,     1,     0,
+       1,     2,     3,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     1,     2,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       0,     0,     5,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     0,     3,     1,     1,     0,     8,     0,
+       4,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     0,    11,
+       1,     3,     1,     4,     1,     3,     2,     1,     4,     1,
+       1,     2,     1,     3,     0,     5,     0,     0,     0,    14,
+       0,     0,    23,     0,     2,     0,     0,    11,     4,     0,
+       1,     3,     1,     2,     0,     1,     1,     0,     2,     1,
+       1,     0,     5,     0,     0,     5,     0,     0,     5,     0,
+       1,     0,     1,     3,     1,     0,     5,     0,     1,     3,
+       4,     0,     3,     0,     3,     0,     0,     0,    15,     0,
+       0,     0,     0,     0,     0,     0,     0,    24,     4,     0,
+       1,     1,     3,     1,     4,     1,     2,     1,     1,     1,
+       1,     5,     5,     1,     1,     1,     1,     0,     3,     0,
+       3,     1,     0,     3,     0,     3,     4,     2,     4,     2,
+       0,     4,     2,     4,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     3,     2,     2,     3,     3,     2,     2,
+       2,     1,     2,     1,     2,     2,     1,     2,     2,     2,
+       1,     2,     1,     2,     2,     2,     2,     2,     2,     1,
+       2,     1,     1,     1,     1,     1,     0,     3,     6,     1,
+       3,     1,     3,     1,     1,     1,     1,     1,     1,     3,
+       1,     3,     0,     5,     1,     1,     1,     1,     2,     0,
+       2,     0,     1,     0,     5,     4,     0,     5,     0,     0,
+       5,     0,     1,     3,     2,     1,     1,     1,     4,     0,
+       1,     3,     1,     0,     1,     3,     1,     1,     2,     0,
+       1,     0,     1,     2,     0,     5,     4,     0,     4,     1,
+       3,     1,     4,     1,     3,     1,     1,     1,     0,     2,
+       1,     2,     1,     3,     1,     4,     6,     1,     1,     2,
+       4,     1,     0,     0,     0,    15,     0,     0,     0,    15,
+       0,     0,     0,    15,     1,     1,     2,     0,     5,     2,
+       1,     0,     4,     0,     1,     3,     1,     1,     0,     1,
+       2,     1,     1,     0,     5,     0,     8,     2,     0,     2,
+       0,     1,     2,     2,     0,     0,     0,     0,    17,     1,
+       0,     1,     2,     0,     8,     1,     3,     1,     2,     1,
+       1,     0,     1,     2,     0,     0,     0,     0,     0,    14,
+       2,     0,     1,     4,     0,     1,     3,     1
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      yytoken = YYTRANSLATE (yychar);				\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
+enum { YYENOMEM = -2 };
 
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
-   This macro was not mandated originally: define only if we know
-   we won't break user code: when these are the locations we know.  */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#ifndef YY_LOCATION_PRINT
-# if YYLTYPE_IS_TRIVIAL
-#  define YY_LOCATION_PRINT(File, Loc)			\
-     fprintf (File, "%d.%d-%d.%d",			\
-	      (Loc).first_line, (Loc).first_column,	\
-	      (Loc).last_line,  (Loc).last_column)
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
 
+#define YYRECOVERING()  (!!yyerrstatus)
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (parserPtr, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (&yylval, YYLEX_PARAM)
-#else
-# define YYLEX yylex (&yylval)
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -2824,80 +2811,59 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, parserPtr); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, void *parserPtr)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (parserPtr);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, void *parserPtr)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, parserPtr);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -2905,80 +2871,68 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *bottom, yytype_int16 *top)
-#else
 static void
-yy_stack_print (bottom, top)
-    yytype_int16 *bottom;
-    yytype_int16 *top;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
-  for (; bottom <= top; ++bottom)
-    YYFPRINTF (stderr, " %d", *bottom);
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
-static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, void *parserPtr)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
-      fprintf (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
-      fprintf (stderr, "\n");
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], parserPtr);
+      YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, parserPtr); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -2993,266 +2947,29 @@ int yydebug;
 # define YYMAXDEPTH 10000
 #endif
 
-
-
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
 
-  if (! yyres)
-    return yystrlen (yystr);
 
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into YYRESULT an error message about the unexpected token
-   YYCHAR while in state YYSTATE.  Return the number of bytes copied,
-   including the terminating null byte.  If YYRESULT is null, do not
-   copy anything; just return the number of bytes that would be
-   copied.  As a special case, return 0 if an ordinary "syntax error"
-   message will do.  Return YYSIZE_MAXIMUM if overflow occurs during
-   size calculation.  */
-static YYSIZE_T
-yysyntax_error (char *yyresult, int yystate, int yychar)
-{
-  int yyn = yypact[yystate];
 
-  if (! (YYPACT_NINF < yyn && yyn <= YYLAST))
-    return 0;
-  else
-    {
-      int yytype = YYTRANSLATE (yychar);
-      YYSIZE_T yysize0 = yytnamerr (0, yytname[yytype]);
-      YYSIZE_T yysize = yysize0;
-      YYSIZE_T yysize1;
-      int yysize_overflow = 0;
-      enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-      char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-      int yyx;
-
-# if 0
-      /* This is so xgettext sees the translatable formats that are
-	 constructed on the fly.  */
-      YY_("syntax error, unexpected %s");
-      YY_("syntax error, unexpected %s, expecting %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s");
-# endif
-      char *yyfmt;
-      char const *yyf;
-      static char const yyunexpected[] = "syntax error, unexpected %s";
-      static char const yyexpecting[] = ", expecting %s";
-      static char const yyor[] = " or %s";
-      char yyformat[sizeof yyunexpected
-		    + sizeof yyexpecting - 1
-		    + ((YYERROR_VERBOSE_ARGS_MAXIMUM - 2)
-		       * (sizeof yyor - 1))];
-      char const *yyprefix = yyexpecting;
-
-      /* Start YYX at -YYN if negative to avoid negative indexes in
-	 YYCHECK.  */
-      int yyxbegin = yyn < 0 ? -yyn : 0;
-
-      /* Stay within bounds of both yycheck and yytname.  */
-      int yychecklim = YYLAST - yyn + 1;
-      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-      int yycount = 1;
-
-      yyarg[0] = yytname[yytype];
-      yyfmt = yystpcpy (yyformat, yyunexpected);
-
-      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-	if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-	  {
-	    if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-	      {
-		yycount = 1;
-		yysize = yysize0;
-		yyformat[sizeof yyunexpected - 1] = '\0';
-		break;
-	      }
-	    yyarg[yycount++] = yytname[yyx];
-	    yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-	    yysize_overflow |= (yysize1 < yysize);
-	    yysize = yysize1;
-	    yyfmt = yystpcpy (yyfmt, yyprefix);
-	    yyprefix = yyor;
-	  }
-
-      yyf = YY_(yyformat);
-      yysize1 = yysize + yystrlen (yyf);
-      yysize_overflow |= (yysize1 < yysize);
-      yysize = yysize1;
-
-      if (yysize_overflow)
-	return YYSIZE_MAXIMUM;
-
-      if (yyresult)
-	{
-	  /* Avoid sprintf, as that infringes on the user's name space.
-	     Don't have undefined behavior even if the translation
-	     produced a string with the wrong number of "%s"s.  */
-	  char *yyp = yyresult;
-	  int yyi = 0;
-	  while ((*yyp = *yyf) != '\0')
-	    {
-	      if (*yyp == '%' && yyf[1] == 's' && yyi < yycount)
-		{
-		  yyp += yytnamerr (yyp, yyarg[yyi++]);
-		  yyf += 2;
-		}
-	      else
-		{
-		  yyp++;
-		  yyf++;
-		}
-	    }
-	}
-      return yysize;
-    }
-}
-#endif /* YYERROR_VERBOSE */
-
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, void *parserPtr)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
+  YY_USE (parserPtr);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
-
-
-/* Prevent warnings from -Wmissing-prototypes.  */
-
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
 
 
@@ -3263,208 +2980,193 @@ int yyparse ();
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
-yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
+yyparse (void *parserPtr)
 {
-  /* The look-ahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
-/* The semantic value of the look-ahead symbol.  */
-YYSTYPE yylval;
-
-/* Number of syntax errors so far.  */
-int yynerrs;
-
-  int yystate;
-  int yyn;
-  int yyresult;
-  /* Number of tokens to shift before error messages enabled.  */
-  int yyerrstatus;
-  /* Look-ahead token as an internal (translated) token number.  */
-  int yytoken = 0;
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
-
-  /* Three stacks and their tools:
-     `yyss': related to states,
-     `yyvs': related to semantic values,
-     `yyls': related to locations.
 
-     Refer to the stacks thru separate pointers, to allow yyoverflow
-     to reallocate them elsewhere.  */
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
-  /* The state stack.  */
-  yytype_int16 yyssa[YYINITDEPTH];
-  yytype_int16 *yyss = yyssa;
-  yytype_int16 *yyssp;
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
 
-  /* The semantic value stack.  */
-  YYSTYPE yyvsa[YYINITDEPTH];
-  YYSTYPE *yyvs = yyvsa;
-  YYSTYPE *yyvsp;
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-  YYSIZE_T yystacksize = YYINITDEPTH;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
 
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
   /* The number of symbols on the RHS of the reduced rule.
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
-
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-
-  yyssp = yyss;
-  yyvsp = yyvs;
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss);
-	YYSTACK_RELOCATE (yyvs);
-
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
-     look-ahead token if we need one and don't already have one.  */
+     lookahead token if we need one and don't already have one.  */
 
-  /* First try to decide what to do without reference to look-ahead token.  */
+  /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYPACT_NINF)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
-  /* Not known => get a look-ahead token if don't already have one.  */
+  /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid look-ahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, parserPtr);
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -3479,30 +3181,26 @@ yybackup:
   yyn = yytable[yyn];
   if (yyn <= 0)
     {
-      if (yyn == 0 || yyn == YYTABLE_NINF)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
   /* Count tokens shifted since error; after three, turn off error
      status.  */
   if (yyerrstatus)
     yyerrstatus--;
 
-  /* Shift the look-ahead token.  */
+  /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -3517,14 +3215,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -3537,40 +3235,44 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
+  case 2: /* mibFile: modules  */
 #line 1599 "parser-smi.y"
     {
         (yyval.err) = 0;
-    ;}
+    }
+#line 3244 "parser-smi.c"
     break;
 
-  case 3:
+  case 3: /* mibFile: %empty  */
 #line 1603 "parser-smi.y"
     {
 	(yyval.err) = 0;
-    ;}
+    }
+#line 3252 "parser-smi.c"
     break;
 
-  case 4:
+  case 4: /* modules: module  */
 #line 1609 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+                        { (yyval.err) = 0; }
+#line 3258 "parser-smi.c"
     break;
 
-  case 5:
+  case 5: /* modules: modules module  */
 #line 1611 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+                        { (yyval.err) = 0; }
+#line 3264 "parser-smi.c"
     break;
 
-  case 6:
+  case 6: /* $@1: %empty  */
 #line 1619 "parser-smi.y"
-    {
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_MODULE;
 			    
-			    thisParserPtr->modulePtr = findModuleByName((yyvsp[(1) - (1)].id));
+			    thisParserPtr->modulePtr = findModuleByName((yyvsp[0].id));
 			    if (!thisParserPtr->modulePtr) {
 				thisParserPtr->modulePtr =
-				    addModule((yyvsp[(1) - (1)].id),
+				    addModule((yyvsp[0].id),
 					      smiStrdup(thisParserPtr->path),
 					      0,
 					      thisParserPtr);
@@ -3580,7 +3282,7 @@ yyreduce:
 				    numStatements = 0;
 				thisParserPtr->modulePtr->
 				    numModuleIdentities = 0;
-				if (!strcmp((yyvsp[(1) - (1)].id), "SNMPv2-SMI")) {
+				if (!strcmp((yyvsp[0].id), "SNMPv2-SMI")) {
 			            /*
 				     * SNMPv2-SMI is an SMIv2 module
 				     * that cannot be identified by
@@ -3592,19 +3294,20 @@ yyreduce:
 			    } else {
 			        smiPrintError(thisParserPtr,
 					      ERR_MODULE_ALREADY_LOADED,
-					      (yyvsp[(1) - (1)].id));
+					      (yyvsp[0].id));
 				/*
 				 * this aborts parsing the whole file,
 				 * not only the current module.
 				 */
 				YYABORT;
 			    }
-			;}
+			}
+#line 3306 "parser-smi.c"
     break;
 
-  case 7:
+  case 7: /* module: moduleName $@1 moduleOid definitions COLON_COLON_EQUAL BEGIN_ exportsClause linkagePart declarationPart END  */
 #line 1663 "parser-smi.y"
-    {
+                        {
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_UNKNOWN)
 				thisModulePtr->export.language = SMI_LANGUAGE_SMIV1;
 			    checkModuleName(thisParserPtr, thisModulePtr);
@@ -3612,50 +3315,58 @@ yyreduce:
 			    checkObjects(thisParserPtr, thisModulePtr);
 			    checkTypes(thisParserPtr, thisModulePtr);
 			    checkDefvals(thisParserPtr, thisModulePtr);
+			    resolveImports(thisParserPtr);
 			    checkImportsUsage(thisParserPtr, thisModulePtr);
 			    smiCheckTypeUsage(thisParserPtr, thisModulePtr);
 			    
 			    thisParserPtr->capabilitiesModulePtr = NULL;
 
                             (yyval.err) = 0;
-			;}
+			}
+#line 3327 "parser-smi.c"
     break;
 
-  case 8:
-#line 1681 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 8: /* moduleOid: '{' objectIdentifier '}'  */
+#line 1682 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3333 "parser-smi.c"
     break;
 
-  case 9:
-#line 1683 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 9: /* moduleOid: %empty  */
+#line 1684 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3339 "parser-smi.c"
     break;
 
-  case 10:
-#line 1687 "parser-smi.y"
-    { ;}
+  case 10: /* definitions: DEFINITIONS  */
+#line 1688 "parser-smi.y"
+                        { }
+#line 3345 "parser-smi.c"
     break;
 
-  case 11:
-#line 1689 "parser-smi.y"
-    {
+  case 11: /* definitions: PIB_DEFINITIONS  */
+#line 1690 "parser-smi.y"
+                        {
                             thisModulePtr->export.language = SMI_LANGUAGE_SPPI;
-                        ;}
+                        }
+#line 3353 "parser-smi.c"
     break;
 
-  case 12:
-#line 1698 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 12: /* linkagePart: linkageClause  */
+#line 1699 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3359 "parser-smi.c"
     break;
 
-  case 13:
-#line 1700 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 13: /* linkagePart: %empty  */
+#line 1701 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3365 "parser-smi.c"
     break;
 
-  case 14:
-#line 1704 "parser-smi.y"
-    {
+  case 14: /* linkageClause: IMPORTS importPart ';'  */
+#line 1705 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_MODULE;
 
@@ -3664,17 +3375,19 @@ yyreduce:
 				thisModulePtr->export.language = SMI_LANGUAGE_SMIV1;
 			    
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3380 "parser-smi.c"
     break;
 
-  case 15:
-#line 1718 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 15: /* exportsClause: %empty  */
+#line 1719 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3386 "parser-smi.c"
     break;
 
-  case 16:
-#line 1720 "parser-smi.y"
-    {
+  case 16: /* $@2: %empty  */
+#line 1721 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language ==
                                  SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SMI_CONSTRUCT_IN_PIB, "EXPORTS");
@@ -3688,52 +3401,57 @@ yyreduce:
 				       "RFC1065-SMI")) {
 			        smiPrintError(thisParserPtr, ERR_EXPORTS);
 			    }
-			;}
+			}
+#line 3406 "parser-smi.c"
     break;
 
-  case 17:
-#line 1737 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 17: /* exportsClause: EXPORTS $@2 ';'  */
+#line 1738 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3412 "parser-smi.c"
     break;
 
-  case 18:
-#line 1741 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 18: /* importPart: imports  */
+#line 1742 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3418 "parser-smi.c"
     break;
 
-  case 19:
-#line 1743 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 19: /* importPart: %empty  */
+#line 1744 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3424 "parser-smi.c"
     break;
 
-  case 20:
-#line 1748 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 20: /* imports: import  */
+#line 1749 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3430 "parser-smi.c"
     break;
 
-  case 21:
-#line 1750 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 21: /* imports: imports import  */
+#line 1751 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3436 "parser-smi.c"
     break;
 
-  case 22:
-#line 1756 "parser-smi.y"
-    {
+  case 22: /* import: importIdentifiers FROM moduleName  */
+#line 1757 "parser-smi.y"
+                        {
 			    Import      *importPtr;
 			    Module      *modulePtr;
                             
 			    /*
-			     * Recursively call the parser to suffer
-			     * the IMPORTS, if the module is not yet
-			     * loaded.
+			     * Record the module of the imported
+			     * identifiers. It has been loaded before
+			     * this one, unless it is part of an import
+			     * cycle. The identifiers are resolved when
+			     * they are used or at the end of the module.
 			     */
-			    modulePtr = findModuleByName((yyvsp[(3) - (3)].id));
-			    if (!modulePtr) {
-				modulePtr = loadModule((yyvsp[(3) - (3)].id), thisParserPtr);
-			    }
-			    checkImports(modulePtr, thisParserPtr);
+			    recordImports((yyvsp[0].id), thisParserPtr);
+			    modulePtr = requireModule((yyvsp[0].id), thisParserPtr);
 
-			    if (modulePtr && !strcmp((yyvsp[(3) - (3)].id), "SNMPv2-SMI")) {
+			    if (modulePtr && !strcmp((yyvsp[0].id), "SNMPv2-SMI")) {
 			        /*
 				 * A module that imports a macro or
 				 * type definition from SNMPv2-SMI
@@ -3746,9 +3464,11 @@ yyreduce:
 				         importPtr;
 				         importPtr = importPtr->nextPtr) {
 				        if ((!strcmp(importPtr->export.module,
-						     (yyvsp[(3) - (3)].id))) &&
-					    ((importPtr->kind == KIND_MACRO) ||
-					     (importPtr->kind == KIND_TYPE))) {
+						     (yyvsp[0].id))) &&
+					    (findMacroByModuleAndName(modulePtr,
+						importPtr->export.name) ||
+					     findTypeByModuleAndName(modulePtr,
+						importPtr->export.name))) {
 					    thisModulePtr->export.language =
 					        SMI_LANGUAGE_SMIV2;
 				        }
@@ -3756,222 +3476,249 @@ yyreduce:
                                 }
 			    }
 
-			    smiFree((yyvsp[(3) - (3)].id));
-			;}
+			    smiFree((yyvsp[0].id));
+			}
+#line 3482 "parser-smi.c"
     break;
 
-  case 23:
-#line 1799 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 23: /* importIdentifiers: importIdentifier  */
+#line 1801 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3488 "parser-smi.c"
     break;
 
-  case 24:
-#line 1802 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 24: /* importIdentifiers: importIdentifiers ',' importIdentifier  */
+#line 1804 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3494 "parser-smi.c"
     break;
 
-  case 25:
-#line 1809 "parser-smi.y"
-    {
-			    addImport((yyvsp[(1) - (1)].id), thisParserPtr);
+  case 25: /* importIdentifier: LOWERCASE_IDENTIFIER  */
+#line 1811 "parser-smi.y"
+                        {
+			    addImport((yyvsp[0].id), thisParserPtr);
 			    thisParserPtr->modulePtr->numImportedIdentifiers++;
 			    (yyval.id) = 0;
-			;}
+			}
+#line 3504 "parser-smi.c"
     break;
 
-  case 26:
-#line 1815 "parser-smi.y"
-    {
-			    addImport((yyvsp[(1) - (1)].id), thisParserPtr);
+  case 26: /* importIdentifier: UPPERCASE_IDENTIFIER  */
+#line 1817 "parser-smi.y"
+                        {
+			    addImport((yyvsp[0].id), thisParserPtr);
 			    thisParserPtr->modulePtr->numImportedIdentifiers++;
 			    (yyval.id) = 0;
-			;}
+			}
+#line 3514 "parser-smi.c"
     break;
 
-  case 27:
-#line 1821 "parser-smi.y"
-    {
-			    addImport(smiStrdup((yyvsp[(1) - (1)].id)), thisParserPtr);
+  case 27: /* importIdentifier: importedKeyword  */
+#line 1823 "parser-smi.y"
+                        {
+			    addImport(smiStrdup((yyvsp[0].id)), thisParserPtr);
 			    thisParserPtr->modulePtr->numImportedIdentifiers++;
 			    (yyval.id) = 0;
-			;}
+			}
+#line 3524 "parser-smi.c"
     break;
 
-  case 28:
-#line 1837 "parser-smi.y"
-    {
+  case 28: /* importedKeyword: importedSMIKeyword  */
+#line 1839 "parser-smi.y"
+                        {
                             /*
                              * There are PIBs that import e.g. Counter64 - so
                              * don't complain here about SMI keywords.
                              */
                            /* if (thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI)
                               smiPrintError(thisParserPtr, ERR_SMI_CONSTRUCT_IN_PIB, $1);*/
-                            (yyval.id) = (yyvsp[(1) - (1)].id);
-                        ;}
+                            (yyval.id) = (yyvsp[0].id);
+                        }
+#line 3538 "parser-smi.c"
     break;
 
-  case 29:
-#line 1847 "parser-smi.y"
-    {
+  case 29: /* importedKeyword: importedSPPIKeyword  */
+#line 1849 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI)
-				smiPrintError(thisParserPtr, ERR_SPPI_TYPE_IN_MIB, (yyvsp[(1) - (1)].id));
-                            (yyval.id) = (yyvsp[(1) - (1)].id);
-                        ;}
+				smiPrintError(thisParserPtr, ERR_SPPI_TYPE_IN_MIB, (yyvsp[0].id));
+                            (yyval.id) = (yyvsp[0].id);
+                        }
+#line 3548 "parser-smi.c"
     break;
 
-  case 52:
-#line 1881 "parser-smi.y"
-    {
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+  case 52: /* moduleName: UPPERCASE_IDENTIFIER  */
+#line 1883 "parser-smi.y"
+                        {
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_MODULENAME_32, ERR_MODULENAME_64);
-			    (yyval.id) = (yyvsp[(1) - (1)].id);
-			;}
+			    (yyval.id) = (yyvsp[0].id);
+			}
+#line 3558 "parser-smi.c"
     break;
 
-  case 53:
-#line 1893 "parser-smi.y"
-    { (yyval.err) = 0; ;}
-    break;
-
-  case 54:
+  case 53: /* declarationPart: declarations  */
 #line 1895 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+                        { (yyval.err) = 0; }
+#line 3564 "parser-smi.c"
     break;
 
-  case 55:
-#line 1900 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 54: /* declarationPart: %empty  */
+#line 1897 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3570 "parser-smi.c"
     break;
 
-  case 56:
+  case 55: /* declarations: declaration  */
 #line 1902 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+                        { (yyval.err) = 0; }
+#line 3576 "parser-smi.c"
+    break;
+
+  case 56: /* declarations: declarations declaration  */
+#line 1904 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 3582 "parser-smi.c"
     break;
 
-  case 57:
-#line 1906 "parser-smi.y"
-    { 
+  case 57: /* declaration: typeDeclaration  */
+#line 1908 "parser-smi.y"
+                        { 
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3591 "parser-smi.c"
     break;
 
-  case 58:
-#line 1911 "parser-smi.y"
-    { 
+  case 58: /* declaration: valueDeclaration  */
+#line 1913 "parser-smi.y"
+                        { 
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3600 "parser-smi.c"
     break;
 
-  case 59:
-#line 1916 "parser-smi.y"
-    { 
+  case 59: /* declaration: objectIdentityClause  */
+#line 1918 "parser-smi.y"
+                        { 
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3609 "parser-smi.c"
     break;
 
-  case 60:
-#line 1921 "parser-smi.y"
-    { 
+  case 60: /* declaration: objectTypeClause  */
+#line 1923 "parser-smi.y"
+                        { 
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3618 "parser-smi.c"
     break;
 
-  case 61:
-#line 1926 "parser-smi.y"
-    { 
+  case 61: /* declaration: trapTypeClause  */
+#line 1928 "parser-smi.y"
+                        { 
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3627 "parser-smi.c"
     break;
 
-  case 62:
-#line 1931 "parser-smi.y"
-    { 
+  case 62: /* declaration: notificationTypeClause  */
+#line 1933 "parser-smi.y"
+                        { 
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3636 "parser-smi.c"
     break;
 
-  case 63:
-#line 1936 "parser-smi.y"
-    { 
+  case 63: /* declaration: moduleIdentityClause  */
+#line 1938 "parser-smi.y"
+                        { 
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3645 "parser-smi.c"
     break;
 
-  case 64:
-#line 1941 "parser-smi.y"
-    { 
+  case 64: /* declaration: moduleComplianceClause  */
+#line 1943 "parser-smi.y"
+                        { 
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3654 "parser-smi.c"
     break;
 
-  case 65:
-#line 1946 "parser-smi.y"
-    { 
+  case 65: /* declaration: objectGroupClause  */
+#line 1948 "parser-smi.y"
+                        { 
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3663 "parser-smi.c"
     break;
 
-  case 66:
-#line 1951 "parser-smi.y"
-    {
+  case 66: /* declaration: notificationGroupClause  */
+#line 1953 "parser-smi.y"
+                        {
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3672 "parser-smi.c"
     break;
 
-  case 67:
-#line 1956 "parser-smi.y"
-    { 
+  case 67: /* declaration: agentCapabilitiesClause  */
+#line 1958 "parser-smi.y"
+                        { 
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3681 "parser-smi.c"
     break;
 
-  case 68:
-#line 1961 "parser-smi.y"
-    { 
+  case 68: /* declaration: macroClause  */
+#line 1963 "parser-smi.y"
+                        { 
 			    thisParserPtr->modulePtr->numStatements++;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3690 "parser-smi.c"
     break;
 
-  case 69:
-#line 1966 "parser-smi.y"
-    {
+  case 69: /* declaration: error '}'  */
+#line 1968 "parser-smi.y"
+                        {
 			    smiPrintError(thisParserPtr,
 					  ERR_FLUSH_DECLARATION);
 			    yyerrok;
 			    (yyval.err) = 1;
-			;}
+			}
+#line 3701 "parser-smi.c"
     break;
 
-  case 70:
-#line 1980 "parser-smi.y"
-    {
+  case 70: /* $@3: %empty  */
+#line 1982 "parser-smi.y"
+                        {
 			    Macro *macroPtr;
 
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_MACRO;
 
-			    macroPtr = addMacro(smiStrdup((yyvsp[(1) - (1)].id)),
+			    macroPtr = addMacro(smiStrdup((yyvsp[0].id)),
 						0, thisParserPtr);
 			    setMacroLine(macroPtr, thisParserPtr->firstStatementLine,
 					 thisParserPtr);
-			;}
+			}
+#line 3717 "parser-smi.c"
     break;
 
-  case 71:
-#line 1992 "parser-smi.y"
-    {
+  case 71: /* $@4: %empty  */
+#line 1994 "parser-smi.y"
+                        {
 			    /*
 			     * ASN.1 macros are known to be in these
 			     * modules.
@@ -3996,69 +3743,81 @@ yyreduce:
                                        "COPS-PR-SPPI-TC")) {
 			        smiPrintError(thisParserPtr, ERR_MACRO);
 			    }
-			;}
+			}
+#line 3748 "parser-smi.c"
     break;
 
-  case 72:
-#line 2020 "parser-smi.y"
-    {
+  case 72: /* macroClause: macroName $@3 MACRO $@4 END  */
+#line 2022 "parser-smi.y"
+                        {
 			    (yyval.err) = 0;
-                        ;}
-    break;
-
-  case 73:
-#line 2025 "parser-smi.y"
-    { (yyval.id) = (yyvsp[(1) - (1)].id); ;}
-    break;
-
-  case 74:
-#line 2026 "parser-smi.y"
-    { (yyval.id) = (yyvsp[(1) - (1)].id); ;}
+                        }
+#line 3756 "parser-smi.c"
     break;
 
-  case 75:
+  case 73: /* macroName: MODULE_IDENTITY  */
 #line 2027 "parser-smi.y"
-    { (yyval.id) = (yyvsp[(1) - (1)].id); ;}
+                                            { (yyval.id) = (yyvsp[0].id); }
+#line 3762 "parser-smi.c"
     break;
 
-  case 76:
+  case 74: /* macroName: OBJECT_TYPE  */
 #line 2028 "parser-smi.y"
-    { (yyval.id) = (yyvsp[(1) - (1)].id); ;}
+                                            { (yyval.id) = (yyvsp[0].id); }
+#line 3768 "parser-smi.c"
     break;
 
-  case 77:
+  case 75: /* macroName: TRAP_TYPE  */
 #line 2029 "parser-smi.y"
-    { (yyval.id) = (yyvsp[(1) - (1)].id); ;}
+                                            { (yyval.id) = (yyvsp[0].id); }
+#line 3774 "parser-smi.c"
     break;
 
-  case 78:
+  case 76: /* macroName: NOTIFICATION_TYPE  */
 #line 2030 "parser-smi.y"
-    { (yyval.id) = (yyvsp[(1) - (1)].id); ;}
+                                            { (yyval.id) = (yyvsp[0].id); }
+#line 3780 "parser-smi.c"
     break;
 
-  case 79:
+  case 77: /* macroName: OBJECT_IDENTITY  */
 #line 2031 "parser-smi.y"
-    { (yyval.id) = (yyvsp[(1) - (1)].id); ;}
+                                            { (yyval.id) = (yyvsp[0].id); }
+#line 3786 "parser-smi.c"
     break;
 
-  case 80:
+  case 78: /* macroName: TEXTUAL_CONVENTION  */
 #line 2032 "parser-smi.y"
-    { (yyval.id) = (yyvsp[(1) - (1)].id); ;}
+                                            { (yyval.id) = (yyvsp[0].id); }
+#line 3792 "parser-smi.c"
     break;
 
-  case 81:
+  case 79: /* macroName: OBJECT_GROUP  */
 #line 2033 "parser-smi.y"
-    { (yyval.id) = (yyvsp[(1) - (1)].id); ;}
+                                            { (yyval.id) = (yyvsp[0].id); }
+#line 3798 "parser-smi.c"
     break;
 
-  case 82:
+  case 80: /* macroName: NOTIFICATION_GROUP  */
 #line 2034 "parser-smi.y"
-    { (yyval.id) = (yyvsp[(1) - (1)].id); ;}
+                                            { (yyval.id) = (yyvsp[0].id); }
+#line 3804 "parser-smi.c"
     break;
 
-  case 83:
-#line 2038 "parser-smi.y"
-    {
+  case 81: /* macroName: MODULE_COMPLIANCE  */
+#line 2035 "parser-smi.y"
+                                            { (yyval.id) = (yyvsp[0].id); }
+#line 3810 "parser-smi.c"
+    break;
+
+  case 82: /* macroName: AGENT_CAPABILITIES  */
+#line 2036 "parser-smi.y"
+                                            { (yyval.id) = (yyvsp[0].id); }
+#line 3816 "parser-smi.c"
+    break;
+
+  case 83: /* $@5: %empty  */
+#line 2040 "parser-smi.y"
+                        {
 			    if (strcmp(thisParserPtr->modulePtr->export.name,
 				       "SNMPv2-SMI") &&
 			        strcmp(thisParserPtr->modulePtr->export.name,
@@ -4075,104 +3834,111 @@ yyreduce:
                                        "COPS-PR-SPPI")) {
 			        smiPrintError(thisParserPtr, ERR_CHOICE);
 			    }
-			;}
+			}
+#line 3839 "parser-smi.c"
     break;
 
-  case 84:
-#line 2058 "parser-smi.y"
-    {
+  case 84: /* choiceClause: CHOICE $@5 '}'  */
+#line 2060 "parser-smi.y"
+                        {
 			    (yyval.typePtr) = addType(NULL, SMI_BASETYPE_UNKNOWN, 0,
 					 thisParserPtr);
-			;}
+			}
+#line 3848 "parser-smi.c"
     break;
 
-  case 85:
-#line 2068 "parser-smi.y"
-    {
-			  (yyval.id) = (yyvsp[(1) - (1)].id);
-			;}
+  case 85: /* fuzzy_lowercase_identifier: LOWERCASE_IDENTIFIER  */
+#line 2070 "parser-smi.y"
+                        {
+			  (yyval.id) = (yyvsp[0].id);
+			}
+#line 3856 "parser-smi.c"
     break;
 
-  case 86:
-#line 2073 "parser-smi.y"
-    {
+  case 86: /* fuzzy_lowercase_identifier: UPPERCASE_IDENTIFIER  */
+#line 2075 "parser-smi.y"
+                        {
 			    smiPrintError (thisParserPtr,
 					   ERR_BAD_LOWER_IDENTIFIER_CASE,
-					   (yyvsp[(1) - (1)].id));
+					   (yyvsp[0].id));
 			    /* xxx
 			    if ((thisParserPtr->flags & SMI_FLAG_BE_LAX) == 0) {
 			        YYERROR;
 			    }
 			    */
-			  (yyval.id) = (yyvsp[(1) - (1)].id);
-			;}
+			  (yyval.id) = (yyvsp[0].id);
+			}
+#line 3872 "parser-smi.c"
     break;
 
-  case 87:
-#line 2088 "parser-smi.y"
-    {
+  case 87: /* $@6: %empty  */
+#line 2090 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_VALUEASSIGNMENT;
 
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_OIDNAME_32, ERR_OIDNAME_64);
 			    smiCheckObjectName(thisParserPtr,
-					       thisModulePtr, (yyvsp[(1) - (1)].id));
+					       thisModulePtr, (yyvsp[0].id));
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_SMIV2)
 			    {
-			        if (strchr((yyvsp[(1) - (1)].id), '-') &&
-				    (strcmp((yyvsp[(1) - (1)].id), "mib-2") ||
+			        if (strchr((yyvsp[0].id), '-') &&
+				    (strcmp((yyvsp[0].id), "mib-2") ||
 				  strcmp(thisModulePtr->export.name, "SNMPv2-SMI"))) {
 				    smiPrintError(thisParserPtr,
 						  ERR_OIDNAME_INCLUDES_HYPHEN,
-						  (yyvsp[(1) - (1)].id));
+						  (yyvsp[0].id));
 				}
 			    }
-			;}
+			}
+#line 3896 "parser-smi.c"
     break;
 
-  case 88:
-#line 2109 "parser-smi.y"
-    {
+  case 88: /* valueDeclaration: fuzzy_lowercase_identifier $@6 OBJECT IDENTIFIER COLON_COLON_EQUAL '{' objectIdentifier '}'  */
+#line 2111 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    
-			    objectPtr = (yyvsp[(7) - (8)].objectPtr);
-			    smiCheckObjectReuse(thisParserPtr, (yyvsp[(1) - (8)].id), &objectPtr);
-			    objectPtr = setObjectName(objectPtr, (yyvsp[(1) - (8)].id), thisParserPtr);
+			    objectPtr = (yyvsp[-1].objectPtr);
+			    smiCheckObjectReuse(thisParserPtr, (yyvsp[-7].id), &objectPtr);
+			    objectPtr = setObjectName(objectPtr, (yyvsp[-7].id), thisParserPtr);
 			    deleteObjectFlags(objectPtr, FLAG_INCOMPLETE);
 			    setObjectLine(objectPtr, thisParserPtr->firstStatementLine,
 					  thisParserPtr);
 			    setObjectDecl(objectPtr,
 					  SMI_DECL_VALUEASSIGNMENT);
 			    (yyval.err) = 0;
-			;}
+			}
+#line 3914 "parser-smi.c"
     break;
 
-  case 89:
-#line 2128 "parser-smi.y"
-    {
+  case 89: /* $@7: %empty  */
+#line 2130 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_TYPEASSIGNMENT;
 
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_TYPENAME_32, ERR_TYPENAME_64);
-			;}
+			}
+#line 3926 "parser-smi.c"
     break;
 
-  case 90:
-#line 2136 "parser-smi.y"
-    {
+  case 90: /* typeDeclaration: typeName $@7 COLON_COLON_EQUAL typeDeclarationRHS  */
+#line 2138 "parser-smi.y"
+                        {
 			    Type *typePtr;
 			    
-			    if (strlen((yyvsp[(1) - (4)].id))) {
-				if ((yyvsp[(4) - (4)].typePtr)->export.basetype != SMI_BASETYPE_UNKNOWN) {
+			    if (strlen((yyvsp[-3].id))) {
+				if ((yyvsp[0].typePtr)->export.basetype != SMI_BASETYPE_UNKNOWN) {
 				    smiCheckTypeName(thisParserPtr,
-						     thisModulePtr, (yyvsp[(1) - (4)].id),
+						     thisModulePtr, (yyvsp[-3].id),
 						     thisParserPtr->firstStatementLine);
 				}
-				setTypeLine((yyvsp[(4) - (4)].typePtr), thisParserPtr->firstStatementLine,
+				setTypeLine((yyvsp[0].typePtr), thisParserPtr->firstStatementLine,
 					    thisParserPtr);
-				setTypeName((yyvsp[(4) - (4)].typePtr), (yyvsp[(1) - (4)].id));
+				setTypeName((yyvsp[0].typePtr), (yyvsp[-3].id));
 				(yyval.err) = 0;
 			    } else {
 				(yyval.err) = 0;
@@ -4185,150 +3951,152 @@ yyreduce:
 			     */
 			    if (thisModulePtr &&
 				(!strcmp(thisModulePtr->export.name, "SNMPv2-SMI"))) {
-				if (!strcmp((yyvsp[(1) - (4)].id), "Counter32")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeUnsigned32Ptr);
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
+				if (!strcmp((yyvsp[-3].id), "Counter32")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeUnsigned32Ptr);
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
 				    }
-				} else if (!strcmp((yyvsp[(1) - (4)].id), "Gauge32")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeUnsigned32Ptr);
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
+				} else if (!strcmp((yyvsp[-3].id), "Gauge32")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeUnsigned32Ptr);
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
 				    }
-				} else if (!strcmp((yyvsp[(1) - (4)].id), "Unsigned32")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeUnsigned32Ptr);
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
+				} else if (!strcmp((yyvsp[-3].id), "Unsigned32")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeUnsigned32Ptr);
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
 				    }
-				} else if (!strcmp((yyvsp[(1) - (4)].id), "TimeTicks")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeUnsigned32Ptr);
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
+				} else if (!strcmp((yyvsp[-3].id), "TimeTicks")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeUnsigned32Ptr);
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
 				    }
-				} else if (!strcmp((yyvsp[(1) - (4)].id), "Counter64")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED64;
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED64;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.unsigned64 = 0;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED64;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned64 = SMI_BASETYPE_UNSIGNED64_MAX;
+				} else if (!strcmp((yyvsp[-3].id), "Counter64")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED64;
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED64;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.unsigned64 = 0;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED64;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned64 = SMI_BASETYPE_UNSIGNED64_MAX;
 				    }
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeUnsigned64Ptr);
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeUnsigned64Ptr);
 				}
 			    }
 			    if (thisModulePtr &&
 				(!strcmp(thisModulePtr->export.name, "RFC1155-SMI") ||
 				 !strcmp(thisModulePtr->export.name, "RFC1065-SMI"))) {
-				if (!strcmp((yyvsp[(1) - (4)].id), "Counter")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeUnsigned32Ptr);
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
+				if (!strcmp((yyvsp[-3].id), "Counter")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeUnsigned32Ptr);
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
 				    }
-				} else if (!strcmp((yyvsp[(1) - (4)].id), "Gauge")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeUnsigned32Ptr);
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
+				} else if (!strcmp((yyvsp[-3].id), "Gauge")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeUnsigned32Ptr);
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
 				    }
-				} else if (!strcmp((yyvsp[(1) - (4)].id), "TimeTicks")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeUnsigned32Ptr);
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
+				} else if (!strcmp((yyvsp[-3].id), "TimeTicks")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeUnsigned32Ptr);
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
 				    }
-				} else if (!strcmp((yyvsp[(1) - (4)].id), "NetworkAddress")) {
-				    setTypeName((yyvsp[(4) - (4)].typePtr), smiStrdup("NetworkAddress"));
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_OCTETSTRING;
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), findTypeByModuleAndName(
+				} else if (!strcmp((yyvsp[-3].id), "NetworkAddress")) {
+				    setTypeName((yyvsp[0].typePtr), smiStrdup("NetworkAddress"));
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_OCTETSTRING;
+				    setTypeParent((yyvsp[0].typePtr), findTypeByModuleAndName(
 					                   thisModulePtr,
 						           "IpAddress"));
-				} else if (!strcmp((yyvsp[(1) - (4)].id), "IpAddress")) {
+				} else if (!strcmp((yyvsp[-3].id), "IpAddress")) {
 				    typePtr = findTypeByModuleAndName(
 					thisModulePtr, "NetworkAddress");
 				    if (typePtr) 
-					setTypeParent(typePtr, (yyvsp[(4) - (4)].typePtr));
+					setTypeParent(typePtr, (yyvsp[0].typePtr));
 				}
 			    }
 			    if (thisModulePtr &&
 				(!strcmp(thisModulePtr->export.name, "COPS-PR-SPPI"))) {
-				if (!strcmp((yyvsp[(1) - (4)].id), "Unsigned32")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeUnsigned32Ptr);
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
+				if (!strcmp((yyvsp[-3].id), "Unsigned32")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeUnsigned32Ptr);
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
 				    }
-				} else if (!strcmp((yyvsp[(1) - (4)].id), "TimeTicks")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeUnsigned32Ptr);
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
+				} else if (!strcmp((yyvsp[-3].id), "TimeTicks")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED32;
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeUnsigned32Ptr);
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.unsigned32 = 0;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED32;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned32 = 4294967295U;
 				    }
-				} else if (!strcmp((yyvsp[(1) - (4)].id), "Unsigned64")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED64;
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED64;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.unsigned64 = 0;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED64;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned64 = SMI_BASETYPE_UNSIGNED64_MAX;
+				} else if (!strcmp((yyvsp[-3].id), "Unsigned64")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_UNSIGNED64;
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_UNSIGNED64;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.unsigned64 = 0;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_UNSIGNED64;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.unsigned64 = SMI_BASETYPE_UNSIGNED64_MAX;
 				    }
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeUnsigned64Ptr);
-				} else if (!strcmp((yyvsp[(1) - (4)].id), "Integer64")) {
-				    (yyvsp[(4) - (4)].typePtr)->export.basetype = SMI_BASETYPE_INTEGER64;
-				    if ((yyvsp[(4) - (4)].typePtr)->listPtr) {
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_INTEGER64;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.minValue.value.integer64 = SMI_BASETYPE_INTEGER64_MIN;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_INTEGER64;
-					((Range *)(yyvsp[(4) - (4)].typePtr)->listPtr->ptr)->export.maxValue.value.integer64 = SMI_BASETYPE_INTEGER64_MAX;
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeUnsigned64Ptr);
+				} else if (!strcmp((yyvsp[-3].id), "Integer64")) {
+				    (yyvsp[0].typePtr)->export.basetype = SMI_BASETYPE_INTEGER64;
+				    if ((yyvsp[0].typePtr)->listPtr) {
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.basetype = SMI_BASETYPE_INTEGER64;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.minValue.value.integer64 = SMI_BASETYPE_INTEGER64_MIN;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.basetype = SMI_BASETYPE_INTEGER64;
+					((Range *)(yyvsp[0].typePtr)->listPtr->ptr)->export.maxValue.value.integer64 = SMI_BASETYPE_INTEGER64_MAX;
 				    }
-				    setTypeParent((yyvsp[(4) - (4)].typePtr), smiHandle->typeInteger64Ptr);
+				    setTypeParent((yyvsp[0].typePtr), smiHandle->typeInteger64Ptr);
 				}
 			    }
-			;}
+			}
+#line 4086 "parser-smi.c"
     break;
 
-  case 91:
-#line 2294 "parser-smi.y"
-    {
-			    (yyval.id) = (yyvsp[(1) - (1)].id);
-			;}
+  case 91: /* typeName: UPPERCASE_IDENTIFIER  */
+#line 2296 "parser-smi.y"
+                        {
+			    (yyval.id) = (yyvsp[0].id);
+			}
+#line 4094 "parser-smi.c"
     break;
 
-  case 92:
-#line 2298 "parser-smi.y"
-    {
-			    (yyval.id) = smiStrdup((yyvsp[(1) - (1)].id));
+  case 92: /* typeName: typeSMI  */
+#line 2300 "parser-smi.y"
+                        {
+			    (yyval.id) = smiStrdup((yyvsp[0].id));
 			    /*
 			     * well known types (keywords in this grammar)
 			     * are known to be defined in these modules.
@@ -4347,15 +4115,16 @@ yyreduce:
 				       "RFC1155-SMI") &&
 				strcmp(thisParserPtr->modulePtr->export.name,
 				       "COPS-PR-SPPI")) {
-			        smiPrintError(thisParserPtr, ERR_TYPE_SMI_OR_SPPI, (yyvsp[(1) - (1)].id));
+			        smiPrintError(thisParserPtr, ERR_TYPE_SMI_OR_SPPI, (yyvsp[0].id));
 			    }
-			;}
+			}
+#line 4122 "parser-smi.c"
     break;
 
-  case 93:
-#line 2322 "parser-smi.y"
-    {
-			    (yyval.id) = smiStrdup((yyvsp[(1) - (1)].id));
+  case 93: /* typeName: typeSPPIonly  */
+#line 2324 "parser-smi.y"
+                        {
+			    (yyval.id) = smiStrdup((yyvsp[0].id));
 			    /*
 			     * well known types (keywords in this grammar)
 			     * are known to be defined in these modules.
@@ -4363,42 +4132,45 @@ yyreduce:
 			    if ((strcmp(thisParserPtr->modulePtr->export.name,
 					"COPS-PR-SPPI")) &&
 				(thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI))
-			        smiPrintError(thisParserPtr, ERR_TYPE_SPPI, (yyvsp[(1) - (1)].id));
-                        ;}
+			        smiPrintError(thisParserPtr, ERR_TYPE_SPPI, (yyvsp[0].id));
+                        }
+#line 4138 "parser-smi.c"
     break;
 
-  case 95:
-#line 2337 "parser-smi.y"
-    {
+  case 95: /* typeSMI: typeSMIonly  */
+#line 2339 "parser-smi.y"
+                        {
                             if ((thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI) &&
-                                !findImportByName((yyvsp[(1) - (1)].id), thisParserPtr->modulePtr))
-                                smiPrintError(thisParserPtr, ERR_SMI_CONSTRUCT_IN_PIB, (yyvsp[(1) - (1)].id));
-                            (yyval.id) = (yyvsp[(1) - (1)].id);
-                        ;}
+                                !findImportByName((yyvsp[0].id), thisParserPtr->modulePtr))
+                                smiPrintError(thisParserPtr, ERR_SMI_CONSTRUCT_IN_PIB, (yyvsp[0].id));
+                            (yyval.id) = (yyvsp[0].id);
+                        }
+#line 4149 "parser-smi.c"
     break;
 
-  case 106:
-#line 2362 "parser-smi.y"
-    {
-			    if ((yyvsp[(1) - (1)].typePtr)->export.name) {
+  case 106: /* typeDeclarationRHS: Syntax  */
+#line 2364 "parser-smi.y"
+                        {
+			    if ((yyvsp[0].typePtr)->export.name) {
 				/*
 				 * If we found an already defined type,
 				 * we have to inherit a new type structure.
 				 * (Otherwise the `Syntax' rule created
 				 * a new type for us.)
 				 */
-				(yyval.typePtr) = duplicateType((yyvsp[(1) - (1)].typePtr), 0, thisParserPtr);
+				(yyval.typePtr) = duplicateType((yyvsp[0].typePtr), 0, thisParserPtr);
 				setTypeDecl((yyval.typePtr), SMI_DECL_TYPEASSIGNMENT);
 			    } else {
-				(yyval.typePtr) = (yyvsp[(1) - (1)].typePtr);
+				(yyval.typePtr) = (yyvsp[0].typePtr);
 				setTypeDecl((yyval.typePtr), SMI_DECL_TYPEASSIGNMENT);
 			    }
-			;}
+			}
+#line 4169 "parser-smi.c"
     break;
 
-  case 107:
-#line 2378 "parser-smi.y"
-    {
+  case 107: /* $@8: %empty  */
+#line 2380 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
 			    thisParserPtr->currentDecl = SMI_DECL_TEXTUALCONVENTION;
@@ -4425,84 +4197,89 @@ yyreduce:
 						      "COPS-PR-SPPI");
 				}
 			    }
-			;}
+			}
+#line 4202 "parser-smi.c"
     break;
 
-  case 108:
-#line 2409 "parser-smi.y"
-    {
-			    checkDescr(thisParserPtr, (yyvsp[(7) - (7)].text));
-			;}
+  case 108: /* $@9: %empty  */
+#line 2411 "parser-smi.y"
+                        {
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
+			}
+#line 4210 "parser-smi.c"
     break;
 
-  case 109:
-#line 2414 "parser-smi.y"
-    {
-			    if (((yyvsp[(11) - (11)].typePtr)) && !((yyvsp[(11) - (11)].typePtr)->export.name)) {
+  case 109: /* typeDeclarationRHS: TEXTUAL_CONVENTION $@8 DisplayPart STATUS Status DESCRIPTION Text $@9 ReferPart SYNTAX Syntax  */
+#line 2416 "parser-smi.y"
+                        {
+			    if (((yyvsp[0].typePtr)) && !((yyvsp[0].typePtr)->export.name)) {
 				/*
 				 * If the Type we found has just been
 				 * defined, we don't have to allocate
 				 * a new one.
 				 */
-				(yyval.typePtr) = (yyvsp[(11) - (11)].typePtr);
+				(yyval.typePtr) = (yyvsp[0].typePtr);
 			    } else {
-				if (!((yyvsp[(11) - (11)].typePtr)))
+				if (!((yyvsp[0].typePtr)))
 				    smiPrintError(thisParserPtr, ERR_INTERNAL);
 				/*
 				 * Otherwise, we have to allocate a
 				 * new Type struct, inherited from $10.
 				 */
-				(yyval.typePtr) = duplicateType((yyvsp[(11) - (11)].typePtr), 0, thisParserPtr);
+				(yyval.typePtr) = duplicateType((yyvsp[0].typePtr), 0, thisParserPtr);
 			    }
-			    setTypeDescription((yyval.typePtr), (yyvsp[(7) - (11)].text), thisParserPtr);
-			    if ((yyvsp[(9) - (11)].text)) {
-				setTypeReference((yyval.typePtr), (yyvsp[(9) - (11)].text), thisParserPtr);
+			    setTypeDescription((yyval.typePtr), (yyvsp[-4].text), thisParserPtr);
+			    if ((yyvsp[-2].text)) {
+				setTypeReference((yyval.typePtr), (yyvsp[-2].text), thisParserPtr);
 			    }
-			    setTypeStatus((yyval.typePtr), (yyvsp[(5) - (11)].status));
-			    if ((yyvsp[(3) - (11)].text)) {
+			    setTypeStatus((yyval.typePtr), (yyvsp[-6].status));
+			    if ((yyvsp[-8].text)) {
 				if (smiCheckFormat(thisParserPtr,
-						   (yyval.typePtr)->export.basetype, (yyvsp[(3) - (11)].text),
+						   (yyval.typePtr)->export.basetype, (yyvsp[-8].text),
 						   thisParserPtr->firstStatementLine)) {
-				    setTypeFormat((yyval.typePtr), (yyvsp[(3) - (11)].text));
+				    setTypeFormat((yyval.typePtr), (yyvsp[-8].text));
 				}
 			    }
 			    setTypeDecl((yyval.typePtr), SMI_DECL_TEXTUALCONVENTION);
-			;}
+			}
+#line 4246 "parser-smi.c"
     break;
 
-  case 110:
-#line 2446 "parser-smi.y"
-    {
-			    (yyval.typePtr) = (yyvsp[(1) - (1)].typePtr);
+  case 110: /* typeDeclarationRHS: choiceClause  */
+#line 2448 "parser-smi.y"
+                        {
+			    (yyval.typePtr) = (yyvsp[0].typePtr);
 			    setTypeDecl((yyval.typePtr), SMI_DECL_TYPEASSIGNMENT);
-			;}
+			}
+#line 4255 "parser-smi.c"
     break;
 
-  case 111:
-#line 2454 "parser-smi.y"
-    {
-			    if ((yyvsp[(3) - (3)].typePtr)) {
+  case 111: /* conceptualTable: SEQUENCE OF row  */
+#line 2456 "parser-smi.y"
+                        {
+			    if ((yyvsp[0].typePtr)) {
 				(yyval.typePtr) = addType(NULL,
 					     SMI_BASETYPE_UNKNOWN, 0,
 					     thisParserPtr);
 				setTypeDecl((yyval.typePtr), SMI_DECL_IMPL_SEQUENCEOF);
-				setTypeParent((yyval.typePtr), (yyvsp[(3) - (3)].typePtr));
+				setTypeParent((yyval.typePtr), (yyvsp[0].typePtr));
 			    } else {
 				(yyval.typePtr) = NULL;
 			    }
-			;}
+			}
+#line 4271 "parser-smi.c"
     break;
 
-  case 112:
-#line 2473 "parser-smi.y"
-    {
+  case 112: /* row: UPPERCASE_IDENTIFIER  */
+#line 2475 "parser-smi.y"
+                        {
 			    Type *typePtr;
 			    Import *importPtr;
 
 			    (yyval.typePtr) = findTypeByModulenameAndName(
-				thisParserPtr->modulePtr->export.name, (yyvsp[(1) - (1)].id));
+				thisParserPtr->modulePtr->export.name, (yyvsp[0].id));
 			    if (! (yyval.typePtr)) {
-				importPtr = findImportByName((yyvsp[(1) - (1)].id),
+				importPtr = findImportByName((yyvsp[0].id),
 							     thisModulePtr);
 				if (!importPtr ||
 				    (importPtr->kind == KIND_NOTFOUND)) {
@@ -4510,7 +4287,7 @@ yyreduce:
 				     * forward referenced type. create it,
 				     * marked with FLAG_INCOMPLETE.
 				     */
-				    typePtr = addType((yyvsp[(1) - (1)].id),
+				    typePtr = addType((yyvsp[0].id),
 						      SMI_BASETYPE_UNKNOWN,
 						      FLAG_INCOMPLETE,
 						      thisParserPtr);
@@ -4524,88 +4301,92 @@ yyreduce:
 				    (yyval.typePtr) = findTypeByModulenameAndName(
 					importPtr->export.module,
 					importPtr->export.name);
-				    smiFree((yyvsp[(1) - (1)].id));
+				    smiFree((yyvsp[0].id));
 				}
 			    } else {
-				smiFree((yyvsp[(1) - (1)].id));
+				smiFree((yyvsp[0].id));
 			    }
-			;}
+			}
+#line 4311 "parser-smi.c"
     break;
 
-  case 113:
-#line 2513 "parser-smi.y"
-    {
+  case 113: /* entryType: SEQUENCE '{' sequenceItems '}'  */
+#line 2515 "parser-smi.y"
+                        {
 			    (yyval.typePtr) = addType(NULL, SMI_BASETYPE_UNKNOWN, 0,
 					 thisParserPtr);
-			    setTypeList((yyval.typePtr), (yyvsp[(3) - (4)].listPtr));
-			;}
+			    setTypeList((yyval.typePtr), (yyvsp[-1].listPtr));
+			}
+#line 4321 "parser-smi.c"
     break;
 
-  case 114:
-#line 2521 "parser-smi.y"
-    {
+  case 114: /* sequenceItems: sequenceItem  */
+#line 2523 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].objectPtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].objectPtr);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 4331 "parser-smi.c"
     break;
 
-  case 115:
-#line 2528 "parser-smi.y"
-    {
+  case 115: /* sequenceItems: sequenceItems ',' sequenceItem  */
+#line 2530 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (void *)(yyvsp[(3) - (3)].objectPtr);
+			    p->ptr = (void *)(yyvsp[0].objectPtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-			;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+			}
+#line 4346 "parser-smi.c"
     break;
 
-  case 116:
-#line 2547 "parser-smi.y"
-    {
+  case 116: /* sequenceItem: LOWERCASE_IDENTIFIER sequenceSyntax  */
+#line 2549 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    Import *importPtr;
 			    Type *typePtr;
 			    
 			    objectPtr =
 			        findObjectByModuleAndName(thisParserPtr->modulePtr,
-							  (yyvsp[(1) - (2)].id));
+							  (yyvsp[-1].id));
 
 			    if (!objectPtr) {
-				importPtr = findImportByName((yyvsp[(1) - (2)].id),
+				importPtr = findImportByName((yyvsp[-1].id),
 							     thisModulePtr);
 				if (!importPtr ||
 				    (importPtr->kind == KIND_NOTFOUND)) {
-				    objectPtr = addObject((yyvsp[(1) - (2)].id), thisParserPtr->pendingNodePtr,
+				    objectPtr = addObject((yyvsp[-1].id), thisParserPtr->pendingNodePtr,
 					                  0,
 					                  FLAG_INCOMPLETE |
 							  FLAG_SEQTYPE,
 						          thisParserPtr);
-				    setObjectType(objectPtr, (yyvsp[(2) - (2)].typePtr));
+				    setObjectType(objectPtr, (yyvsp[0].typePtr));
 				} else {
 				    /*
 				     * imported object.
 				     */
 				    importPtr->use++;
 				    objectPtr = findObjectByModulenameAndName(
-					importPtr->export.module, (yyvsp[(1) - (2)].id));
-				    smiFree((yyvsp[(1) - (2)].id));
+					importPtr->export.module, (yyvsp[-1].id));
+				    smiFree((yyvsp[-1].id));
 
 				    if (objectPtr->typePtr->export.name) {
 					typePtr = objectPtr->typePtr;
 				    } else {
 					typePtr = objectPtr->typePtr->parentPtr;
 				    }
-				    if (((yyvsp[(2) - (2)].typePtr) != typePtr) &&
-					(((yyvsp[(2) - (2)].typePtr)->export.basetype !=
+				    if (((yyvsp[0].typePtr) != typePtr) &&
+					(((yyvsp[0].typePtr)->export.basetype !=
 					  SMI_BASETYPE_INTEGER32) ||
 					 (typePtr->export.basetype !=
 					  SMI_BASETYPE_ENUM)) &&
-					(((yyvsp[(2) - (2)].typePtr)->export.basetype !=
+					(((yyvsp[0].typePtr)->export.basetype !=
 					  SMI_BASETYPE_OCTETSTRING) ||
 					 (typePtr->export.basetype !=
 					  SMI_BASETYPE_BITS))) {
@@ -4615,7 +4396,7 @@ yyreduce:
 				    }
 				}
 			    } else {
-				smiFree((yyvsp[(1) - (2)].id));
+				smiFree((yyvsp[-1].id));
 				if (objectPtr->typePtr) {
 
 				    if (objectPtr->typePtr->export.name) {
@@ -4623,12 +4404,12 @@ yyreduce:
 				    } else {
 					typePtr = objectPtr->typePtr->parentPtr;
 				    }
-				    if (((yyvsp[(2) - (2)].typePtr) != typePtr) &&
-					(((yyvsp[(2) - (2)].typePtr)->export.basetype !=
+				    if (((yyvsp[0].typePtr) != typePtr) &&
+					(((yyvsp[0].typePtr)->export.basetype !=
 					  SMI_BASETYPE_INTEGER32) ||
 					 (typePtr->export.basetype !=
 					  SMI_BASETYPE_ENUM)) &&
-					(((yyvsp[(2) - (2)].typePtr)->export.basetype !=
+					(((yyvsp[0].typePtr)->export.basetype !=
 					  SMI_BASETYPE_OCTETSTRING) ||
 					 (typePtr->export.basetype !=
 					  SMI_BASETYPE_BITS))) {
@@ -4638,28 +4419,30 @@ yyreduce:
 				    }
 
 				} else {
-				    setObjectType(objectPtr, (yyvsp[(2) - (2)].typePtr));
+				    setObjectType(objectPtr, (yyvsp[0].typePtr));
 				    addObjectFlags(objectPtr,
 						   FLAG_SEQTYPE);
 				}
 			    }
 
 			    (yyval.objectPtr) = objectPtr;
-			;}
+			}
+#line 4431 "parser-smi.c"
     break;
 
-  case 117:
-#line 2630 "parser-smi.y"
-    {
-			    (yyval.typePtr) = (yyvsp[(1) - (1)].typePtr);
+  case 117: /* Syntax: ObjectSyntax  */
+#line 2632 "parser-smi.y"
+                        {
+			    (yyval.typePtr) = (yyvsp[0].typePtr);
 			    if ((yyval.typePtr))
 				defaultBasetype = (yyval.typePtr)->export.basetype;
-			;}
+			}
+#line 4441 "parser-smi.c"
     break;
 
-  case 118:
-#line 2638 "parser-smi.y"
-    {
+  case 118: /* Syntax: BITS '{' NamedBits '}'  */
+#line 2640 "parser-smi.y"
+                        {
 			    Type *typePtr;
 			    List *p;
 			    
@@ -4669,39 +4452,42 @@ yyreduce:
 					      thisParserPtr);
 			    setTypeDecl(typePtr, SMI_DECL_IMPLICIT_TYPE);
 			    setTypeParent(typePtr, smiHandle->typeBitsPtr);
-			    setTypeList(typePtr, (yyvsp[(3) - (4)].listPtr));
-			    for (p = (yyvsp[(3) - (4)].listPtr); p; p = p->nextPtr)
+			    setTypeList(typePtr, (yyvsp[-1].listPtr));
+			    for (p = (yyvsp[-1].listPtr); p; p = p->nextPtr)
 				((NamedNumber *)p->ptr)->typePtr = typePtr;
 			    smiCheckNamedNumbersOrder(parserPtr, typePtr);
 			    (yyval.typePtr) = typePtr;
-			;}
+			}
+#line 4462 "parser-smi.c"
     break;
 
-  case 119:
-#line 2658 "parser-smi.y"
-    {
-			    (yyval.typePtr) = (yyvsp[(1) - (1)].typePtr);
-			;}
+  case 119: /* sequenceSyntax: sequenceObjectSyntax  */
+#line 2660 "parser-smi.y"
+                        {
+			    (yyval.typePtr) = (yyvsp[0].typePtr);
+			}
+#line 4470 "parser-smi.c"
     break;
 
-  case 120:
-#line 2662 "parser-smi.y"
-    {
+  case 120: /* sequenceSyntax: BITS  */
+#line 2664 "parser-smi.y"
+                        {
 			    /* TODO: */
 			    (yyval.typePtr) = smiHandle->typeOctetStringPtr;
-			;}
+			}
+#line 4479 "parser-smi.c"
     break;
 
-  case 121:
-#line 2667 "parser-smi.y"
-    {
+  case 121: /* sequenceSyntax: UPPERCASE_IDENTIFIER anySubType  */
+#line 2669 "parser-smi.y"
+                        {
 			    Type *typePtr;
 			    Import *importPtr;
 			    
 			    (yyval.typePtr) = findTypeByModulenameAndName(
-				thisParserPtr->modulePtr->export.name, (yyvsp[(1) - (2)].id));
+				thisParserPtr->modulePtr->export.name, (yyvsp[-1].id));
 			    if (! (yyval.typePtr)) {
-				importPtr = findImportByName((yyvsp[(1) - (2)].id),
+				importPtr = findImportByName((yyvsp[-1].id),
 							     thisModulePtr);
 				if (!importPtr ||
 				    (importPtr->kind == KIND_NOTFOUND)) {
@@ -4709,7 +4495,7 @@ yyreduce:
 				     * forward referenced type. create it,
 				     * marked with FLAG_INCOMPLETE.
 				     */
-				    typePtr = addType((yyvsp[(1) - (2)].id), SMI_BASETYPE_UNKNOWN,
+				    typePtr = addType((yyvsp[-1].id), SMI_BASETYPE_UNKNOWN,
 						      FLAG_INCOMPLETE,
 						      thisParserPtr);
 				    (yyval.typePtr) = typePtr;
@@ -4718,92 +4504,98 @@ yyreduce:
 				    (yyval.typePtr) = findTypeByModulenameAndName(
 					importPtr->export.module,
 					importPtr->export.name);
-				    smiFree((yyvsp[(1) - (2)].id));
+				    smiFree((yyvsp[-1].id));
 				}
 			    } else {
-				smiFree((yyvsp[(1) - (2)].id));
+				smiFree((yyvsp[-1].id));
 			    }
-			;}
+			}
+#line 4514 "parser-smi.c"
     break;
 
-  case 122:
-#line 2700 "parser-smi.y"
-    {
+  case 122: /* NamedBits: NamedBit  */
+#line 2702 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].namedNumberPtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].namedNumberPtr);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 4524 "parser-smi.c"
     break;
 
-  case 123:
-#line 2706 "parser-smi.y"
-    {
+  case 123: /* NamedBits: NamedBits ',' NamedBit  */
+#line 2708 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (void *)(yyvsp[(3) - (3)].namedNumberPtr);
+			    p->ptr = (void *)(yyvsp[0].namedNumberPtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-			;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+			}
+#line 4539 "parser-smi.c"
     break;
 
-  case 124:
-#line 2719 "parser-smi.y"
-    {
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+  case 124: /* $@10: %empty  */
+#line 2721 "parser-smi.y"
+                        {
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_BITNAME_32, ERR_BITNAME_64);
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_SMIV2)
 			    {
-				if (strchr((yyvsp[(1) - (1)].id), '-')) {
+				if (strchr((yyvsp[0].id), '-')) {
 				    smiPrintError(thisParserPtr,
 						  ERR_NAMEDBIT_INCLUDES_HYPHEN,
-						  (yyvsp[(1) - (1)].id));
+						  (yyvsp[0].id));
 				}
 			    }
-			;}
+			}
+#line 4556 "parser-smi.c"
     break;
 
-  case 125:
-#line 2732 "parser-smi.y"
-    {
+  case 125: /* NamedBit: LOWERCASE_IDENTIFIER $@10 '(' NUMBER ')'  */
+#line 2734 "parser-smi.y"
+                        {
 			    (yyval.namedNumberPtr) = smiMalloc(sizeof(NamedNumber));
-			    (yyval.namedNumberPtr)->export.name = (yyvsp[(1) - (5)].id);
+			    (yyval.namedNumberPtr)->export.name = (yyvsp[-4].id);
 			    (yyval.namedNumberPtr)->export.value.basetype =
 				                       SMI_BASETYPE_UNSIGNED32;
-			    (yyval.namedNumberPtr)->export.value.value.unsigned32 = (yyvsp[(4) - (5)].unsigned32);
+			    (yyval.namedNumberPtr)->export.value.value.unsigned32 = (yyvsp[-1].unsigned32);
 			    /* RFC 2578 7.1.4 */
-			    if ((yyvsp[(4) - (5)].unsigned32) >= 65535*8) {
+			    if ((yyvsp[-1].unsigned32) >= 65535*8) {
 				smiPrintError(thisParserPtr,
 					      ERR_BITS_NUMBER_TOO_LARGE,
-					      (yyvsp[(1) - (5)].id), (yyvsp[(4) - (5)].unsigned32));
+					      (yyvsp[-4].id), (yyvsp[-1].unsigned32));
 			    } else {
-				if ((yyvsp[(4) - (5)].unsigned32) >= 128) {
+				if ((yyvsp[-1].unsigned32) >= 128) {
 				    smiPrintError(thisParserPtr,
 						  ERR_BITS_NUMBER_LARGE,
-						  (yyvsp[(1) - (5)].id), (yyvsp[(4) - (5)].unsigned32));
+						  (yyvsp[-4].id), (yyvsp[-1].unsigned32));
 				}
 			    }
-			;}
+			}
+#line 4580 "parser-smi.c"
     break;
 
-  case 126:
-#line 2754 "parser-smi.y"
-    {
+  case 126: /* $@11: %empty  */
+#line 2756 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_OBJECTIDENTITY;
 
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_OIDNAME_32, ERR_OIDNAME_64);
 			    smiCheckObjectName(thisParserPtr,
-					       thisModulePtr, (yyvsp[(1) - (1)].id));
-			;}
+					       thisModulePtr, (yyvsp[0].id));
+			}
+#line 4594 "parser-smi.c"
     break;
 
-  case 127:
-#line 2764 "parser-smi.y"
-    {
+  case 127: /* $@12: %empty  */
+#line 2766 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
 			    if (strcmp(thisModulePtr->export.name, "SNMPv2-SMI") &&
@@ -4825,55 +4617,59 @@ yyreduce:
 						      "COPS-PR-SPPI");
 				}
 			    }
-			;}
+			}
+#line 4622 "parser-smi.c"
     break;
 
-  case 128:
-#line 2789 "parser-smi.y"
-    {
-			    checkDescr(thisParserPtr, (yyvsp[(8) - (8)].text));
-			;}
+  case 128: /* $@13: %empty  */
+#line 2791 "parser-smi.y"
+                        {
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
+			}
+#line 4630 "parser-smi.c"
     break;
 
-  case 129:
-#line 2795 "parser-smi.y"
-    {
+  case 129: /* objectIdentityClause: LOWERCASE_IDENTIFIER $@11 OBJECT_IDENTITY $@12 STATUS Status DESCRIPTION Text $@13 ReferPart COLON_COLON_EQUAL '{' objectIdentifier '}'  */
+#line 2797 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    
-			    objectPtr = (yyvsp[(13) - (14)].objectPtr);
-			    smiCheckObjectReuse(thisParserPtr, (yyvsp[(1) - (14)].id), &objectPtr);
+			    objectPtr = (yyvsp[-1].objectPtr);
+			    smiCheckObjectReuse(thisParserPtr, (yyvsp[-13].id), &objectPtr);
 
-			    objectPtr = setObjectName(objectPtr, (yyvsp[(1) - (14)].id), thisParserPtr);
+			    objectPtr = setObjectName(objectPtr, (yyvsp[-13].id), thisParserPtr);
 			    setObjectDecl(objectPtr, SMI_DECL_OBJECTIDENTITY);
 			    setObjectLine(objectPtr, thisParserPtr->firstStatementLine,
 					  thisParserPtr);
-			    setObjectStatus(objectPtr, (yyvsp[(6) - (14)].status));
-			    setObjectDescription(objectPtr, (yyvsp[(8) - (14)].text), thisParserPtr);
-			    if ((yyvsp[(10) - (14)].text)) {
-				setObjectReference(objectPtr, (yyvsp[(10) - (14)].text), thisParserPtr);
+			    setObjectStatus(objectPtr, (yyvsp[-8].status));
+			    setObjectDescription(objectPtr, (yyvsp[-6].text), thisParserPtr);
+			    if ((yyvsp[-4].text)) {
+				setObjectReference(objectPtr, (yyvsp[-4].text), thisParserPtr);
 			    }
 			    addObjectFlags(objectPtr, FLAG_REGISTERED);
 			    deleteObjectFlags(objectPtr, FLAG_INCOMPLETE);
 			    (yyval.err) = 0;
-			;}
+			}
+#line 4654 "parser-smi.c"
     break;
 
-  case 130:
-#line 2817 "parser-smi.y"
-    {
+  case 130: /* $@14: %empty  */
+#line 2819 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_OBJECTTYPE;
 			    
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_OIDNAME_32, ERR_OIDNAME_64);
 			    smiCheckObjectName(thisParserPtr,
-					       thisModulePtr, (yyvsp[(1) - (1)].id));
-			;}
+					       thisModulePtr, (yyvsp[0].id));
+			}
+#line 4668 "parser-smi.c"
     break;
 
-  case 131:
-#line 2827 "parser-smi.y"
-    {
+  case 131: /* $@15: %empty  */
+#line 2829 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    importPtr = findImportByName("OBJECT-TYPE",
@@ -4898,28 +4694,29 @@ yyreduce:
 				}
 			    }
                             indexFlag = 0;
-			;}
+			}
+#line 4699 "parser-smi.c"
     break;
 
-  case 132:
-#line 2867 "parser-smi.y"
-    {
+  case 132: /* objectTypeClause: LOWERCASE_IDENTIFIER $@14 OBJECT_TYPE $@15 SYNTAX Syntax UnitsPart MaxOrPIBAccessPart SPPIPibReferencesPart SPPIPibTagPart STATUS Status descriptionClause SPPIErrorsPart ReferPart IndexPart MibIndex SPPIUniquePart DefValPart COLON_COLON_EQUAL '{' ObjectName '}'  */
+#line 2869 "parser-smi.y"
+                        {
 			    Object *objectPtr, *parentPtr;
 			    Type *typePtr = NULL;
 			    
-			    objectPtr = (yyvsp[(22) - (23)].objectPtr);
+			    objectPtr = (yyvsp[-1].objectPtr);
 
-			    smiCheckObjectReuse(thisParserPtr, (yyvsp[(1) - (23)].id), &objectPtr);
+			    smiCheckObjectReuse(thisParserPtr, (yyvsp[-22].id), &objectPtr);
 
-			    objectPtr = setObjectName(objectPtr, (yyvsp[(1) - (23)].id), thisParserPtr);
+			    objectPtr = setObjectName(objectPtr, (yyvsp[-22].id), thisParserPtr);
 			    setObjectDecl(objectPtr, SMI_DECL_OBJECTTYPE);
 			    setObjectLine(objectPtr, thisParserPtr->firstStatementLine,
 					  thisParserPtr);
 			    if (checkObjectFlags(objectPtr, FLAG_SEQTYPE)) {
 				deleteObjectFlags(objectPtr, FLAG_SEQTYPE);
-				if ((yyvsp[(6) - (23)].typePtr)) {
-				    if ((yyvsp[(6) - (23)].typePtr)->export.name) {
-					typePtr = (yyvsp[(6) - (23)].typePtr);
+				if ((yyvsp[-17].typePtr)) {
+				    if ((yyvsp[-17].typePtr)->export.name) {
+					typePtr = (yyvsp[-17].typePtr);
                                         /*
                                          * According to RFC 3159 7.1.3. Opaque must not be used
                                          * in a SYNTAX clause.
@@ -4935,7 +4732,7 @@ yyreduce:
                                             !strcmp(typePtr->export.name, "IpAddress"))
                                             smiPrintError(thisParserPtr, ERR_IPADDRESS_IN_SYNTAX);
 				    } else {
-					typePtr = (yyvsp[(6) - (23)].typePtr)->parentPtr;
+					typePtr = (yyvsp[-17].typePtr)->parentPtr;
 				    }
 				    if ((objectPtr->typePtr != typePtr) &&
 					((objectPtr->typePtr->export.basetype !=
@@ -4952,17 +4749,17 @@ yyreduce:
 				    }
 				}
 			    }
-			    setObjectType(objectPtr, (yyvsp[(6) - (23)].typePtr));
-			    if (!((yyvsp[(6) - (23)].typePtr)->export.name)) {
+			    setObjectType(objectPtr, (yyvsp[-17].typePtr));
+			    if (!((yyvsp[-17].typePtr)->export.name)) {
 				/*
 				 * An inlined type.
 				 */
 #if 0 /* export implicitly defined types by the node's lowercase name */
-				setTypeName((yyvsp[(6) - (23)].typePtr), (yyvsp[(1) - (23)].id));
+				setTypeName((yyvsp[-17].typePtr), (yyvsp[-22].id));
 #endif
 			    }
-			    setObjectUnits(objectPtr, (yyvsp[(7) - (23)].text));
-			    setObjectAccess(objectPtr, (yyvsp[(8) - (23)].access));
+			    setObjectUnits(objectPtr, (yyvsp[-16].text));
+			    setObjectAccess(objectPtr, (yyvsp[-15].access));
 			    if (thisParserPtr->flags & FLAG_CREATABLE) {
 				thisParserPtr->flags &= ~FLAG_CREATABLE;
 				parentPtr =
@@ -5004,14 +4801,14 @@ yyreduce:
 						  ERR_SCALAR_READCREATE);
 				}
 			    }
-			    setObjectStatus(objectPtr, (yyvsp[(12) - (23)].status));
+			    setObjectStatus(objectPtr, (yyvsp[-11].status));
 			    addObjectFlags(objectPtr, FLAG_REGISTERED);
 			    deleteObjectFlags(objectPtr, FLAG_INCOMPLETE);
-			    if ((yyvsp[(13) - (23)].text)) {
-				setObjectDescription(objectPtr, (yyvsp[(13) - (23)].text), thisParserPtr);
+			    if ((yyvsp[-10].text)) {
+				setObjectDescription(objectPtr, (yyvsp[-10].text), thisParserPtr);
 			    }
-			    if ((yyvsp[(15) - (23)].text)) {
-				setObjectReference(objectPtr, (yyvsp[(15) - (23)].text), thisParserPtr);
+			    if ((yyvsp[-8].text)) {
+				setObjectReference(objectPtr, (yyvsp[-8].text), thisParserPtr);
 			    }
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI) {
                                 /*
@@ -5020,18 +4817,18 @@ yyreduce:
                                  * which is 1 if IndexPart has been used.
                                  */
                                 if (indexFlag == INDEXFLAG_AUGMENTS) { /* IndexPart was used */
-			            if ((yyvsp[(16) - (23)].index).indexkind != SMI_INDEX_UNKNOWN) {
-				        setObjectList(objectPtr, (yyvsp[(16) - (23)].index).listPtr);
-				        setObjectImplied(objectPtr, (yyvsp[(16) - (23)].index).implied);
-				        setObjectIndexkind(objectPtr, (yyvsp[(16) - (23)].index).indexkind);
-				        setObjectRelated(objectPtr, (yyvsp[(16) - (23)].index).rowPtr);
+			            if ((yyvsp[-7].index).indexkind != SMI_INDEX_UNKNOWN) {
+				        setObjectList(objectPtr, (yyvsp[-7].index).listPtr);
+				        setObjectImplied(objectPtr, (yyvsp[-7].index).implied);
+				        setObjectIndexkind(objectPtr, (yyvsp[-7].index).indexkind);
+				        setObjectRelated(objectPtr, (yyvsp[-7].index).rowPtr);
 			            }
                                 } else {
-			            if ((yyvsp[(17) - (23)].index).indexkind != SMI_INDEX_UNKNOWN) {
-				        setObjectList(objectPtr, (yyvsp[(17) - (23)].index).listPtr);
-				        setObjectImplied(objectPtr, (yyvsp[(17) - (23)].index).implied);
-				        setObjectIndexkind(objectPtr, (yyvsp[(17) - (23)].index).indexkind);
-				        setObjectRelated(objectPtr, (yyvsp[(17) - (23)].index).rowPtr);
+			            if ((yyvsp[-6].index).indexkind != SMI_INDEX_UNKNOWN) {
+				        setObjectList(objectPtr, (yyvsp[-6].index).listPtr);
+				        setObjectImplied(objectPtr, (yyvsp[-6].index).implied);
+				        setObjectIndexkind(objectPtr, (yyvsp[-6].index).indexkind);
+				        setObjectRelated(objectPtr, (yyvsp[-6].index).rowPtr);
 			            }
                                 }
                             } else {
@@ -5045,45 +4842,45 @@ yyreduce:
                                  * If an optional INDEX exists then it is
                                  * appended to this list.
                                  */
-			        if ((yyvsp[(16) - (23)].index).indexkind != SMI_INDEX_UNKNOWN) {
-                                    setObjectList(objectPtr, (yyvsp[(16) - (23)].index).listPtr);
-				    setObjectIndexkind(objectPtr, (yyvsp[(16) - (23)].index).indexkind);
-				    setObjectRelated(objectPtr, (yyvsp[(16) - (23)].index).rowPtr);
+			        if ((yyvsp[-7].index).indexkind != SMI_INDEX_UNKNOWN) {
+                                    setObjectList(objectPtr, (yyvsp[-7].index).listPtr);
+				    setObjectIndexkind(objectPtr, (yyvsp[-7].index).indexkind);
+				    setObjectRelated(objectPtr, (yyvsp[-7].index).rowPtr);
 			        }
-			        if ((yyvsp[(17) - (23)].index).indexkind != SMI_INDEX_UNKNOWN) {
+			        if ((yyvsp[-6].index).indexkind != SMI_INDEX_UNKNOWN) {
                                     if (objectPtr->listPtr) {
                                         List *p;
                                         for (p = objectPtr->listPtr; p->nextPtr;
                                              p = p->nextPtr);
-                                        p->nextPtr = (yyvsp[(17) - (23)].index).listPtr;
+                                        p->nextPtr = (yyvsp[-6].index).listPtr;
                                     }
-				    setObjectImplied(objectPtr, (yyvsp[(17) - (23)].index).implied);
+				    setObjectImplied(objectPtr, (yyvsp[-6].index).implied);
 			        }
                             }
-                            if ((yyvsp[(18) - (23)].listPtr)) {
-                                setObjectUniqueness(objectPtr, (yyvsp[(18) - (23)].listPtr));
+                            if ((yyvsp[-5].listPtr)) {
+                                setObjectUniqueness(objectPtr, (yyvsp[-5].listPtr));
                             }
-			    if ((yyvsp[(19) - (23)].valuePtr)) {
+			    if ((yyvsp[-4].valuePtr)) {
 				if (objectPtr->typePtr
 				    && (((objectPtr->typePtr->export.basetype == SMI_BASETYPE_OCTETSTRING) &&
-					 ((yyvsp[(19) - (23)].valuePtr)->basetype != SMI_BASETYPE_OCTETSTRING))
+					 ((yyvsp[-4].valuePtr)->basetype != SMI_BASETYPE_OCTETSTRING))
 					|| ((objectPtr->typePtr->export.basetype == SMI_BASETYPE_OBJECTIDENTIFIER) &&
-					    ((yyvsp[(19) - (23)].valuePtr)->basetype != SMI_BASETYPE_OBJECTIDENTIFIER)))) {
+					    ((yyvsp[-4].valuePtr)->basetype != SMI_BASETYPE_OBJECTIDENTIFIER)))) {
 				    smiPrintError(thisParserPtr,
 						  ERR_DEFVAL_SYNTAX);
-				    if ((yyvsp[(19) - (23)].valuePtr)->basetype == SMI_BASETYPE_OBJECTIDENTIFIER) {
-					smiFree((yyvsp[(19) - (23)].valuePtr)->value.oid);
+				    if ((yyvsp[-4].valuePtr)->basetype == SMI_BASETYPE_OBJECTIDENTIFIER) {
+					smiFree((yyvsp[-4].valuePtr)->value.oid);
 				    }
-				    if (((yyvsp[(19) - (23)].valuePtr)->basetype == SMI_BASETYPE_BITS) ||
-					((yyvsp[(19) - (23)].valuePtr)->basetype == SMI_BASETYPE_OCTETSTRING)) {
-					smiFree((yyvsp[(19) - (23)].valuePtr)->value.ptr);
+				    if (((yyvsp[-4].valuePtr)->basetype == SMI_BASETYPE_BITS) ||
+					((yyvsp[-4].valuePtr)->basetype == SMI_BASETYPE_OCTETSTRING)) {
+					smiFree((yyvsp[-4].valuePtr)->value.ptr);
 				    }
-				    smiFree((yyvsp[(19) - (23)].valuePtr));
+				    smiFree((yyvsp[-4].valuePtr));
 				} else {
-				    setObjectValue(objectPtr, (yyvsp[(19) - (23)].valuePtr));
+				    setObjectValue(objectPtr, (yyvsp[-4].valuePtr));
 				}
 			    }
-                            if ((yyvsp[(9) - (23)].objectPtr)) {
+                            if ((yyvsp[-14].objectPtr)) {
                                 if (objectPtr->relatedPtr)
                                     smiPrintError(thisParserPtr, ERR_OBJECTPTR_ELEMENT_IN_USE,
                                                   "relatedPtr", "PIB-REFERENCES");
@@ -5097,7 +4894,7 @@ yyreduce:
                                     smiPrintErrorAtLine(parserPtr, ERR_PIB_REFERENCES_WRONG_TYPE,
                                                         objectPtr->line);
                                 else
-                                    setObjectRelated(objectPtr, (yyvsp[(9) - (23)].objectPtr));
+                                    setObjectRelated(objectPtr, (yyvsp[-14].objectPtr));
                             } else {
                                /*
                                 * Does this object have a SYNTAX of 'ReferenceId'
@@ -5110,7 +4907,7 @@ yyreduce:
                                    smiPrintErrorAtLine(parserPtr, ERR_LACKING_PIB_REFERENCES,
                                                        objectPtr->line);
                             }
-                            if ((yyvsp[(10) - (23)].objectPtr)) {
+                            if ((yyvsp[-13].objectPtr)) {
                                 if (objectPtr->relatedPtr)
                                     smiPrintError(thisParserPtr, ERR_OBJECTPTR_ELEMENT_IN_USE,
                                                   "relatedPtr", "PIB-TAG");
@@ -5124,7 +4921,7 @@ yyreduce:
                                     smiPrintErrorAtLine(parserPtr, ERR_PIB_TAG_WRONG_TYPE,
                                                         objectPtr->line);
                                 else
-                                    setObjectRelated(objectPtr, (yyvsp[(10) - (23)].objectPtr));
+                                    setObjectRelated(objectPtr, (yyvsp[-13].objectPtr));
                             } else {
                                 /*
                                  * Does this object have a SYNTAX of 'TagReferenceId'
@@ -5138,7 +4935,7 @@ yyreduce:
                                                         objectPtr->line);
 
                             }
-                            if ((yyvsp[(14) - (23)].listPtr)) {
+                            if ((yyvsp[-9].listPtr)) {
                                 if (objectPtr->listPtr)
                                     smiPrintError(thisParserPtr, ERR_OBJECTPTR_ELEMENT_IN_USE,
                                                   "listPtr", "INSTALL-ERRORS");
@@ -5152,15 +4949,16 @@ yyreduce:
                                     smiPrintErrorAtLine(parserPtr, ERR_INSTALL_ERRORS_FOR_NON_TABLE,
                                                         objectPtr->line);
                                 else
-                                    setObjectList(objectPtr, (yyvsp[(14) - (23)].listPtr));
+                                    setObjectList(objectPtr, (yyvsp[-9].listPtr));
                             }
 			    (yyval.err) = 0;
-			;}
+			}
+#line 4957 "parser-smi.c"
     break;
 
-  case 133:
-#line 3123 "parser-smi.y"
-    {
+  case 133: /* descriptionClause: %empty  */
+#line 3125 "parser-smi.y"
+                        {
 			    if ((thisModulePtr->export.language == SMI_LANGUAGE_SMIV2) ||
                                 (thisModulePtr->export.language == SMI_LANGUAGE_SPPI))
 			    {
@@ -5168,33 +4966,36 @@ yyreduce:
 					      ERR_MISSING_DESCRIPTION);
 			    }
 			    (yyval.text) = NULL;
-			;}
+			}
+#line 4971 "parser-smi.c"
     break;
 
-  case 134:
-#line 3133 "parser-smi.y"
-    {
-			    (yyval.text) = (yyvsp[(2) - (2)].text);
-			    checkDescr(thisParserPtr, (yyvsp[(2) - (2)].text));
-			;}
+  case 134: /* descriptionClause: DESCRIPTION Text  */
+#line 3135 "parser-smi.y"
+                        {
+			    (yyval.text) = (yyvsp[0].text);
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
+			}
+#line 4980 "parser-smi.c"
     break;
 
-  case 135:
-#line 3140 "parser-smi.y"
-    {
+  case 135: /* $@16: %empty  */
+#line 3142 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_TRAPTYPE;
 			    
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_OIDNAME_32, ERR_OIDNAME_64);
 			    smiCheckObjectName(thisParserPtr,
-					       thisModulePtr, (yyvsp[(1) - (1)].id));
-			;}
+					       thisModulePtr, (yyvsp[0].id));
+			}
+#line 4994 "parser-smi.c"
     break;
 
-  case 136:
-#line 3150 "parser-smi.y"
-    {
+  case 136: /* $@17: %empty  */
+#line 3152 "parser-smi.y"
+                        {
 			    Import *importPtr;
                             if (thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SMI_CONSTRUCT_IN_PIB, "TRAP-TYPE");
@@ -5213,16 +5014,17 @@ yyreduce:
 					      ERR_MACRO_NOT_IMPORTED,
 					      "TRAP-TYPE", "RFC-1215");
 			    }
-			;}
+			}
+#line 5019 "parser-smi.c"
     break;
 
-  case 137:
-#line 3176 "parser-smi.y"
-    {
+  case 137: /* trapTypeClause: fuzzy_lowercase_identifier $@16 TRAP_TYPE $@17 ENTERPRISE objectIdentifier VarPart DescrPart ReferPart COLON_COLON_EQUAL NUMBER  */
+#line 3178 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    Node *nodePtr;
 			    
-			    objectPtr = (yyvsp[(6) - (11)].objectPtr);
+			    objectPtr = (yyvsp[-5].objectPtr);
 			    nodePtr = findNodeByParentAndSubid(
 				objectPtr->nodePtr, 0);
 			    if (nodePtr && nodePtr->lastObjectPtr &&
@@ -5241,279 +5043,312 @@ yyreduce:
 			    }
 			    objectPtr = addObject(NULL,
 						  objectPtr->nodePtr,
-						  (yyvsp[(11) - (11)].unsigned32),
+						  (yyvsp[0].unsigned32),
 						  FLAG_INCOMPLETE,
 						  thisParserPtr);
 			    
-			    smiCheckObjectReuse(thisParserPtr, (yyvsp[(1) - (11)].id), &objectPtr);
+			    smiCheckObjectReuse(thisParserPtr, (yyvsp[-10].id), &objectPtr);
 
-			    objectPtr = setObjectName(objectPtr, (yyvsp[(1) - (11)].id), thisParserPtr);
+			    objectPtr = setObjectName(objectPtr, (yyvsp[-10].id), thisParserPtr);
 			    setObjectDecl(objectPtr,
 					  SMI_DECL_TRAPTYPE);
 			    setObjectLine(objectPtr, thisParserPtr->firstStatementLine,
 					  thisParserPtr);
 			    addObjectFlags(objectPtr, FLAG_REGISTERED);
 			    deleteObjectFlags(objectPtr, FLAG_INCOMPLETE);
-			    setObjectList(objectPtr, (yyvsp[(7) - (11)].listPtr));
+			    setObjectList(objectPtr, (yyvsp[-4].listPtr));
 			    setObjectStatus(objectPtr, SMI_STATUS_CURRENT); 
-			    setObjectDescription(objectPtr, (yyvsp[(8) - (11)].text), thisParserPtr);
-			    if ((yyvsp[(9) - (11)].text)) {
-				setObjectReference(objectPtr, (yyvsp[(9) - (11)].text), thisParserPtr);
+			    setObjectDescription(objectPtr, (yyvsp[-3].text), thisParserPtr);
+			    if ((yyvsp[-2].text)) {
+				setObjectReference(objectPtr, (yyvsp[-2].text), thisParserPtr);
 			    }
 			    (yyval.err) = 0;
-			;}
+			}
+#line 5068 "parser-smi.c"
     break;
 
-  case 138:
-#line 3223 "parser-smi.y"
-    {
-			    (yyval.listPtr) = (yyvsp[(3) - (4)].listPtr);
-			;}
+  case 138: /* VarPart: VARIABLES '{' VarTypes '}'  */
+#line 3225 "parser-smi.y"
+                        {
+			    (yyval.listPtr) = (yyvsp[-1].listPtr);
+			}
+#line 5076 "parser-smi.c"
     break;
 
-  case 139:
-#line 3227 "parser-smi.y"
-    {
+  case 139: /* VarPart: %empty  */
+#line 3229 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = NULL;
-			;}
+			}
+#line 5084 "parser-smi.c"
     break;
 
-  case 140:
-#line 3233 "parser-smi.y"
-    {
-			    if ((yyvsp[(1) - (1)].objectPtr)) {
+  case 140: /* VarTypes: VarType  */
+#line 3235 "parser-smi.y"
+                        {
+			    if ((yyvsp[0].objectPtr)) {
 				(yyval.listPtr) = smiMalloc(sizeof(List));
-				(yyval.listPtr)->ptr = (yyvsp[(1) - (1)].objectPtr);
+				(yyval.listPtr)->ptr = (yyvsp[0].objectPtr);
 				(yyval.listPtr)->nextPtr = NULL;
 			    } else {
 				(yyval.listPtr) = NULL;
 			    }
-			;}
+			}
+#line 5098 "parser-smi.c"
     break;
 
-  case 141:
-#line 3243 "parser-smi.y"
-    {
+  case 141: /* VarTypes: VarTypes ',' VarType  */
+#line 3245 "parser-smi.y"
+                        {
 			    List *p, *pp;
 
-			    if ((yyvsp[(3) - (3)].objectPtr)) {
+			    if ((yyvsp[0].objectPtr)) {
 				p = smiMalloc(sizeof(List));
-				p->ptr = (yyvsp[(3) - (3)].objectPtr);
+				p->ptr = (yyvsp[0].objectPtr);
 				p->nextPtr = NULL;
-				if ((yyvsp[(1) - (3)].listPtr)) {
-				    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr;
+				if ((yyvsp[-2].listPtr)) {
+				    for (pp = (yyvsp[-2].listPtr); pp->nextPtr;
 					 pp = pp->nextPtr);
 				    pp->nextPtr = p;
-				    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
+				    (yyval.listPtr) = (yyvsp[-2].listPtr);
 				} else {
 				    (yyval.listPtr) = p;
 				}
 			    } else {
-				(yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
+				(yyval.listPtr) = (yyvsp[-2].listPtr);
 			    }
-			;}
+			}
+#line 5122 "parser-smi.c"
     break;
 
-  case 142:
-#line 3265 "parser-smi.y"
-    {
-			    (yyval.objectPtr) = (yyvsp[(1) - (1)].objectPtr);
-			;}
+  case 142: /* VarType: ObjectName  */
+#line 3267 "parser-smi.y"
+                        {
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
+			}
+#line 5130 "parser-smi.c"
     break;
 
-  case 143:
-#line 3271 "parser-smi.y"
-    {
-			    (yyval.text) = (yyvsp[(2) - (2)].text);
-			    checkDescr(thisParserPtr, (yyvsp[(2) - (2)].text));
-			;}
+  case 143: /* DescrPart: DESCRIPTION Text  */
+#line 3273 "parser-smi.y"
+                        {
+			    (yyval.text) = (yyvsp[0].text);
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
+			}
+#line 5139 "parser-smi.c"
     break;
 
-  case 144:
-#line 3276 "parser-smi.y"
-    { (yyval.text) = NULL; ;}
+  case 144: /* DescrPart: %empty  */
+#line 3278 "parser-smi.y"
+                        { (yyval.text) = NULL; }
+#line 5145 "parser-smi.c"
     break;
 
-  case 145:
-#line 3280 "parser-smi.y"
-    {
-                            (yyval.access) = (yyvsp[(1) - (1)].access);
-                        ;}
+  case 145: /* MaxOrPIBAccessPart: MaxAccessPart  */
+#line 3282 "parser-smi.y"
+                        {
+                            (yyval.access) = (yyvsp[0].access);
+                        }
+#line 5153 "parser-smi.c"
     break;
 
-  case 146:
-#line 3284 "parser-smi.y"
-    {
+  case 146: /* MaxOrPIBAccessPart: PibAccessPart  */
+#line 3286 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SPPI_CONSTRUCT_IN_MIB, "MAX-ACCESS");
-                            if ((yyvsp[(1) - (1)].access) == SMI_ACCESS_NOT_ACCESSIBLE)
+                            if ((yyvsp[0].access) == SMI_ACCESS_NOT_ACCESSIBLE)
                                 smiPrintError(thisParserPtr, ERR_NOT_ACCESSIBLE_IN_PIB_ACCESS);
-                            (yyval.access) = (yyvsp[(1) - (1)].access);
-                        ;}
+                            (yyval.access) = (yyvsp[0].access);
+                        }
+#line 5165 "parser-smi.c"
     break;
 
-  case 147:
-#line 3292 "parser-smi.y"
-    { (yyval.access) = 0;  ;}
+  case 147: /* MaxOrPIBAccessPart: %empty  */
+#line 3294 "parser-smi.y"
+                        { (yyval.access) = 0;  }
+#line 5171 "parser-smi.c"
     break;
 
-  case 148:
-#line 3296 "parser-smi.y"
-    { (yyval.access) = (yyvsp[(2) - (2)].access); ;}
+  case 148: /* PibAccessPart: PibAccess Access  */
+#line 3298 "parser-smi.y"
+                        { (yyval.access) = (yyvsp[0].access); }
+#line 5177 "parser-smi.c"
     break;
 
-  case 149:
-#line 3300 "parser-smi.y"
-    { 
+  case 149: /* PibAccess: POLICY_ACCESS  */
+#line 3302 "parser-smi.y"
+                        { 
                             smiPrintError(thisParserPtr, ERR_POLICY_ACCESS_IN_PIB);
-                        ;}
+                        }
+#line 5185 "parser-smi.c"
     break;
 
-  case 150:
-#line 3304 "parser-smi.y"
-    { ;}
+  case 150: /* PibAccess: PIB_ACCESS  */
+#line 3306 "parser-smi.y"
+                        { }
+#line 5191 "parser-smi.c"
     break;
 
-  case 151:
-#line 3308 "parser-smi.y"
-    {
+  case 151: /* $@18: %empty  */
+#line 3310 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SPPI_CONSTRUCT_IN_MIB, "PIB-REFERENCES");
-                        ;}
+                        }
+#line 5200 "parser-smi.c"
     break;
 
-  case 152:
-#line 3313 "parser-smi.y"
-    { (yyval.objectPtr) = (yyvsp[(4) - (5)].objectPtr); ;}
+  case 152: /* SPPIPibReferencesPart: PIB_REFERENCES $@18 '{' Entry '}'  */
+#line 3315 "parser-smi.y"
+                        { (yyval.objectPtr) = (yyvsp[-1].objectPtr); }
+#line 5206 "parser-smi.c"
     break;
 
-  case 153:
-#line 3315 "parser-smi.y"
-    { (yyval.objectPtr) = 0; ;}
+  case 153: /* SPPIPibReferencesPart: %empty  */
+#line 3317 "parser-smi.y"
+                        { (yyval.objectPtr) = 0; }
+#line 5212 "parser-smi.c"
     break;
 
-  case 154:
-#line 3319 "parser-smi.y"
-    {
+  case 154: /* $@19: %empty  */
+#line 3321 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SPPI_CONSTRUCT_IN_MIB, "PIB-TAG");
-                        ;}
+                        }
+#line 5221 "parser-smi.c"
     break;
 
-  case 155:
-#line 3324 "parser-smi.y"
-    { (yyval.objectPtr) = (yyvsp[(4) - (5)].objectPtr); ;}
+  case 155: /* SPPIPibTagPart: PIB_TAG $@19 '{' ObjectName '}'  */
+#line 3326 "parser-smi.y"
+                        { (yyval.objectPtr) = (yyvsp[-1].objectPtr); }
+#line 5227 "parser-smi.c"
     break;
 
-  case 156:
-#line 3326 "parser-smi.y"
-    { (yyval.objectPtr) = 0; ;}
+  case 156: /* SPPIPibTagPart: %empty  */
+#line 3328 "parser-smi.y"
+                        { (yyval.objectPtr) = 0; }
+#line 5233 "parser-smi.c"
     break;
 
-  case 157:
-#line 3331 "parser-smi.y"
-    {
+  case 157: /* $@20: %empty  */
+#line 3333 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SPPI_CONSTRUCT_IN_MIB, "UNIQUENESS");
-                        ;}
+                        }
+#line 5242 "parser-smi.c"
     break;
 
-  case 158:
-#line 3336 "parser-smi.y"
-    { (yyval.listPtr) = (yyvsp[(4) - (5)].listPtr); ;}
-    break;
-
-  case 159:
+  case 158: /* SPPIUniquePart: UNIQUENESS $@20 '{' UniqueTypesPart '}'  */
 #line 3338 "parser-smi.y"
-    { (yyval.listPtr) = NULL; ;}
+                        { (yyval.listPtr) = (yyvsp[-1].listPtr); }
+#line 5248 "parser-smi.c"
     break;
 
-  case 160:
-#line 3342 "parser-smi.y"
-    { (yyval.listPtr) = (yyvsp[(1) - (1)].listPtr); ;}
+  case 159: /* SPPIUniquePart: %empty  */
+#line 3340 "parser-smi.y"
+                        { (yyval.listPtr) = NULL; }
+#line 5254 "parser-smi.c"
     break;
 
-  case 161:
+  case 160: /* UniqueTypesPart: UniqueTypes  */
 #line 3344 "parser-smi.y"
-    { (yyval.listPtr) = NULL; ;}
+                        { (yyval.listPtr) = (yyvsp[0].listPtr); }
+#line 5260 "parser-smi.c"
     break;
 
-  case 162:
-#line 3348 "parser-smi.y"
-    {
+  case 161: /* UniqueTypesPart: %empty  */
+#line 3346 "parser-smi.y"
+                        { (yyval.listPtr) = NULL; }
+#line 5266 "parser-smi.c"
+    break;
+
+  case 162: /* UniqueTypes: UniqueType  */
+#line 3350 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].objectPtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].objectPtr);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 5276 "parser-smi.c"
     break;
 
-  case 163:
-#line 3355 "parser-smi.y"
-    {
+  case 163: /* UniqueTypes: UniqueTypes ',' UniqueType  */
+#line 3357 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (yyvsp[(3) - (3)].objectPtr);
+			    p->ptr = (yyvsp[0].objectPtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-                        ;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+                        }
+#line 5291 "parser-smi.c"
     break;
 
-  case 164:
-#line 3368 "parser-smi.y"
-    { (yyval.objectPtr) = (yyvsp[(1) - (1)].objectPtr); ;}
+  case 164: /* UniqueType: ObjectName  */
+#line 3370 "parser-smi.y"
+                        { (yyval.objectPtr) = (yyvsp[0].objectPtr); }
+#line 5297 "parser-smi.c"
     break;
 
-  case 165:
-#line 3372 "parser-smi.y"
-    {
+  case 165: /* $@21: %empty  */
+#line 3374 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SPPI_CONSTRUCT_IN_MIB, "INSTALL-ERRORS");
-                        ;}
+                        }
+#line 5306 "parser-smi.c"
     break;
 
-  case 166:
-#line 3377 "parser-smi.y"
-    { (yyval.listPtr) = (yyvsp[(4) - (5)].listPtr); ;}
+  case 166: /* SPPIErrorsPart: INSTALL_ERRORS $@21 '{' Errors '}'  */
+#line 3379 "parser-smi.y"
+                        { (yyval.listPtr) = (yyvsp[-1].listPtr); }
+#line 5312 "parser-smi.c"
     break;
 
-  case 167:
-#line 3379 "parser-smi.y"
-    { (yyval.listPtr) = NULL; ;}
+  case 167: /* SPPIErrorsPart: %empty  */
+#line 3381 "parser-smi.y"
+                        { (yyval.listPtr) = NULL; }
+#line 5318 "parser-smi.c"
     break;
 
-  case 168:
-#line 3383 "parser-smi.y"
-    {
+  case 168: /* Errors: Error  */
+#line 3385 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].objectPtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].objectPtr);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 5328 "parser-smi.c"
     break;
 
-  case 169:
-#line 3390 "parser-smi.y"
-    {
+  case 169: /* Errors: Errors ',' Error  */
+#line 3392 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (yyvsp[(3) - (3)].objectPtr);
+			    p->ptr = (yyvsp[0].objectPtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-                        ;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+                        }
+#line 5343 "parser-smi.c"
     break;
 
-  case 170:
-#line 3403 "parser-smi.y"
-    {
+  case 170: /* Error: LOWERCASE_IDENTIFIER '(' NUMBER ')'  */
+#line 3405 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    
-                            if (((yyvsp[(3) - (4)].unsigned32) < 1) || ((yyvsp[(3) - (4)].unsigned32) > 65536))
-                                smiPrintError(thisParserPtr, ERR_ERROR_NUMBER_RANGE, (yyvsp[(3) - (4)].unsigned32));
+                            if (((yyvsp[-1].unsigned32) < 1) || ((yyvsp[-1].unsigned32) > 65536))
+                                smiPrintError(thisParserPtr, ERR_ERROR_NUMBER_RANGE, (yyvsp[-1].unsigned32));
                             /*
                              * This is not a regular object that will be added vid
                              * 'addObject' as error identifier have no other
@@ -5521,62 +5356,68 @@ yyreduce:
                              * a direct mapping to the actual protocol fields.
                              */
                             objectPtr = smiMalloc(sizeof(Object));
-                            objectPtr->export.name = (yyvsp[(1) - (4)].id);
+                            objectPtr->export.name = (yyvsp[-3].id);
                             objectPtr->export.oidlen = 1;
-                            objectPtr->export.oid = (void *)(yyvsp[(3) - (4)].unsigned32);
+                            objectPtr->export.oid = (void *)(yyvsp[-1].unsigned32);
 			    (yyval.objectPtr) = objectPtr;
-			;}
+			}
+#line 5365 "parser-smi.c"
     break;
 
-  case 171:
-#line 3424 "parser-smi.y"
-    {
+  case 171: /* $@22: %empty  */
+#line 3426 "parser-smi.y"
+                        {
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_SMIV1)
 			    {
 			        smiPrintError(thisParserPtr,
 					      ERR_MAX_ACCESS_IN_SMIV1);
 			    } else if (thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SMI_CONSTRUCT_IN_PIB, "MAX-ACCESS");
-			;}
+			}
+#line 5378 "parser-smi.c"
     break;
 
-  case 172:
-#line 3433 "parser-smi.y"
-    { (yyval.access) = (yyvsp[(3) - (3)].access); ;}
+  case 172: /* MaxAccessPart: MAX_ACCESS $@22 Access  */
+#line 3435 "parser-smi.y"
+                        { (yyval.access) = (yyvsp[0].access); }
+#line 5384 "parser-smi.c"
     break;
 
-  case 173:
-#line 3435 "parser-smi.y"
-    {
+  case 173: /* $@23: %empty  */
+#line 3437 "parser-smi.y"
+                        {
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_SMIV2)
 			    {
 			        smiPrintError(thisParserPtr, ERR_ACCESS_IN_SMIV2);
 			    } else if (thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SMI_CONSTRUCT_IN_PIB, "ACCESS");
-			;}
+			}
+#line 5396 "parser-smi.c"
     break;
 
-  case 174:
-#line 3444 "parser-smi.y"
-    { (yyval.access) = (yyvsp[(3) - (3)].access); ;}
+  case 174: /* MaxAccessPart: ACCESS $@23 Access  */
+#line 3446 "parser-smi.y"
+                        { (yyval.access) = (yyvsp[0].access); }
+#line 5402 "parser-smi.c"
     break;
 
-  case 175:
-#line 3448 "parser-smi.y"
-    {
+  case 175: /* $@24: %empty  */
+#line 3450 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_NOTIFICATIONTYPE;
 
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_OIDNAME_32, ERR_OIDNAME_64);
 			    smiCheckObjectName(thisParserPtr,
-					       thisModulePtr, (yyvsp[(1) - (1)].id));
-			;}
+					       thisModulePtr, (yyvsp[0].id));
+			}
+#line 5416 "parser-smi.c"
     break;
 
-  case 176:
-#line 3458 "parser-smi.y"
-    {
+  case 176: /* $@25: %empty  */
+#line 3460 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
                             if (thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI)
@@ -5592,58 +5433,62 @@ yyreduce:
 					      "NOTIFICATION-TYPE",
 					      "SNMPv2-SMI");
 			    }
-			;}
+			}
+#line 5438 "parser-smi.c"
     break;
 
-  case 177:
-#line 3478 "parser-smi.y"
-    {
-			    checkDescr(thisParserPtr, (yyvsp[(9) - (9)].text));
-			;}
+  case 177: /* $@26: %empty  */
+#line 3480 "parser-smi.y"
+                        {
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
+			}
+#line 5446 "parser-smi.c"
     break;
 
-  case 178:
-#line 3484 "parser-smi.y"
-    {
+  case 178: /* notificationTypeClause: LOWERCASE_IDENTIFIER $@24 NOTIFICATION_TYPE $@25 NotificationObjectsPart STATUS Status DESCRIPTION Text $@26 ReferPart COLON_COLON_EQUAL '{' NotificationName '}'  */
+#line 3486 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    
-			    objectPtr = (yyvsp[(14) - (15)].objectPtr);
+			    objectPtr = (yyvsp[-1].objectPtr);
 
-			    smiCheckObjectReuse(thisParserPtr, (yyvsp[(1) - (15)].id), &objectPtr);
+			    smiCheckObjectReuse(thisParserPtr, (yyvsp[-14].id), &objectPtr);
 
-			    objectPtr = setObjectName(objectPtr, (yyvsp[(1) - (15)].id), thisParserPtr);
+			    objectPtr = setObjectName(objectPtr, (yyvsp[-14].id), thisParserPtr);
 			    setObjectDecl(objectPtr,
 					  SMI_DECL_NOTIFICATIONTYPE);
 			    setObjectLine(objectPtr, thisParserPtr->firstStatementLine,
 					  thisParserPtr);
 			    addObjectFlags(objectPtr, FLAG_REGISTERED);
 			    deleteObjectFlags(objectPtr, FLAG_INCOMPLETE);
-			    setObjectList(objectPtr, (yyvsp[(5) - (15)].listPtr));
-			    setObjectStatus(objectPtr, (yyvsp[(7) - (15)].status));
-			    setObjectDescription(objectPtr, (yyvsp[(9) - (15)].text), thisParserPtr);
-			    if ((yyvsp[(11) - (15)].text)) {
-				setObjectReference(objectPtr, (yyvsp[(11) - (15)].text), thisParserPtr);
+			    setObjectList(objectPtr, (yyvsp[-10].listPtr));
+			    setObjectStatus(objectPtr, (yyvsp[-8].status));
+			    setObjectDescription(objectPtr, (yyvsp[-6].text), thisParserPtr);
+			    if ((yyvsp[-4].text)) {
+				setObjectReference(objectPtr, (yyvsp[-4].text), thisParserPtr);
 			    }
 			    (yyval.err) = 0;
-			;}
+			}
+#line 5473 "parser-smi.c"
     break;
 
-  case 179:
-#line 3509 "parser-smi.y"
-    {
+  case 179: /* $@27: %empty  */
+#line 3511 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_MODULEIDENTITY;
 			    
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_OIDNAME_32, ERR_OIDNAME_64);
 			    smiCheckObjectName(thisParserPtr,
-					       thisModulePtr, (yyvsp[(1) - (1)].id));
-			;}
+					       thisModulePtr, (yyvsp[0].id));
+			}
+#line 5487 "parser-smi.c"
     break;
 
-  case 180:
-#line 3519 "parser-smi.y"
-    {
+  case 180: /* $@28: %empty  */
+#line 3521 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    importPtr = findImportByName("MODULE-IDENTITY",
@@ -5666,53 +5511,59 @@ yyreduce:
 			        smiPrintError(thisParserPtr,
 					      ERR_MODULE_IDENTITY_NOT_FIRST);
 			    }
-			;}
+			}
+#line 5516 "parser-smi.c"
     break;
 
-  case 181:
-#line 3544 "parser-smi.y"
-    {
+  case 181: /* $@29: %empty  */
+#line 3546 "parser-smi.y"
+                        {
                           /* do nothing at the moment */
-                        ;}
+                        }
+#line 5524 "parser-smi.c"
     break;
 
-  case 182:
-#line 3548 "parser-smi.y"
-    {
-			    setModuleLastUpdated(thisParserPtr->modulePtr, (yyvsp[(8) - (8)].date));
-			;}
+  case 182: /* $@30: %empty  */
+#line 3550 "parser-smi.y"
+                        {
+			    setModuleLastUpdated(thisParserPtr->modulePtr, (yyvsp[0].date));
+			}
+#line 5532 "parser-smi.c"
     break;
 
-  case 183:
-#line 3552 "parser-smi.y"
-    {
-			    if ((yyvsp[(11) - (11)].text) && !strlen((yyvsp[(11) - (11)].text))) {
+  case 183: /* $@31: %empty  */
+#line 3554 "parser-smi.y"
+                        {
+			    if ((yyvsp[0].text) && !strlen((yyvsp[0].text))) {
 				smiPrintError(thisParserPtr,
 					      ERR_EMPTY_ORGANIZATION);
 			    }
-			;}
+			}
+#line 5543 "parser-smi.c"
     break;
 
-  case 184:
-#line 3559 "parser-smi.y"
-    {
-			    if ((yyvsp[(14) - (14)].text) && !strlen((yyvsp[(14) - (14)].text))) {
+  case 184: /* $@32: %empty  */
+#line 3561 "parser-smi.y"
+                        {
+			    if ((yyvsp[0].text) && !strlen((yyvsp[0].text))) {
 				smiPrintError(thisParserPtr,
 					      ERR_EMPTY_CONTACT);
 			    }
-			;}
+			}
+#line 5554 "parser-smi.c"
     break;
 
-  case 185:
-#line 3566 "parser-smi.y"
-    {
-			    checkDescr(thisParserPtr, (yyvsp[(17) - (17)].text));
-			;}
+  case 185: /* $@33: %empty  */
+#line 3568 "parser-smi.y"
+                        {
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
+			}
+#line 5562 "parser-smi.c"
     break;
 
-  case 186:
-#line 3570 "parser-smi.y"
-    {
+  case 186: /* $@34: %empty  */
+#line 3572 "parser-smi.y"
+                        {
 			    if ((!thisModulePtr->firstRevisionPtr) ||
 				(thisModulePtr->firstRevisionPtr->export.date !=
 				 thisModulePtr->lastUpdated)) {
@@ -5723,20 +5574,21 @@ yyreduce:
 						"[Revision added by libsmi due to a LAST-UPDATED clause.]"),
 					    thisParserPtr);
 			    }
-			;}
+			}
+#line 5579 "parser-smi.c"
     break;
 
-  case 187:
-#line 3584 "parser-smi.y"
-    {
+  case 187: /* moduleIdentityClause: LOWERCASE_IDENTIFIER $@27 MODULE_IDENTITY $@28 SubjectCategoriesPart $@29 LAST_UPDATED ExtUTCTime $@30 ORGANIZATION Text $@31 CONTACT_INFO Text $@32 DESCRIPTION Text $@33 RevisionPart $@34 COLON_COLON_EQUAL '{' objectIdentifier '}'  */
+#line 3586 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    
-			    objectPtr = (yyvsp[(23) - (24)].objectPtr);
-			    smiCheckObjectReuse(thisParserPtr, (yyvsp[(1) - (24)].id), &objectPtr);
+			    objectPtr = (yyvsp[-1].objectPtr);
+			    smiCheckObjectReuse(thisParserPtr, (yyvsp[-23].id), &objectPtr);
 
 			    thisParserPtr->modulePtr->numModuleIdentities++;
 
-			    objectPtr = setObjectName(objectPtr, (yyvsp[(1) - (24)].id), thisParserPtr);
+			    objectPtr = setObjectName(objectPtr, (yyvsp[-23].id), thisParserPtr);
 			    setObjectDecl(objectPtr, SMI_DECL_MODULEIDENTITY);
 			    setObjectLine(objectPtr, thisParserPtr->firstStatementLine,
 					  thisParserPtr);
@@ -5746,77 +5598,83 @@ yyreduce:
 			    setModuleIdentityObject(thisParserPtr->modulePtr,
 						    objectPtr);
 			    setModuleOrganization(thisParserPtr->modulePtr,
-						  (yyvsp[(11) - (24)].text));
+						  (yyvsp[-13].text));
 			    setModuleContactInfo(thisParserPtr->modulePtr,
-						 (yyvsp[(14) - (24)].text));
+						 (yyvsp[-10].text));
 			    setModuleDescription(thisParserPtr->modulePtr,
-						 (yyvsp[(17) - (24)].text), thisParserPtr);
-                            if ((yyvsp[(5) - (24)].subjectCategoriesPtr) != NULL) {
-                                setObjectList(objectPtr, (yyvsp[(5) - (24)].subjectCategoriesPtr)->categories);
-                                smiFree((yyvsp[(5) - (24)].subjectCategoriesPtr));
+						 (yyvsp[-7].text), thisParserPtr);
+                            if ((yyvsp[-19].subjectCategoriesPtr) != NULL) {
+                                setObjectList(objectPtr, (yyvsp[-19].subjectCategoriesPtr)->categories);
+                                smiFree((yyvsp[-19].subjectCategoriesPtr));
                             }
 			    /* setObjectDescription(objectPtr, $15); */
 			    (yyval.err) = 0;
-			;}
+			}
+#line 5614 "parser-smi.c"
     break;
 
-  case 188:
-#line 3617 "parser-smi.y"
-    {
+  case 188: /* SubjectCategoriesPart: SUBJECT_CATEGORIES '{' SubjectCategories '}'  */
+#line 3619 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SPPI_CONSTRUCT_IN_MIB, "SUBJECT-CATEGORIES");
-                            (yyval.subjectCategoriesPtr) = (yyvsp[(3) - (4)].subjectCategoriesPtr);
-                        ;}
+                            (yyval.subjectCategoriesPtr) = (yyvsp[-1].subjectCategoriesPtr);
+                        }
+#line 5624 "parser-smi.c"
     break;
 
-  case 189:
-#line 3623 "parser-smi.y"
-    {
+  case 189: /* SubjectCategoriesPart: %empty  */
+#line 3625 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SUBJECT_CATEGORIES_MISSING);
                             (yyval.subjectCategoriesPtr) = NULL;
-                        ;}
+                        }
+#line 5634 "parser-smi.c"
     break;
 
-  case 190:
-#line 3631 "parser-smi.y"
-    {
+  case 190: /* SubjectCategories: CategoryIDs  */
+#line 3633 "parser-smi.y"
+                        {
                             (yyval.subjectCategoriesPtr) = smiMalloc(sizeof(SubjectCategories));
-                            (yyval.subjectCategoriesPtr)->categories    = (yyvsp[(1) - (1)].listPtr);
-                        ;}
+                            (yyval.subjectCategoriesPtr)->categories    = (yyvsp[0].listPtr);
+                        }
+#line 5643 "parser-smi.c"
     break;
 
-  case 191:
-#line 3638 "parser-smi.y"
-    {
+  case 191: /* CategoryIDs: CategoryID  */
+#line 3640 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].objectPtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].objectPtr);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 5653 "parser-smi.c"
     break;
 
-  case 192:
-#line 3644 "parser-smi.y"
-    {
+  case 192: /* CategoryIDs: CategoryIDs ',' CategoryID  */
+#line 3646 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
-                            if ((yyvsp[(1) - (3)].listPtr)->ptr == NULL)
+                            if ((yyvsp[-2].listPtr)->ptr == NULL)
                                 smiPrintError(thisParserPtr, ERR_SUBJECT_CATEGORIES_ALL);
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (void *)(yyvsp[(3) - (3)].objectPtr);
+			    p->ptr = (void *)(yyvsp[0].objectPtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-			;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+			}
+#line 5670 "parser-smi.c"
     break;
 
-  case 193:
-#line 3659 "parser-smi.y"
-    {
+  case 193: /* CategoryID: LOWERCASE_IDENTIFIER  */
+#line 3661 "parser-smi.y"
+                        {
                             Object *objectPtr;
                             
-                            if (strcmp((yyvsp[(1) - (1)].id), "all"))
+                            if (strcmp((yyvsp[0].id), "all"))
                                 smiPrintError(thisParserPtr, ERR_SUBJECT_CATEGORIES_MISSING_SUBID);
                             else {
                                 /*
@@ -5831,16 +5689,17 @@ yyreduce:
                                 objectPtr->export.oid = 0;
                                 (yyval.objectPtr) = objectPtr;
                             }
-                            smiFree((yyvsp[(1) - (1)].id));
-                        ;}
+                            smiFree((yyvsp[0].id));
+                        }
+#line 5695 "parser-smi.c"
     break;
 
-  case 194:
-#line 3680 "parser-smi.y"
-    {
+  case 194: /* CategoryID: LOWERCASE_IDENTIFIER '(' NUMBER ')'  */
+#line 3682 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    
-                            if (!strcmp((yyvsp[(1) - (4)].id), "all")) {
+                            if (!strcmp((yyvsp[-3].id), "all")) {
                                 smiPrintError(thisParserPtr, ERR_SUBJECT_CATEGORIES_ALL_WITH_SUBID);
                                 (yyval.objectPtr) = NULL;
                             } else {
@@ -5851,24 +5710,26 @@ yyreduce:
                                  * a direct mapping to the actual protocol fields.
                                  */
                                 objectPtr = smiMalloc(sizeof(Object));
-                                objectPtr->export.name = (yyvsp[(1) - (4)].id);
+                                objectPtr->export.name = (yyvsp[-3].id);
                                 objectPtr->export.oidlen = 1;
-                                objectPtr->export.oid = (void *)(yyvsp[(3) - (4)].unsigned32);
+                                objectPtr->export.oid = (void *)(yyvsp[-1].unsigned32);
                                 (yyval.objectPtr) = objectPtr;
                             }
-			;}
+			}
+#line 5720 "parser-smi.c"
     break;
 
-  case 195:
-#line 3703 "parser-smi.y"
-    {
-			    (yyval.typePtr) = (yyvsp[(1) - (1)].typePtr);
-			;}
+  case 195: /* ObjectSyntax: SimpleSyntax  */
+#line 3705 "parser-smi.y"
+                        {
+			    (yyval.typePtr) = (yyvsp[0].typePtr);
+			}
+#line 5728 "parser-smi.c"
     break;
 
-  case 196:
-#line 3707 "parser-smi.y"
-    {
+  case 196: /* ObjectSyntax: typeTag SimpleSyntax  */
+#line 3709 "parser-smi.y"
+                        {
 			    if (strcmp(thisParserPtr->modulePtr->export.name,
 				       "SNMPv2-SMI") &&
 			        strcmp(thisParserPtr->modulePtr->export.name,
@@ -5883,43 +5744,47 @@ yyreduce:
 				       "RFC1155-SMI") &&
                                 strcmp(thisParserPtr->modulePtr->export.name,
                                        "COPS-PR-SPPI")) {
-			        smiPrintError(thisParserPtr, ERR_TYPE_TAG, (yyvsp[(1) - (2)].err));
+			        smiPrintError(thisParserPtr, ERR_TYPE_TAG, (yyvsp[-1].err));
 			    }
-			    (yyval.typePtr) = (yyvsp[(2) - (2)].typePtr);
-			;}
+			    (yyval.typePtr) = (yyvsp[0].typePtr);
+			}
+#line 5752 "parser-smi.c"
     break;
 
-  case 197:
-#line 3727 "parser-smi.y"
-    {
+  case 197: /* ObjectSyntax: conceptualTable  */
+#line 3729 "parser-smi.y"
+                        {
 			    /* TODO */
-			    (yyval.typePtr) = (yyvsp[(1) - (1)].typePtr);
-			;}
+			    (yyval.typePtr) = (yyvsp[0].typePtr);
+			}
+#line 5761 "parser-smi.c"
     break;
 
-  case 198:
-#line 3732 "parser-smi.y"
-    {
+  case 198: /* ObjectSyntax: row  */
+#line 3734 "parser-smi.y"
+                        {
 			    /* TODO */
-			    (yyval.typePtr) = (yyvsp[(1) - (1)].typePtr);
-			;}
+			    (yyval.typePtr) = (yyvsp[0].typePtr);
+			}
+#line 5770 "parser-smi.c"
     break;
 
-  case 199:
-#line 3737 "parser-smi.y"
-    {
+  case 199: /* ObjectSyntax: entryType  */
+#line 3739 "parser-smi.y"
+                        {
 			    /* TODO */
-			    (yyval.typePtr) = (yyvsp[(1) - (1)].typePtr);
-			;}
+			    (yyval.typePtr) = (yyvsp[0].typePtr);
+			}
+#line 5779 "parser-smi.c"
     break;
 
-  case 200:
-#line 3742 "parser-smi.y"
-    {
+  case 200: /* ObjectSyntax: ApplicationSyntax  */
+#line 3744 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
-			    if ((yyvsp[(1) - (1)].typePtr) && (yyvsp[(1) - (1)].typePtr)->export.name) {
-				importPtr = findImportByName((yyvsp[(1) - (1)].typePtr)->export.name,
+			    if ((yyvsp[0].typePtr) && (yyvsp[0].typePtr)->export.name) {
+				importPtr = findImportByName((yyvsp[0].typePtr)->export.name,
 							     thisModulePtr);
 				if (importPtr) {
 				    importPtr->use++;
@@ -5927,32 +5792,36 @@ yyreduce:
 			    }
 
 			    /* TODO */
-			    (yyval.typePtr) = (yyvsp[(1) - (1)].typePtr);
-			;}
+			    (yyval.typePtr) = (yyvsp[0].typePtr);
+			}
+#line 5798 "parser-smi.c"
     break;
 
-  case 201:
-#line 3759 "parser-smi.y"
-    { (yyval.err) = 0; /* TODO: check range */ ;}
+  case 201: /* typeTag: '[' APPLICATION NUMBER ']' IMPLICIT  */
+#line 3761 "parser-smi.y"
+                        { (yyval.err) = 0; /* TODO: check range */ }
+#line 5804 "parser-smi.c"
     break;
 
-  case 202:
-#line 3761 "parser-smi.y"
-    { (yyval.err) = 0; /* TODO: check range */ ;}
+  case 202: /* typeTag: '[' UNIVERSAL NUMBER ']' IMPLICIT  */
+#line 3763 "parser-smi.y"
+                        { (yyval.err) = 0; /* TODO: check range */ }
+#line 5810 "parser-smi.c"
     break;
 
-  case 203:
-#line 3769 "parser-smi.y"
-    { (yyval.typePtr) = (yyvsp[(1) - (1)].typePtr); ;}
+  case 203: /* sequenceObjectSyntax: sequenceSimpleSyntax  */
+#line 3771 "parser-smi.y"
+                        { (yyval.typePtr) = (yyvsp[0].typePtr); }
+#line 5816 "parser-smi.c"
     break;
 
-  case 204:
-#line 3774 "parser-smi.y"
-    {
+  case 204: /* sequenceObjectSyntax: sequenceApplicationSyntax  */
+#line 3776 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
-			    if ((yyvsp[(1) - (1)].typePtr) && (yyvsp[(1) - (1)].typePtr)->export.name) {
-				importPtr = findImportByName((yyvsp[(1) - (1)].typePtr)->export.name,
+			    if ((yyvsp[0].typePtr) && (yyvsp[0].typePtr)->export.name) {
+				importPtr = findImportByName((yyvsp[0].typePtr)->export.name,
 							     thisModulePtr);
 				if (importPtr) {
 				    importPtr->use++;
@@ -5960,18 +5829,20 @@ yyreduce:
 			    }
 
 			    /* TODO */
-			    (yyval.typePtr) = (yyvsp[(1) - (1)].typePtr);
-			;}
+			    (yyval.typePtr) = (yyvsp[0].typePtr);
+			}
+#line 5835 "parser-smi.c"
     break;
 
-  case 205:
-#line 3791 "parser-smi.y"
-    { (yyval.valuePtr) = (yyvsp[(1) - (1)].valuePtr); ;}
+  case 205: /* valueofObjectSyntax: valueofSimpleSyntax  */
+#line 3793 "parser-smi.y"
+                        { (yyval.valuePtr) = (yyvsp[0].valuePtr); }
+#line 5841 "parser-smi.c"
     break;
 
-  case 206:
-#line 3800 "parser-smi.y"
-    {
+  case 206: /* SimpleSyntax: INTEGER  */
+#line 3802 "parser-smi.y"
+                        {
 			    if ((thisModulePtr->export.language == SMI_LANGUAGE_SMIV2)
 				&&
 				(strcmp(thisModulePtr->export.name, "SNMPv2-SMI") &&
@@ -5982,19 +5853,21 @@ yyreduce:
 
 			    defaultBasetype = SMI_BASETYPE_INTEGER32;
 			    (yyval.typePtr) = smiHandle->typeInteger32Ptr;
-			;}
+			}
+#line 5858 "parser-smi.c"
     break;
 
-  case 207:
-#line 3813 "parser-smi.y"
-    {
+  case 207: /* $@35: %empty  */
+#line 3815 "parser-smi.y"
+                        {
 			    defaultBasetype = SMI_BASETYPE_INTEGER32;
-			;}
+			}
+#line 5866 "parser-smi.c"
     break;
 
-  case 208:
-#line 3817 "parser-smi.y"
-    {
+  case 208: /* SimpleSyntax: INTEGER $@35 integerSubType  */
+#line 3819 "parser-smi.y"
+                        {
 			    if ((thisModulePtr->export.language == SMI_LANGUAGE_SMIV2)
 				&&
 				(strcmp(thisModulePtr->export.name, "SNMPv2-SMI") &&
@@ -6005,35 +5878,38 @@ yyreduce:
 
 			    (yyval.typePtr) = duplicateType(smiHandle->typeInteger32Ptr, 0,
 					       thisParserPtr);
-			    setTypeList((yyval.typePtr), (yyvsp[(3) - (3)].listPtr));
+			    setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 			    smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
-			;}
+			}
+#line 5885 "parser-smi.c"
     break;
 
-  case 209:
-#line 3832 "parser-smi.y"
-    {
+  case 209: /* $@36: %empty  */
+#line 3834 "parser-smi.y"
+                        {
 			    defaultBasetype = SMI_BASETYPE_ENUM;
-			;}
+			}
+#line 5893 "parser-smi.c"
     break;
 
-  case 210:
-#line 3836 "parser-smi.y"
-    {
+  case 210: /* SimpleSyntax: INTEGER $@36 enumSpec  */
+#line 3838 "parser-smi.y"
+                        {
 			    List *p;
 			    
 			    (yyval.typePtr) = duplicateType(smiHandle->typeEnumPtr, 0,
 					       thisParserPtr);
-			    setTypeList((yyval.typePtr), (yyvsp[(3) - (3)].listPtr));
-			    for (p = (yyvsp[(3) - (3)].listPtr); p; p = p->nextPtr)
+			    setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
+			    for (p = (yyvsp[0].listPtr); p; p = p->nextPtr)
 				((NamedNumber *)p->ptr)->typePtr = (yyval.typePtr);
 			    smiCheckNamedNumbersOrder(parserPtr, (yyval.typePtr));
-			;}
+			}
+#line 5908 "parser-smi.c"
     break;
 
-  case 211:
-#line 3847 "parser-smi.y"
-    {
+  case 211: /* SimpleSyntax: INTEGER32  */
+#line 3849 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
 			    defaultBasetype = SMI_BASETYPE_INTEGER32;
@@ -6057,19 +5933,21 @@ yyreduce:
 
 			    /* TODO: any need to distinguish from INTEGER? */
 			    (yyval.typePtr) = smiHandle->typeInteger32Ptr;
-			;}
+			}
+#line 5938 "parser-smi.c"
     break;
 
-  case 212:
-#line 3873 "parser-smi.y"
-    {
+  case 212: /* $@37: %empty  */
+#line 3875 "parser-smi.y"
+                        {
 			    defaultBasetype = SMI_BASETYPE_INTEGER32;
-			;}
+			}
+#line 5946 "parser-smi.c"
     break;
 
-  case 213:
-#line 3877 "parser-smi.y"
-    {
+  case 213: /* SimpleSyntax: INTEGER32 $@37 integerSubType  */
+#line 3879 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    importPtr = findImportByName("Integer32",
@@ -6092,35 +5970,37 @@ yyreduce:
 
 			    (yyval.typePtr) = duplicateType(smiHandle->typeInteger32Ptr, 0,
 					       thisParserPtr);
-			    setTypeList((yyval.typePtr), (yyvsp[(3) - (3)].listPtr));
+			    setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 			    smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
-			;}
+			}
+#line 5977 "parser-smi.c"
     break;
 
-  case 214:
-#line 3904 "parser-smi.y"
-    {
+  case 214: /* $@38: %empty  */
+#line 3906 "parser-smi.y"
+                        {
 			    defaultBasetype = SMI_BASETYPE_ENUM;
-			;}
+			}
+#line 5985 "parser-smi.c"
     break;
 
-  case 215:
-#line 3908 "parser-smi.y"
-    {
+  case 215: /* SimpleSyntax: UPPERCASE_IDENTIFIER $@38 enumSpec  */
+#line 3910 "parser-smi.y"
+                        {
 			    Type *parentPtr;
 			    Import *importPtr;
 			    List *p;
 			    
 			    parentPtr = findTypeByModuleAndName(
-			        thisParserPtr->modulePtr, (yyvsp[(1) - (3)].id));
+			        thisParserPtr->modulePtr, (yyvsp[-2].id));
 			    if (!parentPtr) {
-			        importPtr = findImportByName((yyvsp[(1) - (3)].id),
+			        importPtr = findImportByName((yyvsp[-2].id),
 							     thisModulePtr);
 				if (importPtr &&
 				    importPtr->kind == KIND_TYPE) {
 				    importPtr->use++;
 				    parentPtr = findTypeByModulenameAndName(
-					importPtr->export.module, (yyvsp[(1) - (3)].id));
+					importPtr->export.module, (yyvsp[-2].id));
 				}
 			    }
 			    if (parentPtr) {
@@ -6130,51 +6010,52 @@ yyreduce:
 				     SMI_BASETYPE_BITS)) {
 				    smiPrintError(thisParserPtr,
 						  ERR_ILLEGAL_ENUM_FOR_PARENT_TYPE,
-						  (yyvsp[(1) - (3)].id));
+						  (yyvsp[-2].id));
 				    (yyval.typePtr) = duplicateType(smiHandle->typeEnumPtr, 0,
 						       thisParserPtr);
 				} else {
 				    (yyval.typePtr) = duplicateType(parentPtr, 0,
 						       thisParserPtr);
 				}
-				smiFree((yyvsp[(1) - (3)].id));
+				smiFree((yyvsp[-2].id));
 			    } else {
 				/* 
 				 * forward referenced type. create it,
 				 * marked with FLAG_INCOMPLETE.
 				 */
-				parentPtr = addType((yyvsp[(1) - (3)].id),
+				parentPtr = addType((yyvsp[-2].id),
 						    SMI_BASETYPE_UNKNOWN,
 						    FLAG_INCOMPLETE,
 						    thisParserPtr);
 				(yyval.typePtr) = duplicateType(parentPtr, 0,
 						   thisParserPtr);
 			    }
-			    setTypeList((yyval.typePtr), (yyvsp[(3) - (3)].listPtr));
-			    for (p = (yyvsp[(3) - (3)].listPtr); p; p = p->nextPtr)
+			    setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
+			    for (p = (yyvsp[0].listPtr); p; p = p->nextPtr)
 				((NamedNumber *)p->ptr)->typePtr = (yyval.typePtr);
 			    smiCheckNamedNumbersOrder(parserPtr, (yyval.typePtr));
-			;}
+			}
+#line 6039 "parser-smi.c"
     break;
 
-  case 216:
-#line 3959 "parser-smi.y"
-    {
+  case 216: /* SimpleSyntax: moduleName '.' UPPERCASE_IDENTIFIER enumSpec  */
+#line 3961 "parser-smi.y"
+                        {
 			    Type *parentPtr;
 			    Import *importPtr;
 			    List *p;
 			    
                             defaultBasetype = SMI_BASETYPE_ENUM;
-                            parentPtr = findTypeByModulenameAndName((yyvsp[(1) - (4)].id), (yyvsp[(3) - (4)].id));
+                            parentPtr = findTypeByModulenameAndName((yyvsp[-3].id), (yyvsp[-1].id));
 			    if (!parentPtr) {
 				importPtr =
-				    findImportByModulenameAndName((yyvsp[(1) - (4)].id),
-							  (yyvsp[(3) - (4)].id), thisModulePtr);
+				    findImportByModulenameAndName((yyvsp[-3].id),
+							  (yyvsp[-1].id), thisModulePtr);
 				if (importPtr &&
 				    importPtr->kind == KIND_TYPE) {
 				    importPtr->use++;
 				    parentPtr =
-					findTypeByModulenameAndName((yyvsp[(1) - (4)].id), (yyvsp[(3) - (4)].id));
+					findTypeByModulenameAndName((yyvsp[-3].id), (yyvsp[-1].id));
 				}
 			    }
 			    if (parentPtr) {
@@ -6184,7 +6065,7 @@ yyreduce:
 				     SMI_BASETYPE_BITS)) {
 				    smiPrintError(thisParserPtr,
 						  ERR_ILLEGAL_ENUM_FOR_PARENT_TYPE,
-						  (yyvsp[(3) - (4)].id));
+						  (yyvsp[-1].id));
 				    (yyval.typePtr) = duplicateType(smiHandle->typeEnumPtr, 0,
 						       thisParserPtr);
 				} else {
@@ -6193,35 +6074,36 @@ yyreduce:
 				}
 			    } else {
 				smiPrintError(thisParserPtr,
-					      ERR_UNKNOWN_TYPE, (yyvsp[(3) - (4)].id));
+					      ERR_UNKNOWN_TYPE, (yyvsp[-1].id));
 				(yyval.typePtr) = duplicateType(smiHandle->typeEnumPtr, 0,
 						   thisParserPtr);
 			    }
-			    setTypeList((yyval.typePtr), (yyvsp[(4) - (4)].listPtr));
-			    for (p = (yyvsp[(4) - (4)].listPtr); p; p = p->nextPtr)
+			    setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
+			    for (p = (yyvsp[0].listPtr); p; p = p->nextPtr)
 				((NamedNumber *)p->ptr)->typePtr = (yyval.typePtr);
 			    smiCheckNamedNumbersOrder(parserPtr, (yyval.typePtr));
-			    smiFree((yyvsp[(1) - (4)].id));
-			    smiFree((yyvsp[(3) - (4)].id));
-			;}
+			    smiFree((yyvsp[-3].id));
+			    smiFree((yyvsp[-1].id));
+			}
+#line 6089 "parser-smi.c"
     break;
 
-  case 217:
-#line 4005 "parser-smi.y"
-    {
+  case 217: /* SimpleSyntax: UPPERCASE_IDENTIFIER integerSubType  */
+#line 4007 "parser-smi.y"
+                        {
 			    Type *parentPtr;
 			    Import *importPtr;
 			    
 			    parentPtr = findTypeByModuleAndName(
-				thisParserPtr->modulePtr, (yyvsp[(1) - (2)].id));
+				thisParserPtr->modulePtr, (yyvsp[-1].id));
 			    if (!parentPtr) {
-				importPtr = findImportByName((yyvsp[(1) - (2)].id),
+				importPtr = findImportByName((yyvsp[-1].id),
 							     thisModulePtr);
 				if (importPtr &&
 				    importPtr->kind == KIND_TYPE) {
 				    importPtr->use++;
 				    parentPtr = findTypeByModulenameAndName(
-					importPtr->export.module, (yyvsp[(1) - (2)].id));
+					importPtr->export.module, (yyvsp[-1].id));
 				}
 			    }
 			    if (parentPtr) {
@@ -6235,7 +6117,7 @@ yyreduce:
 				     SMI_BASETYPE_UNSIGNED64)) {
 				    smiPrintError(thisParserPtr,
 					     ERR_ILLEGAL_RANGE_FOR_PARENT_TYPE,
-						  (yyvsp[(1) - (2)].id));
+						  (yyvsp[-1].id));
 				    (yyval.typePtr) = duplicateType(smiHandle->typeInteger32Ptr, 0,
 						       thisParserPtr);
 				    defaultBasetype = SMI_BASETYPE_INTEGER32;
@@ -6245,13 +6127,13 @@ yyreduce:
 				    (yyval.typePtr) = duplicateType(parentPtr, 0,
 						       thisParserPtr);
 				}
-				smiFree((yyvsp[(1) - (2)].id));
+				smiFree((yyvsp[-1].id));
 			    } else {
 				/* 
 				 * forward referenced type. create it,
 				 * marked with FLAG_INCOMPLETE.
 				 */
-				parentPtr = addType((yyvsp[(1) - (2)].id),
+				parentPtr = addType((yyvsp[-1].id),
 						    SMI_BASETYPE_UNKNOWN,
 						    FLAG_INCOMPLETE,
 						    thisParserPtr);
@@ -6259,26 +6141,27 @@ yyreduce:
 						   thisParserPtr);
 				defaultBasetype = SMI_BASETYPE_INTEGER32;
 			    }
-			    setTypeList((yyval.typePtr), (yyvsp[(2) - (2)].listPtr));
+			    setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 			    smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
-			;}
+			}
+#line 6148 "parser-smi.c"
     break;
 
-  case 218:
-#line 4061 "parser-smi.y"
-    {
+  case 218: /* SimpleSyntax: moduleName '.' UPPERCASE_IDENTIFIER integerSubType  */
+#line 4063 "parser-smi.y"
+                        {
 			    Type *parentPtr;
 			    Import *importPtr;
 			    
-			    parentPtr = findTypeByModulenameAndName((yyvsp[(1) - (4)].id), (yyvsp[(3) - (4)].id));
+			    parentPtr = findTypeByModulenameAndName((yyvsp[-3].id), (yyvsp[-1].id));
 			    if (!parentPtr) {
-				importPtr = findImportByModulenameAndName((yyvsp[(1) - (4)].id),
-							  (yyvsp[(3) - (4)].id), thisModulePtr);
+				importPtr = findImportByModulenameAndName((yyvsp[-3].id),
+							  (yyvsp[-1].id), thisModulePtr);
 				if (importPtr &&
 				    importPtr->kind == KIND_TYPE) {
 				    importPtr->use++;
 				    parentPtr = findTypeByModulenameAndName(
-					(yyvsp[(1) - (4)].id), (yyvsp[(3) - (4)].id));
+					(yyvsp[-3].id), (yyvsp[-1].id));
 				}
 			    }
 			    if (parentPtr) {
@@ -6292,7 +6175,7 @@ yyreduce:
 				     SMI_BASETYPE_UNSIGNED64)) {
 				    smiPrintError(thisParserPtr,
 					     ERR_ILLEGAL_RANGE_FOR_PARENT_TYPE,
-						  (yyvsp[(3) - (4)].id));
+						  (yyvsp[-1].id));
 				    (yyval.typePtr) = duplicateType(smiHandle->typeInteger32Ptr, 0,
 						       thisParserPtr);
 				    defaultBasetype = SMI_BASETYPE_INTEGER32;
@@ -6304,61 +6187,65 @@ yyreduce:
 				}
 			    } else {
 				smiPrintError(thisParserPtr,
-					      ERR_UNKNOWN_TYPE, (yyvsp[(3) - (4)].id));
+					      ERR_UNKNOWN_TYPE, (yyvsp[-1].id));
 				(yyval.typePtr) = duplicateType(smiHandle->typeInteger32Ptr, 0,
 						   thisParserPtr);
 				defaultBasetype = SMI_BASETYPE_INTEGER32;
 			    }
-			    setTypeList((yyval.typePtr), (yyvsp[(4) - (4)].listPtr));
+			    setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 			    smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
-			    smiFree((yyvsp[(1) - (4)].id));
-			    smiFree((yyvsp[(3) - (4)].id));
-			;}
+			    smiFree((yyvsp[-3].id));
+			    smiFree((yyvsp[-1].id));
+			}
+#line 6201 "parser-smi.c"
     break;
 
-  case 219:
-#line 4110 "parser-smi.y"
-    {
+  case 219: /* SimpleSyntax: OCTET STRING  */
+#line 4112 "parser-smi.y"
+                        {
 			    defaultBasetype = SMI_BASETYPE_OCTETSTRING;
 			    (yyval.typePtr) = smiHandle->typeOctetStringPtr;
-			;}
+			}
+#line 6210 "parser-smi.c"
     break;
 
-  case 220:
-#line 4115 "parser-smi.y"
-    {
+  case 220: /* $@39: %empty  */
+#line 4117 "parser-smi.y"
+                        {
 			    defaultBasetype = SMI_BASETYPE_OCTETSTRING;
-			;}
+			}
+#line 6218 "parser-smi.c"
     break;
 
-  case 221:
-#line 4119 "parser-smi.y"
-    {
+  case 221: /* SimpleSyntax: OCTET STRING $@39 octetStringSubType  */
+#line 4121 "parser-smi.y"
+                        {
 			    
 			    (yyval.typePtr) = duplicateType(smiHandle->typeOctetStringPtr, 0,
 					       thisParserPtr);
-			    setTypeList((yyval.typePtr), (yyvsp[(4) - (4)].listPtr));
+			    setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 			    smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
-			;}
+			}
+#line 6230 "parser-smi.c"
     break;
 
-  case 222:
-#line 4127 "parser-smi.y"
-    {
+  case 222: /* SimpleSyntax: UPPERCASE_IDENTIFIER octetStringSubType  */
+#line 4129 "parser-smi.y"
+                        {
 			    Type *parentPtr;
 			    Import *importPtr;
 			    
 			    defaultBasetype = SMI_BASETYPE_OCTETSTRING;
 			    parentPtr = findTypeByModuleAndName(
-				thisParserPtr->modulePtr, (yyvsp[(1) - (2)].id));
+				thisParserPtr->modulePtr, (yyvsp[-1].id));
 			    if (!parentPtr) {
-				importPtr = findImportByName((yyvsp[(1) - (2)].id),
+				importPtr = findImportByName((yyvsp[-1].id),
 							     thisModulePtr);
 				if (importPtr &&
 				    importPtr->kind == KIND_TYPE) {
 				    importPtr->use++;
 				    parentPtr = findTypeByModulenameAndName(
-					importPtr->export.module, (yyvsp[(1) - (2)].id));
+					importPtr->export.module, (yyvsp[-1].id));
 				}
 			    }
 			    if (parentPtr) {
@@ -6366,47 +6253,48 @@ yyreduce:
 				    SMI_BASETYPE_OCTETSTRING) {
 				    smiPrintError(thisParserPtr,
 					      ERR_ILLEGAL_SIZE_FOR_PARENT_TYPE,
-						  (yyvsp[(1) - (2)].id));
+						  (yyvsp[-1].id));
 				    (yyval.typePtr) = duplicateType(smiHandle->typeOctetStringPtr, 0,
 						       thisParserPtr);
 				} else {
 				    (yyval.typePtr) = duplicateType(parentPtr, 0,
 						       thisParserPtr);
 				}
-				smiFree((yyvsp[(1) - (2)].id));
+				smiFree((yyvsp[-1].id));
 			    } else {
 				/* 
 				 * forward referenced type. create it,
 				 * marked with FLAG_INCOMPLETE.
 				 */
-				parentPtr = addType((yyvsp[(1) - (2)].id),
+				parentPtr = addType((yyvsp[-1].id),
 						    SMI_BASETYPE_UNKNOWN,
 						    FLAG_INCOMPLETE,
 						    thisParserPtr);
 				(yyval.typePtr) = duplicateType(parentPtr, 0,
 						   thisParserPtr);
 			    }
-			    setTypeList((yyval.typePtr), (yyvsp[(2) - (2)].listPtr));
+			    setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 			    smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
-			;}
+			}
+#line 6280 "parser-smi.c"
     break;
 
-  case 223:
-#line 4174 "parser-smi.y"
-    {
+  case 223: /* SimpleSyntax: moduleName '.' UPPERCASE_IDENTIFIER octetStringSubType  */
+#line 4176 "parser-smi.y"
+                        {
 			    Type *parentPtr;
 			    Import *importPtr;
 			    
 			    defaultBasetype = SMI_BASETYPE_OCTETSTRING;
-			    parentPtr = findTypeByModulenameAndName((yyvsp[(1) - (4)].id), (yyvsp[(3) - (4)].id));
+			    parentPtr = findTypeByModulenameAndName((yyvsp[-3].id), (yyvsp[-1].id));
 			    if (!parentPtr) {
-				importPtr = findImportByModulenameAndName((yyvsp[(1) - (4)].id),
-							  (yyvsp[(3) - (4)].id), thisModulePtr);
+				importPtr = findImportByModulenameAndName((yyvsp[-3].id),
+							  (yyvsp[-1].id), thisModulePtr);
 				if (importPtr &&
 				    importPtr->kind == KIND_TYPE) {
 				    importPtr->use++;
 				    parentPtr = findTypeByModulenameAndName(
-					(yyvsp[(1) - (4)].id), (yyvsp[(3) - (4)].id));
+					(yyvsp[-3].id), (yyvsp[-1].id));
 				}
 			    }
 			    if (parentPtr) {
@@ -6414,7 +6302,7 @@ yyreduce:
 				    SMI_BASETYPE_OCTETSTRING) {
 				    smiPrintError(thisParserPtr,
 					      ERR_ILLEGAL_SIZE_FOR_PARENT_TYPE,
-						  (yyvsp[(3) - (4)].id));
+						  (yyvsp[-1].id));
 				    (yyval.typePtr) = duplicateType(smiHandle->typeOctetStringPtr, 0,
 						       thisParserPtr);
 				} else {
@@ -6423,77 +6311,83 @@ yyreduce:
 				}
 			    } else {
 				smiPrintError(thisParserPtr,
-					      ERR_UNKNOWN_TYPE, (yyvsp[(3) - (4)].id));
+					      ERR_UNKNOWN_TYPE, (yyvsp[-1].id));
 				(yyval.typePtr) = duplicateType(smiHandle->typeOctetStringPtr, 0,
 						   thisParserPtr);
 			    }
-			    setTypeList((yyval.typePtr), (yyvsp[(4) - (4)].listPtr));
+			    setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 			    smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
-			    smiFree((yyvsp[(1) - (4)].id));
-			    smiFree((yyvsp[(3) - (4)].id));
-			;}
+			    smiFree((yyvsp[-3].id));
+			    smiFree((yyvsp[-1].id));
+			}
+#line 6324 "parser-smi.c"
     break;
 
-  case 224:
-#line 4214 "parser-smi.y"
-    {
+  case 224: /* SimpleSyntax: OBJECT IDENTIFIER anySubType  */
+#line 4216 "parser-smi.y"
+                        {
 			    defaultBasetype = SMI_BASETYPE_OBJECTIDENTIFIER;
 			    (yyval.typePtr) = smiHandle->typeObjectIdentifierPtr;
-			;}
+			}
+#line 6333 "parser-smi.c"
     break;
 
-  case 225:
-#line 4222 "parser-smi.y"
-    {
+  case 225: /* valueofSimpleSyntax: NUMBER  */
+#line 4224 "parser-smi.y"
+                        {
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_UNSIGNED32;
-			    (yyval.valuePtr)->value.unsigned32 = (yyvsp[(1) - (1)].unsigned32);
-			;}
+			    (yyval.valuePtr)->value.unsigned32 = (yyvsp[0].unsigned32);
+			}
+#line 6343 "parser-smi.c"
     break;
 
-  case 226:
-#line 4228 "parser-smi.y"
-    {
+  case 226: /* valueofSimpleSyntax: NEGATIVENUMBER  */
+#line 4230 "parser-smi.y"
+                        {
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_INTEGER32;
-			    (yyval.valuePtr)->value.integer32 = (yyvsp[(1) - (1)].integer32);
-			;}
+			    (yyval.valuePtr)->value.integer32 = (yyvsp[0].integer32);
+			}
+#line 6353 "parser-smi.c"
     break;
 
-  case 227:
-#line 4234 "parser-smi.y"
-    {   
+  case 227: /* valueofSimpleSyntax: NUMBER64  */
+#line 4236 "parser-smi.y"
+                        {   
                             /* The scanner already checks for the language */
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_UNSIGNED64;
-			    (yyval.valuePtr)->value.unsigned64 = (yyvsp[(1) - (1)].unsigned64);
-			;}
+			    (yyval.valuePtr)->value.unsigned64 = (yyvsp[0].unsigned64);
+			}
+#line 6364 "parser-smi.c"
     break;
 
-  case 228:
-#line 4241 "parser-smi.y"
-    {
+  case 228: /* valueofSimpleSyntax: NEGATIVENUMBER64  */
+#line 4243 "parser-smi.y"
+                        {
                             /* The scanner already checks for the language */
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_INTEGER64;
-			    (yyval.valuePtr)->value.integer64 = (yyvsp[(1) - (1)].integer64);
-			;}
+			    (yyval.valuePtr)->value.integer64 = (yyvsp[0].integer64);
+			}
+#line 6375 "parser-smi.c"
     break;
 
-  case 229:
-#line 4248 "parser-smi.y"
-    {
+  case 229: /* valueofSimpleSyntax: BIN_STRING  */
+#line 4250 "parser-smi.y"
+                        {
 			    char s[9];
 			    int i, len, j;
 			    
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    if (defaultBasetype == SMI_BASETYPE_OCTETSTRING) {
 				(yyval.valuePtr)->basetype = SMI_BASETYPE_OCTETSTRING;
-				len = strlen((yyvsp[(1) - (1)].text));
+				len = strlen((yyvsp[0].text));
 				(yyval.valuePtr)->value.ptr =
 				    smiMalloc((len+7)/8+1);
 				for (i = 0; i < len; i += 8) {
-				    strncpy(s, &(yyvsp[(1) - (1)].text)[i], 8);
+				    strncpy(s, &(yyvsp[0].text)[i], 8);
 				    for (j = 1; j < 8; j++) {
 					if (!s[j]) s[j] = '0';
 				    }
@@ -6504,24 +6398,25 @@ yyreduce:
 				(yyval.valuePtr)->len = (len+7)/8;
 			    } else {
 				(yyval.valuePtr)->basetype = SMI_BASETYPE_UNSIGNED32;
-				(yyval.valuePtr)->value.unsigned32 = strtoul((yyvsp[(1) - (1)].text), NULL, 2);
+				(yyval.valuePtr)->value.unsigned32 = strtoul((yyvsp[0].text), NULL, 2);
 			    }
-			;}
+			}
+#line 6405 "parser-smi.c"
     break;
 
-  case 230:
-#line 4274 "parser-smi.y"
-    {
+  case 230: /* valueofSimpleSyntax: HEX_STRING  */
+#line 4276 "parser-smi.y"
+                        {
 			    char s[3];
 			    int i, len;
 			    
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    if (defaultBasetype == SMI_BASETYPE_OCTETSTRING) {
 				(yyval.valuePtr)->basetype = SMI_BASETYPE_OCTETSTRING;
-				len = strlen((yyvsp[(1) - (1)].text));
+				len = strlen((yyvsp[0].text));
 				(yyval.valuePtr)->value.ptr = smiMalloc((len+1)/2+1);
 				for (i = 0; i < len; i += 2) {
-				    strncpy(s, &(yyvsp[(1) - (1)].text)[i], 2);
+				    strncpy(s, &(yyvsp[0].text)[i], 2);
 				    if (!s[1]) s[1] = '0';
 				    s[2] = 0;
 				    (yyval.valuePtr)->value.ptr[i/2] =
@@ -6530,14 +6425,15 @@ yyreduce:
 				(yyval.valuePtr)->len = (len+1)/2;
 			    } else {
 				(yyval.valuePtr)->basetype = SMI_BASETYPE_UNSIGNED32;
-				(yyval.valuePtr)->value.unsigned32 = strtoul((yyvsp[(1) - (1)].text), NULL, 16);
+				(yyval.valuePtr)->value.unsigned32 = strtoul((yyvsp[0].text), NULL, 16);
 			    }
-			;}
+			}
+#line 6432 "parser-smi.c"
     break;
 
-  case 231:
-#line 4297 "parser-smi.y"
-    {
+  case 231: /* valueofSimpleSyntax: LOWERCASE_IDENTIFIER  */
+#line 4299 "parser-smi.y"
+                        {
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    if ((defaultBasetype != SMI_BASETYPE_ENUM) &&
 				(defaultBasetype != SMI_BASETYPE_OBJECTIDENTIFIER)) {
@@ -6553,24 +6449,26 @@ yyreduce:
 			    } else {
 				(yyval.valuePtr)->basetype = defaultBasetype;
 				(yyval.valuePtr)->len = -1;  /* indicates unresolved ptr */
-				(yyval.valuePtr)->value.ptr = (yyvsp[(1) - (1)].id); /* JS: needs strdup? */
+				(yyval.valuePtr)->value.ptr = (yyvsp[0].id); /* JS: needs strdup? */
 			    }
-			;}
+			}
+#line 6456 "parser-smi.c"
     break;
 
-  case 232:
-#line 4317 "parser-smi.y"
-    {
+  case 232: /* valueofSimpleSyntax: QUOTED_STRING  */
+#line 4319 "parser-smi.y"
+                        {
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_OCTETSTRING;
-			    (yyval.valuePtr)->value.ptr = smiStrdup((yyvsp[(1) - (1)].text));
-			    (yyval.valuePtr)->len = strlen((yyvsp[(1) - (1)].text));
-			;}
+			    (yyval.valuePtr)->value.ptr = smiStrdup((yyvsp[0].text));
+			    (yyval.valuePtr)->len = strlen((yyvsp[0].text));
+			}
+#line 6467 "parser-smi.c"
     break;
 
-  case 233:
-#line 4340 "parser-smi.y"
-    {
+  case 233: /* valueofSimpleSyntax: '{' objectIdentifier_defval '}'  */
+#line 4342 "parser-smi.y"
+                        {
 			    /*
 			     * SMIv1 allows something like { 0 0 } !
 			     * SMIv2 does not!
@@ -6589,19 +6487,21 @@ yyreduce:
 			    (yyval.valuePtr)->value.oid = smiMalloc(2 * sizeof(SmiSubid));
 			    (yyval.valuePtr)->value.oid[0] = 0;
 			    (yyval.valuePtr)->value.oid[1] = 0;
-			;}
+			}
+#line 6492 "parser-smi.c"
     break;
 
-  case 234:
-#line 4367 "parser-smi.y"
-    {
+  case 234: /* sequenceSimpleSyntax: INTEGER anySubType  */
+#line 4369 "parser-smi.y"
+                        {
 			    (yyval.typePtr) = smiHandle->typeInteger32Ptr;
-			;}
+			}
+#line 6500 "parser-smi.c"
     break;
 
-  case 235:
-#line 4371 "parser-smi.y"
-    {
+  case 235: /* sequenceSimpleSyntax: INTEGER32 anySubType  */
+#line 4373 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    /* TODO: any need to distinguish from INTEGER? */
@@ -6624,26 +6524,29 @@ yyreduce:
 						  "Integer32");
 				}
 			    }
-			;}
+			}
+#line 6529 "parser-smi.c"
     break;
 
-  case 236:
-#line 4396 "parser-smi.y"
-    {
+  case 236: /* sequenceSimpleSyntax: OCTET STRING anySubType  */
+#line 4398 "parser-smi.y"
+                        {
 			    (yyval.typePtr) = smiHandle->typeOctetStringPtr;
-			;}
+			}
+#line 6537 "parser-smi.c"
     break;
 
-  case 237:
-#line 4400 "parser-smi.y"
-    {
+  case 237: /* sequenceSimpleSyntax: OBJECT IDENTIFIER anySubType  */
+#line 4402 "parser-smi.y"
+                        {
 			    (yyval.typePtr) = smiHandle->typeObjectIdentifierPtr;
-			;}
+			}
+#line 6545 "parser-smi.c"
     break;
 
-  case 238:
-#line 4406 "parser-smi.y"
-    {
+  case 238: /* ApplicationSyntax: IPADDRESS anySubType  */
+#line 4408 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    (yyval.typePtr) = findTypeByName("IpAddress");
@@ -6669,12 +6572,13 @@ yyreduce:
 						  "IpAddress");
 				}
 			    }
-			;}
+			}
+#line 6577 "parser-smi.c"
     break;
 
-  case 239:
-#line 4434 "parser-smi.y"
-    {
+  case 239: /* ApplicationSyntax: COUNTER32 anySubType  */
+#line 4436 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
                             if ((thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI) &&
@@ -6698,19 +6602,20 @@ yyreduce:
 						  "Counter32");
 				}
 			    }
-			;}
+			}
+#line 6607 "parser-smi.c"
     break;
 
-  case 240:
-#line 4460 "parser-smi.y"
-    {
+  case 240: /* ApplicationSyntax: COUNTER32 integerSubType  */
+#line 4462 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    List *listPtr, *nextListPtr;
 			    
 			    smiPrintError(thisParserPtr,
 					  ERR_ILLEGAL_RANGE_FOR_COUNTER,
 					  "Counter32");
-			    for (listPtr = (yyvsp[(2) - (2)].listPtr); listPtr;
+			    for (listPtr = (yyvsp[0].listPtr); listPtr;
 				 listPtr = nextListPtr) {
 				nextListPtr = listPtr->nextPtr;
 				smiFree((Range *)listPtr->ptr);
@@ -6738,12 +6643,13 @@ yyreduce:
 						  "Counter32");
 				}
 			    }
-			;}
+			}
+#line 6648 "parser-smi.c"
     break;
 
-  case 241:
-#line 4497 "parser-smi.y"
-    {
+  case 241: /* ApplicationSyntax: GAUGE32  */
+#line 4499 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
                             if ((thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI) &&
@@ -6767,12 +6673,13 @@ yyreduce:
 						  "Gauge32");
 				}
 			    }
-			;}
+			}
+#line 6678 "parser-smi.c"
     break;
 
-  case 242:
-#line 4523 "parser-smi.y"
-    {
+  case 242: /* ApplicationSyntax: GAUGE32 integerSubType  */
+#line 4525 "parser-smi.y"
+                        {
 			    Type *parentPtr;
 			    Import *importPtr;
 			    
@@ -6787,7 +6694,7 @@ yyreduce:
 			    } else {
 				(yyval.typePtr) = duplicateType(parentPtr, 0,
 						   thisParserPtr);
-				setTypeList((yyval.typePtr), (yyvsp[(2) - (2)].listPtr));
+				setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 				smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
 			    }
 			    
@@ -6803,12 +6710,13 @@ yyreduce:
 						  "Gauge32");
 				}
 			    }
-			;}
+			}
+#line 6715 "parser-smi.c"
     break;
 
-  case 243:
-#line 4556 "parser-smi.y"
-    {
+  case 243: /* ApplicationSyntax: UNSIGNED32  */
+#line 4558 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
 			    (yyval.typePtr) = smiHandle->typeUnsigned32Ptr;
@@ -6830,17 +6738,18 @@ yyreduce:
 						  "Unsigned32");
 				}
 			    }
-			;}
+			}
+#line 6743 "parser-smi.c"
     break;
 
-  case 244:
-#line 4580 "parser-smi.y"
-    {
+  case 244: /* ApplicationSyntax: UNSIGNED32 integerSubType  */
+#line 4582 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    (yyval.typePtr) = duplicateType(smiHandle->typeUnsigned32Ptr, 0,
 					       thisParserPtr);
-			    setTypeList((yyval.typePtr), (yyvsp[(2) - (2)].listPtr));
+			    setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 			    smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
 
 			    importPtr = findImportByName("Unsigned32",
@@ -6860,12 +6769,13 @@ yyreduce:
 						  "Unsigned32");
 				}
 			    }
-			;}
+			}
+#line 6774 "parser-smi.c"
     break;
 
-  case 245:
-#line 4607 "parser-smi.y"
-    {
+  case 245: /* ApplicationSyntax: TIMETICKS anySubType  */
+#line 4609 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    (yyval.typePtr) = findTypeByName("TimeTicks");
@@ -6891,12 +6801,13 @@ yyreduce:
 						  "TimeTicks");
 				}
 			    }
-			;}
+			}
+#line 6806 "parser-smi.c"
     break;
 
-  case 246:
-#line 4635 "parser-smi.y"
-    {
+  case 246: /* ApplicationSyntax: OPAQUE  */
+#line 4637 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    (yyval.typePtr) = findTypeByName("Opaque");
@@ -6932,12 +6843,13 @@ yyreduce:
 						  "Opaque");
 				}
 			    }
-			;}
+			}
+#line 6848 "parser-smi.c"
     break;
 
-  case 247:
-#line 4673 "parser-smi.y"
-    {
+  case 247: /* ApplicationSyntax: OPAQUE octetStringSubType  */
+#line 4675 "parser-smi.y"
+                        {
 			    Type *parentPtr;
 			    Import *importPtr;
 			    
@@ -6960,7 +6872,7 @@ yyreduce:
 				}
 				(yyval.typePtr) = duplicateType(parentPtr, 0,
 						   thisParserPtr);
-				setTypeList((yyval.typePtr), (yyvsp[(2) - (2)].listPtr));
+				setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 				smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
 			    }
 
@@ -6981,12 +6893,13 @@ yyreduce:
 						  "Opaque");
 				}
 			    }
-			;}
+			}
+#line 6898 "parser-smi.c"
     break;
 
-  case 248:
-#line 4719 "parser-smi.y"
-    {
+  case 248: /* ApplicationSyntax: COUNTER64 anySubType  */
+#line 4721 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
                             if ((thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI) &&
@@ -7010,19 +6923,20 @@ yyreduce:
 						  "Counter64");
 				}
 			    }
-			;}
+			}
+#line 6928 "parser-smi.c"
     break;
 
-  case 249:
-#line 4745 "parser-smi.y"
-    {
+  case 249: /* ApplicationSyntax: COUNTER64 integerSubType  */
+#line 4747 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    List *listPtr, *nextListPtr;
 			    
 			    smiPrintError(thisParserPtr,
 					  ERR_ILLEGAL_RANGE_FOR_COUNTER,
 					  "Counter64");
-			    for (listPtr = (yyvsp[(2) - (2)].listPtr); listPtr;
+			    for (listPtr = (yyvsp[0].listPtr); listPtr;
 				 listPtr = nextListPtr) {
 				nextListPtr = listPtr->nextPtr;
 				smiFree((Range *)listPtr->ptr);
@@ -7050,12 +6964,13 @@ yyreduce:
 						  "Counter64");
 				}
 			    }
-			;}
+			}
+#line 6969 "parser-smi.c"
     break;
 
-  case 250:
-#line 4782 "parser-smi.y"
-    {
+  case 250: /* ApplicationSyntax: INTEGER64  */
+#line 4784 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
 			    (yyval.typePtr) = findTypeByModulenameAndName(
@@ -7079,12 +6994,13 @@ yyreduce:
 					importPtr->export.name);
 				}
 			    }
-			;}
+			}
+#line 6999 "parser-smi.c"
     break;
 
-  case 251:
-#line 4808 "parser-smi.y"
-    {
+  case 251: /* ApplicationSyntax: INTEGER64 integerSubType  */
+#line 4810 "parser-smi.y"
+                        {
 			    Type *parentPtr;
 			    Import *importPtr;
 			    
@@ -7116,15 +7032,16 @@ yyreduce:
 			    } else {
 				(yyval.typePtr) = duplicateType(parentPtr, 0,
 						   thisParserPtr);
-				setTypeList((yyval.typePtr), (yyvsp[(2) - (2)].listPtr));
+				setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 				smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
 			    }
-			;}
+			}
+#line 7040 "parser-smi.c"
     break;
 
-  case 252:
-#line 4845 "parser-smi.y"
-    {
+  case 252: /* ApplicationSyntax: UNSIGNED64  */
+#line 4847 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
 			    (yyval.typePtr) = findTypeByModulenameAndName(
@@ -7148,12 +7065,13 @@ yyreduce:
 					importPtr->export.name);
 				}
 			    }
-			;}
+			}
+#line 7070 "parser-smi.c"
     break;
 
-  case 253:
-#line 4871 "parser-smi.y"
-    {
+  case 253: /* ApplicationSyntax: UNSIGNED64 integerSubType  */
+#line 4873 "parser-smi.y"
+                        {
 			    Type *parentPtr;
 			    Import *importPtr;
 			    
@@ -7185,15 +7103,16 @@ yyreduce:
 			    } else {
 				(yyval.typePtr) = duplicateType(parentPtr, 0,
 						   thisParserPtr);
-				setTypeList((yyval.typePtr), (yyvsp[(2) - (2)].listPtr));
+				setTypeList((yyval.typePtr), (yyvsp[0].listPtr));
 				smiCheckTypeRanges(thisParserPtr, (yyval.typePtr));
 			    }
-			;}
+			}
+#line 7111 "parser-smi.c"
     break;
 
-  case 254:
-#line 4914 "parser-smi.y"
-    {
+  case 254: /* sequenceApplicationSyntax: IPADDRESS anySubType  */
+#line 4916 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    (yyval.typePtr) = findTypeByName("IpAddress");
@@ -7219,12 +7138,13 @@ yyreduce:
 						  "IpAddress");
 				}
 			    }
-			;}
+			}
+#line 7143 "parser-smi.c"
     break;
 
-  case 255:
-#line 4942 "parser-smi.y"
-    {
+  case 255: /* sequenceApplicationSyntax: COUNTER32 anySubType  */
+#line 4944 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
                             if ((thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI) &&
@@ -7248,12 +7168,13 @@ yyreduce:
 						  "Counter32");
 				}
 			    }
-			;}
+			}
+#line 7173 "parser-smi.c"
     break;
 
-  case 256:
-#line 4968 "parser-smi.y"
-    {
+  case 256: /* sequenceApplicationSyntax: GAUGE32 anySubType  */
+#line 4970 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
                             if ((thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI) &&
@@ -7277,12 +7198,13 @@ yyreduce:
 						  "Gauge32");
 				}
 			    }
-			;}
+			}
+#line 7203 "parser-smi.c"
     break;
 
-  case 257:
-#line 4994 "parser-smi.y"
-    {
+  case 257: /* sequenceApplicationSyntax: UNSIGNED32 anySubType  */
+#line 4996 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    (yyval.typePtr) = smiHandle->typeUnsigned32Ptr;
@@ -7304,12 +7226,13 @@ yyreduce:
 						  "Unsigned32");
 				}
 			    }
-			;}
+			}
+#line 7231 "parser-smi.c"
     break;
 
-  case 258:
-#line 5018 "parser-smi.y"
-    {
+  case 258: /* sequenceApplicationSyntax: TIMETICKS anySubType  */
+#line 5020 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    (yyval.typePtr) = findTypeByName("TimeTicks");
@@ -7335,12 +7258,13 @@ yyreduce:
 						  "TimeTicks");
 				}
 			    }
-			;}
+			}
+#line 7263 "parser-smi.c"
     break;
 
-  case 259:
-#line 5046 "parser-smi.y"
-    {
+  case 259: /* sequenceApplicationSyntax: OPAQUE  */
+#line 5048 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    (yyval.typePtr) = findTypeByName("Opaque");
@@ -7378,12 +7302,13 @@ yyreduce:
 						  "Opaque");
 				}
 			    }
-			;}
+			}
+#line 7307 "parser-smi.c"
     break;
 
-  case 260:
-#line 5086 "parser-smi.y"
-    {
+  case 260: /* sequenceApplicationSyntax: COUNTER64 anySubType  */
+#line 5088 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
                             if ((thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI) &&
@@ -7407,12 +7332,13 @@ yyreduce:
 						  "Counter64");
 				}
 			    }
-			;}
+			}
+#line 7337 "parser-smi.c"
     break;
 
-  case 261:
-#line 5112 "parser-smi.y"
-    {
+  case 261: /* sequenceApplicationSyntax: INTEGER64  */
+#line 5114 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI)
@@ -7435,12 +7361,13 @@ yyreduce:
 						  "Integer64");
 				}
 			    }
-			;}
+			}
+#line 7366 "parser-smi.c"
     break;
 
-  case 262:
-#line 5137 "parser-smi.y"
-    {
+  case 262: /* sequenceApplicationSyntax: UNSIGNED64  */
+#line 5139 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
 			    importPtr = findImportByName("Unsigned64",
@@ -7463,19 +7390,20 @@ yyreduce:
 						  "Unsigned64");
 				}
 			    }
-			;}
+			}
+#line 7395 "parser-smi.c"
     break;
 
-  case 263:
-#line 5164 "parser-smi.y"
-    {
+  case 263: /* anySubType: integerSubType  */
+#line 5166 "parser-smi.y"
+                        {
 			    List *listPtr, *nextListPtr;
 
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_SMIV2)
 				smiPrintError(thisParserPtr,
 					      ERR_UNEXPECTED_TYPE_RESTRICTION);
 
-			    for (listPtr = (yyvsp[(1) - (1)].listPtr); listPtr;
+			    for (listPtr = (yyvsp[0].listPtr); listPtr;
 				 listPtr = nextListPtr) {
 				nextListPtr = listPtr->nextPtr;
 				smiFree((Range *)(listPtr->ptr));
@@ -7483,19 +7411,20 @@ yyreduce:
 			    }
 
 			    (yyval.listPtr) = NULL;
-			;}
+			}
+#line 7416 "parser-smi.c"
     break;
 
-  case 264:
-#line 5181 "parser-smi.y"
-    {
+  case 264: /* anySubType: octetStringSubType  */
+#line 5183 "parser-smi.y"
+                        {
 			    List *listPtr, *nextListPtr;
 
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_SMIV2)
 				smiPrintError(thisParserPtr,
 					      ERR_UNEXPECTED_TYPE_RESTRICTION);
 
-			    for (listPtr = (yyvsp[(1) - (1)].listPtr); listPtr;
+			    for (listPtr = (yyvsp[0].listPtr); listPtr;
 				 listPtr = nextListPtr) {
 				nextListPtr = listPtr->nextPtr;
 				smiFree((Range *)(listPtr->ptr));
@@ -7503,19 +7432,20 @@ yyreduce:
 			    }
 
 			    (yyval.listPtr) = NULL;
-			;}
+			}
+#line 7437 "parser-smi.c"
     break;
 
-  case 265:
-#line 5198 "parser-smi.y"
-    {
+  case 265: /* anySubType: enumSpec  */
+#line 5200 "parser-smi.y"
+                        {
 			    List *listPtr, *nextListPtr;
 
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_SMIV2)
 				smiPrintError(thisParserPtr,
 					      ERR_UNEXPECTED_TYPE_RESTRICTION);
 
-			    for (listPtr = (yyvsp[(1) - (1)].listPtr); listPtr;
+			    for (listPtr = (yyvsp[0].listPtr); listPtr;
 				 listPtr = nextListPtr) {
 				nextListPtr = listPtr->nextPtr;
 				smiFree(((NamedNumber *)(listPtr->ptr))->export.name);
@@ -7524,122 +7454,134 @@ yyreduce:
 			    }
 
 			    (yyval.listPtr) = NULL;
-			;}
+			}
+#line 7459 "parser-smi.c"
     break;
 
-  case 266:
-#line 5216 "parser-smi.y"
-    {
+  case 266: /* anySubType: %empty  */
+#line 5218 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = NULL;
-			;}
+			}
+#line 7467 "parser-smi.c"
     break;
 
-  case 267:
-#line 5230 "parser-smi.y"
-    { (yyval.listPtr) = (yyvsp[(2) - (3)].listPtr); ;}
+  case 267: /* integerSubType: '(' ranges ')'  */
+#line 5232 "parser-smi.y"
+                        { (yyval.listPtr) = (yyvsp[-1].listPtr); }
+#line 7473 "parser-smi.c"
     break;
 
-  case 268:
-#line 5240 "parser-smi.y"
-    {
-			    (yyval.listPtr) = (yyvsp[(4) - (6)].listPtr);
-			;}
+  case 268: /* octetStringSubType: '(' SIZE '(' ranges ')' ')'  */
+#line 5242 "parser-smi.y"
+                        {
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+			}
+#line 7481 "parser-smi.c"
     break;
 
-  case 269:
-#line 5246 "parser-smi.y"
-    {
+  case 269: /* ranges: range  */
+#line 5248 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].rangePtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].rangePtr);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 7491 "parser-smi.c"
     break;
 
-  case 270:
-#line 5252 "parser-smi.y"
-    {
+  case 270: /* ranges: ranges '|' range  */
+#line 5254 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (void *)(yyvsp[(3) - (3)].rangePtr);
+			    p->ptr = (void *)(yyvsp[0].rangePtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
 			    
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-			;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+			}
+#line 7507 "parser-smi.c"
     break;
 
-  case 271:
-#line 5266 "parser-smi.y"
-    {
+  case 271: /* range: value  */
+#line 5268 "parser-smi.y"
+                        {
 			    (yyval.rangePtr) = smiMalloc(sizeof(Range));
-			    (yyval.rangePtr)->export.minValue = *(yyvsp[(1) - (1)].valuePtr);
-			    (yyval.rangePtr)->export.maxValue = *(yyvsp[(1) - (1)].valuePtr);
-			    smiFree((yyvsp[(1) - (1)].valuePtr));
-			;}
+			    (yyval.rangePtr)->export.minValue = *(yyvsp[0].valuePtr);
+			    (yyval.rangePtr)->export.maxValue = *(yyvsp[0].valuePtr);
+			    smiFree((yyvsp[0].valuePtr));
+			}
+#line 7518 "parser-smi.c"
     break;
 
-  case 272:
-#line 5273 "parser-smi.y"
-    {
+  case 272: /* range: value DOT_DOT value  */
+#line 5275 "parser-smi.y"
+                        {
 			    (yyval.rangePtr) = smiMalloc(sizeof(Range));
-			    (yyval.rangePtr)->export.minValue = *(yyvsp[(1) - (3)].valuePtr);
-			    (yyval.rangePtr)->export.maxValue = *(yyvsp[(3) - (3)].valuePtr);
-			    smiFree((yyvsp[(1) - (3)].valuePtr));
-			    smiFree((yyvsp[(3) - (3)].valuePtr));
-			;}
+			    (yyval.rangePtr)->export.minValue = *(yyvsp[-2].valuePtr);
+			    (yyval.rangePtr)->export.maxValue = *(yyvsp[0].valuePtr);
+			    smiFree((yyvsp[-2].valuePtr));
+			    smiFree((yyvsp[0].valuePtr));
+			}
+#line 7530 "parser-smi.c"
     break;
 
-  case 273:
-#line 5283 "parser-smi.y"
-    {
+  case 273: /* value: NEGATIVENUMBER  */
+#line 5285 "parser-smi.y"
+                        {
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_INTEGER32;
-			    (yyval.valuePtr)->value.integer32 = (yyvsp[(1) - (1)].integer32);
-			;}
+			    (yyval.valuePtr)->value.integer32 = (yyvsp[0].integer32);
+			}
+#line 7540 "parser-smi.c"
     break;
 
-  case 274:
-#line 5289 "parser-smi.y"
-    {
+  case 274: /* value: NUMBER  */
+#line 5291 "parser-smi.y"
+                        {
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_UNSIGNED32;
-			    (yyval.valuePtr)->value.unsigned32 = (yyvsp[(1) - (1)].unsigned32);
-			;}
+			    (yyval.valuePtr)->value.unsigned32 = (yyvsp[0].unsigned32);
+			}
+#line 7550 "parser-smi.c"
     break;
 
-  case 275:
-#line 5295 "parser-smi.y"
-    {
+  case 275: /* value: NEGATIVENUMBER64  */
+#line 5297 "parser-smi.y"
+                        {
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_INTEGER64;
-			    (yyval.valuePtr)->value.integer64 = (yyvsp[(1) - (1)].integer64);
-			;}
+			    (yyval.valuePtr)->value.integer64 = (yyvsp[0].integer64);
+			}
+#line 7560 "parser-smi.c"
     break;
 
-  case 276:
-#line 5301 "parser-smi.y"
-    {
+  case 276: /* value: NUMBER64  */
+#line 5303 "parser-smi.y"
+                        {
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_UNSIGNED64;
-			    (yyval.valuePtr)->value.unsigned64 = (yyvsp[(1) - (1)].unsigned64);
-			;}
+			    (yyval.valuePtr)->value.unsigned64 = (yyvsp[0].unsigned64);
+			}
+#line 7570 "parser-smi.c"
     break;
 
-  case 277:
-#line 5307 "parser-smi.y"
-    {
+  case 277: /* value: HEX_STRING  */
+#line 5309 "parser-smi.y"
+                        {
 			    char s[3];
 			    int i, len;
 			    
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    if (defaultBasetype == SMI_BASETYPE_OCTETSTRING) {
 				(yyval.valuePtr)->basetype = SMI_BASETYPE_OCTETSTRING;
-				len = strlen((yyvsp[(1) - (1)].text));
+				len = strlen((yyvsp[0].text));
 				(yyval.valuePtr)->value.ptr = smiMalloc((len+1)/2+1);
 				for (i = 0; i < len; i += 2) {
-				    strncpy(s, &(yyvsp[(1) - (1)].text)[i], 2);
+				    strncpy(s, &(yyvsp[0].text)[i], 2);
 				    if (!s[1]) s[1] = '0';
 				    s[2] = 0;
 				    (yyval.valuePtr)->value.ptr[i/2] =
@@ -7648,24 +7590,25 @@ yyreduce:
 				(yyval.valuePtr)->len = (len+1)/2;
 			    } else {
 				(yyval.valuePtr)->basetype = SMI_BASETYPE_UNSIGNED32;
-				(yyval.valuePtr)->value.unsigned32 = strtoul((yyvsp[(1) - (1)].text), NULL, 16);
+				(yyval.valuePtr)->value.unsigned32 = strtoul((yyvsp[0].text), NULL, 16);
 			    }
-			;}
+			}
+#line 7597 "parser-smi.c"
     break;
 
-  case 278:
-#line 5330 "parser-smi.y"
-    {
+  case 278: /* value: BIN_STRING  */
+#line 5332 "parser-smi.y"
+                        {
 			    char s[9];
 			    int i, len, j;
 			    
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    if (defaultBasetype == SMI_BASETYPE_OCTETSTRING) {
 				(yyval.valuePtr)->basetype = SMI_BASETYPE_OCTETSTRING;
-				len = strlen((yyvsp[(1) - (1)].text));
+				len = strlen((yyvsp[0].text));
 				(yyval.valuePtr)->value.ptr = smiMalloc((len+7)/8+1);
 				for (i = 0; i < len; i += 8) {
-				    strncpy(s, &(yyvsp[(1) - (1)].text)[i], 8);
+				    strncpy(s, &(yyvsp[0].text)[i], 8);
 				    for (j = 1; j < 8; j++) {
 					if (!s[j]) s[j] = '0';
 				    }
@@ -7676,112 +7619,120 @@ yyreduce:
 				(yyval.valuePtr)->len = (len+7)/8;
 			    } else {
 				(yyval.valuePtr)->basetype = SMI_BASETYPE_UNSIGNED32;
-				(yyval.valuePtr)->value.unsigned32 = strtoul((yyvsp[(1) - (1)].text), NULL, 2);
+				(yyval.valuePtr)->value.unsigned32 = strtoul((yyvsp[0].text), NULL, 2);
 			    }
-			;}
+			}
+#line 7626 "parser-smi.c"
     break;
 
-  case 279:
-#line 5357 "parser-smi.y"
-    {
-			    (yyval.listPtr) = (yyvsp[(2) - (3)].listPtr);
-			;}
+  case 279: /* enumSpec: '{' enumItems '}'  */
+#line 5359 "parser-smi.y"
+                        {
+			    (yyval.listPtr) = (yyvsp[-1].listPtr);
+			}
+#line 7634 "parser-smi.c"
     break;
 
-  case 280:
-#line 5363 "parser-smi.y"
-    {
+  case 280: /* enumItems: enumItem  */
+#line 5365 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].namedNumberPtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].namedNumberPtr);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 7644 "parser-smi.c"
     break;
 
-  case 281:
-#line 5369 "parser-smi.y"
-    {
+  case 281: /* enumItems: enumItems ',' enumItem  */
+#line 5371 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (void *)(yyvsp[(3) - (3)].namedNumberPtr);
+			    p->ptr = (void *)(yyvsp[0].namedNumberPtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-			;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+			}
+#line 7659 "parser-smi.c"
     break;
 
-  case 282:
-#line 5382 "parser-smi.y"
-    {
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+  case 282: /* $@40: %empty  */
+#line 5384 "parser-smi.y"
+                        {
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_ENUMNAME_32, ERR_ENUMNAME_64);
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_SMIV2)
 			    {
-				if (strchr((yyvsp[(1) - (1)].id), '-')) {
+				if (strchr((yyvsp[0].id), '-')) {
 				    smiPrintError(thisParserPtr,
 					  ERR_NAMEDNUMBER_INCLUDES_HYPHEN,
-						  (yyvsp[(1) - (1)].id));
+						  (yyvsp[0].id));
 				}
 			    }
-			;}
+			}
+#line 7676 "parser-smi.c"
     break;
 
-  case 283:
-#line 5395 "parser-smi.y"
-    {
+  case 283: /* enumItem: LOWERCASE_IDENTIFIER $@40 '(' enumNumber ')'  */
+#line 5397 "parser-smi.y"
+                        {
 			    (yyval.namedNumberPtr) = smiMalloc(sizeof(NamedNumber));
-			    (yyval.namedNumberPtr)->export.name = (yyvsp[(1) - (5)].id);
-			    (yyval.namedNumberPtr)->export.value = *(yyvsp[(4) - (5)].valuePtr);
-			    smiFree((yyvsp[(4) - (5)].valuePtr));
-			;}
+			    (yyval.namedNumberPtr)->export.name = (yyvsp[-4].id);
+			    (yyval.namedNumberPtr)->export.value = *(yyvsp[-1].valuePtr);
+			    smiFree((yyvsp[-1].valuePtr));
+			}
+#line 7687 "parser-smi.c"
     break;
 
-  case 284:
-#line 5404 "parser-smi.y"
-    {
-			    if ((yyvsp[(1) - (1)].unsigned32) > SMI_BASETYPE_INTEGER32_MAX) {
+  case 284: /* enumNumber: NUMBER  */
+#line 5406 "parser-smi.y"
+                        {
+			    if ((yyvsp[0].unsigned32) > SMI_BASETYPE_INTEGER32_MAX) {
 				smiPrintError(thisParserPtr,
-					      ERR_INTEGER32_TOO_LARGE, (yyvsp[(1) - (1)].unsigned32));
+					      ERR_INTEGER32_TOO_LARGE, (yyvsp[0].unsigned32));
 			    }
 			    if ((thisModulePtr->export.language == SMI_LANGUAGE_SMIV1) &&
-				((yyvsp[(1) - (1)].unsigned32) == 0)) {
+				((yyvsp[0].unsigned32) == 0)) {
 				smiPrintError(thisParserPtr,
 					      ERR_ENUM_ZERO);
 			    }
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_INTEGER32;
-			    (yyval.valuePtr)->value.integer32 = (yyvsp[(1) - (1)].unsigned32);
-			;}
+			    (yyval.valuePtr)->value.integer32 = (yyvsp[0].unsigned32);
+			}
+#line 7706 "parser-smi.c"
     break;
 
-  case 285:
-#line 5419 "parser-smi.y"
-    {
+  case 285: /* enumNumber: NEGATIVENUMBER  */
+#line 5421 "parser-smi.y"
+                        {
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_INTEGER32;
-			    (yyval.valuePtr)->value.integer32 = (yyvsp[(1) - (1)].integer32);
+			    (yyval.valuePtr)->value.integer32 = (yyvsp[0].integer32);
 			    /* TODO: non-negative is suggested */
-			;}
+			}
+#line 7717 "parser-smi.c"
     break;
 
-  case 286:
-#line 5428 "parser-smi.y"
-    {
+  case 286: /* Status: LOWERCASE_IDENTIFIER  */
+#line 5430 "parser-smi.y"
+                        {
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_SMIV2)
 			    {
-			        if (!strcmp((yyvsp[(1) - (1)].id), "current")) {
+			        if (!strcmp((yyvsp[0].id), "current")) {
 				    (yyval.status) = SMI_STATUS_CURRENT;
-			        } else if (!strcmp((yyvsp[(1) - (1)].id), "deprecated")) {
+			        } else if (!strcmp((yyvsp[0].id), "deprecated")) {
 				    (yyval.status) = SMI_STATUS_DEPRECATED;
-			        } else if (!strcmp((yyvsp[(1) - (1)].id), "obsolete")) {
+			        } else if (!strcmp((yyvsp[0].id), "obsolete")) {
 				    (yyval.status) = SMI_STATUS_OBSOLETE;
 			        } else {
 				    smiPrintError(thisParserPtr,
 					          ERR_INVALID_SMIV2_STATUS,
-					          (yyvsp[(1) - (1)].id));
-				    if (!strcmp((yyvsp[(1) - (1)].id), "mandatory")
-				        || !strcmp((yyvsp[(1) - (1)].id), "optional")) {
+					          (yyvsp[0].id));
+				    if (!strcmp((yyvsp[0].id), "mandatory")
+				        || !strcmp((yyvsp[0].id), "optional")) {
 				        /* best guess */
 				        (yyval.status) = SMI_STATUS_CURRENT;
 				    } else {
@@ -7789,19 +7740,19 @@ yyreduce:
 				    }
 			        }
 			    } else if (thisModulePtr->export.language != SMI_LANGUAGE_SPPI) {
-			        if (!strcmp((yyvsp[(1) - (1)].id), "mandatory")) {
+			        if (!strcmp((yyvsp[0].id), "mandatory")) {
 				    (yyval.status) = SMI_STATUS_MANDATORY;
-			        } else if (!strcmp((yyvsp[(1) - (1)].id), "optional")) {
+			        } else if (!strcmp((yyvsp[0].id), "optional")) {
 				    (yyval.status) = SMI_STATUS_OPTIONAL;
-			        } else if (!strcmp((yyvsp[(1) - (1)].id), "obsolete")) {
+			        } else if (!strcmp((yyvsp[0].id), "obsolete")) {
 				    (yyval.status) = SMI_STATUS_OBSOLETE;
-			        } else if (!strcmp((yyvsp[(1) - (1)].id), "deprecated")) {
+			        } else if (!strcmp((yyvsp[0].id), "deprecated")) {
 				    (yyval.status) = SMI_STATUS_OBSOLETE;
 			        } else {
 				    smiPrintError(thisParserPtr,
 					          ERR_INVALID_SMIV1_STATUS,
-					          (yyvsp[(1) - (1)].id));
-				    if (!strcmp((yyvsp[(1) - (1)].id), "current")) {
+					          (yyvsp[0].id));
+				    if (!strcmp((yyvsp[0].id), "current")) {
 				        /* best guess */
 				        (yyval.status) = SMI_STATUS_MANDATORY; 
 				    } else {
@@ -7809,158 +7760,166 @@ yyreduce:
 				    }
 			        }
 			    } else { /* it is SPPI */
-			        if (!strcmp((yyvsp[(1) - (1)].id), "current")) {
+			        if (!strcmp((yyvsp[0].id), "current")) {
 				    (yyval.status) = SMI_STATUS_CURRENT;
-			        } else if (!strcmp((yyvsp[(1) - (1)].id), "obsolete")) {
+			        } else if (!strcmp((yyvsp[0].id), "obsolete")) {
 				    (yyval.status) = SMI_STATUS_OBSOLETE;
-			        } else if (!strcmp((yyvsp[(1) - (1)].id), "deprecated")) {
+			        } else if (!strcmp((yyvsp[0].id), "deprecated")) {
 				    (yyval.status) = SMI_STATUS_OBSOLETE;
                                 } else {
                                     smiPrintError(thisParserPtr,
-                                                  ERR_INVALID_SPPI_STATUS, (yyvsp[(1) - (1)].id));
+                                                  ERR_INVALID_SPPI_STATUS, (yyvsp[0].id));
                                     (yyval.status) = SMI_STATUS_UNKNOWN;
                                 }
                             }
-			    smiFree((yyvsp[(1) - (1)].id));
-			;}
+			    smiFree((yyvsp[0].id));
+			}
+#line 7778 "parser-smi.c"
     break;
 
-  case 287:
-#line 5487 "parser-smi.y"
-    {
-			    if (!strcmp((yyvsp[(1) - (1)].id), "current")) {
+  case 287: /* Status_Capabilities: LOWERCASE_IDENTIFIER  */
+#line 5489 "parser-smi.y"
+                        {
+			    if (!strcmp((yyvsp[0].id), "current")) {
 				(yyval.status) = SMI_STATUS_CURRENT;
-			    } else if (!strcmp((yyvsp[(1) - (1)].id), "obsolete")) {
+			    } else if (!strcmp((yyvsp[0].id), "obsolete")) {
 				(yyval.status) = SMI_STATUS_OBSOLETE;
 			    } else {
 				smiPrintError(thisParserPtr,
 					      ERR_INVALID_CAPABILITIES_STATUS,
-					      (yyvsp[(1) - (1)].id));
+					      (yyvsp[0].id));
 				(yyval.status) = SMI_STATUS_UNKNOWN;
 			    }
-			    smiFree((yyvsp[(1) - (1)].id));
-			;}
+			    smiFree((yyvsp[0].id));
+			}
+#line 7796 "parser-smi.c"
     break;
 
-  case 288:
-#line 5503 "parser-smi.y"
-    {
-			    (yyval.text) = (yyvsp[(2) - (2)].text);
+  case 288: /* DisplayPart: DISPLAY_HINT Text  */
+#line 5505 "parser-smi.y"
+                        {
+			    (yyval.text) = (yyvsp[0].text);
 			    
-			    if ((yyvsp[(2) - (2)].text) && !strlen((yyvsp[(2) - (2)].text))) {
+			    if ((yyvsp[0].text) && !strlen((yyvsp[0].text))) {
 				smiPrintError(thisParserPtr,
 					      ERR_EMPTY_FORMAT);
 			    }
-			;}
+			}
+#line 7809 "parser-smi.c"
     break;
 
-  case 289:
-#line 5512 "parser-smi.y"
-    {
+  case 289: /* DisplayPart: %empty  */
+#line 5514 "parser-smi.y"
+                        {
 			    (yyval.text) = NULL;
-			;}
+			}
+#line 7817 "parser-smi.c"
     break;
 
-  case 290:
-#line 5518 "parser-smi.y"
-    {
-			    (yyval.text) = (yyvsp[(2) - (2)].text);
+  case 290: /* UnitsPart: UNITS Text  */
+#line 5520 "parser-smi.y"
+                        {
+			    (yyval.text) = (yyvsp[0].text);
 			    
-			    if ((yyvsp[(2) - (2)].text) && !strlen((yyvsp[(2) - (2)].text))) {
+			    if ((yyvsp[0].text) && !strlen((yyvsp[0].text))) {
 				smiPrintError(thisParserPtr,
 					      ERR_EMPTY_UNITS);
 			    }
-			;}
+			}
+#line 7830 "parser-smi.c"
     break;
 
-  case 291:
-#line 5527 "parser-smi.y"
-    {
+  case 291: /* UnitsPart: %empty  */
+#line 5529 "parser-smi.y"
+                        {
 			    (yyval.text) = NULL;
-			;}
+			}
+#line 7838 "parser-smi.c"
     break;
 
-  case 292:
-#line 5533 "parser-smi.y"
-    {
+  case 292: /* Access: LOWERCASE_IDENTIFIER  */
+#line 5535 "parser-smi.y"
+                        {
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_SMIV2)
 			    {
-				if (!strcmp((yyvsp[(1) - (1)].id), "not-accessible")) {
+				if (!strcmp((yyvsp[0].id), "not-accessible")) {
 				    (yyval.access) = SMI_ACCESS_NOT_ACCESSIBLE;
-				} else if (!strcmp((yyvsp[(1) - (1)].id),
+				} else if (!strcmp((yyvsp[0].id),
 						   "accessible-for-notify")) {
 				    (yyval.access) = SMI_ACCESS_NOTIFY;
-				} else if (!strcmp((yyvsp[(1) - (1)].id), "read-only")) {
+				} else if (!strcmp((yyvsp[0].id), "read-only")) {
 				    (yyval.access) = SMI_ACCESS_READ_ONLY;
-				} else if (!strcmp((yyvsp[(1) - (1)].id), "read-write")) {
+				} else if (!strcmp((yyvsp[0].id), "read-write")) {
 				    (yyval.access) = SMI_ACCESS_READ_WRITE;
-				} else if (!strcmp((yyvsp[(1) - (1)].id), "read-create")) {
+				} else if (!strcmp((yyvsp[0].id), "read-create")) {
 				    (yyval.access) = SMI_ACCESS_READ_WRITE;
 				    thisParserPtr->flags |= FLAG_CREATABLE;
 				    /* TODO:remember it's really read-create */
-				} else if (!strcmp((yyvsp[(1) - (1)].id), "write-only")) {
+				} else if (!strcmp((yyvsp[0].id), "write-only")) {
 				    smiPrintError(thisParserPtr,
 						  ERR_SMIV2_WRITE_ONLY);
 				    (yyval.access) = SMI_ACCESS_READ_WRITE;
 				} else {
 				    smiPrintError(thisParserPtr,
 						  ERR_INVALID_SMIV2_ACCESS,
-						  (yyvsp[(1) - (1)].id));
+						  (yyvsp[0].id));
 				    (yyval.access) = SMI_ACCESS_UNKNOWN;
 				}
 			    } else if (thisModulePtr->export.language != SMI_LANGUAGE_SPPI) {
-				if (!strcmp((yyvsp[(1) - (1)].id), "not-accessible")) {
+				if (!strcmp((yyvsp[0].id), "not-accessible")) {
 				    (yyval.access) = SMI_ACCESS_NOT_ACCESSIBLE;
-				} else if (!strcmp((yyvsp[(1) - (1)].id), "read-only")) {
+				} else if (!strcmp((yyvsp[0].id), "read-only")) {
 				    (yyval.access) = SMI_ACCESS_READ_ONLY;
-				} else if (!strcmp((yyvsp[(1) - (1)].id), "read-write")) {
+				} else if (!strcmp((yyvsp[0].id), "read-write")) {
 				    (yyval.access) = SMI_ACCESS_READ_WRITE;
-				} else if (!strcmp((yyvsp[(1) - (1)].id), "write-only")) {
+				} else if (!strcmp((yyvsp[0].id), "write-only")) {
 				    smiPrintError(thisParserPtr,
 						  ERR_SMIV1_WRITE_ONLY);
 				    (yyval.access) = SMI_ACCESS_READ_WRITE;
 				} else {
 				    smiPrintError(thisParserPtr,
 						  ERR_INVALID_SMIV1_ACCESS,
-						  (yyvsp[(1) - (1)].id));
+						  (yyvsp[0].id));
 				    (yyval.access) = SMI_ACCESS_UNKNOWN;
 				}
 			    } else {
-			        if (!strcmp((yyvsp[(1) - (1)].id), "install")) {
+			        if (!strcmp((yyvsp[0].id), "install")) {
 				    (yyval.access) = SMI_ACCESS_INSTALL;
-			        } else if (!strcmp((yyvsp[(1) - (1)].id), "install-notify")) {
+			        } else if (!strcmp((yyvsp[0].id), "install-notify")) {
 				    (yyval.access) = SMI_ACCESS_INSTALL_NOTIFY;
-			        } else if (!strcmp((yyvsp[(1) - (1)].id), "notify")) {
+			        } else if (!strcmp((yyvsp[0].id), "notify")) {
 				    (yyval.access) = SMI_ACCESS_NOTIFY;
-			        } else if (!strcmp((yyvsp[(1) - (1)].id), "report-only")) {
+			        } else if (!strcmp((yyvsp[0].id), "report-only")) {
 				    (yyval.access) = SMI_ACCESS_REPORT_ONLY;
-			        } else if (!strcmp((yyvsp[(1) - (1)].id), "not-accessible")) {
+			        } else if (!strcmp((yyvsp[0].id), "not-accessible")) {
 				    (yyval.access) = SMI_ACCESS_NOT_ACCESSIBLE;
                                 } else {
 				    smiPrintError(thisParserPtr,
 					          ERR_INVALID_SPPI_ACCESS,
-					          (yyvsp[(1) - (1)].id));
+					          (yyvsp[0].id));
 				    (yyval.access) = SMI_ACCESS_UNKNOWN;
 			        }
                             }
-			    smiFree((yyvsp[(1) - (1)].id));
-			;}
+			    smiFree((yyvsp[0].id));
+			}
+#line 7906 "parser-smi.c"
     break;
 
-  case 293:
-#line 5599 "parser-smi.y"
-    {
+  case 293: /* $@41: %empty  */
+#line 5601 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SPPI_CONSTRUCT_IN_MIB, "PIB-INDEX");
-                        ;}
+                        }
+#line 7915 "parser-smi.c"
     break;
 
-  case 294:
-#line 5604 "parser-smi.y"
-    {
+  case 294: /* IndexPart: PIB_INDEX $@41 '{' Entry '}'  */
+#line 5606 "parser-smi.y"
+                        {
                             List *p = smiMalloc(sizeof(List));
                             
-                            p->ptr       = (yyvsp[(4) - (5)].objectPtr);
+                            p->ptr       = (yyvsp[-1].objectPtr);
                             p->nextPtr   = NULL;
                             
 			    (yyval.index).indexkind = SMI_INDEX_INDEX;
@@ -7968,49 +7927,54 @@ yyreduce:
 			    (yyval.index).listPtr   = p;
 			    (yyval.index).rowPtr    = NULL;
                             indexFlag    = INDEXFLAG_PIBINDEX;
-			;}
+			}
+#line 7932 "parser-smi.c"
     break;
 
-  case 295:
-#line 5619 "parser-smi.y"
-    {
+  case 295: /* IndexPart: AUGMENTS '{' Entry '}'  */
+#line 5621 "parser-smi.y"
+                        {
 			    (yyval.index).indexkind    = SMI_INDEX_AUGMENT;
 			    (yyval.index).implied      = 0;
 			    (yyval.index).listPtr      = NULL;
-			    (yyval.index).rowPtr       = (yyvsp[(3) - (4)].objectPtr);
+			    (yyval.index).rowPtr       = (yyvsp[-1].objectPtr);
                             indexFlag       = INDEXFLAG_AUGMENTS;
-			;}
+			}
+#line 7944 "parser-smi.c"
     break;
 
-  case 296:
-#line 5627 "parser-smi.y"
-    {
+  case 296: /* $@42: %empty  */
+#line 5629 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SPPI_CONSTRUCT_IN_MIB, "EXTENDS");
-                        ;}
+                        }
+#line 7953 "parser-smi.c"
     break;
 
-  case 297:
-#line 5632 "parser-smi.y"
-    {
+  case 297: /* IndexPart: EXTENDS $@42 '{' Entry '}'  */
+#line 5634 "parser-smi.y"
+                        {
 			    (yyval.index).indexkind    = SMI_INDEX_SPARSE;
 			    (yyval.index).implied      = 0;
 			    (yyval.index).listPtr      = NULL;
-			    (yyval.index).rowPtr       = (yyvsp[(4) - (5)].objectPtr);
+			    (yyval.index).rowPtr       = (yyvsp[-1].objectPtr);
                             indexFlag       = INDEXFLAG_EXTENDS;
-			;}
+			}
+#line 7965 "parser-smi.c"
     break;
 
-  case 298:
-#line 5640 "parser-smi.y"
-    {
+  case 298: /* IndexPart: %empty  */
+#line 5642 "parser-smi.y"
+                        {
 			    (yyval.index).indexkind = SMI_INDEX_UNKNOWN;
-			;}
+			}
+#line 7973 "parser-smi.c"
     break;
 
-  case 299:
-#line 5646 "parser-smi.y"
-    {
+  case 299: /* $@43: %empty  */
+#line 5648 "parser-smi.y"
+                        {
                             /* 
                              * To avoid ambiguity caused by merging
                              * the SMI and SPPI parser we use a flag.
@@ -8034,82 +7998,91 @@ yyreduce:
 			     * whether we have seen an IMPLIED keyword.
 			     */
 			    impliedFlag = 0;
-			;}
+			}
+#line 8003 "parser-smi.c"
     break;
 
-  case 300:
-#line 5672 "parser-smi.y"
-    {
+  case 300: /* MibIndex: INDEX $@43 '{' IndexTypes '}'  */
+#line 5674 "parser-smi.y"
+                        {
 			    (yyval.index).indexkind = SMI_INDEX_INDEX;
 			    (yyval.index).implied   = impliedFlag;
-			    (yyval.index).listPtr   = (yyvsp[(4) - (5)].listPtr);
+			    (yyval.index).listPtr   = (yyvsp[-1].listPtr);
 			    (yyval.index).rowPtr    = NULL;
-                        ;}
+                        }
+#line 8014 "parser-smi.c"
     break;
 
-  case 301:
-#line 5679 "parser-smi.y"
-    {
+  case 301: /* MibIndex: %empty  */
+#line 5681 "parser-smi.y"
+                        {
 			    (yyval.index).indexkind = SMI_INDEX_UNKNOWN;
-			;}
+			}
+#line 8022 "parser-smi.c"
     break;
 
-  case 302:
-#line 5685 "parser-smi.y"
-    {
+  case 302: /* IndexTypes: IndexType  */
+#line 5687 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].objectPtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].objectPtr);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 8032 "parser-smi.c"
     break;
 
-  case 303:
-#line 5692 "parser-smi.y"
-    {
+  case 303: /* IndexTypes: IndexTypes ',' IndexType  */
+#line 5694 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (yyvsp[(3) - (3)].objectPtr);
+			    p->ptr = (yyvsp[0].objectPtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-			;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+			}
+#line 8047 "parser-smi.c"
     break;
 
-  case 304:
-#line 5705 "parser-smi.y"
-    {
+  case 304: /* IndexType: IMPLIED Index  */
+#line 5707 "parser-smi.y"
+                        {
 			    impliedFlag = 1;
-			    (yyval.objectPtr) = (yyvsp[(2) - (2)].objectPtr);
-			;}
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
+			}
+#line 8056 "parser-smi.c"
     break;
 
-  case 305:
-#line 5710 "parser-smi.y"
-    {
-			    (yyval.objectPtr) = (yyvsp[(1) - (1)].objectPtr);
-			;}
+  case 305: /* IndexType: Index  */
+#line 5712 "parser-smi.y"
+                        {
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
+			}
+#line 8064 "parser-smi.c"
     break;
 
-  case 306:
-#line 5720 "parser-smi.y"
-    {
-			    (yyval.objectPtr) = (yyvsp[(1) - (1)].objectPtr);
-			;}
+  case 306: /* Index: ObjectName  */
+#line 5722 "parser-smi.y"
+                        {
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
+			}
+#line 8072 "parser-smi.c"
     break;
 
-  case 307:
-#line 5726 "parser-smi.y"
-    {
-			    (yyval.objectPtr) = (yyvsp[(1) - (1)].objectPtr);
-			;}
+  case 307: /* Entry: ObjectName  */
+#line 5728 "parser-smi.y"
+                        {
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
+			}
+#line 8080 "parser-smi.c"
     break;
 
-  case 308:
-#line 5732 "parser-smi.y"
-    {
-			    (yyval.valuePtr) = (yyvsp[(3) - (4)].valuePtr);
+  case 308: /* DefValPart: DEFVAL '{' Value '}'  */
+#line 5734 "parser-smi.y"
+                        {
+			    (yyval.valuePtr) = (yyvsp[-1].valuePtr);
 			    if ((defaultBasetype == SMI_BASETYPE_BITS) &&
 				((yyval.valuePtr)->basetype != SMI_BASETYPE_BITS)) {
 				smiPrintError(thisParserPtr,
@@ -8120,315 +8093,349 @@ yyreduce:
 				smiFree((yyval.valuePtr));
 				(yyval.valuePtr) = NULL;
 			    }
-			;}
+			}
+#line 8098 "parser-smi.c"
     break;
 
-  case 309:
-#line 5746 "parser-smi.y"
-    { (yyval.valuePtr) = NULL; ;}
+  case 309: /* DefValPart: %empty  */
+#line 5748 "parser-smi.y"
+                        { (yyval.valuePtr) = NULL; }
+#line 8104 "parser-smi.c"
     break;
 
-  case 310:
-#line 5751 "parser-smi.y"
-    { (yyval.valuePtr) = (yyvsp[(1) - (1)].valuePtr); ;}
+  case 310: /* Value: valueofObjectSyntax  */
+#line 5753 "parser-smi.y"
+                        { (yyval.valuePtr) = (yyvsp[0].valuePtr); }
+#line 8110 "parser-smi.c"
     break;
 
-  case 311:
-#line 5753 "parser-smi.y"
-    {
+  case 311: /* Value: '{' BitsValue '}'  */
+#line 5755 "parser-smi.y"
+                        {
 			    (yyval.valuePtr) = smiMalloc(sizeof(SmiValue));
 			    (yyval.valuePtr)->basetype = SMI_BASETYPE_BITS;
-			    (yyval.valuePtr)->value.ptr = (void *)(yyvsp[(2) - (3)].listPtr);
-			;}
+			    (yyval.valuePtr)->value.ptr = (void *)(yyvsp[-1].listPtr);
+			}
+#line 8120 "parser-smi.c"
     break;
 
-  case 312:
-#line 5761 "parser-smi.y"
-    { (yyval.listPtr) = (yyvsp[(1) - (1)].listPtr); ;}
+  case 312: /* BitsValue: BitNames  */
+#line 5763 "parser-smi.y"
+                        { (yyval.listPtr) = (yyvsp[0].listPtr); }
+#line 8126 "parser-smi.c"
     break;
 
-  case 313:
-#line 5763 "parser-smi.y"
-    { (yyval.listPtr) = NULL; ;}
+  case 313: /* BitsValue: %empty  */
+#line 5765 "parser-smi.y"
+                        { (yyval.listPtr) = NULL; }
+#line 8132 "parser-smi.c"
     break;
 
-  case 314:
-#line 5767 "parser-smi.y"
-    {
+  case 314: /* BitNames: LOWERCASE_IDENTIFIER  */
+#line 5769 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].id);
+			    (yyval.listPtr)->ptr = (yyvsp[0].id);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 8142 "parser-smi.c"
     break;
 
-  case 315:
-#line 5773 "parser-smi.y"
-    {
+  case 315: /* BitNames: BitNames ',' LOWERCASE_IDENTIFIER  */
+#line 5775 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (yyvsp[(3) - (3)].id);
+			    p->ptr = (yyvsp[0].id);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-			;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+			}
+#line 8157 "parser-smi.c"
     break;
 
-  case 316:
-#line 5786 "parser-smi.y"
-    {
-			    (yyval.objectPtr) = (yyvsp[(1) - (1)].objectPtr);
-			;}
+  case 316: /* ObjectName: objectIdentifier  */
+#line 5788 "parser-smi.y"
+                        {
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
+			}
+#line 8165 "parser-smi.c"
     break;
 
-  case 317:
-#line 5792 "parser-smi.y"
-    {
-			    (yyval.objectPtr) = (yyvsp[(1) - (1)].objectPtr);
-			;}
+  case 317: /* NotificationName: objectIdentifier  */
+#line 5794 "parser-smi.y"
+                        {
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
+			}
+#line 8173 "parser-smi.c"
     break;
 
-  case 318:
-#line 5798 "parser-smi.y"
-    {
-			    (yyval.text) = (yyvsp[(2) - (2)].text);
+  case 318: /* ReferPart: REFERENCE Text  */
+#line 5800 "parser-smi.y"
+                        {
+			    (yyval.text) = (yyvsp[0].text);
 
-			    if ((yyvsp[(2) - (2)].text) && !strlen((yyvsp[(2) - (2)].text))) {
+			    if ((yyvsp[0].text) && !strlen((yyvsp[0].text))) {
 				smiPrintError(thisParserPtr,
 					      ERR_EMPTY_REFERENCE);
 			    }
-			;}
+			}
+#line 8186 "parser-smi.c"
     break;
 
-  case 319:
-#line 5807 "parser-smi.y"
-    { (yyval.text) = NULL; ;}
+  case 319: /* ReferPart: %empty  */
+#line 5809 "parser-smi.y"
+                        { (yyval.text) = NULL; }
+#line 8192 "parser-smi.c"
     break;
 
-  case 320:
-#line 5811 "parser-smi.y"
-    { (yyval.err) = 0; ;}
-    break;
-
-  case 321:
+  case 320: /* RevisionPart: Revisions  */
 #line 5813 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+                        { (yyval.err) = 0; }
+#line 8198 "parser-smi.c"
     break;
 
-  case 322:
-#line 5817 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 321: /* RevisionPart: %empty  */
+#line 5815 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 8204 "parser-smi.c"
     break;
 
-  case 323:
+  case 322: /* Revisions: Revision  */
 #line 5819 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+                        { (yyval.err) = 0; }
+#line 8210 "parser-smi.c"
     break;
 
-  case 324:
-#line 5823 "parser-smi.y"
-    {
+  case 323: /* Revisions: Revisions Revision  */
+#line 5821 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 8216 "parser-smi.c"
+    break;
+
+  case 324: /* $@44: %empty  */
+#line 5825 "parser-smi.y"
+                        {
 			    thisParserPtr->firstRevisionLine = thisParserPtr->line;
 
 			    if (thisParserPtr->modulePtr->lastRevisionPtr &&
-				((yyvsp[(2) - (2)].date) >= thisParserPtr->modulePtr->lastRevisionPtr->export.date)) {
+				((yyvsp[0].date) >= thisParserPtr->modulePtr->lastRevisionPtr->export.date)) {
 				smiPrintError(thisParserPtr,
 					      ERR_REVISION_NOT_DESCENDING);
 			    }
 
-			    if ((yyvsp[(2) - (2)].date) > thisParserPtr->modulePtr->lastUpdated) {
+			    if ((yyvsp[0].date) > thisParserPtr->modulePtr->lastUpdated) {
 				smiPrintError(thisParserPtr,
 					      ERR_REVISION_AFTER_LAST_UPDATE);
 			    }
-			;}
+			}
+#line 8235 "parser-smi.c"
     break;
 
-  case 325:
-#line 5838 "parser-smi.y"
-    {
+  case 325: /* Revision: REVISION ExtUTCTime $@44 DESCRIPTION Text  */
+#line 5840 "parser-smi.y"
+                        {
 			    Revision *revisionPtr;
 
-			    checkDescr(thisParserPtr, (yyvsp[(5) - (5)].text));
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
 
-			    revisionPtr = addRevision((yyvsp[(2) - (5)].date), (yyvsp[(5) - (5)].text), thisParserPtr);
+			    revisionPtr = addRevision((yyvsp[-3].date), (yyvsp[0].text), thisParserPtr);
 			    if (revisionPtr) {
 				setRevisionLine(revisionPtr,
 						thisParserPtr->firstRevisionLine,
 						thisParserPtr);
 			    }
 			    (yyval.err) = revisionPtr ? 0 : -1;
-			;}
+			}
+#line 8253 "parser-smi.c"
     break;
 
-  case 326:
-#line 5854 "parser-smi.y"
-    {
-			    (yyval.listPtr) = (yyvsp[(3) - (4)].listPtr);
-			;}
+  case 326: /* NotificationObjectsPart: OBJECTS '{' Objects '}'  */
+#line 5856 "parser-smi.y"
+                        {
+			    (yyval.listPtr) = (yyvsp[-1].listPtr);
+			}
+#line 8261 "parser-smi.c"
     break;
 
-  case 327:
-#line 5858 "parser-smi.y"
-    {
+  case 327: /* NotificationObjectsPart: %empty  */
+#line 5860 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = NULL;
-			;}
+			}
+#line 8269 "parser-smi.c"
     break;
 
-  case 328:
-#line 5864 "parser-smi.y"
-    {
-			    (yyval.listPtr) = (yyvsp[(3) - (4)].listPtr);
-			;}
+  case 328: /* ObjectGroupObjectsPart: OBJECTS '{' Objects '}'  */
+#line 5866 "parser-smi.y"
+                        {
+			    (yyval.listPtr) = (yyvsp[-1].listPtr);
+			}
+#line 8277 "parser-smi.c"
     break;
 
-  case 329:
-#line 5870 "parser-smi.y"
-    {
+  case 329: /* Objects: Object  */
+#line 5872 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].objectPtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].objectPtr);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 8287 "parser-smi.c"
     break;
 
-  case 330:
-#line 5876 "parser-smi.y"
-    {
+  case 330: /* Objects: Objects ',' Object  */
+#line 5878 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (yyvsp[(3) - (3)].objectPtr);
+			    p->ptr = (yyvsp[0].objectPtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-			;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+			}
+#line 8302 "parser-smi.c"
     break;
 
-  case 331:
-#line 5889 "parser-smi.y"
-    {
-			    (yyval.objectPtr) = (yyvsp[(1) - (1)].objectPtr);
+  case 331: /* Object: ObjectName  */
+#line 5891 "parser-smi.y"
+                        {
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
 			    if ((thisParserPtr->currentDecl == SMI_DECL_OBJECTGROUP) &&
 				(yyval.objectPtr)->modulePtr != thisParserPtr->modulePtr) {
                                 smiPrintError(thisParserPtr,
 					      ERR_COMPLIANCE_MEMBER_NOT_LOCAL,
 					      (yyval.objectPtr)->export.name);
 			    }
-			;}
+			}
+#line 8316 "parser-smi.c"
     break;
 
-  case 332:
-#line 5901 "parser-smi.y"
-    {
-			    (yyval.listPtr) = (yyvsp[(3) - (4)].listPtr);
-			;}
+  case 332: /* NotificationsPart: NOTIFICATIONS '{' Notifications '}'  */
+#line 5903 "parser-smi.y"
+                        {
+			    (yyval.listPtr) = (yyvsp[-1].listPtr);
+			}
+#line 8324 "parser-smi.c"
     break;
 
-  case 333:
-#line 5907 "parser-smi.y"
-    {
+  case 333: /* Notifications: Notification  */
+#line 5909 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].objectPtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].objectPtr);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 8334 "parser-smi.c"
     break;
 
-  case 334:
-#line 5913 "parser-smi.y"
-    {
+  case 334: /* Notifications: Notifications ',' Notification  */
+#line 5915 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (yyvsp[(3) - (3)].objectPtr);
+			    p->ptr = (yyvsp[0].objectPtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-			;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+			}
+#line 8349 "parser-smi.c"
     break;
 
-  case 335:
-#line 5926 "parser-smi.y"
-    {
-			    (yyval.objectPtr) = (yyvsp[(1) - (1)].objectPtr);
+  case 335: /* Notification: NotificationName  */
+#line 5928 "parser-smi.y"
+                        {
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
 			    if ((yyval.objectPtr)->modulePtr != thisParserPtr->modulePtr) {
                                 smiPrintError(thisParserPtr,
 					      ERR_COMPLIANCE_MEMBER_NOT_LOCAL,
 					      (yyval.objectPtr)->export.name);
 			    }
-			;}
+			}
+#line 8362 "parser-smi.c"
     break;
 
-  case 336:
-#line 5937 "parser-smi.y"
-    {
+  case 336: /* Text: QUOTED_STRING  */
+#line 5939 "parser-smi.y"
+                        {
 			    int len;
-			    (yyval.text) = smiStrdup((yyvsp[(1) - (1)].text));
+			    (yyval.text) = smiStrdup((yyvsp[0].text));
 			    len = strlen((yyval.text));
 			    while (len > 0 && (yyval.text)[len-1] == '\n') {
 				(yyval.text)[--len] = 0;
 			    }
-			;}
+			}
+#line 8375 "parser-smi.c"
     break;
 
-  case 337:
-#line 5948 "parser-smi.y"
-    {
-			    (yyval.date) = checkDate(thisParserPtr, (yyvsp[(1) - (1)].text));
-			;}
+  case 337: /* ExtUTCTime: QUOTED_STRING  */
+#line 5950 "parser-smi.y"
+                        {
+			    (yyval.date) = checkDate(thisParserPtr, (yyvsp[0].text));
+			}
+#line 8383 "parser-smi.c"
     break;
 
-  case 338:
-#line 5953 "parser-smi.y"
-    {
+  case 338: /* $@45: %empty  */
+#line 5955 "parser-smi.y"
+                        {
 			    thisParserPtr->parentNodePtr = smiHandle->rootNodePtr;
-			;}
+			}
+#line 8391 "parser-smi.c"
     break;
 
-  case 339:
-#line 5957 "parser-smi.y"
-    {
-			    (yyval.objectPtr) = (yyvsp[(2) - (2)].objectPtr);
+  case 339: /* objectIdentifier: $@45 subidentifiers  */
+#line 5959 "parser-smi.y"
+                        {
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
 			    if ((yyval.objectPtr)) {
-				thisParserPtr->parentNodePtr = (yyvsp[(2) - (2)].objectPtr)->nodePtr;
+				thisParserPtr->parentNodePtr = (yyvsp[0].objectPtr)->nodePtr;
 			    } else {
 				thisParserPtr->parentNodePtr = NULL;
 			    }
-			;}
+			}
+#line 8404 "parser-smi.c"
     break;
 
-  case 340:
-#line 5969 "parser-smi.y"
-    {
-			    (yyval.objectPtr) = (yyvsp[(1) - (1)].objectPtr);
-			;}
+  case 340: /* subidentifiers: subidentifier  */
+#line 5971 "parser-smi.y"
+                        {
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
+			}
+#line 8412 "parser-smi.c"
     break;
 
-  case 341:
-#line 5974 "parser-smi.y"
-    {
-			    (yyval.objectPtr) = (yyvsp[(2) - (2)].objectPtr);
-			;}
+  case 341: /* subidentifiers: subidentifiers subidentifier  */
+#line 5976 "parser-smi.y"
+                        {
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
+			}
+#line 8420 "parser-smi.c"
     break;
 
-  case 342:
-#line 5982 "parser-smi.y"
-    {
+  case 342: /* subidentifier: fuzzy_lowercase_identifier  */
+#line 5984 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    Import *importPtr;
 			    
 			    if (thisParserPtr->parentNodePtr != smiHandle->rootNodePtr) {
 				smiPrintError(thisParserPtr,
-					      ERR_OIDLABEL_NOT_FIRST, (yyvsp[(1) - (1)].id));
+					      ERR_OIDLABEL_NOT_FIRST, (yyvsp[0].id));
 			    }
 			    objectPtr = findObjectByModuleAndName(
-				thisParserPtr->modulePtr, (yyvsp[(1) - (1)].id));
+				thisParserPtr->modulePtr, (yyvsp[0].id));
 			    if (objectPtr) {
 				(yyval.objectPtr) = objectPtr;
-				smiFree((yyvsp[(1) - (1)].id));
+				smiFree((yyvsp[0].id));
 			    } else {
-				importPtr = findImportByName((yyvsp[(1) - (1)].id),
+				importPtr = findImportByName((yyvsp[0].id),
 							     thisModulePtr);
 				if (!importPtr ||
 				    (importPtr->kind == KIND_NOTFOUND)) {
@@ -8439,46 +8446,46 @@ yyreduce:
 				    if (thisParserPtr->complianceModulePtr) {
 					objectPtr =
 					    findObjectByModuleAndName(
-						thisParserPtr->complianceModulePtr, (yyvsp[(1) - (1)].id));
+						thisParserPtr->complianceModulePtr, (yyvsp[0].id));
 					if (objectPtr) {
 					    importPtr = addImport(
-						(yyvsp[(1) - (1)].id),
+						(yyvsp[0].id),
 						thisParserPtr);
 					    setImportModulename(importPtr,
-								thisParserPtr->complianceModulePtr->export.name);
+						smiStrdup(thisParserPtr->complianceModulePtr->export.name));
 					    addImportFlags(importPtr,
 							   FLAG_INCOMPLIANCE);
 					    importPtr->use++;
 					} else {
-					    objectPtr = addObject((yyvsp[(1) - (1)].id),
+					    objectPtr = addObject((yyvsp[0].id),
 								  thisParserPtr->pendingNodePtr, 0,
 								  FLAG_INCOMPLETE,
 								  thisParserPtr);
 					    smiPrintError(thisParserPtr,
-							  ERR_IDENTIFIER_NOT_IN_MODULE, (yyvsp[(1) - (1)].id),
+							  ERR_IDENTIFIER_NOT_IN_MODULE, (yyvsp[0].id),
 							  thisParserPtr->complianceModulePtr->export.name);
 					}
 				    } else if (thisParserPtr->capabilitiesModulePtr) {
 					objectPtr =
 					    findObjectByModuleAndName(
-						thisParserPtr->capabilitiesModulePtr, (yyvsp[(1) - (1)].id));
+						thisParserPtr->capabilitiesModulePtr, (yyvsp[0].id));
 					if (objectPtr) {
 					    importPtr = addImport(
-						(yyvsp[(1) - (1)].id),
+						(yyvsp[0].id),
 						thisParserPtr);
 					    setImportModulename(importPtr,
-								thisParserPtr->capabilitiesModulePtr->
-								export.name);
+						smiStrdup(thisParserPtr->capabilitiesModulePtr->
+								export.name));
 					    addImportFlags(importPtr,
 							   FLAG_INCOMPLIANCE);
 					    importPtr->use++;
 					} else {
-					    objectPtr = addObject((yyvsp[(1) - (1)].id),
+					    objectPtr = addObject((yyvsp[0].id),
 								  thisParserPtr->pendingNodePtr, 0,
 								  FLAG_INCOMPLETE,
 								  thisParserPtr);
 					    smiPrintError(thisParserPtr,
-							  ERR_IDENTIFIER_NOT_IN_MODULE, (yyvsp[(1) - (1)].id),
+							  ERR_IDENTIFIER_NOT_IN_MODULE, (yyvsp[0].id),
 							  thisParserPtr->capabilitiesModulePtr->export.name);
 					}
 				    } else {
@@ -8487,7 +8494,7 @@ yyreduce:
 					 * create it,
 					 * marked with FLAG_INCOMPLETE.
 					 */
-					objectPtr = addObject((yyvsp[(1) - (1)].id),
+					objectPtr = addObject((yyvsp[0].id),
 							      thisParserPtr->pendingNodePtr,
 							      0,
 							      FLAG_INCOMPLETE,
@@ -8500,39 +8507,40 @@ yyreduce:
 				     */
 				    importPtr->use++;
 				    (yyval.objectPtr) = findObjectByModulenameAndName(
-					importPtr->export.module, (yyvsp[(1) - (1)].id));
-				    smiFree((yyvsp[(1) - (1)].id));
+					importPtr->export.module, (yyvsp[0].id));
+				    smiFree((yyvsp[0].id));
 				}
 			    }
 			    if ((yyval.objectPtr))
 				thisParserPtr->parentNodePtr = (yyval.objectPtr)->nodePtr;
-			;}
+			}
+#line 8518 "parser-smi.c"
     break;
 
-  case 343:
-#line 6076 "parser-smi.y"
-    {
+  case 343: /* subidentifier: moduleName '.' LOWERCASE_IDENTIFIER  */
+#line 6078 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    Import *importPtr;
 			    char *md;
 			    
 			    if (thisParserPtr->parentNodePtr != smiHandle->rootNodePtr) {
 				md = smiMalloc(sizeof(char) *
-					       (strlen((yyvsp[(1) - (3)].id)) + strlen((yyvsp[(3) - (3)].id)) + 2));
-				sprintf(md, "%s.%s", (yyvsp[(1) - (3)].id), (yyvsp[(3) - (3)].id));
+					       (strlen((yyvsp[-2].id)) + strlen((yyvsp[0].id)) + 2));
+				sprintf(md, "%s.%s", (yyvsp[-2].id), (yyvsp[0].id));
 				smiPrintError(thisParserPtr,
 					      ERR_OIDLABEL_NOT_FIRST, md);
 				smiFree(md);
 			    } else {
 				objectPtr = findObjectByModulenameAndName(
-				    (yyvsp[(1) - (3)].id), (yyvsp[(3) - (3)].id));
+				    (yyvsp[-2].id), (yyvsp[0].id));
 				if (objectPtr) {
 				    (yyval.objectPtr) = objectPtr;
-				    smiFree((yyvsp[(1) - (3)].id));
-				    smiFree((yyvsp[(3) - (3)].id));
+				    smiFree((yyvsp[-2].id));
+				    smiFree((yyvsp[0].id));
 				} else {
 				    importPtr = findImportByModulenameAndName(
-					(yyvsp[(1) - (3)].id), (yyvsp[(3) - (3)].id), thisModulePtr);
+					(yyvsp[-2].id), (yyvsp[0].id), thisModulePtr);
 				    if (!importPtr ||
 					(importPtr->kind == KIND_NOTFOUND)) {
 					/* TODO: check: $1 == thisModule ? */
@@ -8543,46 +8551,46 @@ yyreduce:
 					if (thisParserPtr->complianceModulePtr) {
 					    objectPtr =
 						findObjectByModuleAndName(
-						    thisParserPtr->complianceModulePtr, (yyvsp[(1) - (3)].id));
+						    thisParserPtr->complianceModulePtr, (yyvsp[-2].id));
 					    if (objectPtr) {
 						importPtr = addImport(
-						    (yyvsp[(1) - (3)].id),
+						    (yyvsp[-2].id),
 						    thisParserPtr);
 						setImportModulename(importPtr,
-						    thisParserPtr->complianceModulePtr->export.name);
+						    smiStrdup(thisParserPtr->complianceModulePtr->export.name));
 						addImportFlags(importPtr,
 							       FLAG_INCOMPLIANCE);
 						importPtr->use++;
 					    } else {
-						objectPtr = addObject((yyvsp[(1) - (3)].id),
+						objectPtr = addObject((yyvsp[-2].id),
 						    thisParserPtr->pendingNodePtr, 0,
 						    FLAG_INCOMPLETE,
 						    thisParserPtr);
 						smiPrintError(thisParserPtr,
-					      ERR_IDENTIFIER_NOT_IN_MODULE, (yyvsp[(1) - (3)].id),
+					      ERR_IDENTIFIER_NOT_IN_MODULE, (yyvsp[-2].id),
 					     thisParserPtr->complianceModulePtr->export.name);
 					    }
 					} else if (thisParserPtr->capabilitiesModulePtr) {
 					    objectPtr =
 						findObjectByModuleAndName(
-						    thisParserPtr->capabilitiesModulePtr, (yyvsp[(1) - (3)].id));
+						    thisParserPtr->capabilitiesModulePtr, (yyvsp[-2].id));
 					    if (objectPtr) {
 						importPtr = addImport(
-						    (yyvsp[(1) - (3)].id),
+						    (yyvsp[-2].id),
 						    thisParserPtr);
 						setImportModulename(importPtr,
-						        thisParserPtr->capabilitiesModulePtr->
-								  export.name);
+						        smiStrdup(thisParserPtr->capabilitiesModulePtr->
+								  export.name));
 						addImportFlags(importPtr,
 							       FLAG_INCOMPLIANCE);
 						importPtr->use++;
 					    } else {
-						objectPtr = addObject((yyvsp[(1) - (3)].id),
+						objectPtr = addObject((yyvsp[-2].id),
 						    thisParserPtr->pendingNodePtr, 0,
 						    FLAG_INCOMPLETE,
 						    thisParserPtr);
 						smiPrintError(thisParserPtr,
-					      ERR_IDENTIFIER_NOT_IN_MODULE, (yyvsp[(1) - (3)].id),
+					      ERR_IDENTIFIER_NOT_IN_MODULE, (yyvsp[-2].id),
 					   thisParserPtr->capabilitiesModulePtr->export.name);
 					    }
 					} else {
@@ -8591,12 +8599,12 @@ yyreduce:
 					     * create it,
 					     * marked with FLAG_INCOMPLETE.
 					     */
-					    objectPtr = addObject((yyvsp[(3) - (3)].id),
+					    objectPtr = addObject((yyvsp[0].id),
 							    thisParserPtr->pendingNodePtr,
 							      0,
 							      FLAG_INCOMPLETE,
 							      thisParserPtr);
-					    smiFree((yyvsp[(1) - (3)].id));
+					    smiFree((yyvsp[-2].id));
 					}
 					(yyval.objectPtr) = objectPtr;
 				    } else {
@@ -8605,25 +8613,26 @@ yyreduce:
 					 */
 					importPtr->use++;
 					(yyval.objectPtr) = findObjectByModulenameAndName(
-					    importPtr->export.module, (yyvsp[(3) - (3)].id));
-					smiFree((yyvsp[(1) - (3)].id));
-					smiFree((yyvsp[(3) - (3)].id));
+					    importPtr->export.module, (yyvsp[0].id));
+					smiFree((yyvsp[-2].id));
+					smiFree((yyvsp[0].id));
 				    }
 				}
 				if ((yyval.objectPtr))
 				    thisParserPtr->parentNodePtr = (yyval.objectPtr)->nodePtr;
 			    }
-			;}
+			}
+#line 8626 "parser-smi.c"
     break;
 
-  case 344:
-#line 6180 "parser-smi.y"
-    {
+  case 344: /* subidentifier: NUMBER  */
+#line 6182 "parser-smi.y"
+                        {
 			    Node *nodePtr;
 			    Object *objectPtr;
 
 			    nodePtr = findNodeByParentAndSubid(thisParserPtr->parentNodePtr,
-							       (yyvsp[(1) - (1)].unsigned32));
+							       (yyvsp[0].unsigned32));
 			    if (nodePtr && nodePtr->lastObjectPtr &&
 	       		(nodePtr->lastObjectPtr->modulePtr == thisModulePtr)) {
 				/*
@@ -8634,18 +8643,19 @@ yyreduce:
 			    } else {
 				objectPtr = addObject(NULL,
 						      thisParserPtr->parentNodePtr,
-						      (yyvsp[(1) - (1)].unsigned32),
+						      (yyvsp[0].unsigned32),
 						      FLAG_INCOMPLETE,
 						      thisParserPtr);
 				(yyval.objectPtr) = objectPtr;
 			    }
 			    thisParserPtr->parentNodePtr = (yyval.objectPtr)->nodePtr;
-			;}
+			}
+#line 8654 "parser-smi.c"
     break;
 
-  case 345:
-#line 6204 "parser-smi.y"
-    {
+  case 345: /* subidentifier: LOWERCASE_IDENTIFIER '(' NUMBER ')'  */
+#line 6206 "parser-smi.y"
+                        {
 			    Object *objectPtr = NULL;
 			    Object *oldObjectPtr = NULL;
 			    Node *oldNodePtr = NULL;
@@ -8655,23 +8665,23 @@ yyreduce:
 			     */
 
 			    oldNodePtr = findNodeByParentAndSubid(
-				thisParserPtr->parentNodePtr, (yyvsp[(3) - (4)].unsigned32));
+				thisParserPtr->parentNodePtr, (yyvsp[-1].unsigned32));
 			    oldObjectPtr = findObjectByModuleAndName(
-                                thisParserPtr->modulePtr, (yyvsp[(1) - (4)].id));
+                                thisParserPtr->modulePtr, (yyvsp[-3].id));
 
 			    if (oldObjectPtr &&
-				((oldObjectPtr->nodePtr->subid != (yyvsp[(3) - (4)].unsigned32)) ||
+				((oldObjectPtr->nodePtr->subid != (yyvsp[-1].unsigned32)) ||
 				 (oldObjectPtr->nodePtr->parentPtr != thisParserPtr->parentNodePtr))) {
 				smiPrintError(thisParserPtr,
 					      ERR_IDENTIFIER_OID_CHANGED,
-					      (yyvsp[(1) - (4)].id));
+					      (yyvsp[-3].id));
 				smiPrintErrorAtLine(thisParserPtr,
 						    ERR_PREVIOUS_DEFINITION,
 						    oldObjectPtr->line,
 						    oldObjectPtr->export.name);
-				objectPtr = addObject((yyvsp[(1) - (4)].id),
+				objectPtr = addObject((yyvsp[-3].id),
 						      thisParserPtr->parentNodePtr,
-						      (yyvsp[(3) - (4)].unsigned32), 0, thisParserPtr);
+						      (yyvsp[-1].unsigned32), 0, thisParserPtr);
 				setObjectDecl(objectPtr,
 					      SMI_DECL_IMPL_OBJECT);
 				(yyval.objectPtr) = objectPtr;
@@ -8679,84 +8689,85 @@ yyreduce:
 			    } else if (oldNodePtr &&
 				       oldNodePtr->lastObjectPtr &&
 				       oldNodePtr->lastObjectPtr->export.name &&
-				       strcmp(oldNodePtr->lastObjectPtr->export.name, (yyvsp[(1) - (4)].id))) {
+				       strcmp(oldNodePtr->lastObjectPtr->export.name, (yyvsp[-3].id))) {
 				smiPrintError(thisParserPtr,
 					      ERR_OIDLABEL_CHANGED,
-					      (yyvsp[(1) - (4)].id), oldNodePtr->lastObjectPtr->export.name);
+					      (yyvsp[-3].id), oldNodePtr->lastObjectPtr->export.name);
 				smiPrintErrorAtLine(thisParserPtr,
 						    ERR_PREVIOUS_DEFINITION,
 						    oldNodePtr->lastObjectPtr->line,
 						    oldNodePtr->lastObjectPtr->export.name);
-				objectPtr = addObject((yyvsp[(1) - (4)].id),
+				objectPtr = addObject((yyvsp[-3].id),
 						      thisParserPtr->parentNodePtr,
-						      (yyvsp[(3) - (4)].unsigned32), 0, thisParserPtr);
+						      (yyvsp[-1].unsigned32), 0, thisParserPtr);
 				setObjectDecl(objectPtr,
 					      SMI_DECL_IMPL_OBJECT);
 				(yyval.objectPtr) = objectPtr;
 				thisParserPtr->parentNodePtr = (yyval.objectPtr)->nodePtr;
 			    } else {
-				objectPtr = addObject((yyvsp[(1) - (4)].id), thisParserPtr->parentNodePtr,
-						      (yyvsp[(3) - (4)].unsigned32), 0,
+				objectPtr = addObject((yyvsp[-3].id), thisParserPtr->parentNodePtr,
+						      (yyvsp[-1].unsigned32), 0,
 						      thisParserPtr);
 				setObjectDecl(objectPtr,
 					      SMI_DECL_IMPL_OBJECT);
 				(yyval.objectPtr) = objectPtr;
 				thisParserPtr->parentNodePtr = (yyval.objectPtr)->nodePtr;
 			    }
-			;}
+			}
+#line 8718 "parser-smi.c"
     break;
 
-  case 346:
-#line 6264 "parser-smi.y"
-    {
+  case 346: /* subidentifier: moduleName '.' LOWERCASE_IDENTIFIER '(' NUMBER ')'  */
+#line 6266 "parser-smi.y"
+                        {
 			    Object *objectPtr = NULL;
 			    Object *oldObjectPtr = NULL;
 			    Node *oldNodePtr = NULL;
 			    char *md;
 
 			    md = smiMalloc(sizeof(char) *
-					   (strlen((yyvsp[(1) - (6)].id)) + strlen((yyvsp[(3) - (6)].id)) + 2));
-			    sprintf(md, "%s.%s", (yyvsp[(1) - (6)].id), (yyvsp[(3) - (6)].id));
+					   (strlen((yyvsp[-5].id)) + strlen((yyvsp[-3].id)) + 2));
+			    sprintf(md, "%s.%s", (yyvsp[-5].id), (yyvsp[-3].id));
 
 			    oldNodePtr = findNodeByParentAndSubid(
-				thisParserPtr->parentNodePtr, (yyvsp[(5) - (6)].unsigned32));
+				thisParserPtr->parentNodePtr, (yyvsp[-1].unsigned32));
 			    oldObjectPtr = findObjectByModulenameAndName(
-                                (yyvsp[(1) - (6)].id), (yyvsp[(3) - (6)].id));
+                                (yyvsp[-5].id), (yyvsp[-3].id));
 
 			    if (oldObjectPtr &&
-				((oldObjectPtr->nodePtr->subid != (yyvsp[(5) - (6)].unsigned32)) ||
+				((oldObjectPtr->nodePtr->subid != (yyvsp[-1].unsigned32)) ||
 				 (oldObjectPtr->nodePtr->parentPtr != thisParserPtr->parentNodePtr))) {
 				smiPrintError(thisParserPtr,
 					      ERR_ILLEGALLY_QUALIFIED, md);
 				smiPrintError(thisParserPtr,
 					      ERR_IDENTIFIER_OID_CHANGED,
-					      (yyvsp[(3) - (6)].id));
+					      (yyvsp[-3].id));
 				smiPrintErrorAtLine(thisParserPtr,
 						    ERR_PREVIOUS_DEFINITION,
 						    oldObjectPtr->line,
 						    oldObjectPtr->export.name);
-				objectPtr = addObject((yyvsp[(3) - (6)].id),
+				objectPtr = addObject((yyvsp[-3].id),
 						      thisParserPtr->parentNodePtr,
-						      (yyvsp[(5) - (6)].unsigned32), 0, thisParserPtr);
+						      (yyvsp[-1].unsigned32), 0, thisParserPtr);
 				setObjectDecl(objectPtr,
 					      SMI_DECL_IMPL_OBJECT);
 				(yyval.objectPtr) = objectPtr;
 				thisParserPtr->parentNodePtr = (yyval.objectPtr)->nodePtr;
 			    } else if (oldNodePtr &&
 				       oldNodePtr->lastObjectPtr &&
-				       strcmp(oldNodePtr->lastObjectPtr->export.name, (yyvsp[(3) - (6)].id))) {
+				       strcmp(oldNodePtr->lastObjectPtr->export.name, (yyvsp[-3].id))) {
 				smiPrintError(thisParserPtr,
 					      ERR_ILLEGALLY_QUALIFIED, md);
 				smiPrintError(thisParserPtr,
 					      ERR_OIDLABEL_CHANGED,
-					      (yyvsp[(3) - (6)].id), oldNodePtr->lastObjectPtr->export.name);
+					      (yyvsp[-3].id), oldNodePtr->lastObjectPtr->export.name);
 				smiPrintErrorAtLine(thisParserPtr,
 						    ERR_PREVIOUS_DEFINITION,
 						    oldNodePtr->lastObjectPtr->line,
 						    oldNodePtr->lastObjectPtr->export.name);
-				objectPtr = addObject((yyvsp[(3) - (6)].id),
+				objectPtr = addObject((yyvsp[-3].id),
 						      thisParserPtr->parentNodePtr,
-						      (yyvsp[(5) - (6)].unsigned32), 0, thisParserPtr);
+						      (yyvsp[-1].unsigned32), 0, thisParserPtr);
 				setObjectDecl(objectPtr,
 					      SMI_DECL_IMPL_OBJECT);
 				(yyval.objectPtr) = objectPtr;
@@ -8764,8 +8775,8 @@ yyreduce:
 			    } else {
 				smiPrintError(thisParserPtr,
 					      ERR_ILLEGALLY_QUALIFIED, md);
-				objectPtr = addObject((yyvsp[(3) - (6)].id), thisParserPtr->parentNodePtr,
-						      (yyvsp[(5) - (6)].unsigned32), 0,
+				objectPtr = addObject((yyvsp[-3].id), thisParserPtr->parentNodePtr,
+						      (yyvsp[-1].unsigned32), 0,
 						      thisParserPtr);
 				setObjectDecl(objectPtr,
 					      SMI_DECL_IMPL_OBJECT);
@@ -8773,50 +8784,57 @@ yyreduce:
 				thisParserPtr->parentNodePtr = (yyval.objectPtr)->nodePtr;
 			    }
 			    smiFree(md);
-			;}
-    break;
-
-  case 347:
-#line 6333 "parser-smi.y"
-    { (yyval.text) = NULL; ;}
+			}
+#line 8789 "parser-smi.c"
     break;
 
-  case 348:
-#line 6337 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 347: /* objectIdentifier_defval: subidentifiers_defval  */
+#line 6335 "parser-smi.y"
+                        { (yyval.text) = NULL; }
+#line 8795 "parser-smi.c"
     break;
 
-  case 349:
+  case 348: /* subidentifiers_defval: subidentifier_defval  */
 #line 6339 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+                        { (yyval.err) = 0; }
+#line 8801 "parser-smi.c"
     break;
 
-  case 350:
-#line 6343 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 349: /* subidentifiers_defval: subidentifiers_defval subidentifier_defval  */
+#line 6341 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 8807 "parser-smi.c"
     break;
 
-  case 351:
+  case 350: /* subidentifier_defval: LOWERCASE_IDENTIFIER '(' NUMBER ')'  */
 #line 6345 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+                        { (yyval.err) = 0; }
+#line 8813 "parser-smi.c"
     break;
 
-  case 352:
-#line 6349 "parser-smi.y"
-    {
+  case 351: /* subidentifier_defval: NUMBER  */
+#line 6347 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 8819 "parser-smi.c"
+    break;
+
+  case 352: /* $@46: %empty  */
+#line 6351 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_OBJECTGROUP;
 			    
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_OIDNAME_32, ERR_OIDNAME_64);
 			    smiCheckObjectName(thisParserPtr,
-					       thisModulePtr, (yyvsp[(1) - (1)].id));
-			;}
+					       thisModulePtr, (yyvsp[0].id));
+			}
+#line 8833 "parser-smi.c"
     break;
 
-  case 353:
-#line 6359 "parser-smi.y"
-    {
+  case 353: /* $@47: %empty  */
+#line 6361 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_UNKNOWN)
@@ -8831,59 +8849,63 @@ yyreduce:
 					      ERR_MACRO_NOT_IMPORTED,
 					      "OBJECT-GROUP", "SNMPv2-CONF");
 			    }
-			;}
+			}
+#line 8854 "parser-smi.c"
     break;
 
-  case 354:
-#line 6378 "parser-smi.y"
-    {
-			    checkDescr(thisParserPtr, (yyvsp[(9) - (9)].text));
-			;}
+  case 354: /* $@48: %empty  */
+#line 6380 "parser-smi.y"
+                        {
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
+			}
+#line 8862 "parser-smi.c"
     break;
 
-  case 355:
-#line 6383 "parser-smi.y"
-    {
+  case 355: /* objectGroupClause: LOWERCASE_IDENTIFIER $@46 OBJECT_GROUP $@47 ObjectGroupObjectsPart STATUS Status DESCRIPTION Text $@48 ReferPart COLON_COLON_EQUAL '{' objectIdentifier '}'  */
+#line 6385 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    
-			    objectPtr = (yyvsp[(14) - (15)].objectPtr);
+			    objectPtr = (yyvsp[-1].objectPtr);
 
-			    smiCheckObjectReuse(thisParserPtr, (yyvsp[(1) - (15)].id), &objectPtr);
+			    smiCheckObjectReuse(thisParserPtr, (yyvsp[-14].id), &objectPtr);
 
-			    objectPtr = setObjectName(objectPtr, (yyvsp[(1) - (15)].id), thisParserPtr);
+			    objectPtr = setObjectName(objectPtr, (yyvsp[-14].id), thisParserPtr);
 			    setObjectDecl(objectPtr, SMI_DECL_OBJECTGROUP);
 			    setObjectLine(objectPtr, thisParserPtr->firstStatementLine,
 					  thisParserPtr);
 			    addObjectFlags(objectPtr, FLAG_REGISTERED);
 			    deleteObjectFlags(objectPtr, FLAG_INCOMPLETE);
-			    setObjectStatus(objectPtr, (yyvsp[(7) - (15)].status));
-			    setObjectDescription(objectPtr, (yyvsp[(9) - (15)].text), thisParserPtr);
-			    if ((yyvsp[(11) - (15)].text)) {
-				setObjectReference(objectPtr, (yyvsp[(11) - (15)].text), thisParserPtr);
+			    setObjectStatus(objectPtr, (yyvsp[-8].status));
+			    setObjectDescription(objectPtr, (yyvsp[-6].text), thisParserPtr);
+			    if ((yyvsp[-4].text)) {
+				setObjectReference(objectPtr, (yyvsp[-4].text), thisParserPtr);
 			    }
 			    setObjectAccess(objectPtr,
 					    SMI_ACCESS_NOT_ACCESSIBLE);
-			    setObjectList(objectPtr, (yyvsp[(5) - (15)].listPtr));
+			    setObjectList(objectPtr, (yyvsp[-10].listPtr));
 			    (yyval.err) = 0;
-			;}
+			}
+#line 8890 "parser-smi.c"
     break;
 
-  case 356:
-#line 6409 "parser-smi.y"
-    {
+  case 356: /* $@49: %empty  */
+#line 6411 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_NOTIFICATIONGROUP;
 			    
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_OIDNAME_32, ERR_OIDNAME_64);
 			    smiCheckObjectName(thisParserPtr,
-					       thisModulePtr, (yyvsp[(1) - (1)].id));
-			;}
+					       thisModulePtr, (yyvsp[0].id));
+			}
+#line 8904 "parser-smi.c"
     break;
 
-  case 357:
-#line 6419 "parser-smi.y"
-    {
+  case 357: /* $@50: %empty  */
+#line 6421 "parser-smi.y"
+                        {
 			    Import *importPtr;
                             if (thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SMI_CONSTRUCT_IN_PIB, "NOTIFICATION-GROUP");
@@ -8901,60 +8923,64 @@ yyreduce:
 					      "NOTIFICATION-GROUP",
 					      "SNMPv2-CONF");
 			    }
-			;}
+			}
+#line 8928 "parser-smi.c"
     break;
 
-  case 358:
-#line 6441 "parser-smi.y"
-    {
-			    checkDescr(thisParserPtr, (yyvsp[(9) - (9)].text));
-			;}
+  case 358: /* $@51: %empty  */
+#line 6443 "parser-smi.y"
+                        {
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
+			}
+#line 8936 "parser-smi.c"
     break;
 
-  case 359:
-#line 6446 "parser-smi.y"
-    {
+  case 359: /* notificationGroupClause: LOWERCASE_IDENTIFIER $@49 NOTIFICATION_GROUP $@50 NotificationsPart STATUS Status DESCRIPTION Text $@51 ReferPart COLON_COLON_EQUAL '{' objectIdentifier '}'  */
+#line 6448 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    
-			    objectPtr = (yyvsp[(14) - (15)].objectPtr);
+			    objectPtr = (yyvsp[-1].objectPtr);
 
-			    smiCheckObjectReuse(thisParserPtr, (yyvsp[(1) - (15)].id), &objectPtr);
+			    smiCheckObjectReuse(thisParserPtr, (yyvsp[-14].id), &objectPtr);
 
-			    objectPtr = setObjectName(objectPtr, (yyvsp[(1) - (15)].id), thisParserPtr);
+			    objectPtr = setObjectName(objectPtr, (yyvsp[-14].id), thisParserPtr);
 			    setObjectDecl(objectPtr,
 					  SMI_DECL_NOTIFICATIONGROUP);
 			    setObjectLine(objectPtr, thisParserPtr->firstStatementLine,
 					  thisParserPtr);
 			    addObjectFlags(objectPtr, FLAG_REGISTERED);
 			    deleteObjectFlags(objectPtr, FLAG_INCOMPLETE);
-			    setObjectStatus(objectPtr, (yyvsp[(7) - (15)].status));
-			    setObjectDescription(objectPtr, (yyvsp[(9) - (15)].text), thisParserPtr);
-			    if ((yyvsp[(11) - (15)].text)) {
-				setObjectReference(objectPtr, (yyvsp[(11) - (15)].text), thisParserPtr);
+			    setObjectStatus(objectPtr, (yyvsp[-8].status));
+			    setObjectDescription(objectPtr, (yyvsp[-6].text), thisParserPtr);
+			    if ((yyvsp[-4].text)) {
+				setObjectReference(objectPtr, (yyvsp[-4].text), thisParserPtr);
 			    }
 			    setObjectAccess(objectPtr,
 					    SMI_ACCESS_NOT_ACCESSIBLE);
-			    setObjectList(objectPtr, (yyvsp[(5) - (15)].listPtr));
+			    setObjectList(objectPtr, (yyvsp[-10].listPtr));
 			    (yyval.err) = 0;
-			;}
+			}
+#line 8965 "parser-smi.c"
     break;
 
-  case 360:
-#line 6473 "parser-smi.y"
-    {
+  case 360: /* $@52: %empty  */
+#line 6475 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_MODULECOMPLIANCE;
 			    
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_OIDNAME_32, ERR_OIDNAME_64);
 			    smiCheckObjectName(thisParserPtr,
-					       thisModulePtr, (yyvsp[(1) - (1)].id));
-			;}
+					       thisModulePtr, (yyvsp[0].id));
+			}
+#line 8979 "parser-smi.c"
     break;
 
-  case 361:
-#line 6483 "parser-smi.y"
-    {
+  case 361: /* $@53: %empty  */
+#line 6485 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
 			    if (thisModulePtr->export.language == SMI_LANGUAGE_UNKNOWN)
@@ -8969,49 +8995,51 @@ yyreduce:
 					      "MODULE-COMPLIANCE",
 					      "SNMPv2-CONF");
 			    }
-			;}
+			}
+#line 9000 "parser-smi.c"
     break;
 
-  case 362:
-#line 6501 "parser-smi.y"
-    {
-			    checkDescr(thisParserPtr, (yyvsp[(8) - (8)].text));
-			;}
+  case 362: /* $@54: %empty  */
+#line 6503 "parser-smi.y"
+                        {
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
+			}
+#line 9008 "parser-smi.c"
     break;
 
-  case 363:
-#line 6507 "parser-smi.y"
-    {
+  case 363: /* moduleComplianceClause: LOWERCASE_IDENTIFIER $@52 MODULE_COMPLIANCE $@53 STATUS Status DESCRIPTION Text $@54 ReferPart ComplianceModulePart COLON_COLON_EQUAL '{' objectIdentifier '}'  */
+#line 6509 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    Option *optionPtr;
 			    Refinement *refinementPtr;
 			    List *listPtr;
 			    
-			    objectPtr = (yyvsp[(14) - (15)].objectPtr);
+			    objectPtr = (yyvsp[-1].objectPtr);
 
-			    smiCheckObjectReuse(thisParserPtr, (yyvsp[(1) - (15)].id), &objectPtr);
+			    smiCheckObjectReuse(thisParserPtr, (yyvsp[-14].id), &objectPtr);
 
-			    setObjectName(objectPtr, (yyvsp[(1) - (15)].id), thisParserPtr);
+			    setObjectName(objectPtr, (yyvsp[-14].id), thisParserPtr);
 			    setObjectDecl(objectPtr,
 					  SMI_DECL_MODULECOMPLIANCE);
 			    setObjectLine(objectPtr, thisParserPtr->firstStatementLine,
 					  thisParserPtr);
 			    addObjectFlags(objectPtr, FLAG_REGISTERED);
 			    deleteObjectFlags(objectPtr, FLAG_INCOMPLETE);
-			    setObjectStatus(objectPtr, (yyvsp[(6) - (15)].status));
-			    setObjectDescription(objectPtr, (yyvsp[(8) - (15)].text), thisParserPtr);
-			    if ((yyvsp[(10) - (15)].text)) {
-				setObjectReference(objectPtr, (yyvsp[(10) - (15)].text), thisParserPtr);
+			    setObjectStatus(objectPtr, (yyvsp[-9].status));
+			    setObjectDescription(objectPtr, (yyvsp[-7].text), thisParserPtr);
+			    if ((yyvsp[-5].text)) {
+				setObjectReference(objectPtr, (yyvsp[-5].text), thisParserPtr);
 			    }
 			    setObjectAccess(objectPtr,
 					    SMI_ACCESS_NOT_ACCESSIBLE);
-			    setObjectList(objectPtr, (yyvsp[(11) - (15)].compl).mandatorylistPtr);
-			    objectPtr->optionlistPtr = (yyvsp[(11) - (15)].compl).optionlistPtr;
+			    setObjectList(objectPtr, (yyvsp[-4].compl).mandatorylistPtr);
+			    objectPtr->optionlistPtr = (yyvsp[-4].compl).optionlistPtr;
 			    objectPtr->refinementlistPtr =
-				                          (yyvsp[(11) - (15)].compl).refinementlistPtr;
+				                          (yyvsp[-4].compl).refinementlistPtr;
 
-			    if ((yyvsp[(11) - (15)].compl).optionlistPtr) {
-				for (listPtr = (yyvsp[(11) - (15)].compl).optionlistPtr;
+			    if ((yyvsp[-4].compl).optionlistPtr) {
+				for (listPtr = (yyvsp[-4].compl).optionlistPtr;
 				     listPtr;
 				     listPtr = listPtr->nextPtr) {
 				    optionPtr = ((Option *)(listPtr->ptr));
@@ -9025,8 +9053,8 @@ yyreduce:
 			     * ``<compliancename>+<objecttypename>+type''
 			     * ``<compliancename>+<objecttypename>+writetype''
 			     */
-			    if ((yyvsp[(11) - (15)].compl).refinementlistPtr) {
-				for (listPtr = (yyvsp[(11) - (15)].compl).refinementlistPtr;
+			    if ((yyvsp[-4].compl).refinementlistPtr) {
+				for (listPtr = (yyvsp[-4].compl).refinementlistPtr;
 				     listPtr;
 				     listPtr = listPtr->nextPtr) {
 				    refinementPtr =
@@ -9036,62 +9064,66 @@ yyreduce:
 			    }
 
 			    (yyval.err) = 0;
-			;}
+			}
+#line 9069 "parser-smi.c"
     break;
 
-  case 364:
-#line 6566 "parser-smi.y"
-    {
-			    (yyval.compl) = (yyvsp[(1) - (1)].compl);
-			;}
+  case 364: /* ComplianceModulePart: ComplianceModules  */
+#line 6568 "parser-smi.y"
+                        {
+			    (yyval.compl) = (yyvsp[0].compl);
+			}
+#line 9077 "parser-smi.c"
     break;
 
-  case 365:
-#line 6572 "parser-smi.y"
-    {
-			    (yyval.compl) = (yyvsp[(1) - (1)].compl);
-			;}
+  case 365: /* ComplianceModules: ComplianceModule  */
+#line 6574 "parser-smi.y"
+                        {
+			    (yyval.compl) = (yyvsp[0].compl);
+			}
+#line 9085 "parser-smi.c"
     break;
 
-  case 366:
-#line 6576 "parser-smi.y"
-    {
+  case 366: /* ComplianceModules: ComplianceModules ComplianceModule  */
+#line 6578 "parser-smi.y"
+                        {
 			    List *listPtr;
 			    
 			    /* concatenate lists in $1 and $2 */
-			    if ((yyvsp[(1) - (2)].compl).mandatorylistPtr) {
-				for (listPtr = (yyvsp[(1) - (2)].compl).mandatorylistPtr;
+			    if ((yyvsp[-1].compl).mandatorylistPtr) {
+				for (listPtr = (yyvsp[-1].compl).mandatorylistPtr;
 				     listPtr->nextPtr;
 				     listPtr = listPtr->nextPtr);
-				listPtr->nextPtr = (yyvsp[(2) - (2)].compl).mandatorylistPtr;
-				(yyval.compl).mandatorylistPtr = (yyvsp[(1) - (2)].compl).mandatorylistPtr;
+				listPtr->nextPtr = (yyvsp[0].compl).mandatorylistPtr;
+				(yyval.compl).mandatorylistPtr = (yyvsp[-1].compl).mandatorylistPtr;
 			    } else {
-				(yyval.compl).mandatorylistPtr = (yyvsp[(2) - (2)].compl).mandatorylistPtr;
+				(yyval.compl).mandatorylistPtr = (yyvsp[0].compl).mandatorylistPtr;
 			    }
-			    if ((yyvsp[(1) - (2)].compl).optionlistPtr) {
-				for (listPtr = (yyvsp[(1) - (2)].compl).optionlistPtr;
+			    if ((yyvsp[-1].compl).optionlistPtr) {
+				for (listPtr = (yyvsp[-1].compl).optionlistPtr;
 				     listPtr->nextPtr;
 				     listPtr = listPtr->nextPtr);
-				listPtr->nextPtr = (yyvsp[(2) - (2)].compl).optionlistPtr;
-				(yyval.compl).optionlistPtr = (yyvsp[(1) - (2)].compl).optionlistPtr;
+				listPtr->nextPtr = (yyvsp[0].compl).optionlistPtr;
+				(yyval.compl).optionlistPtr = (yyvsp[-1].compl).optionlistPtr;
 			    } else {
-				(yyval.compl).optionlistPtr = (yyvsp[(2) - (2)].compl).optionlistPtr;
+				(yyval.compl).optionlistPtr = (yyvsp[0].compl).optionlistPtr;
 			    }
-			    if ((yyvsp[(1) - (2)].compl).refinementlistPtr) {
-				for (listPtr = (yyvsp[(1) - (2)].compl).refinementlistPtr;
+			    if ((yyvsp[-1].compl).refinementlistPtr) {
+				for (listPtr = (yyvsp[-1].compl).refinementlistPtr;
 				     listPtr->nextPtr;
 				     listPtr = listPtr->nextPtr);
-				listPtr->nextPtr = (yyvsp[(2) - (2)].compl).refinementlistPtr;
-				(yyval.compl).refinementlistPtr = (yyvsp[(1) - (2)].compl).refinementlistPtr;
+				listPtr->nextPtr = (yyvsp[0].compl).refinementlistPtr;
+				(yyval.compl).refinementlistPtr = (yyvsp[-1].compl).refinementlistPtr;
 			    } else {
-				(yyval.compl).refinementlistPtr = (yyvsp[(2) - (2)].compl).refinementlistPtr;
+				(yyval.compl).refinementlistPtr = (yyvsp[0].compl).refinementlistPtr;
 			    }
-			;}
+			}
+#line 9122 "parser-smi.c"
     break;
 
-  case 367:
-#line 6611 "parser-smi.y"
-    {
+  case 367: /* $@55: %empty  */
+#line 6613 "parser-smi.y"
+                        {
 			    /*
 			     * Remember the module. SMIv2 is broken by
 			     * design to allow subsequent clauses to
@@ -9100,146 +9132,149 @@ yyreduce:
 			     * require, we will fake it by inserting
 			     * appropriate imports.
 			     */
-			    if ((yyvsp[(2) - (2)].modulePtr) == thisModulePtr)
+			    if ((yyvsp[0].modulePtr) == thisModulePtr)
 				thisParserPtr->complianceModulePtr = NULL;
 			    else
-				thisParserPtr->complianceModulePtr = (yyvsp[(2) - (2)].modulePtr);
-			;}
+				thisParserPtr->complianceModulePtr = (yyvsp[0].modulePtr);
+			}
+#line 9141 "parser-smi.c"
     break;
 
-  case 368:
-#line 6627 "parser-smi.y"
-    {
-			    (yyval.compl).mandatorylistPtr = (yyvsp[(4) - (5)].listPtr);
-			    (yyval.compl).optionlistPtr = (yyvsp[(5) - (5)].compl).optionlistPtr;
-			    (yyval.compl).refinementlistPtr = (yyvsp[(5) - (5)].compl).refinementlistPtr;
-			    if (thisParserPtr->complianceModulePtr) {
-				checkImports(thisParserPtr->complianceModulePtr,
-					     thisParserPtr);
-				thisParserPtr->complianceModulePtr = NULL;
-			    }
-			;}
+  case 368: /* ComplianceModule: MODULE ComplianceModuleName $@55 MandatoryPart CompliancePart  */
+#line 6629 "parser-smi.y"
+                        {
+			    (yyval.compl).mandatorylistPtr = (yyvsp[-1].listPtr);
+			    (yyval.compl).optionlistPtr = (yyvsp[0].compl).optionlistPtr;
+			    (yyval.compl).refinementlistPtr = (yyvsp[0].compl).refinementlistPtr;
+			    thisParserPtr->complianceModulePtr = NULL;
+			}
+#line 9152 "parser-smi.c"
     break;
 
-  case 369:
-#line 6640 "parser-smi.y"
-    {
-			    (yyval.modulePtr) = findModuleByName((yyvsp[(1) - (2)].id));
+  case 369: /* ComplianceModuleName: UPPERCASE_IDENTIFIER objectIdentifier  */
+#line 6638 "parser-smi.y"
+                        {
 			    /* TODO: handle objectIdentifier */
-			    if (!(yyval.modulePtr)) {
-				(yyval.modulePtr) = loadModule((yyvsp[(1) - (2)].id), thisParserPtr);
-			    }
-			    smiFree((yyvsp[(1) - (2)].id));
-			;}
+			    (yyval.modulePtr) = requireModule((yyvsp[-1].id), thisParserPtr);
+			    smiFree((yyvsp[-1].id));
+			}
+#line 9162 "parser-smi.c"
     break;
 
-  case 370:
-#line 6649 "parser-smi.y"
-    {
-			    (yyval.modulePtr) = findModuleByName((yyvsp[(1) - (1)].id));
-			    if (!(yyval.modulePtr)) {
-				(yyval.modulePtr) = loadModule((yyvsp[(1) - (1)].id), thisParserPtr);
-			    }
-			    smiFree((yyvsp[(1) - (1)].id));
-			;}
+  case 370: /* ComplianceModuleName: UPPERCASE_IDENTIFIER  */
+#line 6644 "parser-smi.y"
+                        {
+			    (yyval.modulePtr) = requireModule((yyvsp[0].id), thisParserPtr);
+			    smiFree((yyvsp[0].id));
+			}
+#line 9171 "parser-smi.c"
     break;
 
-  case 371:
-#line 6658 "parser-smi.y"
-    {
+  case 371: /* ComplianceModuleName: %empty  */
+#line 6650 "parser-smi.y"
+                        {
 			    (yyval.modulePtr) = thisModulePtr;
-			;}
+			}
+#line 9179 "parser-smi.c"
     break;
 
-  case 372:
-#line 6664 "parser-smi.y"
-    {
-			    (yyval.listPtr) = (yyvsp[(3) - (4)].listPtr);
-			;}
+  case 372: /* MandatoryPart: MANDATORY_GROUPS '{' MandatoryGroups '}'  */
+#line 6656 "parser-smi.y"
+                        {
+			    (yyval.listPtr) = (yyvsp[-1].listPtr);
+			}
+#line 9187 "parser-smi.c"
     break;
 
-  case 373:
-#line 6668 "parser-smi.y"
-    {
+  case 373: /* MandatoryPart: %empty  */
+#line 6660 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = NULL;
-			;}
+			}
+#line 9195 "parser-smi.c"
     break;
 
-  case 374:
-#line 6674 "parser-smi.y"
-    {
+  case 374: /* MandatoryGroups: MandatoryGroup  */
+#line 6666 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].objectPtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].objectPtr);
 			    (yyval.listPtr)->nextPtr = NULL;
-			;}
+			}
+#line 9205 "parser-smi.c"
     break;
 
-  case 375:
-#line 6680 "parser-smi.y"
-    {
+  case 375: /* MandatoryGroups: MandatoryGroups ',' MandatoryGroup  */
+#line 6672 "parser-smi.y"
+                        {
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (yyvsp[(3) - (3)].objectPtr);
+			    p->ptr = (yyvsp[0].objectPtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
-			;}
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
+			}
+#line 9220 "parser-smi.c"
     break;
 
-  case 376:
-#line 6693 "parser-smi.y"
-    {
+  case 376: /* MandatoryGroup: objectIdentifier  */
+#line 6685 "parser-smi.y"
+                        {
 			    /* TODO: check that objectIdentifier is
 			       found, is defined in thisParserPtr->complianceModulePtr,
 			       and is a group node. */
 			    Import *importPtr;
 
-			    (yyval.objectPtr) = (yyvsp[(1) - (1)].objectPtr);
+			    (yyval.objectPtr) = (yyvsp[0].objectPtr);
 			    if (thisParserPtr->complianceModulePtr) {
 				(yyval.objectPtr) = findObjectByModuleAndName(
 				                           thisParserPtr->complianceModulePtr,
-							   (yyvsp[(1) - (1)].objectPtr)->export.name);
+							   (yyvsp[0].objectPtr)->export.name);
 			    }
-			    if (thisParserPtr->complianceModulePtr && (yyvsp[(1) - (1)].objectPtr)->export.name) {
+			    if (thisParserPtr->complianceModulePtr && (yyvsp[0].objectPtr)->export.name) {
 				importPtr = findImportByModulenameAndName(
 				    thisParserPtr->complianceModulePtr->export.name,
-				    (yyvsp[(1) - (1)].objectPtr)->export.name, thisModulePtr);
+				    (yyvsp[0].objectPtr)->export.name, thisModulePtr);
 				if (importPtr)
 				    importPtr->use++;
 			    }
-			;}
+			}
+#line 9245 "parser-smi.c"
     break;
 
-  case 377:
-#line 6716 "parser-smi.y"
-    {
+  case 377: /* CompliancePart: Compliances  */
+#line 6708 "parser-smi.y"
+                        {
 			    (yyval.compl).mandatorylistPtr = NULL;
-			    (yyval.compl).optionlistPtr = (yyvsp[(1) - (1)].compl).optionlistPtr;
-			    (yyval.compl).refinementlistPtr = (yyvsp[(1) - (1)].compl).refinementlistPtr;
-			;}
+			    (yyval.compl).optionlistPtr = (yyvsp[0].compl).optionlistPtr;
+			    (yyval.compl).refinementlistPtr = (yyvsp[0].compl).refinementlistPtr;
+			}
+#line 9255 "parser-smi.c"
     break;
 
-  case 378:
-#line 6722 "parser-smi.y"
-    {
+  case 378: /* CompliancePart: %empty  */
+#line 6714 "parser-smi.y"
+                        {
 			    (yyval.compl).mandatorylistPtr = NULL;
 			    (yyval.compl).optionlistPtr = NULL;
 			    (yyval.compl).refinementlistPtr = NULL;
-			;}
+			}
+#line 9265 "parser-smi.c"
     break;
 
-  case 379:
-#line 6730 "parser-smi.y"
-    {
-			    (yyval.compl) = (yyvsp[(1) - (1)].compl);
-			;}
+  case 379: /* Compliances: Compliance  */
+#line 6722 "parser-smi.y"
+                        {
+			    (yyval.compl) = (yyvsp[0].compl);
+			}
+#line 9273 "parser-smi.c"
     break;
 
-  case 380:
-#line 6734 "parser-smi.y"
-    {
+  case 380: /* Compliances: Compliances Compliance  */
+#line 6726 "parser-smi.y"
+                        {
 			    List *listPtr;
 			    int stop;
 			    
@@ -9247,140 +9282,146 @@ yyreduce:
 
 			    /* check for duplicates in optionlist */
 			    stop = 0;
-			    if ((yyvsp[(2) - (2)].compl).optionlistPtr) {
-				for (listPtr = (yyvsp[(1) - (2)].compl).optionlistPtr; listPtr;
+			    if ((yyvsp[0].compl).optionlistPtr) {
+				for (listPtr = (yyvsp[-1].compl).optionlistPtr; listPtr;
 				     listPtr = listPtr->nextPtr) {
 				    if (((Option *)listPtr->ptr)->objectPtr ==
-					((Option *)(yyvsp[(2) - (2)].compl).optionlistPtr->ptr)->objectPtr) {
+					((Option *)(yyvsp[0].compl).optionlistPtr->ptr)->objectPtr) {
 					smiPrintError(thisParserPtr,
 						      ERR_OPTIONALGROUP_ALREADY_EXISTS,
-						      ((Option *)(yyvsp[(2) - (2)].compl).optionlistPtr->ptr)->objectPtr->export.name);
+						      ((Option *)(yyvsp[0].compl).optionlistPtr->ptr)->objectPtr->export.name);
 					stop = 1;
-					(yyval.compl).optionlistPtr = (yyvsp[(1) - (2)].compl).optionlistPtr;
+					(yyval.compl).optionlistPtr = (yyvsp[-1].compl).optionlistPtr;
 				    }
 				}
 			    }
 	
                             /* concatenate optionlists */
-			    if ((yyvsp[(1) - (2)].compl).optionlistPtr) {
-				for (listPtr = (yyvsp[(1) - (2)].compl).optionlistPtr;
+			    if ((yyvsp[-1].compl).optionlistPtr) {
+				for (listPtr = (yyvsp[-1].compl).optionlistPtr;
 				     listPtr->nextPtr;
 				     listPtr = listPtr->nextPtr);
 				if (!stop) {
-				    listPtr->nextPtr = (yyvsp[(2) - (2)].compl).optionlistPtr;
+				    listPtr->nextPtr = (yyvsp[0].compl).optionlistPtr;
 				}
-				(yyval.compl).optionlistPtr = (yyvsp[(1) - (2)].compl).optionlistPtr;
+				(yyval.compl).optionlistPtr = (yyvsp[-1].compl).optionlistPtr;
 			    } else {
-				(yyval.compl).optionlistPtr = (yyvsp[(2) - (2)].compl).optionlistPtr;
+				(yyval.compl).optionlistPtr = (yyvsp[0].compl).optionlistPtr;
 			    }
 
 			    /* check for duplicates in refinementlist */
 			    stop = 0;
-			    if ((yyvsp[(2) - (2)].compl).refinementlistPtr) {
-				for (listPtr = (yyvsp[(1) - (2)].compl).refinementlistPtr; listPtr;
+			    if ((yyvsp[0].compl).refinementlistPtr) {
+				for (listPtr = (yyvsp[-1].compl).refinementlistPtr; listPtr;
 				     listPtr = listPtr->nextPtr) {
 				    if (((Refinement *)listPtr->ptr)->objectPtr ==
-					((Refinement *)(yyvsp[(2) - (2)].compl).refinementlistPtr->ptr)->objectPtr) {
+					((Refinement *)(yyvsp[0].compl).refinementlistPtr->ptr)->objectPtr) {
 					smiPrintError(thisParserPtr,
 						      ERR_REFINEMENT_ALREADY_EXISTS,
-						      ((Refinement *)(yyvsp[(2) - (2)].compl).refinementlistPtr->ptr)->objectPtr->export.name);
+						      ((Refinement *)(yyvsp[0].compl).refinementlistPtr->ptr)->objectPtr->export.name);
 					stop = 1;
-					(yyval.compl).refinementlistPtr = (yyvsp[(1) - (2)].compl).refinementlistPtr;
+					(yyval.compl).refinementlistPtr = (yyvsp[-1].compl).refinementlistPtr;
 				    }
 				}
 			    }
 			    
                             /* concatenate refinementlists */
-			    if ((yyvsp[(1) - (2)].compl).refinementlistPtr) {
-				for (listPtr = (yyvsp[(1) - (2)].compl).refinementlistPtr;
+			    if ((yyvsp[-1].compl).refinementlistPtr) {
+				for (listPtr = (yyvsp[-1].compl).refinementlistPtr;
 				     listPtr->nextPtr;
 				     listPtr = listPtr->nextPtr);
 				if (!stop) {
-				    listPtr->nextPtr = (yyvsp[(2) - (2)].compl).refinementlistPtr;
+				    listPtr->nextPtr = (yyvsp[0].compl).refinementlistPtr;
 				}
-				(yyval.compl).refinementlistPtr = (yyvsp[(1) - (2)].compl).refinementlistPtr;
+				(yyval.compl).refinementlistPtr = (yyvsp[-1].compl).refinementlistPtr;
 			    } else {
-				(yyval.compl).refinementlistPtr = (yyvsp[(2) - (2)].compl).refinementlistPtr;
+				(yyval.compl).refinementlistPtr = (yyvsp[0].compl).refinementlistPtr;
 			    }
-			;}
+			}
+#line 9342 "parser-smi.c"
     break;
 
-  case 381:
-#line 6801 "parser-smi.y"
-    {
+  case 381: /* Compliance: ComplianceGroup  */
+#line 6793 "parser-smi.y"
+                        {
 			    (yyval.compl).mandatorylistPtr = NULL;
-			    (yyval.compl).optionlistPtr = (yyvsp[(1) - (1)].listPtr);
+			    (yyval.compl).optionlistPtr = (yyvsp[0].listPtr);
 			    (yyval.compl).refinementlistPtr = NULL;
-			;}
+			}
+#line 9352 "parser-smi.c"
     break;
 
-  case 382:
-#line 6807 "parser-smi.y"
-    {
+  case 382: /* Compliance: ComplianceObject  */
+#line 6799 "parser-smi.y"
+                        {
 			    (yyval.compl).mandatorylistPtr = NULL;
 			    (yyval.compl).optionlistPtr = NULL;
-			    (yyval.compl).refinementlistPtr = (yyvsp[(1) - (1)].listPtr);
-			;}
+			    (yyval.compl).refinementlistPtr = (yyvsp[0].listPtr);
+			}
+#line 9362 "parser-smi.c"
     break;
 
-  case 383:
-#line 6815 "parser-smi.y"
-    {
+  case 383: /* $@56: %empty  */
+#line 6807 "parser-smi.y"
+                        {
 			    thisParserPtr->firstNestedStatementLine = thisParserPtr->line;
-			;}
+			}
+#line 9370 "parser-smi.c"
     break;
 
-  case 384:
-#line 6820 "parser-smi.y"
-    {
+  case 384: /* ComplianceGroup: GROUP $@56 objectIdentifier DESCRIPTION Text  */
+#line 6812 "parser-smi.y"
+                        {
 			    Import *importPtr;
 			    
-			    if (thisParserPtr->complianceModulePtr && (yyvsp[(3) - (5)].objectPtr)->export.name) {
+			    if (thisParserPtr->complianceModulePtr && (yyvsp[-2].objectPtr)->export.name) {
 				importPtr = findImportByModulenameAndName(
 						    thisParserPtr->complianceModulePtr->export.name,
-						    (yyvsp[(3) - (5)].objectPtr)->export.name,
+						    (yyvsp[-2].objectPtr)->export.name,
 						    thisModulePtr);
 				if (importPtr)
 				    importPtr->use++;
 			    }
 
-			    checkDescr(thisParserPtr, (yyvsp[(5) - (5)].text));
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
 			    
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
 			    (yyval.listPtr)->nextPtr = NULL;
 			    (yyval.listPtr)->ptr = smiMalloc(sizeof(Option));
 			    ((Option *)((yyval.listPtr)->ptr))->line = thisParserPtr->firstNestedStatementLine;
-			    ((Option *)((yyval.listPtr)->ptr))->objectPtr = (yyvsp[(3) - (5)].objectPtr);
+			    ((Option *)((yyval.listPtr)->ptr))->objectPtr = (yyvsp[-2].objectPtr);
 			    if (! (thisModulePtr->flags & SMI_FLAG_NODESCR)) {
-				((Option *)((yyval.listPtr)->ptr))->export.description = (yyvsp[(5) - (5)].text);
+				((Option *)((yyval.listPtr)->ptr))->export.description = (yyvsp[0].text);
 			    } else {
-				smiFree((yyvsp[(5) - (5)].text));
+				smiFree((yyvsp[0].text));
 			    }
-			;}
+			}
+#line 9400 "parser-smi.c"
     break;
 
-  case 385:
-#line 6848 "parser-smi.y"
-    {
+  case 385: /* $@57: %empty  */
+#line 6840 "parser-smi.y"
+                        {
 			    thisParserPtr->firstNestedStatementLine = thisParserPtr->line;
-			;}
+			}
+#line 9408 "parser-smi.c"
     break;
 
-  case 386:
-#line 6856 "parser-smi.y"
-    {
+  case 386: /* ComplianceObject: OBJECT $@57 ObjectName SyntaxPart WriteSyntaxPart AccessPart DESCRIPTION Text  */
+#line 6848 "parser-smi.y"
+                        {
 			    Import *importPtr;
 
-			    if (thisParserPtr->complianceModulePtr && (yyvsp[(3) - (8)].objectPtr)->export.name) {
+			    if (thisParserPtr->complianceModulePtr && (yyvsp[-5].objectPtr)->export.name) {
 				importPtr = findImportByModulenameAndName(
 						    thisParserPtr->complianceModulePtr->export.name,
-						    (yyvsp[(3) - (8)].objectPtr)->export.name,
+						    (yyvsp[-5].objectPtr)->export.name,
 						    thisModulePtr);
 				if (importPtr) 
 				    importPtr->use++;
 			    }
 
-			    checkDescr(thisParserPtr, (yyvsp[(8) - (8)].text));
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
 			    
 			    thisParserPtr->flags &= ~FLAG_CREATABLE;
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
@@ -9388,113 +9429,123 @@ yyreduce:
 			    (yyval.listPtr)->ptr = smiMalloc(sizeof(Refinement));
 			    ((Refinement *)((yyval.listPtr)->ptr))->line =
 				thisParserPtr->firstNestedStatementLine;
-			    ((Refinement *)((yyval.listPtr)->ptr))->objectPtr = (yyvsp[(3) - (8)].objectPtr);
-			    ((Refinement *)((yyval.listPtr)->ptr))->typePtr = (yyvsp[(4) - (8)].typePtr);
-			    if ((yyvsp[(4) - (8)].typePtr)) {
-				(yyvsp[(4) - (8)].typePtr)->parentPtr = (yyvsp[(3) - (8)].objectPtr)->typePtr;
+			    ((Refinement *)((yyval.listPtr)->ptr))->objectPtr = (yyvsp[-5].objectPtr);
+			    ((Refinement *)((yyval.listPtr)->ptr))->typePtr = (yyvsp[-4].typePtr);
+			    if ((yyvsp[-4].typePtr)) {
+				(yyvsp[-4].typePtr)->parentPtr = (yyvsp[-5].objectPtr)->typePtr;
 			    }
-			    ((Refinement *)((yyval.listPtr)->ptr))->writetypePtr = (yyvsp[(5) - (8)].typePtr);
-			    if ((yyvsp[(5) - (8)].typePtr)) {
-				(yyvsp[(5) - (8)].typePtr)->parentPtr = (yyvsp[(3) - (8)].objectPtr)->typePtr;
+			    ((Refinement *)((yyval.listPtr)->ptr))->writetypePtr = (yyvsp[-3].typePtr);
+			    if ((yyvsp[-3].typePtr)) {
+				(yyvsp[-3].typePtr)->parentPtr = (yyvsp[-5].objectPtr)->typePtr;
 			    }
-			    ((Refinement *)((yyval.listPtr)->ptr))->export.access = (yyvsp[(6) - (8)].access);
+			    ((Refinement *)((yyval.listPtr)->ptr))->export.access = (yyvsp[-2].access);
 			    if (! (thisParserPtr->flags & SMI_FLAG_NODESCR)) {
-				((Refinement *)((yyval.listPtr)->ptr))->export.description = (yyvsp[(8) - (8)].text);
+				((Refinement *)((yyval.listPtr)->ptr))->export.description = (yyvsp[0].text);
 			    } else {
-				smiFree((yyvsp[(8) - (8)].text));
+				smiFree((yyvsp[0].text));
 			    }
-			;}
+			}
+#line 9449 "parser-smi.c"
     break;
 
-  case 387:
-#line 6895 "parser-smi.y"
-    {
-			    if ((yyvsp[(2) - (2)].typePtr)->export.name) {
-				(yyval.typePtr) = duplicateType((yyvsp[(2) - (2)].typePtr), 0, thisParserPtr);
+  case 387: /* SyntaxPart: SYNTAX Syntax  */
+#line 6887 "parser-smi.y"
+                        {
+			    if ((yyvsp[0].typePtr)->export.name) {
+				(yyval.typePtr) = duplicateType((yyvsp[0].typePtr), 0, thisParserPtr);
 			    } else {
-				(yyval.typePtr) = (yyvsp[(2) - (2)].typePtr);
+				(yyval.typePtr) = (yyvsp[0].typePtr);
 			    }
-			;}
+			}
+#line 9461 "parser-smi.c"
     break;
 
-  case 388:
-#line 6903 "parser-smi.y"
-    {
+  case 388: /* SyntaxPart: %empty  */
+#line 6895 "parser-smi.y"
+                        {
 			    (yyval.typePtr) = NULL;
-			;}
+			}
+#line 9469 "parser-smi.c"
     break;
 
-  case 389:
-#line 6909 "parser-smi.y"
-    {
+  case 389: /* WriteSyntaxPart: WRITE_SYNTAX WriteSyntax  */
+#line 6901 "parser-smi.y"
+                        {
                             /* must not be present in PIBs */
                             if (thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SMI_CONSTRUCT_IN_PIB, "WRITE-SYNTAX");
-			    if ((yyvsp[(2) - (2)].typePtr)->export.name) {
-				(yyval.typePtr) = duplicateType((yyvsp[(2) - (2)].typePtr), 0, thisParserPtr);
+			    if ((yyvsp[0].typePtr)->export.name) {
+				(yyval.typePtr) = duplicateType((yyvsp[0].typePtr), 0, thisParserPtr);
 			    } else {
-				(yyval.typePtr) = (yyvsp[(2) - (2)].typePtr);
+				(yyval.typePtr) = (yyvsp[0].typePtr);
 			    }
-			;}
+			}
+#line 9484 "parser-smi.c"
     break;
 
-  case 390:
-#line 6920 "parser-smi.y"
-    {
+  case 390: /* WriteSyntaxPart: %empty  */
+#line 6912 "parser-smi.y"
+                        {
 			    (yyval.typePtr) = NULL;
-			;}
+			}
+#line 9492 "parser-smi.c"
     break;
 
-  case 391:
-#line 6926 "parser-smi.y"
-    {
-			    (yyval.typePtr) = (yyvsp[(1) - (1)].typePtr);
-			;}
+  case 391: /* WriteSyntax: Syntax  */
+#line 6918 "parser-smi.y"
+                        {
+			    (yyval.typePtr) = (yyvsp[0].typePtr);
+			}
+#line 9500 "parser-smi.c"
     break;
 
-  case 392:
-#line 6932 "parser-smi.y"
-    {
+  case 392: /* AccessPart: MIN_ACCESS Access  */
+#line 6924 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SMI_CONSTRUCT_IN_PIB, "MIN-ACCESS");
-			    (yyval.access) = (yyvsp[(2) - (2)].access);
-			;}
+			    (yyval.access) = (yyvsp[0].access);
+			}
+#line 9510 "parser-smi.c"
     break;
 
-  case 393:
-#line 6938 "parser-smi.y"
-    {
+  case 393: /* AccessPart: PIB_MIN_ACCESS Access  */
+#line 6930 "parser-smi.y"
+                        {
                             if (thisParserPtr->modulePtr->export.language != SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SPPI_CONSTRUCT_IN_MIB, "PIB-MIN-ACCESS");
-                            if ((yyvsp[(2) - (2)].access) == SMI_ACCESS_REPORT_ONLY)
+                            if ((yyvsp[0].access) == SMI_ACCESS_REPORT_ONLY)
                                 smiPrintError(thisParserPtr, ERR_REPORT_ONLY_IN_PIB_MIN_ACCESS);
-                            (yyval.access) = (yyvsp[(2) - (2)].access);
-                        ;}
+                            (yyval.access) = (yyvsp[0].access);
+                        }
+#line 9522 "parser-smi.c"
     break;
 
-  case 394:
-#line 6946 "parser-smi.y"
-    {
+  case 394: /* AccessPart: %empty  */
+#line 6938 "parser-smi.y"
+                        {
 			    (yyval.access) = SMI_ACCESS_UNKNOWN;
-			;}
+			}
+#line 9530 "parser-smi.c"
     break;
 
-  case 395:
-#line 6952 "parser-smi.y"
-    {
+  case 395: /* $@58: %empty  */
+#line 6944 "parser-smi.y"
+                        {
 			    thisParserPtr->firstStatementLine = thisParserPtr->line;
 			    thisParserPtr->currentDecl = SMI_DECL_AGENTCAPABILITIES;
 			    
-			    checkNameLen(thisParserPtr, (yyvsp[(1) - (1)].id),
+			    checkNameLen(thisParserPtr, (yyvsp[0].id),
 					 ERR_OIDNAME_32, ERR_OIDNAME_64);
 			    smiCheckObjectName(thisParserPtr,
-					       thisModulePtr, (yyvsp[(1) - (1)].id));
-			;}
+					       thisModulePtr, (yyvsp[0].id));
+			}
+#line 9544 "parser-smi.c"
     break;
 
-  case 396:
-#line 6962 "parser-smi.y"
-    {
+  case 396: /* $@59: %empty  */
+#line 6954 "parser-smi.y"
+                        {
 			    Import *importPtr;
                             if (thisParserPtr->modulePtr->export.language == SMI_LANGUAGE_SPPI)
                                 smiPrintError(thisParserPtr, ERR_SMI_CONSTRUCT_IN_PIB, "AGENT-CAAPABILITIES");
@@ -9512,36 +9563,38 @@ yyreduce:
 					      "AGENT-CAPABILITIES",
 					      "SNMPv2-CONF");
 			    }
-			;}
+			}
+#line 9568 "parser-smi.c"
     break;
 
-  case 397:
-#line 6984 "parser-smi.y"
-    {
-			    checkDescr(thisParserPtr, (yyvsp[(10) - (10)].text));
-			;}
+  case 397: /* $@60: %empty  */
+#line 6976 "parser-smi.y"
+                        {
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
+			}
+#line 9576 "parser-smi.c"
     break;
 
-  case 398:
-#line 6990 "parser-smi.y"
-    {
+  case 398: /* agentCapabilitiesClause: LOWERCASE_IDENTIFIER $@58 AGENT_CAPABILITIES $@59 PRODUCT_RELEASE Text STATUS Status_Capabilities DESCRIPTION Text $@60 ReferPart ModulePart_Capabilities COLON_COLON_EQUAL '{' objectIdentifier '}'  */
+#line 6982 "parser-smi.y"
+                        {
 			    Object *objectPtr;
 			    
-			    objectPtr = (yyvsp[(16) - (17)].objectPtr);
+			    objectPtr = (yyvsp[-1].objectPtr);
 			    
-			    smiCheckObjectReuse(thisParserPtr, (yyvsp[(1) - (17)].id), &objectPtr);
+			    smiCheckObjectReuse(thisParserPtr, (yyvsp[-16].id), &objectPtr);
 
-			    setObjectName(objectPtr, (yyvsp[(1) - (17)].id), thisParserPtr);
+			    setObjectName(objectPtr, (yyvsp[-16].id), thisParserPtr);
 			    setObjectDecl(objectPtr,
 					  SMI_DECL_AGENTCAPABILITIES);
 			    setObjectLine(objectPtr, thisParserPtr->firstStatementLine,
 					  thisParserPtr);
 			    addObjectFlags(objectPtr, FLAG_REGISTERED);
 			    deleteObjectFlags(objectPtr, FLAG_INCOMPLETE);
-			    setObjectStatus(objectPtr, (yyvsp[(8) - (17)].status));
-			    setObjectDescription(objectPtr, (yyvsp[(10) - (17)].text), thisParserPtr);
-			    if ((yyvsp[(12) - (17)].text)) {
-				setObjectReference(objectPtr, (yyvsp[(12) - (17)].text), thisParserPtr);
+			    setObjectStatus(objectPtr, (yyvsp[-9].status));
+			    setObjectDescription(objectPtr, (yyvsp[-7].text), thisParserPtr);
+			    if ((yyvsp[-5].text)) {
+				setObjectReference(objectPtr, (yyvsp[-5].text), thisParserPtr);
 			    }
 			    setObjectAccess(objectPtr,
 					    SMI_ACCESS_NOT_ACCESSIBLE);
@@ -9550,32 +9603,37 @@ yyreduce:
 				 * TODO: ModulePart_Capabilities
 				 */
 			    (yyval.err) = 0;
-			;}
+			}
+#line 9608 "parser-smi.c"
     break;
 
-  case 399:
-#line 7020 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 399: /* ModulePart_Capabilities: Modules_Capabilities  */
+#line 7012 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9614 "parser-smi.c"
     break;
 
-  case 400:
-#line 7022 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 400: /* ModulePart_Capabilities: %empty  */
+#line 7014 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9620 "parser-smi.c"
     break;
 
-  case 401:
-#line 7026 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 401: /* Modules_Capabilities: Module_Capabilities  */
+#line 7018 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9626 "parser-smi.c"
     break;
 
-  case 402:
-#line 7028 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 402: /* Modules_Capabilities: Modules_Capabilities Module_Capabilities  */
+#line 7020 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9632 "parser-smi.c"
     break;
 
-  case 403:
-#line 7032 "parser-smi.y"
-    {
+  case 403: /* $@61: %empty  */
+#line 7024 "parser-smi.y"
+                        {
 			    /*
 			     * Remember the module. SMIv2 is broken by
 			     * design to allow subsequent clauses to
@@ -9584,236 +9642,245 @@ yyreduce:
 			     * require, we will fake it by inserting
 			     * appropriate imports.
 			     */
-			    if ((yyvsp[(2) - (2)].modulePtr) == thisModulePtr)
+			    if ((yyvsp[0].modulePtr) == thisModulePtr)
 				thisParserPtr->capabilitiesModulePtr = NULL;
 			    else
-				thisParserPtr->capabilitiesModulePtr = (yyvsp[(2) - (2)].modulePtr);
-			;}
+				thisParserPtr->capabilitiesModulePtr = (yyvsp[0].modulePtr);
+			}
+#line 9651 "parser-smi.c"
     break;
 
-  case 404:
-#line 7048 "parser-smi.y"
-    {
-			    if (thisParserPtr->capabilitiesModulePtr) {
-				checkImports(thisParserPtr->capabilitiesModulePtr,
-					     thisParserPtr);
-				thisParserPtr->capabilitiesModulePtr = NULL;
-			    }
+  case 404: /* Module_Capabilities: SUPPORTS ModuleName_Capabilities $@61 INCLUDES '{' CapabilitiesGroups '}' VariationPart  */
+#line 7040 "parser-smi.y"
+                        {
+			    thisParserPtr->capabilitiesModulePtr = NULL;
 			    (yyval.err) = 0;
-			;}
+			}
+#line 9660 "parser-smi.c"
     break;
 
-  case 405:
-#line 7059 "parser-smi.y"
-    {
+  case 405: /* CapabilitiesGroups: CapabilitiesGroup  */
+#line 7047 "parser-smi.y"
+                        {
 #if 0
 			    (yyval.listPtr) = smiMalloc(sizeof(List));
-			    (yyval.listPtr)->ptr = (yyvsp[(1) - (1)].listPtr);
+			    (yyval.listPtr)->ptr = (yyvsp[0].listPtr);
 			    (yyval.listPtr)->nextPtr = NULL;
 #else
 			    (yyval.listPtr) = NULL;
 #endif
-			;}
+			}
+#line 9674 "parser-smi.c"
     break;
 
-  case 406:
-#line 7069 "parser-smi.y"
-    {
+  case 406: /* CapabilitiesGroups: CapabilitiesGroups ',' CapabilitiesGroup  */
+#line 7057 "parser-smi.y"
+                        {
 #if 0
 			    List *p, *pp;
 			    
 			    p = smiMalloc(sizeof(List));
-			    p->ptr = (yyvsp[(3) - (3)].listPtr);
+			    p->ptr = (yyvsp[0].listPtr);
 			    p->nextPtr = NULL;
-			    for (pp = (yyvsp[(1) - (3)].listPtr); pp->nextPtr; pp = pp->nextPtr);
+			    for (pp = (yyvsp[-2].listPtr); pp->nextPtr; pp = pp->nextPtr);
 			    pp->nextPtr = p;
-			    (yyval.listPtr) = (yyvsp[(1) - (3)].listPtr);
+			    (yyval.listPtr) = (yyvsp[-2].listPtr);
 #else
 			    (yyval.listPtr) = NULL;
 #endif
-			;}
+			}
+#line 9693 "parser-smi.c"
     break;
 
-  case 407:
-#line 7086 "parser-smi.y"
-    {
+  case 407: /* CapabilitiesGroup: objectIdentifier  */
+#line 7074 "parser-smi.y"
+                        {
 			    (yyval.listPtr) = NULL;
-			;}
+			}
+#line 9701 "parser-smi.c"
     break;
 
-  case 408:
-#line 7092 "parser-smi.y"
-    {
-			    (yyval.modulePtr) = findModuleByName((yyvsp[(1) - (2)].id));
+  case 408: /* ModuleName_Capabilities: UPPERCASE_IDENTIFIER objectIdentifier  */
+#line 7080 "parser-smi.y"
+                        {
 			    /* TODO: handle objectIdentifier */
-			    if (!(yyval.modulePtr)) {
-				(yyval.modulePtr) = loadModule((yyvsp[(1) - (2)].id), thisParserPtr);
-			    }
-			    smiFree((yyvsp[(1) - (2)].id));
-			;}
+			    (yyval.modulePtr) = requireModule((yyvsp[-1].id), thisParserPtr);
+			    smiFree((yyvsp[-1].id));
+			}
+#line 9711 "parser-smi.c"
     break;
 
-  case 409:
-#line 7101 "parser-smi.y"
-    {
-			    (yyval.modulePtr) = findModuleByName((yyvsp[(1) - (1)].id));
-			    if (!(yyval.modulePtr)) {
-				(yyval.modulePtr) = loadModule((yyvsp[(1) - (1)].id), thisParserPtr);
-			    }
-			    smiFree((yyvsp[(1) - (1)].id));
-			;}
+  case 409: /* ModuleName_Capabilities: UPPERCASE_IDENTIFIER  */
+#line 7086 "parser-smi.y"
+                        {
+			    (yyval.modulePtr) = requireModule((yyvsp[0].id), thisParserPtr);
+			    smiFree((yyvsp[0].id));
+			}
+#line 9720 "parser-smi.c"
     break;
 
-  case 410:
-#line 7111 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 410: /* VariationPart: Variations  */
+#line 7093 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9726 "parser-smi.c"
     break;
 
-  case 411:
-#line 7113 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 411: /* VariationPart: %empty  */
+#line 7095 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9732 "parser-smi.c"
     break;
 
-  case 412:
-#line 7117 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 412: /* Variations: Variation  */
+#line 7099 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9738 "parser-smi.c"
     break;
 
-  case 413:
-#line 7119 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 413: /* Variations: Variations Variation  */
+#line 7101 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9744 "parser-smi.c"
     break;
 
-  case 414:
-#line 7123 "parser-smi.y"
-    {
-			    if ((yyvsp[(2) - (2)].objectPtr)) {
-				variationkind = (yyvsp[(2) - (2)].objectPtr)->export.nodekind;
+  case 414: /* $@62: %empty  */
+#line 7105 "parser-smi.y"
+                        {
+			    if ((yyvsp[0].objectPtr)) {
+				variationkind = (yyvsp[0].objectPtr)->export.nodekind;
 			    } else {
 				variationkind = SMI_NODEKIND_UNKNOWN;
 			    }
-			;}
+			}
+#line 9756 "parser-smi.c"
     break;
 
-  case 415:
-#line 7131 "parser-smi.y"
-    {
+  case 415: /* $@63: %empty  */
+#line 7113 "parser-smi.y"
+                        {
 			    if (variationkind == SMI_NODEKIND_NOTIFICATION) {
 				smiPrintError(thisParserPtr,
 				      ERR_NOTIFICATION_VARIATION_SYNTAX);
 			    }
-			;}
+			}
+#line 9767 "parser-smi.c"
     break;
 
-  case 416:
-#line 7138 "parser-smi.y"
-    {
+  case 416: /* $@64: %empty  */
+#line 7120 "parser-smi.y"
+                        {
 			    if (variationkind == SMI_NODEKIND_NOTIFICATION) {
 				smiPrintError(thisParserPtr,
 				      ERR_NOTIFICATION_VARIATION_WRITESYNTAX);
 			    }
-			;}
+			}
+#line 9778 "parser-smi.c"
     break;
 
-  case 417:
-#line 7146 "parser-smi.y"
-    {
+  case 417: /* $@65: %empty  */
+#line 7128 "parser-smi.y"
+                        {
 			    if (variationkind == SMI_NODEKIND_NOTIFICATION) {
 				smiPrintError(thisParserPtr,
 				      ERR_NOTIFICATION_VARIATION_CREATION);
 			    }
-			;}
+			}
+#line 9789 "parser-smi.c"
     break;
 
-  case 418:
-#line 7153 "parser-smi.y"
-    {
+  case 418: /* $@66: %empty  */
+#line 7135 "parser-smi.y"
+                        {
 			    if (variationkind == SMI_NODEKIND_NOTIFICATION) {
 				smiPrintError(thisParserPtr,
 				      ERR_NOTIFICATION_VARIATION_DEFVAL);
-			    } else if ((yyvsp[(11) - (11)].valuePtr)) {
+			    } else if ((yyvsp[0].valuePtr)) {
 				adjustDefval(thisParserPtr,
-					     (yyvsp[(11) - (11)].valuePtr), (yyvsp[(2) - (11)].objectPtr)->typePtr,
+					     (yyvsp[0].valuePtr), (yyvsp[-9].objectPtr)->typePtr,
 					     thisParserPtr->line);
 				smiCheckValueType(thisParserPtr,
-						  (yyvsp[(11) - (11)].valuePtr), (yyvsp[(2) - (11)].objectPtr)->typePtr,
+						  (yyvsp[0].valuePtr), (yyvsp[-9].objectPtr)->typePtr,
 						  thisParserPtr->line);
 			    }
-			;}
+			}
+#line 9807 "parser-smi.c"
     break;
 
-  case 419:
-#line 7167 "parser-smi.y"
-    {
+  case 419: /* Variation: VARIATION ObjectName $@62 SyntaxPart $@63 WriteSyntaxPart $@64 VariationAccessPart CreationPart $@65 DefValPart $@66 DESCRIPTION Text  */
+#line 7149 "parser-smi.y"
+                        {
 			    thisParserPtr->flags &= ~FLAG_CREATABLE;
 			    (yyval.err) = 0;
 			    variationkind = SMI_NODEKIND_UNKNOWN;
 
-			    checkDescr(thisParserPtr, (yyvsp[(14) - (14)].text));
-			;}
+			    checkDescr(thisParserPtr, (yyvsp[0].text));
+			}
+#line 9819 "parser-smi.c"
     break;
 
-  case 420:
-#line 7177 "parser-smi.y"
-    { (yyval.access) = (yyvsp[(2) - (2)].access); ;}
+  case 420: /* VariationAccessPart: ACCESS VariationAccess  */
+#line 7159 "parser-smi.y"
+                        { (yyval.access) = (yyvsp[0].access); }
+#line 9825 "parser-smi.c"
     break;
 
-  case 421:
-#line 7179 "parser-smi.y"
-    { (yyval.access) = 0; ;}
+  case 421: /* VariationAccessPart: %empty  */
+#line 7161 "parser-smi.y"
+                        { (yyval.access) = 0; }
+#line 9831 "parser-smi.c"
     break;
 
-  case 422:
-#line 7183 "parser-smi.y"
-    {
-			    if (!strcmp((yyvsp[(1) - (1)].id), "not-implemented")) {
+  case 422: /* VariationAccess: LOWERCASE_IDENTIFIER  */
+#line 7165 "parser-smi.y"
+                        {
+			    if (!strcmp((yyvsp[0].id), "not-implemented")) {
 				(yyval.access) = SMI_ACCESS_NOT_IMPLEMENTED;
-			    } else if (!strcmp((yyvsp[(1) - (1)].id), "accessible-for-notify")) {
+			    } else if (!strcmp((yyvsp[0].id), "accessible-for-notify")) {
 				if (variationkind ==
 				    SMI_NODEKIND_NOTIFICATION) {
 				    smiPrintError(thisParserPtr,
 				     ERR_INVALID_NOTIFICATION_VARIATION_ACCESS,
-					       (yyvsp[(1) - (1)].id));
+					       (yyvsp[0].id));
 				    (yyval.access) = SMI_ACCESS_UNKNOWN;
 				} else {
 				    (yyval.access) = SMI_ACCESS_NOTIFY;
 				}
-			    } else if (!strcmp((yyvsp[(1) - (1)].id), "read-only")) {
+			    } else if (!strcmp((yyvsp[0].id), "read-only")) {
 				if (variationkind ==
 				    SMI_NODEKIND_NOTIFICATION) {
 				    smiPrintError(thisParserPtr,
 				     ERR_INVALID_NOTIFICATION_VARIATION_ACCESS,
-					       (yyvsp[(1) - (1)].id));
+					       (yyvsp[0].id));
 				    (yyval.access) = SMI_ACCESS_UNKNOWN;
 				} else {
 				    (yyval.access) = SMI_ACCESS_READ_ONLY;
 				}
-			    } else if (!strcmp((yyvsp[(1) - (1)].id), "read-write")) {
+			    } else if (!strcmp((yyvsp[0].id), "read-write")) {
 				if (variationkind ==
 				    SMI_NODEKIND_NOTIFICATION) {
 				    smiPrintError(thisParserPtr,
 				     ERR_INVALID_NOTIFICATION_VARIATION_ACCESS,
-					       (yyvsp[(1) - (1)].id));
+					       (yyvsp[0].id));
 				    (yyval.access) = SMI_ACCESS_UNKNOWN;
 				} else {
 				    (yyval.access) = SMI_ACCESS_READ_WRITE;
 				}
-			    } else if (!strcmp((yyvsp[(1) - (1)].id), "read-create")) {
+			    } else if (!strcmp((yyvsp[0].id), "read-create")) {
 				if (variationkind ==
 				    SMI_NODEKIND_NOTIFICATION) {
 				    smiPrintError(thisParserPtr,
 				     ERR_INVALID_NOTIFICATION_VARIATION_ACCESS,
-					       (yyvsp[(1) - (1)].id));
+					       (yyvsp[0].id));
 				    (yyval.access) = SMI_ACCESS_UNKNOWN;
 				} else {
 				    (yyval.access) = SMI_ACCESS_READ_WRITE;
 				}
-			    } else if (!strcmp((yyvsp[(1) - (1)].id), "write-only")) {
+			    } else if (!strcmp((yyvsp[0].id), "write-only")) {
 				if (variationkind ==
 				    SMI_NODEKIND_NOTIFICATION) {
 				    smiPrintError(thisParserPtr,
 				     ERR_INVALID_NOTIFICATION_VARIATION_ACCESS,
-					       (yyvsp[(1) - (1)].id));
+					       (yyvsp[0].id));
 				    (yyval.access) = SMI_ACCESS_UNKNOWN;
 				} else {
 				    (yyval.access) = SMI_ACCESS_READ_WRITE; /* TODO */
@@ -9823,133 +9890,114 @@ yyreduce:
 			    } else {
 				smiPrintError(thisParserPtr,
 					      ERR_INVALID_VARIATION_ACCESS,
-					      (yyvsp[(1) - (1)].id));
+					      (yyvsp[0].id));
 				(yyval.access) = SMI_ACCESS_UNKNOWN;
 			    }
-			;}
+			}
+#line 9898 "parser-smi.c"
     break;
 
-  case 423:
-#line 7248 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 423: /* CreationPart: CREATION_REQUIRES '{' Cells '}'  */
+#line 7230 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9904 "parser-smi.c"
     break;
 
-  case 424:
-#line 7250 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 424: /* CreationPart: %empty  */
+#line 7232 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9910 "parser-smi.c"
     break;
 
-  case 425:
-#line 7254 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 425: /* Cells: Cell  */
+#line 7236 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9916 "parser-smi.c"
     break;
 
-  case 426:
-#line 7256 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 426: /* Cells: Cells ',' Cell  */
+#line 7238 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9922 "parser-smi.c"
     break;
 
-  case 427:
-#line 7260 "parser-smi.y"
-    { (yyval.err) = 0; ;}
+  case 427: /* Cell: ObjectName  */
+#line 7242 "parser-smi.y"
+                        { (yyval.err) = 0; }
+#line 9928 "parser-smi.c"
     break;
 
 
-/* Line 1267 of yacc.c.  */
-#line 9860 "parser-smi.c"
+#line 9932 "parser-smi.c"
+
       default: break;
     }
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (YY_("syntax error"));
-#else
-      {
-	YYSIZE_T yysize = yysyntax_error (0, yystate, yychar);
-	if (yymsg_alloc < yysize && yymsg_alloc < YYSTACK_ALLOC_MAXIMUM)
-	  {
-	    YYSIZE_T yyalloc = 2 * yysize;
-	    if (! (yysize <= yyalloc && yyalloc <= YYSTACK_ALLOC_MAXIMUM))
-	      yyalloc = YYSTACK_ALLOC_MAXIMUM;
-	    if (yymsg != yymsgbuf)
-	      YYSTACK_FREE (yymsg);
-	    yymsg = (char *) YYSTACK_ALLOC (yyalloc);
-	    if (yymsg)
-	      yymsg_alloc = yyalloc;
-	    else
-	      {
-		yymsg = yymsgbuf;
-		yymsg_alloc = sizeof yymsgbuf;
-	      }
-	  }
-
-	if (0 < yysize && yysize <= yymsg_alloc)
-	  {
-	    (void) yysyntax_error (yymsg, yystate, yychar);
-	    yyerror (yymsg);
-	  }
-	else
-	  {
-	    yyerror (YY_("syntax error"));
-	    if (yysize != 0)
-	      goto yyexhaustedlab;
-	  }
-      }
-#endif
+      yyerror (parserPtr, YY_("syntax error"));
     }
 
-
-
   if (yyerrstatus == 3)
     {
-      /* If just tried and failed to reuse look-ahead token after an
-	 error, discard it.  */
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, parserPtr);
+          yychar = YYEMPTY;
+        }
     }
 
-  /* Else will try to reuse look-ahead token after shifting the error
+  /* Else will try to reuse lookahead token after shifting the error
      token.  */
   goto yyerrlab1;
 
@@ -9958,14 +10006,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -9978,42 +10025,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
-      if (yyn != YYPACT_NINF)
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, parserPtr);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -10024,54 +10071,57 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#ifndef yyoverflow
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
+  yyerror (parserPtr, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
-  if (yychar != YYEOF && yychar != YYEMPTY)
-     yydestruct ("Cleanup: discarding lookahead",
-		 yytoken, &yylval);
-  /* Do not reclaim the symbols of the rule which action triggered
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, parserPtr);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, parserPtr);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
 
+  return yyresult;
+}
 
-#line 7263 "parser-smi.y"
+#line 7245 "parser-smi.y"
 
 
 #endif
-
@@ -43,12 +43,6 @@
 
 
 
-/*
- * These arguments are passed to yyparse() and yylex().
- */
-#define YYPARSE_PARAM parserPtr
-#define YYLEX_PARAM   parserPtr
-
     
     
 #define thisParserPtr      ((Parser *)parserPtr)
@@ -1168,7 +1162,7 @@ checkImportsUsage(Parser *parserPtr, Module *modulePtr)
 					importPtr->export.module);
 		}
 	    }
-	    /* checkImports() handles KIND_NOTFOUND */
+	    /* resolveImports() has reported KIND_NOTFOUND */
 	    if (importPtr->use == 0 && importPtr->kind != KIND_NOTFOUND) {
 		smiPrintErrorAtLine(parserPtr, ERR_UNUSED_IMPORT,
 				    importPtr->line,
@@ -1292,6 +1286,12 @@ checkDate(Parser *parserPtr, char *date)
  */
 %pure_parser
 
+/*
+ * These arguments are passed to yyparse() and yylex().
+ */
+%parse-param { void *parserPtr }
+%lex-param { void *parserPtr }
+
 
 
 /*
@@ -1668,6 +1668,7 @@ module:			moduleName
 			    checkObjects(thisParserPtr, thisModulePtr);
 			    checkTypes(thisParserPtr, thisModulePtr);
 			    checkDefvals(thisParserPtr, thisModulePtr);
+			    resolveImports(thisParserPtr);
 			    checkImportsUsage(thisParserPtr, thisModulePtr);
 			    smiCheckTypeUsage(thisParserPtr, thisModulePtr);
 			    
@@ -1758,15 +1759,14 @@ import:			importIdentifiers FROM moduleName
 			    Module      *modulePtr;
                             
 			    /*
-			     * Recursively call the parser to suffer
-			     * the IMPORTS, if the module is not yet
-			     * loaded.
+			     * Record the module of the imported
+			     * identifiers. It has been loaded before
+			     * this one, unless it is part of an import
+			     * cycle. The identifiers are resolved when
+			     * they are used or at the end of the module.
 			     */
-			    modulePtr = findModuleByName($3);
-			    if (!modulePtr) {
-				modulePtr = loadModule($3, thisParserPtr);
-			    }
-			    checkImports(modulePtr, thisParserPtr);
+			    recordImports($3, thisParserPtr);
+			    modulePtr = requireModule($3, thisParserPtr);
 
 			    if (modulePtr && !strcmp($3, "SNMPv2-SMI")) {
 			        /*
@@ -1782,8 +1782,10 @@ import:			importIdentifiers FROM moduleName
 				         importPtr = importPtr->nextPtr) {
 				        if ((!strcmp(importPtr->export.module,
 						     $3)) &&
-					    ((importPtr->kind == KIND_MACRO) ||
-					     (importPtr->kind == KIND_TYPE))) {
+					    (findMacroByModuleAndName(modulePtr,
+						importPtr->export.name) ||
+					     findTypeByModuleAndName(modulePtr,
+						importPtr->export.name))) {
 					    thisModulePtr->export.language =
 					        SMI_LANGUAGE_SMIV2;
 				        }
@@ -6010,7 +6012,7 @@ subidentifier:
 						$1,
 						thisParserPtr);
 					    setImportModulename(importPtr,
-								thisParserPtr->complianceModulePtr->export.name);
+						smiStrdup(thisParserPtr->complianceModulePtr->export.name));
 					    addImportFlags(importPtr,
 							   FLAG_INCOMPLIANCE);
 					    importPtr->use++;
@@ -6032,8 +6034,8 @@ subidentifier:
 						$1,
 						thisParserPtr);
 					    setImportModulename(importPtr,
-								thisParserPtr->capabilitiesModulePtr->
-								export.name);
+						smiStrdup(thisParserPtr->capabilitiesModulePtr->
+								export.name));
 					    addImportFlags(importPtr,
 							   FLAG_INCOMPLIANCE);
 					    importPtr->use++;
@@ -6111,7 +6113,7 @@ subidentifier:
 						    $1,
 						    thisParserPtr);
 						setImportModulename(importPtr,
-						    thisParserPtr->complianceModulePtr->export.name);
+						    smiStrdup(thisParserPtr->complianceModulePtr->export.name));
 						addImportFlags(importPtr,
 							       FLAG_INCOMPLIANCE);
 						importPtr->use++;
@@ -6133,8 +6135,8 @@ subidentifier:
 						    $1,
 						    thisParserPtr);
 						setImportModulename(importPtr,
-						        thisParserPtr->capabilitiesModulePtr->
-								  export.name);
+						        smiStrdup(thisParserPtr->capabilitiesModulePtr->
+								  export.name));
 						addImportFlags(importPtr,
 							       FLAG_INCOMPLIANCE);
 						importPtr->use++;
@@ -6628,29 +6630,19 @@ ComplianceModule:	MODULE ComplianceModuleName
 			    $$.mandatorylistPtr = $4;
 			    $$.optionlistPtr = $5.optionlistPtr;
 			    $$.refinementlistPtr = $5.refinementlistPtr;
-			    if (thisParserPtr->complianceModulePtr) {
-				checkImports(thisParserPtr->complianceModulePtr,
-					     thisParserPtr);
-				thisParserPtr->complianceModulePtr = NULL;
-			    }
+			    thisParserPtr->complianceModulePtr = NULL;
 			}
 	;
 
 ComplianceModuleName:	UPPERCASE_IDENTIFIER objectIdentifier
 			{
-			    $$ = findModuleByName($1);
 			    /* TODO: handle objectIdentifier */
-			    if (!$$) {
-				$$ = loadModule($1, thisParserPtr);
-			    }
+			    $$ = requireModule($1, thisParserPtr);
 			    smiFree($1);
 			}
 	|		UPPERCASE_IDENTIFIER
 			{
-			    $$ = findModuleByName($1);
-			    if (!$$) {
-				$$ = loadModule($1, thisParserPtr);
-			    }
+			    $$ = requireModule($1, thisParserPtr);
 			    smiFree($1);
 			}
 	|		/* empty, only if contained in MIB module */
@@ -7046,11 +7038,7 @@ Module_Capabilities:	SUPPORTS ModuleName_Capabilities
 			INCLUDES '{' CapabilitiesGroups '}'
 			VariationPart
 			{
-			    if (thisParserPtr->capabilitiesModulePtr) {
-				checkImports(thisParserPtr->capabilitiesModulePtr,
-					     thisParserPtr);
-				thisParserPtr->capabilitiesModulePtr = NULL;
-			    }
+			    thisParserPtr->capabilitiesModulePtr = NULL;
 			    $$ = 0;
 			}
 	;
@@ -7090,19 +7078,13 @@ CapabilitiesGroup:	objectIdentifier
 
 ModuleName_Capabilities: UPPERCASE_IDENTIFIER objectIdentifier
 			{
-			    $$ = findModuleByName($1);
 			    /* TODO: handle objectIdentifier */
-			    if (!$$) {
-				$$ = loadModule($1, thisParserPtr);
-			    }
+			    $$ = requireModule($1, thisParserPtr);
 			    smiFree($1);
 			}
 	|		UPPERCASE_IDENTIFIER
 			{
-			    $$ = findModuleByName($1);
-			    if (!$$) {
-				$$ = loadModule($1, thisParserPtr);
-			    }
+			    $$ = requireModule($1, thisParserPtr);
 			    smiFree($1);
 			}
 	;
@@ -48,12 +48,6 @@
 #endif
 
 
-/*
- * These arguments are passed to yyparse() and yylex().
- */
-#define YYPARSE_PARAM parserPtr
-#define YYLEX_PARAM   parserPtr
-
     
     
 #define thisParserPtr      ((Parser *)parserPtr)
@@ -356,6 +350,12 @@ static void createBitsValue(SmiValue *valuePtr, Type *typePtr)
  */
 %pure_parser
 
+/*
+ * These arguments are passed to yyparse() and yylex().
+ */
+%parse-param { void *parserPtr }
+%lex-param { void *parserPtr }
+
 
 
 /*
@@ -731,6 +731,7 @@ moduleStatement:	moduleKeyword sep ucIdentifier
 			'}' optsep ';'
 			{
 			    checkTypes(thisParserPtr, thisModulePtr);
+			    resolveImports(thisParserPtr);
 			    
 			    $$ = thisModulePtr;
 			}
@@ -1412,14 +1413,16 @@ importStatement:	importKeyword sep ucIdentifier
 			}
 			optsep ')' optsep ';'
 			{
-			    Module *modulePtr;
 			    char *s = importModulename;
 
-			    modulePtr = findModuleByName(s);
-			    if (!modulePtr) {
-				modulePtr = loadModule(s, thisParserPtr);
-			    }
-			    checkImports(modulePtr, thisParserPtr);
+			    /*
+			     * The module has been loaded before this
+			     * one, unless it is part of an import cycle.
+			     * The identifiers are resolved when they
+			     * are used or at the end of the module.
+			     */
+			    recordImports(s, thisParserPtr);
+			    requireModule(s, thisParserPtr);
 			    free(s);
 			    $$ = NULL;
 			}
@@ -1555,7 +1558,7 @@ identityStatement:	identityKeyword sep lcIdentifier
 			referenceStatement_stmtsep_01
 			{
 				setIdentityReference(identityPtr, $14, 
-									 thisParserPtr)
+									 thisParserPtr);
 			}
 			'}' optsep ';'
 			{
@@ -43,12 +43,6 @@
 #include <dmalloc.h>
 #endif
 
-
-/*
- * These arguments are passed to yyparse() and yylex().
- */
-#define YYPARSE_PARAM parserPtr
-#define YYLEX_PARAM   parserPtr
  
     
 #define thisParserPtr      ((Parser *)parserPtr)
@@ -182,6 +176,12 @@ char* getIdentifier(char* identifierRef) {
  */
 %pure_parser
 
+/*
+ * These arguments are passed to yyparse() and yylex().
+ */
+%parse-param { void *parserPtr }
+%lex-param { void *parserPtr }
+
 /*
  * The attributes.
  */
@@ -478,11 +478,7 @@ moduleStatement:	moduleKeyword identifierStr
 			    if (!thisParserPtr->yangModulePtr) {
                     thisParserPtr->yangModulePtr =  addYangNode($2, YANG_DECL_MODULE, NULL);
                     
-                    if (smiHandle->firstYangModulePtr) {
-                        smiHandle->firstYangModulePtr->nextSiblingPtr = thisModulePtr;
-                    } else {
-                        smiHandle->firstYangModulePtr = thisModulePtr;
-                    }
+                    addYangModule(thisModulePtr);
 			    } else {
 			        smiPrintError(thisParserPtr, ERR_MODULE_ALREADY_LOADED, $2);
                     free($2);
@@ -517,11 +513,7 @@ submoduleStatement:	submoduleKeyword identifierStr
 			    if (!thisParserPtr->yangModulePtr) {
                     thisParserPtr->yangModulePtr =  addYangNode($2, YANG_DECL_SUBMODULE, NULL);
                     
-                    if (smiHandle->firstYangModulePtr) {
-                        smiHandle->firstYangModulePtr->nextSiblingPtr = thisModulePtr;
-                    } else {
-                        smiHandle->firstYangModulePtr = thisModulePtr;
-                    }
+                    addYangModule(thisModulePtr);
 			    } else {
 			        smiPrintError(thisParserPtr, ERR_MODULE_ALREADY_LOADED, $2);
                     free($2);
@@ -0,0 +1,705 @@
+/*
+ * scan.c --
+ *
+ *      Lightweight scanning of module headers.
+ *
+ * Copyright (c) 1999-2002 Frank Strauss, Technical University of Braunschweig.
+ *
+ * See the file "COPYING" for information on usage and redistribution
+ * of this file, and for a DISCLAIMER OF ALL WARRANTIES.
+ */
+
+/*
+ * The functions in this file extract the header of a module (its
+ * name, the imported modules, the revisions and the value of the
+ * MODULE-IDENTITY) by a plain lexical scan which stops as soon as
+ * the header is complete. Nothing is added to the loaded data and no
+ * errors are reported, so this is way cheaper than loading the
+ * module and meant for tools that catalogue large sets of files.
+ * The loader uses it as well to find the modules to be loaded before
+ * a module is parsed.
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#ifdef HAVE_WIN_H
+#include "win.h"
+#endif
+
+#include "common.h"
+
+#ifdef HAVE_DMALLOC_H
+#include <dmalloc.h>
+#endif
+
+
+
+#define SCAN_TEXT_MAX	128
+
+#define SCAN_EOF	0
+#define SCAN_ID		1	/* identifier, keyword or number */
+#define SCAN_STRING	2	/* quoted string */
+#define SCAN_ASSIGN	3	/* ::= (SMI only) */
+#define SCAN_CHAR	4	/* any other character */
+
+typedef struct Scanner {
+    const unsigned char *data;	/* the module text */
+    size_t	size;
+    size_t	pos;
+    int		yang;		/* YANG/SMIng lexical conventions */
+    int		comment;	/* an SMI comment starts at the next char */
+    int		required;	/* scan the whole text for required modules */
+    int		kind;
+    int		len;
+    char	text[SCAN_TEXT_MAX];	/* truncated text of the token */
+} Scanner;
+
+
+
+static int
+nextChar(Scanner *s)
+{
+    return s->pos < s->size ? s->data[s->pos++] : EOF;
+}
+
+
+
+static void
+backChar(Scanner *s, int c)
+{
+    if (c != EOF) {
+	s->pos--;
+    }
+}
+
+
+
+static void
+addChar(Scanner *s, int c)
+{
+    if (s->len < SCAN_TEXT_MAX - 1) {
+	s->text[s->len++] = c;
+	s->text[s->len] = 0;
+    }
+}
+
+
+
+static void
+skipComment(Scanner *s)
+{
+    int c, d;
+
+    if (s->yang) {
+	for (c = nextChar(s), d = EOF;
+	     c != EOF && ! (d == '*' && c == '/');
+	     d = c, c = nextChar(s)) ;
+	return;
+    }
+
+    /* SMI comments end at the end of the line or at the next `--' */
+    while ((c = nextChar(s)) != EOF && c != '\n') {
+	if (c == '-') {
+	    d = nextChar(s);
+	    if (d == '-') {
+		break;
+	    }
+	    backChar(s, d);
+	}
+    }
+}
+
+
+
+static int
+nextToken(Scanner *s)
+{
+    int c, d, q;
+
+    s->len = 0;
+    s->text[0] = 0;
+
+    if (s->comment) {
+	skipComment(s);
+	s->comment = 0;
+    }
+
+    for (;;) {
+	c = nextChar(s);
+	if (c == EOF) {
+	    return s->kind = SCAN_EOF;
+	}
+	if (isspace(c)) {
+	    continue;
+	}
+	if (! s->yang && c == '-') {
+	    d = nextChar(s);
+	    if (d == '-') {
+		skipComment(s);
+		continue;
+	    }
+	    backChar(s, d);
+	}
+	if (s->yang && c == '/') {
+	    d = nextChar(s);
+	    if (d == '/') {
+		while ((c = nextChar(s)) != EOF && c != '\n') ;
+		continue;
+	    }
+	    if (d == '*') {
+		skipComment(s);
+		continue;
+	    }
+	    backChar(s, d);
+	}
+	break;
+    }
+
+    if (c == '"' || c == '\'') {
+	q = c;
+	while ((c = nextChar(s)) != EOF && c != q) {
+	    if (s->yang && q == '"' && c == '\\') {
+		c = nextChar(s);
+		if (c == EOF) {
+		    break;
+		}
+	    }
+	    addChar(s, c);
+	}
+	return s->kind = SCAN_STRING;
+    }
+
+    if (isalnum(c) || c == '_') {
+	do {
+	    addChar(s, c);
+	    c = nextChar(s);
+	    if (! s->yang && c == '-') {
+		d = nextChar(s);
+		if (d == '-') {
+		    s->comment = 1;
+		    c = EOF;
+		    break;
+		}
+		backChar(s, d);
+	    }
+	} while (c != EOF
+		 && (isalnum(c) || c == '_' || c == '-'
+		     || (s->yang && (c == '.' || c == ':'))));
+	if (c != EOF) {
+	    backChar(s, c);
+	}
+	return s->kind = SCAN_ID;
+    }
+
+    if (! s->yang && c == ':') {
+	d = nextChar(s);
+	if (d == ':') {
+	    d = nextChar(s);
+	    if (d == '=') {
+		strcpy(s->text, "::=");
+		s->len = 3;
+		return s->kind = SCAN_ASSIGN;
+	    }
+	}
+	backChar(s, d);
+    }
+
+    addChar(s, c);
+    return s->kind = SCAN_CHAR;
+}
+
+
+
+static int
+isChar(Scanner *s, int c)
+{
+    return s->kind == SCAN_CHAR && s->text[0] == c;
+}
+
+
+
+static int
+isKeyword(Scanner *s, const char *keyword)
+{
+    return s->kind == SCAN_ID && strcmp(s->text, keyword) == 0;
+}
+
+
+
+static void
+addSummaryImport(SmiModuleSummary *summary, const char *module)
+{
+    int i;
+
+    for (i = 0; i < summary->numImports; i++) {
+	if (strcmp(summary->imports[i], module) == 0) {
+	    return;
+	}
+    }
+    summary->imports = smiRealloc(summary->imports,
+			  (summary->numImports + 1) * sizeof(SmiIdentifier));
+    summary->imports[summary->numImports++] = smiStrdup(module);
+}
+
+
+
+static void
+addSummaryRevision(SmiModuleSummary *summary, time_t date)
+{
+    summary->revisions = smiRealloc(summary->revisions,
+			    (summary->numRevisions + 1) * sizeof(time_t));
+    summary->revisions[summary->numRevisions++] = date;
+    if (date > summary->lastUpdated) {
+	summary->lastUpdated = date;
+    }
+}
+
+
+
+/*
+ * Convert an SMI date ("YYYYMMDDHHMMZ" or "YYMMDDHHMMZ") or a YANG
+ * and SMIng date ("YYYY-MM-DD" optionally followed by " HH:MM").
+ * Malformed dates are returned as 0, the errors are reported when the
+ * module gets loaded.
+ */
+
+static time_t
+scanDate(const char *date)
+{
+    struct tm tm;
+    int i, len = strlen(date);
+
+    memset(&tm, 0, sizeof(tm));
+
+    if ((len == 11 || len == 13) && date[len-1] == 'Z') {
+	for (i = 0; i < len - 1; i++) {
+	    if (! isdigit((unsigned char) date[i])) {
+		return 0;
+	    }
+	}
+	if (len == 11) {
+	    sscanf(date, "%2d%2d%2d%2d%2d", &tm.tm_year, &tm.tm_mon,
+		   &tm.tm_mday, &tm.tm_hour, &tm.tm_min);
+	    tm.tm_year += 1900;
+	} else {
+	    sscanf(date, "%4d%2d%2d%2d%2d", &tm.tm_year, &tm.tm_mon,
+		   &tm.tm_mday, &tm.tm_hour, &tm.tm_min);
+	}
+    } else if (sscanf(date, "%4d-%2d-%2d %2d:%2d", &tm.tm_year, &tm.tm_mon,
+		      &tm.tm_mday, &tm.tm_hour, &tm.tm_min) < 3) {
+	return 0;
+    }
+
+    if (tm.tm_mon < 1 || tm.tm_mon > 12 || tm.tm_mday < 1 || tm.tm_mday > 31) {
+	return 0;
+    }
+    tm.tm_year -= 1900;
+    tm.tm_mon -= 1;
+    tm.tm_isdst = 0;
+    return timegm(&tm);
+}
+
+
+
+/*
+ * Skip a value enclosed in braces. If oid is not NULL, the components
+ * of the value are collected separated by blanks.
+ */
+
+static int
+skipValue(Scanner *s, char **oid)
+{
+    char buf[SCAN_TEXT_MAX * 4];
+    int len = 0;
+
+    if (nextToken(s) != SCAN_CHAR || ! isChar(s, '{')) {
+	return -1;
+    }
+    buf[0] = 0;
+    while (nextToken(s) != SCAN_EOF && ! isChar(s, '}')) {
+	if (len + s->len + 2 >= sizeof(buf)) {
+	    continue;
+	}
+	if (len && ! isChar(s, '(') && ! isChar(s, ')')
+	    && buf[len-1] != '(') {
+	    buf[len++] = ' ';
+	}
+	strcpy(buf + len, s->text);
+	len += s->len;
+    }
+    if (s->kind == SCAN_EOF) {
+	return -1;
+    }
+    if (oid) {
+	*oid = smiStrdup(buf);
+    }
+    return 0;
+}
+
+
+
+static void
+scanModuleIdentity(Scanner *s, SmiModuleSummary *summary)
+{
+    int kind;
+
+    while ((kind = nextToken(s)) != SCAN_EOF && kind != SCAN_ASSIGN) {
+	if (isKeyword(s, "LAST-UPDATED")) {
+	    if (nextToken(s) == SCAN_STRING) {
+		summary->lastUpdated = scanDate(s->text);
+	    }
+	} else if (isKeyword(s, "REVISION")) {
+	    if (nextToken(s) == SCAN_STRING) {
+		addSummaryRevision(summary, scanDate(s->text));
+	    }
+	}
+    }
+    if (kind == SCAN_ASSIGN) {
+	skipValue(s, &summary->oid);
+    }
+}
+
+
+
+/*
+ * Skip to the next MODULE or SUPPORTS keyword of an SMI module. This
+ * runs over the whole text, so apart from strings and comments only
+ * the identifiers starting with these letters are looked at.
+ */
+
+static int
+isIdentifierChar(int c)
+{
+    return isalnum(c) || c == '_' || c == '-';
+}
+
+static int
+skipToRequiringKeyword(Scanner *s)
+{
+    const unsigned char *p, *q, *end = s->data + s->size;
+    size_t len;
+
+    if (s->comment) {
+	skipComment(s);
+	s->comment = 0;
+    }
+
+    for (p = s->data + s->pos; p < end; ) {
+	switch (*p) {
+	case '"':
+	case '\'':
+	    q = memchr(p + 1, *p, end - p - 1);
+	    p = q ? q + 1 : end;
+	    break;
+	case '-':
+	    if (p + 1 < end && p[1] == '-') {
+		/* comments end at the end of the line or at the next `--' */
+		for (p += 2; p < end && *p != '\n'; p++) {
+		    if (*p == '-' && p + 1 < end && p[1] == '-') {
+			p++;
+			break;
+		    }
+		}
+	    }
+	    p++;
+	    break;
+	case 'M':
+	case 'S':
+	    len = (*p == 'M') ? 6 : 8;
+	    if ((p == s->data || ! isIdentifierChar(p[-1]))
+		&& (size_t) (end - p) >= len
+		&& ! memcmp(p, (*p == 'M') ? "MODULE" : "SUPPORTS", len)
+		&& (p + len == end || ! isIdentifierChar(p[len])
+		    || (p[len] == '-' && p + len + 1 < end
+			&& p[len + 1] == '-'))) {
+		s->pos = p + len - s->data;
+		return 1;
+	    }
+	    p++;
+	    break;
+	default:
+	    p++;
+	    break;
+	}
+    }
+    s->pos = s->size;
+    return 0;
+}
+
+
+
+/*
+ * Scan the rest of an SMI module for the modules named in the MODULE
+ * clauses of MODULE-COMPLIANCE and the SUPPORTS clauses of
+ * AGENT-CAPABILITIES statements. They are required to load the module
+ * just like the imported ones. A MODULE clause that refers to the
+ * module itself is followed by a keyword or the end of the statement.
+ */
+
+static void
+scanRequiredModules(Scanner *s, SmiModuleSummary *summary)
+{
+    int kind;
+
+    while (skipToRequiringKeyword(s)) {
+	do {
+	    kind = nextToken(s);
+	} while (kind == SCAN_ID
+		 && (isKeyword(s, "MODULE") || isKeyword(s, "SUPPORTS")));
+	if (kind == SCAN_ID && isupper((unsigned char) s->text[0])
+	    && ! isKeyword(s, "MANDATORY-GROUPS")
+	    && ! isKeyword(s, "GROUP") && ! isKeyword(s, "OBJECT")
+	    && strcmp(s->text, summary->name) != 0) {
+	    addSummaryImport(summary, s->text);
+	}
+    }
+}
+
+
+
+static void
+scanSMI(Scanner *s, SmiModuleSummary *summary)
+{
+    char name[SCAN_TEXT_MAX];
+    int i, kind;
+
+    /* module header: name [oid] DEFINITIONS ::= BEGIN */
+
+    if (nextToken(s) != SCAN_ID) {
+	return;
+    }
+    strcpy(name, s->text);
+    while ((kind = nextToken(s)) != SCAN_EOF && ! isKeyword(s, "BEGIN")) ;
+    if (kind == SCAN_EOF) {
+	return;
+    }
+    summary->name = smiStrdup(name);
+
+    kind = nextToken(s);
+    if (isKeyword(s, "IMPORTS")) {
+	while ((kind = nextToken(s)) != SCAN_EOF && ! isChar(s, ';')) {
+	    if (isKeyword(s, "FROM") && nextToken(s) == SCAN_ID) {
+		addSummaryImport(summary, s->text);
+	    }
+	}
+	kind = nextToken(s);
+    }
+
+    /*
+     * The MODULE-IDENTITY should be the first definition. Skip object
+     * identifier assignments which some modules place in front of it
+     * and stop at any other definition.
+     */
+
+    while (kind == SCAN_ID) {
+	strcpy(name, s->text);
+	if (nextToken(s) != SCAN_ID) {
+	    break;
+	}
+	if (isKeyword(s, "MODULE-IDENTITY")) {
+	    summary->identity = smiStrdup(name);
+	    scanModuleIdentity(s, summary);
+	    break;
+	}
+	if (! isKeyword(s, "OBJECT")
+	    || nextToken(s) != SCAN_ID || ! isKeyword(s, "IDENTIFIER")
+	    || nextToken(s) != SCAN_ASSIGN || skipValue(s, NULL) < 0) {
+	    break;
+	}
+	kind = nextToken(s);
+    }
+
+    summary->language = summary->identity ? SMI_LANGUAGE_SMIV2
+					  : SMI_LANGUAGE_SMIV1;
+    if (! strncmp(summary->name, "SNMPv2-", 7)) {
+	summary->language = SMI_LANGUAGE_SMIV2;
+    }
+    for (i = 0; i < summary->numImports; i++) {
+	if (! strcmp(summary->imports[i], "SNMPv2-SMI")) {
+	    summary->language = SMI_LANGUAGE_SMIV2;
+	} else if (! strcmp(summary->imports[i], "COPS-PR-SPPI")) {
+	    summary->language = SMI_LANGUAGE_SPPI;
+	    break;
+	}
+    }
+
+    if (s->required) {
+	scanRequiredModules(s, summary);
+    }
+}
+
+
+
+/*
+ * Skip the rest of a YANG or SMIng statement up to its terminating
+ * semicolon or the end of its block.
+ */
+
+static void
+skipStatement(Scanner *s)
+{
+    int depth = 0;
+
+    for (; s->kind != SCAN_EOF; nextToken(s)) {
+	if (isChar(s, '{')) {
+	    depth++;
+	} else if (isChar(s, '}')) {
+	    if (--depth <= 0) {
+		return;
+	    }
+	} else if (isChar(s, ';') && depth == 0) {
+	    return;
+	}
+    }
+}
+
+
+
+static void
+scanYang(Scanner *s, SmiModuleSummary *summary)
+{
+    static const char *header[] = {
+	"yang-version", "namespace", "prefix", "belongs-to", "include",
+	"organization", "contact", "description", "reference", "identity",
+	NULL
+    };
+    int i, depth;
+
+    if (nextToken(s) != SCAN_ID
+	|| (! isKeyword(s, "module") && ! isKeyword(s, "submodule"))) {
+	return;
+    }
+    if (nextToken(s) != SCAN_ID && s->kind != SCAN_STRING) {
+	return;
+    }
+    summary->name = smiStrdup(s->text);
+    if (nextToken(s) != SCAN_CHAR || ! isChar(s, '{')) {
+	return;
+    }
+
+    while (nextToken(s) != SCAN_EOF && ! isChar(s, '}')) {
+	if (isChar(s, ';')) {
+	    continue;		/* SMIng terminates blocks by `};' */
+	}
+	if (isKeyword(s, "import")) {
+	    if (nextToken(s) == SCAN_ID || s->kind == SCAN_STRING) {
+		addSummaryImport(summary, s->text);
+		nextToken(s);
+	    }
+	} else if (isKeyword(s, "revision")) {
+	    nextToken(s);
+	    if (s->kind == SCAN_ID || s->kind == SCAN_STRING) {
+		addSummaryRevision(summary, scanDate(s->text));	/* YANG */
+		nextToken(s);
+	    } else if (isChar(s, '{')) {
+		for (depth = 1; depth && nextToken(s) != SCAN_EOF; ) {
+		    if (isChar(s, '{')) {
+			depth++;
+		    } else if (isChar(s, '}')) {
+			depth--;
+		    } else if (depth == 1 && isKeyword(s, "date")
+			       && nextToken(s) == SCAN_STRING) {
+			addSummaryRevision(summary, scanDate(s->text));	/* SMIng */
+		    }
+		}
+		continue;
+	    }
+	} else {
+	    for (i = 0; header[i] && ! isKeyword(s, header[i]); i++) ;
+	    if (! header[i]) {
+		break;		/* the first definition ends the header */
+	    }
+	    nextToken(s);
+	}
+	skipStatement(s);
+    }
+}
+
+
+
+/*
+ * Scan the header of a module text. The summary is returned without
+ * a path, or NULL if the text does not contain a module. If required
+ * is set, the imports of an SMI module include the modules named in
+ * its compliance and capabilities statements, which are found by a
+ * scan of the whole text.
+ */
+
+SmiModuleSummary *scanModuleText(const ModuleText *text, int required)
+{
+    SmiModuleSummary *summary;
+    Scanner scanner;
+    SmiLanguage language;
+
+    memset(&scanner, 0, sizeof(scanner));
+    scanner.data = (const unsigned char *) text->data;
+    scanner.size = text->len;
+    scanner.required = required;
+    summary = smiMalloc(sizeof(SmiModuleSummary));
+
+    language = getLanguage(text->data, text->len);
+    if (language == SMI_LANGUAGE_YANG || language == SMI_LANGUAGE_SMING) {
+	scanner.yang = 1;
+	scanYang(&scanner, summary);
+	summary->language = language;
+    } else if (language != SMI_LANGUAGE_UNKNOWN) {
+	scanSMI(&scanner, summary);
+    }
+
+    if (! summary->name) {
+	smiFreeModuleSummary(summary);
+	return NULL;
+    }
+    return summary;
+}
+
+
+
+SmiModuleSummary *smiScanModule(const char *module)
+{
+    SmiModuleSummary *summary;
+    ModuleText text;
+    char *path;
+
+    if (!smiHandle) smiInit(NULL);
+
+    path = openModuleText(module, &text);
+    if (! text.data) {
+	smiFree(path);
+	return NULL;
+    }
+
+    summary = scanModuleText(&text, 0);
+    closeModuleText(&text);
+    if (! summary) {
+	smiFree(path);
+	return NULL;
+    }
+    summary->path = path;
+    return summary;
+}
+
+
+
+void smiFreeModuleSummary(SmiModuleSummary *summary)
+{
+    int i;
+
+    if (! summary) {
+	return;
+    }
+    for (i = 0; i < summary->numImports; i++) {
+	smiFree(summary->imports[i]);
+    }
+    smiFree(summary->imports);
+    smiFree(summary->revisions);
+    smiFree(summary->name);
+    smiFree(summary->path);
+    smiFree(summary->identity);
+    smiFree(summary->oid);
+    smiFree(summary);
+}
@@ -23,7 +23,7 @@
 extern char *yytext;
 extern int yyleng;
 
-extern int smiEnterLexRecursion(FILE *file);
-extern void smiLeaveLexRecursion();
+extern void *smiEnterLexBuffer(char *data, size_t len, int inPlace);
+extern void smiLeaveLexBuffer(void *outerBuffer);
 
 #endif /* _SCANNER_SMI_H */
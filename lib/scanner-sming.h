@@ -23,7 +23,7 @@
 extern char *yytext;
 extern int yyleng;
 
-extern int smingEnterLexRecursion(FILE *file);
-extern void smingLeaveLexRecursion();
+extern void *smingEnterLexBuffer(char *data, size_t len, int inPlace);
+extern void smingLeaveLexBuffer(void *outerBuffer);
 
 #endif /* _SCANNER_SMING_H */
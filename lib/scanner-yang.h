@@ -23,7 +23,7 @@
 extern char *yytext;
 extern int yyleng;
 
-extern int yangEnterLexRecursion(FILE *file);
+extern int yangEnterLexRecursion(char *data, size_t len, int inPlace);
 extern void yangLeaveLexRecursion();
 
 #endif /* _SCANNER_YANG_H */
@@ -28,6 +28,7 @@
 
 #include "smi.h"
 #include "common.h"
+#include "bundle.h"
 #include "data.h"
 #include "yang-data.h"
 #include "error.h"
@@ -55,12 +56,15 @@
 #define MAX(a, b)       ((a) < (b) ? (b) : (a))
 #endif
 
+#define PARSEOID_MAXLABEL 128	/* longest module name or label accepted
+				   by smiParseOID() */
+
 
 
 const char *smi_library_version = SMI_LIBRARY_VERSION;
 const char *smi_version_string = SMI_VERSION_STRING;
 
-Handle *smiHandle = NULL;
+SMI_THREAD_LOCAL Handle *smiHandle = NULL;
 
 
 
@@ -182,6 +186,132 @@ static Object *getNextChildObject(Node *startNodePtr, Module *modulePtr,
 
 
 
+/*
+ * Return the first index element that applies to instances of the
+ * columnar object objectPtr and the row that holds the INDEX clause.
+ */
+
+static SmiElement *getIndexElement(Object *objectPtr, SmiNode **indexNode)
+{
+    Object *rowPtr;
+
+    *indexNode = NULL;
+    if (!objectPtr || objectPtr->export.nodekind != SMI_NODEKIND_COLUMN
+	|| !objectPtr->nodePtr->parentPtr) {
+	return NULL;
+    }
+
+    rowPtr = findObjectByNode(objectPtr->nodePtr->parentPtr);
+    if (!rowPtr) {
+	return NULL;
+    }
+
+    switch (rowPtr->export.indexkind) {
+    case SMI_INDEX_INDEX:
+    case SMI_INDEX_REORDER:
+	*indexNode = &rowPtr->export;
+	break;
+    case SMI_INDEX_AUGMENT:
+    case SMI_INDEX_SPARSE:
+	*indexNode = rowPtr->relatedPtr ? &rowPtr->relatedPtr->export : NULL;
+	break;
+    default:
+	break;
+    }
+
+    return *indexNode ? smiGetFirstElement(*indexNode) : NULL;
+}
+
+
+
+/*
+ * Advance to the next index element after one instance component.
+ * A numeric component only maps to exactly one index element if the
+ * element is of a scalar integer type. Otherwise we lose track.
+ */
+
+static SmiElement *nextIndexElement(SmiElement *smiElement, int numeric)
+{
+    SmiType *smiType;
+
+    if (!smiElement) {
+	return NULL;
+    }
+
+    if (numeric) {
+	smiType = smiGetNodeType(smiGetElementNode(smiElement));
+	if (!smiType
+	    || smiType->basetype == SMI_BASETYPE_OCTETSTRING
+	    || smiType->basetype == SMI_BASETYPE_OBJECTIDENTIFIER
+	    || smiType->basetype == SMI_BASETYPE_BITS) {
+	    return NULL;
+	}
+    }
+
+    return smiGetNextElement(smiElement);
+}
+
+
+
+/*
+ * Append a quoted string index value to oid. The string is encoded
+ * with a leading length subid unless it is the IMPLIED last index
+ * element or an index element with a fixed size.
+ */
+
+static int parseIndexString(const char **pp, SmiNode *indexNode,
+			    SmiElement *smiElement,
+			    SmiSubid *oid, unsigned int *oidlen,
+			    unsigned int max)
+{
+    const char   *p = *pp;
+    SmiType	 *smiType = NULL;
+    unsigned int len = *oidlen, start, fixed = 0;
+    int		 implied = 0;
+
+    if (smiElement) {
+	smiType = smiGetNodeType(smiGetElementNode(smiElement));
+	implied = indexNode->implied && !smiGetNextElement(smiElement);
+	if (smiType && smiType->basetype == SMI_BASETYPE_OCTETSTRING
+	    && smiGetMinSize(smiType) == smiGetMaxSize(smiType)) {
+	    fixed = smiGetMinSize(smiType);
+	}
+    }
+
+    start = len;
+    if (!implied && !fixed) {
+	if (len >= max) {
+	    return -1;
+	}
+	len++;
+    }
+
+    for (p++; *p && *p != '"'; p++) {
+	if (*p == '\\' && p[1]) {
+	    p++;
+	}
+	if (len >= max) {
+	    return -1;
+	}
+	oid[len++] = (unsigned char) *p;
+    }
+    if (*p != '"') {
+	return -1;
+    }
+
+    if (!implied && !fixed) {
+	oid[start] = len - start - 1;
+    } else if (fixed && len - start != fixed) {
+	return -1;
+    }
+
+    *pp = p + 1;
+    *oidlen = len;
+    return 0;
+}
+
+
+
 /*
  * Interface Functions.
  */
@@ -223,9 +353,13 @@ int smiInit(const char *tag)
     /* 1. set to builtin DEFAULT_SMIPATH */
     smiHandle->path = smiStrdup(DEFAULT_SMIPATH);
 
+    /*
+     * The configuration is read for the tag up to the first colon.
+     * There is none if the tag is NULL or starts with a colon.
+     */
     tag2 = smiStrdup(tag);
-    if (tag2) tag2 = strtok(tag2, ":");
-    if (tag2) {
+    if (tag2 && (p = strchr(tag2, ':'))) *p = 0;
+    if (tag2 && tag2[0]) {
 	/* 2. read global config file if present (append/prepend/replace) */
 	smiReadConfig(DEFAULT_GLOBALCONFIG, tag2);
 #ifdef HAVE_PWD_H
@@ -273,6 +407,8 @@ void smiExit()
 
     smiFreeData();
     yangFreeData();    
+    smiClearDiagnostics();
+    freeBundles();
 
     smiFree(smiHandle->path);
 #if !defined(_MSC_VER)
@@ -406,55 +542,117 @@ int smiIsLoaded(const char *module)
 }
 
 extern _YangNode *loadYangModule(const char *modulename, const char *revision, Parser *parserPtr);
+extern _YangNode *loadYangModuleFromBuffer(const char *name, const char *data, size_t len, Parser *parserPtr);
+extern _YangNode *readYangModule(char *path, ModuleText *text, Parser *parserPtr);
 
 char *smiLoadModule(const char *module)
 {
+    const char *data;
+    size_t len;
+    ModuleText text;
+    SmiLanguage lang = SMI_LANGUAGE_UNKNOWN;
+    Module *modulePtr;
+    _YangNode *yangModulePtr;
+    char *path;
+
     if (!smiHandle) smiInit(NULL);
-    
-    SmiLanguage lang = guessLanguage(module);
+
+    modulePtr = smiIsPath(module) ? NULL : findModuleByName(module);
+    if (modulePtr && modulePtr->export.language != SMI_LANGUAGE_YANG) {
+        /* already loaded. */
+        if (!isInView(module)) {
+            addView(module);
+        }
+        return modulePtr->export.name;
+    }
+
+    if (!modulePtr && resolveModule(module, &data, &len)) {
+        return smiLoadModuleFromBuffer(module, data, len);
+    }
+
+    /*
+     * The module is located and read only once. Its text is used to
+     * identify the language and then handed to the parser.
+     */
+    path = openModuleText(module, &text);
+    if (text.data) {
+        lang = getLanguage(text.data, text.len);
+    }
     
     if (lang == SMI_LANGUAGE_YANG) {
-        _YangNode *yangModulePtr = loadYangModule(module, NULL, NULL);
+        yangModulePtr = readYangModule(path, &text, NULL);
+        closeModuleText(&text);
         if (yangModulePtr) {
             return yangModulePtr->export.value;
         } else {
             return NULL;
         }
+    }
+
+    if (text.data) {
+        modulePtr = readModule(path, &text, NULL);
+        closeModuleText(&text);
     } else {
-        Module *modulePtr;
-        if (smiIsPath(module)) {
-            
-            modulePtr = loadModule(module, NULL);
-
-            if (modulePtr) {
-                if (!isInView(modulePtr->export.name)) {
-                    addView(modulePtr->export.name);
-                }
-                return modulePtr->export.name;
-            } else {
-                return NULL;
-            }
-        } else {	
-            if ((modulePtr = findModuleByName(module))) {
-                /* already loaded. */
-                if (!isInView(module)) {
-                    addView(module);
-                }
-                return modulePtr->export.name;
-            } else {
-                if ((modulePtr = loadModule(module, NULL))) {
-                    if (!isInView(module)) {
-                        addView(module);
-                    }
-                    return modulePtr->export.name;
-                } else {
-                    return NULL;
-                }
-            }
+        /* let loadModule() report why the module cannot be read */
+        smiFree(path);
+        modulePtr = loadModule(module, NULL);
+    }
+    if (!modulePtr) {
+        return NULL;
+    }
+    if (smiIsPath(module)) {
+        module = modulePtr->export.name;
+    }
+    if (!isInView(module)) {
+        addView(module);
+    }
+    return modulePtr->export.name;
+}
+
+char *smiLoadModuleFromBuffer(const char *name, const char *data, size_t len)
+{
+    Module *modulePtr;
+    _YangNode *yangModulePtr;
+
+    if (!smiHandle) smiInit(NULL);
+
+    if (!name || !data) {
+        return NULL;
+    }
+
+    if (getLanguage(data, len) == SMI_LANGUAGE_YANG) {
+        yangModulePtr = findYangModuleByName(name, NULL);
+        if (!yangModulePtr) {
+            yangModulePtr = loadYangModuleFromBuffer(name, data, len, NULL);
         }
+        return yangModulePtr ? yangModulePtr->export.value : NULL;
+    }
+
+    modulePtr = findModuleByName(name);
+    if (!modulePtr) {
+        modulePtr = loadModuleFromBuffer(name, data, len, NULL);
     }
+    if (!modulePtr) {
+        return NULL;
+    }
+    if (!isInView(modulePtr->export.name)) {
+        addView(modulePtr->export.name);
+    }
+    return modulePtr->export.name;
 }
 
+
+
+void smiSetModuleResolver(SmiModuleResolver smiModuleResolver, void *userdata)
+{
+    if (!smiHandle) smiInit(NULL);
+
+    smiHandle->moduleResolver = smiModuleResolver;
+    smiHandle->moduleResolverData = userdata;
+}
+
+
+
 void smiSetErrorLevel(int level)
 {
     if (!smiHandle) smiInit(NULL);
@@ -464,6 +662,15 @@ void smiSetErrorLevel(int level)
 
 
 
+int smiGetErrorLevel(void)
+{
+    if (!smiHandle) smiInit(NULL);
+    
+    return smiHandle->errorLevel;
+}
+
+
+
 void smiSetFlags(int userflags)
 {
     if (!smiHandle) smiInit(NULL);
@@ -1358,6 +1565,134 @@ SmiNode *smiGetNodeByOID(unsigned int oidlen, SmiSubid oid[])
 
 
 
+int smiParseOID(const char *str, SmiSubid *oid, unsigned int *oidlen)
+{
+    Module	    *modulePtr = NULL;
+    Object	    *objectPtr = NULL;
+    Node	    *nodePtr = NULL;
+    SmiNode	    *indexNode = NULL;
+    SmiElement	    *smiElement = NULL;
+    const char	    *p, *q;
+    char	    label[PARSEOID_MAXLABEL];
+    unsigned int    len = 0, max, l;
+    int		    dot = 1;
+    unsigned long   subid;
+    char	    *end;
+
+    if (!str || !oid || !oidlen) {
+	return -1;
+    }
+
+    max = *oidlen;
+    *oidlen = 0;
+    p = str;
+
+    /*
+     * An optional module prefix. Module names start with an upper
+     * case letter and are separated by `::', `!' or `.' from a label.
+     */
+    if (isupper((int)p[0])) {
+	for (q = p; isalnum((int)*q) || *q == '-' || *q == '_'; q++);
+	l = q - p;
+	if (q[0] == ':' && q[1] == ':') {
+	    q += 2;
+	} else if ((q[0] == '!' || q[0] == '.') && isalpha((int)q[1])) {
+	    q++;
+	} else {
+	    q = NULL;
+	}
+	if (q) {
+	    if (l >= sizeof(label)) {
+		return -1;
+	    }
+	    memcpy(label, p, l);
+	    label[l] = 0;
+	    modulePtr = findModuleByName(label);
+	    if (!modulePtr) {
+		return -1;
+	    }
+	    p = q;
+	}
+    }
+
+    /*
+     * The base node is either a label or the first numeric subid.
+     */
+    if (isalpha((int)p[0])) {
+	for (q = p; isalnum((int)*q) || *q == '-' || *q == '_'; q++);
+	l = q - p;
+	if (l >= sizeof(label)) {
+	    return -1;
+	}
+	memcpy(label, p, l);
+	label[l] = 0;
+	if (modulePtr) {
+	    objectPtr = findObjectByModuleAndName(modulePtr, label);
+	} else {
+	    objectPtr = findObjectByName(label);
+	}
+	if (!objectPtr || !objectPtr->nodePtr
+	    || objectPtr->export.oidlen > max) {
+	    return -1;
+	}
+	nodePtr = objectPtr->nodePtr;
+	len = objectPtr->export.oidlen;
+	memcpy(oid, objectPtr->export.oid, len * sizeof(SmiSubid));
+	smiElement = getIndexElement(objectPtr, &indexNode);
+	p = q;
+    } else if (isdigit((int)p[0]) || (p[0] == '.' && isdigit((int)p[1]))) {
+	nodePtr = smiHandle->rootNodePtr;
+	if (*p == '.') {
+	    p++;
+	}
+	dot = 0;
+    } else {
+	return -1;
+    }
+
+    /*
+     * The remaining components are numeric subids or quoted string
+     * index values. While we are still in the registration tree, we
+     * follow the nodes to learn about the index of a columnar object.
+     */
+    for (; *p; dot = 1) {
+	if (dot && *p++ != '.') {
+	    return -1;
+	}
+	if (isdigit((int)*p)) {
+	    subid = strtoul(p, &end, 10);
+	    if (len >= max || subid > SMI_BASETYPE_UNSIGNED32_MAX) {
+		return -1;
+	    }
+	    oid[len++] = subid;
+	    p = end;
+	    if (nodePtr) {
+		nodePtr = findNodeByParentAndSubid(nodePtr, subid);
+	    }
+	    if (nodePtr) {
+		smiElement = getIndexElement(findObjectByNode(nodePtr),
+					     &indexNode);
+	    } else {
+		smiElement = nextIndexElement(smiElement, 1);
+	    }
+	} else if (*p == '"') {
+	    if (parseIndexString(&p, indexNode, smiElement,
+				 oid, &len, max)) {
+		return -1;
+	    }
+	    nodePtr = NULL;
+	    smiElement = nextIndexElement(smiElement, 0);
+	} else {
+	    return -1;
+	}
+    }
+
+    *oidlen = len;
+    return 0;
+}
+
+
+
 SmiNode *smiGetFirstNode(SmiModule *smiModulePtr, SmiNodekind nodekind)
 {
     Module *modulePtr;
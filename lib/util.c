@@ -145,6 +145,39 @@ int smiIsPath(const char *s)
 
 
 
+static int hashKeyword(const KeywordTable *table, const char *text, int len)
+{
+    unsigned long h = table->seed;
+    int i;
+
+    for (i = 0; i < len; i++) {
+	h ^= (unsigned char) text[i];
+	h = (h * 16777619UL) & 0xffffffffUL;		/* FNV-1a */
+    }
+    return (int) ((h ^ (h >> 16)) & (table->size - 1));
+}
+
+
+
+const Keyword *smiFindKeyword(const KeywordTable *table,
+			      const char *text, int len)
+{
+    const Keyword *keywordPtr;
+    int slot;
+
+    slot = table->slots[hashKeyword(table, text, len)];
+    if (! slot) {
+	return NULL;
+    }
+    keywordPtr = &table->keywords[slot - 1];
+    if (strncmp(keywordPtr->name, text, len) || keywordPtr->name[len]) {
+	return NULL;
+    }
+    return keywordPtr;
+}
+
+
+
 #ifndef HAVE_TIMEGM
 time_t timegm(struct tm *tm)
 {
@@ -53,6 +53,28 @@
 
 extern int smiIsPath(const char *s);
 
+/*
+ * Keyword tables of the scanners. The slots are generated from the
+ * keywords hashed with the given seed, which has been chosen such
+ * that no two keywords of a table share a slot. Lookups of keywords
+ * thus take a single string comparison.
+ */
+
+typedef struct Keyword {
+    const char	  *name;
+    int		  token;
+} Keyword;
+
+typedef struct KeywordTable {
+    const Keyword *keywords;	/* terminated by a NULL name */
+    unsigned long seed;
+    int		  size;		/* number of slots, a power of 2 */
+    const short	  *slots;	/* index + 1 of the keyword, or 0 */
+} KeywordTable;
+
+extern const Keyword *smiFindKeyword(const KeywordTable *table,
+				     const char *text, int len);
+
 #ifndef HAVE_TIMEGM
 time_t timegm(struct tm *tm);
 #endif
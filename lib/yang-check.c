@@ -185,7 +185,7 @@ int getIdentifierGroup(YangDecl kind) {
 int countChildNodesByTypeAndValue(_YangNode *nodePtr, _YangNode *curNode, YangIdentifierGroup group, char* value) {
     _YangNode *childPtr = NULL;
     int ret = 0;
-    for (childPtr = nodePtr->firstChildPtr; childPtr && childPtr != curNode; childPtr = childPtr->nextSiblingPtr) {       
+    for (childPtr = getFirstChildNode(nodePtr); childPtr && childPtr != curNode; childPtr = childPtr->nextSiblingPtr) {       
         if (getIdentifierGroup(childPtr->export.nodeKind) == group && !strcmp(childPtr->export.value, value)) {
             ret++;
         }
@@ -193,38 +193,159 @@ int countChildNodesByTypeAndValue(_YangNode *nodePtr, _YangNode *curNode, YangId
     return ret;
 }
 
-int countChoiceChildNodesByTypeAndValue(_YangNode *nodePtr, _YangNode *curNode, YangIdentifierGroup group, char* value) {
-    _YangNode *childPtr = NULL;
-    int ret = 0;
-    for (childPtr = nodePtr->firstChildPtr; childPtr && childPtr != curNode; childPtr = childPtr->nextSiblingPtr) {
-        if (childPtr->export.nodeKind == YANG_DECL_CASE) {
-            _YangNode *childPtr2 = childPtr->firstChildPtr;
-            for (; childPtr2 && childPtr2 != curNode; childPtr2 = childPtr2->nextSiblingPtr) {
-                if (getIdentifierGroup(childPtr2->export.nodeKind) == group && !strcmp(childPtr2->export.value, value)) {
-                    ret++;
-                }                
+/*
+ * A set of identifiers used to check their uniqueness. An entry is
+ * keyed by a scope node, the kind of the scope, an identifier group
+ * and a name, and it refers to the first node that has been added
+ * with this key.
+ */
+typedef enum IdentifierScope {
+    IDSC_CHILDREN   = 0,    /* the children of a node */
+    IDSC_CASES      = 1,    /* as above, with the children of its cases */
+    IDSC_SUBMODULES = 2,    /* the children of all submodules of a module */
+    IDSC_DEFINED    = 3     /* the submodules that define an identifier */
+} IdentifierScope;
+
+typedef struct IdentifierEntry {
+    _YangNode           *scopePtr;
+    IdentifierScope     scope;
+    YangIdentifierGroup group;
+    char                *name;
+    void                *data;
+} IdentifierEntry;
+
+typedef struct IdentifierSet {
+    IdentifierEntry     *entries;
+    int                 size;
+    int                 count;
+} IdentifierSet;
+
+static unsigned int hashIdentifier(_YangNode *scopePtr, IdentifierScope scope, YangIdentifierGroup group, const char *name) {
+    unsigned int h = 2166136261U;
+    for (; *name; name++) {
+        h = (h ^ (unsigned char) *name) * 16777619U;
+    }
+    h = (h ^ (unsigned int) ((unsigned long) scopePtr >> 3)) * 16777619U;
+    h = (h ^ (unsigned int) (scope << 8 | group)) * 16777619U;
+    return h ^ (h >> 16);
+}
+
+static IdentifierEntry *findIdentifier(IdentifierSet *set, _YangNode *scopePtr, IdentifierScope scope, YangIdentifierGroup group, const char *name) {
+    int i = hashIdentifier(scopePtr, scope, group, name) & (set->size - 1);
+    while (set->entries[i].name) {
+        IdentifierEntry *entryPtr = &set->entries[i];
+        if (entryPtr->scopePtr == scopePtr && entryPtr->scope == scope &&
+            entryPtr->group == group && !strcmp(entryPtr->name, name)) {
+            break;
+        }
+        i = (i + 1) & (set->size - 1);
+    }
+    return &set->entries[i];
+}
+
+/*
+ * Return the entry with the given key. A new entry is created with its
+ * data set to NULL.
+ */
+static IdentifierEntry *addIdentifier(IdentifierSet *set, _YangNode *scopePtr, IdentifierScope scope, YangIdentifierGroup group, char *name) {
+    IdentifierEntry *entryPtr;
+    if (2 * (set->count + 1) > set->size) {
+        IdentifierEntry *oldEntries = set->entries;
+        int i, oldSize = set->size;
+        set->size = oldSize ? 2 * oldSize : 64;
+        set->entries = smiMalloc(set->size * sizeof(IdentifierEntry));
+        for (i = 0; i < oldSize; i++) {
+            if (oldEntries[i].name) {
+                *findIdentifier(set, oldEntries[i].scopePtr, oldEntries[i].scope, oldEntries[i].group, oldEntries[i].name) = oldEntries[i];
             }
-            if (childPtr2 == curNode) break;
-        } else {
-            if (getIdentifierGroup(childPtr->export.nodeKind) == group && !strcmp(childPtr->export.value, value)) {
-                ret++;
+        }
+        smiFree(oldEntries);
+    }
+    entryPtr = findIdentifier(set, scopePtr, scope, group, name);
+    if (!entryPtr->name) {
+        entryPtr->scopePtr = scopePtr;
+        entryPtr->scope = scope;
+        entryPtr->group = group;
+        entryPtr->name = name;
+        set->count++;
+    }
+    return entryPtr;
+}
+
+static void *lookupIdentifier(IdentifierSet *set, _YangNode *scopePtr, IdentifierScope scope, YangIdentifierGroup group, const char *name) {
+    if (!set->size) return NULL;
+    return findIdentifier(set, scopePtr, scope, group, name)->data;
+}
+
+static void addChildIdentifiers(IdentifierSet *set, _YangNode *scopePtr, IdentifierScope scope, _YangNode *nodePtr) {
+    _YangNode *childPtr;
+    for (childPtr = getFirstChildNode(nodePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
+        YangIdentifierGroup group = getIdentifierGroup(childPtr->export.nodeKind);
+        if (group > YANG_IDGR_NONE && childPtr->export.value) {
+            IdentifierEntry *entryPtr = addIdentifier(set, scopePtr, scope, group, childPtr->export.value);
+            if (!entryPtr->data) {
+                entryPtr->data = childPtr;
             }
         }
     }
-    return ret;
 }
 
-int validateNodeUniqueness(_YangNode *nodePtr) {
+/*
+ * Fill the identifiers of a scope at its first use, which is
+ * remembered by an entry without a group and with an empty name.
+ */
+static void addScopeIdentifiers(IdentifierSet *set, _YangNode *scopePtr, IdentifierScope scope) {
+    IdentifierEntry *entryPtr = addIdentifier(set, scopePtr, scope, YANG_IDGR_NONE, "");
+    if (entryPtr->data) return;
+    entryPtr->data = scopePtr;
+
+    if (scope == IDSC_CHILDREN) {
+        addChildIdentifiers(set, scopePtr, scope, scopePtr);
+    } else if (scope == IDSC_CASES) {
+        _YangNode *childPtr;
+        for (childPtr = getFirstChildNode(scopePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
+            if (childPtr->export.nodeKind == YANG_DECL_CASE) {
+                addChildIdentifiers(set, scopePtr, scope, childPtr);
+            } else {
+                YangIdentifierGroup group = getIdentifierGroup(childPtr->export.nodeKind);
+                if (group > YANG_IDGR_NONE && childPtr->export.value) {
+                    entryPtr = addIdentifier(set, scopePtr, scope, group, childPtr->export.value);
+                    if (!entryPtr->data) {
+                        entryPtr->data = childPtr;
+                    }
+                }
+            }
+        }
+    } else if (scope == IDSC_SUBMODULES) {
+        YangList *submodules = getModuleInfo(scopePtr)->submodules;
+        for (; submodules; submodules = submodules->next) {
+            addChildIdentifiers(set, scopePtr, scope, listNode(submodules));
+        }
+    }
+}
+
+/*
+ * Look up a scope for an identifier that conflicts with nodePtr. In the
+ * scope of nodePtr itself, only the identifiers preceding it conflict.
+ */
+static int isDuplicated(IdentifierSet *set, _YangNode *scopePtr, IdentifierScope scope, _YangNode *nodePtr, YangIdentifierGroup group) {
+    _YangNode *firstPtr;
+    addScopeIdentifiers(set, scopePtr, scope);
+    firstPtr = lookupIdentifier(set, scopePtr, scope, group, nodePtr->export.value);
+    return firstPtr && firstPtr != nodePtr;
+}
+
+static int validateNodeUniqueness(IdentifierSet *set, _YangNode *nodePtr) {
     YangIdentifierGroup ig = getIdentifierGroup(nodePtr->export.nodeKind);
     _YangNode *cur = nodePtr->parentPtr;
     while (cur) {
         if (cur->export.nodeKind == YANG_DECL_CASE) {
             cur = cur->parentPtr;
-            if (countChoiceChildNodesByTypeAndValue(cur, nodePtr, ig, nodePtr->export.value)) {
+            if (isDuplicated(set, cur, IDSC_CASES, nodePtr, ig)) {
                 return 0;
             }
         } else {
-            if (countChildNodesByTypeAndValue(cur, nodePtr, ig, nodePtr->export.value)) {
+            if (isDuplicated(set, cur, IDSC_CHILDREN, nodePtr, ig)) {
                 return 0;
             }            
         }
@@ -235,21 +356,22 @@ int validateNodeUniqueness(_YangNode *nodePtr) {
     }
     /* check with all submodules if it's a top-level definition or not a data defition statement */
     if (ig != YANG_IDGR_NODE || !nodePtr->parentPtr->parentPtr) {
-        YangList* submodules = ((_YangModuleInfo*)nodePtr->modulePtr->info)->submodules;
-        while (submodules) {
-            if (countChildNodesByTypeAndValue(listNode(submodules), nodePtr, ig, nodePtr->export.value)) {
-                return 0;
-            }                    
-            submodules = submodules->next;
-        }    
+        if (isDuplicated(set, nodePtr->modulePtr, IDSC_SUBMODULES, nodePtr, ig)) {
+            return 0;
+        }
     }
     return 1;
 }
 
+void unshareNode(_YangNode *nodePtr);
+
 _YangNode *createReferenceNode(_YangNode *parentPtr, _YangNode *reference, YangNodeType nodeType)
 {
 	_YangNode *node = (_YangNode*) smiMalloc(sizeof(_YangNode));
+    unshareNode(parentPtr);
     node->nodeType              = nodeType;
+    node->privateValue          = 0;
+    node->sharedPtr             = NULL;
 	node->export.value          = reference->export.value;
 	node->export.nodeKind       = reference->export.nodeKind;
     node->export.config 		= reference->export.config;
@@ -266,6 +388,7 @@ _YangNode *createReferenceNode(_YangNode *parentPtr, _YangNode *reference, YangN
     node->lastChildPtr          = NULL;
     node->parentPtr             = parentPtr;
     node->modulePtr             = parentPtr->modulePtr;
+    node->indexPtr              = NULL;
     
     if(parentPtr->lastChildPtr)
     {
@@ -280,6 +403,22 @@ _YangNode *createReferenceNode(_YangNode *parentPtr, _YangNode *reference, YangN
     return node;
 }
 
+/*
+ * Give a reference node its own reference nodes for the children it
+ * shares. This has to be done before the children or their list are
+ * changed, so that the original subtree and its other instances are
+ * left alone.
+ */
+void unshareNode(_YangNode *nodePtr) {
+    _YangNode *sharedPtr = nodePtr->sharedPtr, *childPtr;
+    if (!sharedPtr) return;
+    nodePtr->sharedPtr = NULL;
+    for (childPtr = getFirstChildNode(sharedPtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
+        _YangNode *reference = createReferenceNode(nodePtr, childPtr, nodePtr->nodeType);
+        reference->sharedPtr = childPtr;
+    }
+}
+
 int isDataDefinitionNode(_YangNode *node) {
     if (!node) return;
     YangDecl kind = node->export.nodeKind;
@@ -300,20 +439,102 @@ int isMandatory(_YangNode *nodePtr) {
     return 0;
 }
 
-void copySubtree(_YangNode *destPtr, _YangNode *subtreePtr, YangNodeType nodeType, int skipMandatory) {
+/*
+ * An augment statement in a subtree is expanded for every instance of
+ * the subtree, so such a subtree is not shared.
+ */
+int hasAugments(_YangNode *nodePtr) {
+    _YangNode *childPtr;
+    for (childPtr = getFirstChildNode(nodePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
+        if (childPtr->export.nodeKind == YANG_DECL_AUGMENT || hasAugments(childPtr)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Report the mandatory nodes of a subtree, as the augment of a node in
+ * another module must not add any.
+ */
+void checkMandatoryNodes(_YangNode *nodePtr) {
+    _YangNode *childPtr;
+    if (isMandatory(nodePtr)) {
+        smiPrintErrorAtLine(currentParser, ERR_AUGMENTATION_BY_MANDATORY_NODE, nodePtr->line);
+    }
+    for (childPtr = getFirstChildNode(nodePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
+        checkMandatoryNodes(childPtr);
+    }
+}
+
+/*
+ * Check whether validateConfigProperties() changes the config value of
+ * a node below nodePtr, given the config value nodePtr ends up with.
+ */
+int hasConfigConflicts(_YangNode *nodePtr, int isConfigTrue) {
+    _YangNode *childPtr;
+    for (childPtr = getFirstChildNode(nodePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
+        if (!isConfigTrue && yangIsTrueConf(childPtr->export.config)) {
+            return 1;
+        }
+        if (hasConfigConflicts(childPtr, yangIsTrueConf(childPtr->export.config))) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * A node ends up with config false if one of its ancestors has config
+ * false.
+ */
+int isEffectiveConfigTrue(_YangNode *nodePtr) {
+    for (; nodePtr; nodePtr = nodePtr->parentPtr) {
+        if (!yangIsTrueConf(nodePtr->export.config)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Instantiate a subtree below destPtr. If shared is set, the children
+ * of the subtree are not copied but shared with the new reference node
+ * until unshareNode() is called for it. The children of a case belong
+ * to the name space of the choice, so a case gets its own children.
+ * Children whose config values are going to be changed are copied as
+ * well, since an instance keeps the values the subtree had when it was
+ * instantiated.
+ */
+void copySubtree(_YangNode *destPtr, _YangNode *subtreePtr, YangNodeType nodeType, int skipMandatory, int shared) {
+    _YangNode *reference;
+    if (shared && subtreePtr->export.nodeKind != YANG_DECL_CASE &&
+        !hasConfigConflicts(subtreePtr, isEffectiveConfigTrue(subtreePtr))) {
+        if (skipMandatory) {
+            checkMandatoryNodes(subtreePtr);
+        }
+        reference = createReferenceNode(destPtr, subtreePtr, nodeType);
+        reference->sharedPtr = subtreePtr;
+        return;
+    }
     if (skipMandatory && isMandatory(subtreePtr)) {
         smiPrintErrorAtLine(currentParser, ERR_AUGMENTATION_BY_MANDATORY_NODE, subtreePtr->line);
     }
-    _YangNode *reference = createReferenceNode(destPtr, subtreePtr, nodeType);
-    _YangNode* childPtr = subtreePtr->firstChildPtr;
+    reference = createReferenceNode(destPtr, subtreePtr, nodeType);
+    _YangNode* childPtr = getFirstChildNode(subtreePtr);
     while (childPtr) {
-        copySubtree(reference, childPtr, nodeType, skipMandatory);
+        copySubtree(reference, childPtr, nodeType, skipMandatory, shared);
         childPtr = childPtr->nextSiblingPtr;
     }
 }
 
+/*
+ * Target nodes are changed, so the nodes along the path get their own
+ * children.
+ */
 _YangNode* findTargetNode(_YangNode *nodePtr, char* value) {
     _YangNode *childPtr = NULL;
+    unshareNode(nodePtr);
     for (childPtr = nodePtr->firstChildPtr; childPtr; childPtr = childPtr->nextSiblingPtr) {
         if (isSchemaNode(childPtr->export.nodeKind) && !strcmp(childPtr->export.value, value)) {
             return childPtr;
@@ -398,20 +619,21 @@ int isAllowedStatement(int stmt, int *allowedStmts, int len) {
 }
 
 void applyRefine(_YangNode* target, _YangNode* refinement, int* allowedStmts, int len) {
-    _YangNode *child = refinement->firstChildPtr;
+    _YangNode *child = getFirstChildNode(refinement);
     
+    unshareNode(target);
     while (child) {
         if (!isAllowedStatement(child->export.nodeKind, allowedStmts, len)) {
             smiPrintErrorAtLine(currentParser, ERR_INVALID_REFINE, child->line, yandDeclKeyword[target->export.nodeKind], target->export.value, yandDeclKeyword[child->export.nodeKind]);
         } else {
             if (child->export.nodeKind == YANG_DECL_MUST_STATEMENT) {
-                copySubtree(target, child, YANG_NODE_REFINED, 0);
+                copySubtree(target, child, YANG_NODE_REFINED, 0, 0);
             } else if (child->export.nodeKind == YANG_DECL_DESCRIPTION || 
                 child->export.nodeKind == YANG_DECL_REFERENCE) {
                 /* just skip, because they are not relevant for the future checks */
             } else if (child->export.nodeKind == YANG_DECL_PRESENCE) {
                 if (!findChildNodeByType(target, child->export.nodeKind)) {
-                    copySubtree(target, child, YANG_NODE_REFINED, 0);
+                    copySubtree(target, child, YANG_NODE_REFINED, 0, 0);
                 }
             } else if (child->export.nodeKind == YANG_DECL_CONFIG ||
                     child->export.nodeKind == YANG_DECL_DEFAULT || 
@@ -420,10 +642,9 @@ void applyRefine(_YangNode* target, _YangNode* refinement, int* allowedStmts, in
                     child->export.nodeKind == YANG_DECL_MAX_ELEMENTS) {
                 _YangNode *oldOne = findChildNodeByType(target, child->export.nodeKind);
                 if (oldOne) {
-                    smiFree(oldOne->export.value);
-                    oldOne->export.value = smiStrdup(child->export.value);
+                    setValue(oldOne, child->export.value);
                 } else {
-                    copySubtree(target, child, YANG_NODE_REFINED, 0);
+                    copySubtree(target, child, YANG_NODE_REFINED, 0, 0);
                     oldOne = child;
                 }
                 if (oldOne->export.nodeKind == YANG_DECL_CONFIG) {
@@ -468,16 +689,17 @@ int expandGroupings(_YangNode *node) {
         _YangIdentifierRefInfo* info = (_YangIdentifierRefInfo*)node->info;
         if (info->resolvedNode) {
             if (expandGroupings(info->resolvedNode)) {            
-                _YangNode *refChild = info->resolvedNode->firstChildPtr;
+                _YangNode *refChild = getFirstChildNode(info->resolvedNode);
+                int shared = !hasAugments(info->resolvedNode);
                 while (refChild) {
                     if (isDataDefinitionNode(refChild)) {
-                        copySubtree(node->parentPtr, refChild, YANG_NODE_EXPANDED_USES, 0);
+                        copySubtree(node->parentPtr, refChild, YANG_NODE_EXPANDED_USES, 0, shared);
                     }
                     refChild = refChild->nextSiblingPtr;
                 }
                 
                 /* Apply refinements if there are any  */
-                _YangNode *child = node->firstChildPtr;
+                _YangNode *child = getFirstChildNode(node);
                 while (child) {
                     if (child->export.nodeKind == YANG_DECL_REFINE) {
                         _YangNode* refinement = child;
@@ -515,7 +737,7 @@ int expandGroupings(_YangNode *node) {
         }
     }
     
-    _YangNode *child = node->firstChildPtr;
+    _YangNode *child = getFirstChildNode(node);
     while (child) {
         expandGroupings(child);
         child = child->nextSiblingPtr;
@@ -527,53 +749,82 @@ int expandGroupings(_YangNode *node) {
 }
 
 /*
- * Verifies that all identifiers are unique within all namespaces
+ * Verifies that all identifiers are unique within all namespaces. The
+ * nodes below a reference node that shares its children are reported
+ * as nodes of the given sharedType, like the reference nodes they stand
+ * for; otherwise sharedType is YANG_NODE_ORIGINAL.
  */
-void uniqueNames(_YangNode* nodePtr) { 
+static void checkUniqueNames(IdentifierSet *set, _YangNode* nodePtr, YangNodeType sharedType) { 
     /* go over all child nodes*/
-    _YangNode* cur = nodePtr->firstChildPtr;
+    _YangNode* cur = getFirstChildNode(nodePtr);
     while (cur) {
         YangIdentifierGroup yig = getIdentifierGroup(cur->export.nodeKind);
+        YangNodeType nodeType = sharedType != YANG_NODE_ORIGINAL ? sharedType : cur->nodeType;
         if (yig > YANG_IDGR_NONE) {            
-            if (!validateNodeUniqueness(cur)) {
-                if (cur->nodeType == YANG_NODE_EXPANDED_USES) {
+            if (!validateNodeUniqueness(set, cur)) {
+                if (nodeType == YANG_NODE_EXPANDED_USES) {
                     smiPrintErrorAtLine(currentParser, ERR_DUPLICATED_NODE_WHILE_GROUPING_INSTANTIATION, cur->line, cur->export.value);
-                } else if (cur->nodeType == YANG_NODE_EXPANDED_AUGMENT) {
+                } else if (nodeType == YANG_NODE_EXPANDED_AUGMENT) {
                     smiPrintErrorAtLine(currentParser, ERR_DUPLICATED_NODE_WHILE_AUGMENT_INSTANTIATION, cur->line, cur->export.value);
                 } else {
                     smiPrintErrorAtLine(currentParser, ERR_DUPLICATED_IDENTIFIER, cur->line, cur->export.value);
                 }
             }
         }
-        uniqueNames(cur);
+        checkUniqueNames(set, cur, cur->sharedPtr ? nodeType : sharedType);
         cur = cur->nextSiblingPtr;
     }
 }
 
-/*
- *  Should be reimplemented in more efficient way by using some appropriate datastructures, like HashTable
- */
+void uniqueNames(_YangNode* nodePtr) {
+    IdentifierSet set = { NULL, 0, 0 };
+    checkUniqueNames(&set, nodePtr, YANG_NODE_ORIGINAL);
+    smiFree(set.entries);
+}
+
 void uniqueSubmoduleDefinitions(_YangNode* modulePtr) {
     /* validate name uniqueness of the top level definitions in all submodules */
-    YangList* submodulePtr = ((_YangModuleInfo*)modulePtr->info)->submodules, *firstSubmodulePtr;
-    firstSubmodulePtr = submodulePtr;
+    YangList* submodulePtr = ((_YangModuleInfo*)modulePtr->info)->submodules;
+    IdentifierSet set = { NULL, 0, 0 };
+    IdentifierEntry *entryPtr;
+    int i;
     while (submodulePtr) {
-        _YangNode* curNodePtr = listNode(submodulePtr)->firstChildPtr;
+        _YangNode* curNodePtr = getFirstChildNode(listNode(submodulePtr));
         while (curNodePtr) {
             YangIdentifierGroup ig = getIdentifierGroup(curNodePtr->export.nodeKind);
             if (ig > YANG_IDGR_NONE) {
-               YangList* sPtr = firstSubmodulePtr;
-                while (sPtr != submodulePtr) {
-                    if (countChildNodesByTypeAndValue(listNode(sPtr), curNodePtr, ig, curNodePtr->export.value)) {
-                        smiPrintErrorAtLine(((Parser*)getModuleInfo(listNode(submodulePtr))->parser), ERR_IDENTIFIER_DEFINED_IN_OTHER_SUBMODLE, curNodePtr->line, curNodePtr->export.value, listNode(sPtr)->export.value);
-                    }
-                    sPtr = sPtr->next;
+                /* the preceding submodules that define the same identifier */
+                YangList* sPtr = lookupIdentifier(&set, NULL, IDSC_DEFINED, ig, curNodePtr->export.value);
+                for (; sPtr; sPtr = sPtr->next) {
+                    smiPrintErrorAtLine(((Parser*)getModuleInfo(listNode(submodulePtr))->parser), ERR_IDENTIFIER_DEFINED_IN_OTHER_SUBMODLE, curNodePtr->line, curNodePtr->export.value, listNode(sPtr)->export.value);
                 }
             }
             curNodePtr = curNodePtr->nextSiblingPtr;
         }        
+        for (curNodePtr = getFirstChildNode(listNode(submodulePtr)); curNodePtr; curNodePtr = curNodePtr->nextSiblingPtr) {
+            YangIdentifierGroup ig = getIdentifierGroup(curNodePtr->export.nodeKind);
+            if (ig > YANG_IDGR_NONE) {
+                YangList *lastPtr;
+                entryPtr = addIdentifier(&set, NULL, IDSC_DEFINED, ig, curNodePtr->export.value);
+                for (lastPtr = entryPtr->data; lastPtr && lastPtr->next; lastPtr = lastPtr->next);
+                if (!lastPtr) {
+                    entryPtr->data = addElementToList(NULL, listNode(submodulePtr));
+                } else if (listNode(lastPtr) != listNode(submodulePtr)) {
+                    addLastElementToList(lastPtr, listNode(submodulePtr));
+                }
+            }
+        }
         submodulePtr= submodulePtr->next;
     }   
+    for (i = 0; i < set.size; i++) {
+        YangList *listPtr = set.entries[i].data;
+        while (listPtr) {
+            YangList *next = listPtr->next;
+            smiFree(listPtr);
+            listPtr = next;
+        }
+    }
+    smiFree(set.entries);
 }
 
 int map[65];
@@ -656,7 +907,7 @@ void resolveReferences(_YangNode* node) {
             }
     }
     
-    _YangNode *child = node->firstChildPtr;
+    _YangNode *child = getFirstChildNode(node);
     while (child) {
         resolveReferences(child);
         child = child->nextSiblingPtr;
@@ -702,10 +953,12 @@ int isSchemaNode(YangDecl kind) {
 }
 
 /*
- * Expands all augment statements.
+ * Expands all augment statements. A shared subtree has no augment
+ * statements (see hasAugments()), so the nodes reached through a
+ * reference node are only passed through.
  */
 void expangAugments(_YangNode* node) {
-    _YangNode *child = node->firstChildPtr;
+    _YangNode *child = getFirstChildNode(node);
     while (child) {
         expangAugments(child);
         child = child->nextSiblingPtr;
@@ -724,14 +977,14 @@ void expangAugments(_YangNode* node) {
                 return;
             }
             /* expand augment */
-            _YangNode *child = node->firstChildPtr;
+            _YangNode *child = getFirstChildNode(node);
             
             /*  
              *  From the specification:
              *  If the target node of the “augment” is in another module, 
              *  then nodes added by the augmentation MUST NOT be mandatory nodes. 
              */
-            int isAnotherModule = 1;
+            int isAnotherModule = 1, shared = !hasAugments(node);
             if (!strcmp(getModuleInfo(targetNodePtr->modulePtr)->prefix, getModuleInfo(node->modulePtr)->prefix)) {
                 isAnotherModule = 0;
             }
@@ -761,12 +1014,12 @@ void expangAugments(_YangNode* node) {
                      *  If the target node is in the external module we should check whether adding this node does not break uniqueness
                      *  (because all imported modules have been already validated)
                      */
-                    copySubtree(targetNodePtr, child, YANG_NODE_EXPANDED_AUGMENT, isAnotherModule);
+                    copySubtree(targetNodePtr, child, YANG_NODE_EXPANDED_AUGMENT, isAnotherModule, shared);
                 } else if (child->export.nodeKind == YANG_DECL_CASE) {
                     if (targetNodePtr->export.nodeKind != YANG_DECL_CHOICE) {
                         smiPrintErrorAtLine(currentParser, ERR_NODE_KIND_NOT_ALLOWED, child->line, yandDeclKeyword[child->export.nodeKind], child->export.value, yandDeclKeyword[targetNodePtr->export.nodeKind], targetNodePtr->export.value);
                     }
-                    copySubtree(targetNodePtr, child, YANG_NODE_EXPANDED_AUGMENT, isAnotherModule);
+                    copySubtree(targetNodePtr, child, YANG_NODE_EXPANDED_AUGMENT, isAnotherModule, shared);
                 }
                 child = child->nextSiblingPtr;
             }
@@ -800,13 +1053,21 @@ void validateConfigProperties(_YangNode *nodePtr, int isConfigTrue, int ignore)
         nodePtr->export.nodeKind == YANG_DECL_NOTIFICATION) {
         ignoreFlag = 1;
     }
+    if (!ignoreFlag && nodePtr->sharedPtr && hasConfigConflicts(nodePtr, yangIsTrueConf(nodePtr->export.config))) {
+        unshareNode(nodePtr);
+    }
     _YangNode *childPtr = NULL;
-    for (childPtr = nodePtr->firstChildPtr; childPtr; childPtr = childPtr->nextSiblingPtr) {
+    for (childPtr = getFirstChildNode(nodePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
         validateConfigProperties(childPtr, yangIsTrueConf(nodePtr->export.config), ignoreFlag);
     }
 }
 
-void validateLists(_YangNode *nodePtr) {
+/*
+ * If shared is set, the children of nodePtr are shared with a reference
+ * node. They are checked like the reference nodes they stand for, which
+ * have no key and unique lists.
+ */
+void validateLists(_YangNode *nodePtr, int shared) {
     if (nodePtr->export.nodeKind == YANG_DECL_LIST) {
         /*
          *  From the specification:
@@ -822,7 +1083,7 @@ void validateLists(_YangNode *nodePtr) {
             }
         }        
         if (key) {
-            YangList *keys = (YangList*)key->info;
+            YangList *keys = shared ? NULL : (YangList*)key->info;
             while (keys) {
                 _YangNode *leafPtr = findChildNodeByTypeAndValue(nodePtr, YANG_DECL_LEAF, listIdentifierRef(keys)->ident);
                 if (!leafPtr) {
@@ -846,16 +1107,16 @@ void validateLists(_YangNode *nodePtr) {
          *  which MUST be given in the descendant form. Each such schema node identifier MUST refer to a leaf. 
          *  If one of the referenced leafs represents configuration data, then all of the referenced leafs MUST represent configuration data. 
          */
-        _YangNode *childPtr = nodePtr->firstChildPtr;
+        _YangNode *childPtr = getFirstChildNode(nodePtr);
         while (childPtr) {            
             if (childPtr->export.nodeKind == YANG_DECL_UNIQUE) {
-                _YangList* l = (_YangList*)childPtr->info;
+                _YangList* l = shared ? NULL : (_YangList*)childPtr->info;
                 int configNodeCount = 0, stateNodeCount = 0;
                 while (l) {                    
                     YangList* il = (YangList*)l->data;
                     _YangNode* cur = nodePtr;
                     while (il) {
-                        cur = cur->firstChildPtr;                        
+                        cur = getFirstChildNode(cur);                        
                         while (cur) {
                             if (isDataDefNode(cur) && !strcmp(cur->export.value, listIdentifierRef(il)->ident)) break;
                             cur = cur->nextSiblingPtr;
@@ -890,19 +1151,24 @@ void validateLists(_YangNode *nodePtr) {
         }
     }
     _YangNode *childPtr = NULL;
-    for (childPtr = nodePtr->firstChildPtr; childPtr; childPtr = childPtr->nextSiblingPtr) {
-        validateLists(childPtr);
+    for (childPtr = getFirstChildNode(nodePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
+        validateLists(childPtr, shared || childPtr->sharedPtr);
     }    
 }
 
-void validateDefaultStatements(_YangNode *nodePtr) {
+/*
+ * The parent is passed down, as the parentPtr of a node reached through
+ * a reference node that shares its children is the node in the grouping
+ * and not the reference node.
+ */
+void validateDefaultStatements(_YangNode *nodePtr, _YangNode *parentPtr) {
     YangDecl nodeKind = nodePtr->export.nodeKind;
     if (nodeKind == YANG_DECL_DEFAULT) {
-        YangDecl parentKind = nodePtr->parentPtr->export.nodeKind;
+        YangDecl parentKind = parentPtr->export.nodeKind;
 
         /* An empty type cannot have a default value. */
         if (parentKind == YANG_DECL_LEAF || parentKind == YANG_DECL_TYPEDEF) {
-            _YangNode* typePtr = findChildNodeByType(nodePtr->parentPtr, YANG_DECL_TYPE);
+            _YangNode* typePtr = findChildNodeByType(parentPtr, YANG_DECL_TYPE);
             if (getBuiltInType(typePtr->export.value) == YANG_TYPE_EMPTY) {
                 smiPrintErrorAtLine(currentParser, ERR_DEFAULT_NOT_ALLOWED, nodePtr->line);
             }
@@ -910,7 +1176,7 @@ void validateDefaultStatements(_YangNode *nodePtr) {
 
         /* The "default" statement of the leaf and choice MUST NOT be present where "mandatory" is true. */
         if (parentKind == YANG_DECL_CHOICE || parentKind == YANG_DECL_LEAF) {
-            _YangNode* mandatory = findChildNodeByType(nodePtr->parentPtr, YANG_DECL_MANDATORY);
+            _YangNode* mandatory = findChildNodeByType(parentPtr, YANG_DECL_MANDATORY);
             if (mandatory && !strcmp(mandatory->export.value, "true")) {
                 smiPrintErrorAtLine(currentParser, ERR_IVALIDE_DEFAULT, nodePtr->line);
             }
@@ -921,7 +1187,7 @@ void validateDefaultStatements(_YangNode *nodePtr) {
          * There MUST NOT be any mandatory nodes directly under the default case. 
          */
         if (parentKind == YANG_DECL_CHOICE) {
-            _YangNode *defaultCase = findChildNodeByTypeAndValue(nodePtr->parentPtr, YANG_DECL_CASE, nodePtr->export.value);
+            _YangNode *defaultCase = findChildNodeByTypeAndValue(parentPtr, YANG_DECL_CASE, nodePtr->export.value);
             if (!defaultCase) {
                 smiPrintErrorAtLine(currentParser, ERR_IVALIDE_DEFAULT_CASE, nodePtr->line, nodePtr->export.value);
             } else {
@@ -932,7 +1198,7 @@ void validateDefaultStatements(_YangNode *nodePtr) {
                 */                
                 _YangNode *childPtr = NULL;
                 _YangNode *mandatory = NULL;
-                for (childPtr = defaultCase->firstChildPtr; childPtr; childPtr = childPtr->nextSiblingPtr) {
+                for (childPtr = getFirstChildNode(defaultCase); childPtr; childPtr = childPtr->nextSiblingPtr) {
                     mandatory = findChildNodeByTypeAndValue(childPtr, YANG_DECL_MANDATORY, "true");
                     if (!mandatory) {
                         mandatory = findChildNodeByType(childPtr, YANG_DECL_PRESENCE);
@@ -945,18 +1211,23 @@ void validateDefaultStatements(_YangNode *nodePtr) {
                     }
                     if (mandatory) break;                   
                 }        
-                smiPrintErrorAtLine(currentParser, ERR_MANDATORY_NODE_UNDER_DEFAULT_CASE, nodePtr->line, defaultCase->export.value, nodePtr->parentPtr->export.value);
+                smiPrintErrorAtLine(currentParser, ERR_MANDATORY_NODE_UNDER_DEFAULT_CASE, nodePtr->line, defaultCase->export.value, parentPtr->export.value);
             }
         }
     }
     _YangNode *childPtr = NULL;
-    for (childPtr = nodePtr->firstChildPtr; childPtr; childPtr = childPtr->nextSiblingPtr) {
-        validateDefaultStatements(childPtr);
+    for (childPtr = getFirstChildNode(nodePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
+        validateDefaultStatements(childPtr, nodePtr);
     }        
 }
 
-void typeHandler(_YangNode* nodePtr) {
-    if (nodePtr->nodeType != YANG_NODE_ORIGINAL) return;
+/*
+ * Only original type statements are checked. The nodes below a reference
+ * node that shares its children stand for reference nodes and are
+ * skipped as well.
+ */
+void typeHandler(_YangNode* nodePtr, int shared) {
+    if (shared || nodePtr->nodeType != YANG_NODE_ORIGINAL) return;
     /* resolve built-in type */
     _YangNode* curNode = nodePtr;
     while (curNode->typeInfo->baseTypeNodePtr != NULL) {
@@ -1004,7 +1275,7 @@ void typeHandler(_YangNode* nodePtr) {
         }
     }
 
-    curNode = nodePtr->firstChildPtr;
+    curNode = getFirstChildNode(nodePtr);
     while (curNode) {
         switch (curNode->export.nodeKind) {
             case YANG_DECL_RANGE:
@@ -1066,15 +1337,20 @@ int isInList(int value, int* list) {
     return 0;
 }
 
-void _iterate(_YangNode *nodePtr, void* handler, int* nodeKindList) {
+/*
+ * The handler gets the node and whether it has been reached through a
+ * reference node that shares its children, as the parentPtr and
+ * modulePtr of such a node belong to the original subtree.
+ */
+void _iterate(_YangNode *nodePtr, void* handler, int* nodeKindList, int shared) {
     if (isInList(nodePtr->export.nodeKind, nodeKindList)) {
-        void (*handlerPtr)(_YangNode*);
+        void (*handlerPtr)(_YangNode*, int);
         handlerPtr = handler;
-        handlerPtr(nodePtr);
+        handlerPtr(nodePtr, shared);
     }
     _YangNode *childPtr = NULL;
-    for (childPtr = nodePtr->firstChildPtr; childPtr; childPtr = childPtr->nextSiblingPtr) {
-        _iterate(childPtr, handler, nodeKindList);
+    for (childPtr = getFirstChildNode(nodePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
+        _iterate(childPtr, handler, nodeKindList, shared || nodePtr->sharedPtr);
     }
 }
 /*
@@ -1097,7 +1373,7 @@ void iterate(_YangNode *nodePtr, void* handler, ...) {
         nodeKindList[cnt] = value;
     }
     va_end(ap);
-    _iterate(nodePtr, handler, nodeKindList);
+    _iterate(nodePtr, handler, nodeKindList, 0);
 }
 
 void semanticAnalysis(_YangNode *module) {
@@ -1115,9 +1391,9 @@ void semanticAnalysis(_YangNode *module) {
      */
     validateConfigProperties(module, 1, 0);
     
-    validateDefaultStatements(module);
+    validateDefaultStatements(module, NULL);
 
-    validateLists(module);
+    validateLists(module, 0);
     
     uniqueNames(module);
 
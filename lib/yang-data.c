@@ -128,6 +128,21 @@ void setReference(_YangNode *nodePtr, char *reference)
     nodePtr->export.reference = smiStrdup(reference);
 }
 
+/*
+ * A reference node created by the expansion of a grouping or an augment
+ * shares its value with the original node, so it gets its own copy the
+ * first time the value is changed.
+ */
+void setValue(_YangNode *nodePtr, char *value)
+{
+    if (nodePtr->nodeType == YANG_NODE_ORIGINAL || nodePtr->privateValue) {
+        smiFree(nodePtr->export.value);
+    } else {
+        nodePtr->privateValue = 1;
+    }
+    nodePtr->export.value = smiStrdup(value);
+}
+
 /*
  * Node uniqueness validation
  */
@@ -150,7 +165,7 @@ int getCardinality(_YangNode *nodePtr, YangDecl nodeKind)
 {
     _YangNode *childPtr = NULL;
     int ret = 0;
-    for (childPtr = nodePtr->firstChildPtr; childPtr; childPtr = childPtr->nextSiblingPtr) {
+    for (childPtr = getFirstChildNode(nodePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
         if (childPtr->export.nodeKind == nodeKind) {
             ret++;
         }
@@ -168,6 +183,164 @@ _YangModuleInfo* getModuleInfo(_YangNode* module) {
     return (_YangModuleInfo*)module->info;
 }
 
+/* ----------------------------------------------------------------------
+ *
+ *  Indexes of definitions and modules
+ *
+ * ----------------------------------------------------------------------
+ */
+
+/*
+ * Scopes with fewer children are searched linearly and get no index.
+ */
+#define YANG_INDEX_MIN_CHILDREN 8
+
+static int isIndexedKind(YangDecl nodeKind) {
+    return nodeKind == YANG_DECL_TYPEDEF ||
+           nodeKind == YANG_DECL_GROUPING ||
+           nodeKind == YANG_DECL_IDENTITY ||
+           nodeKind == YANG_DECL_FEATURE ||
+           nodeKind == YANG_DECL_EXTENSION ||
+           nodeKind == YANG_DECL_MODULE ||
+           nodeKind == YANG_DECL_SUBMODULE;
+}
+
+/*
+ * Modules and submodules share one name space.
+ */
+static YangDecl namespaceKind(YangDecl nodeKind) {
+    if (nodeKind == YANG_DECL_SUBMODULE) {
+        return YANG_DECL_MODULE;
+    }
+    return nodeKind;
+}
+
+static YangDecl indexKind(_YangNode *nodePtr) {
+    return namespaceKind(nodePtr->export.nodeKind);
+}
+
+static unsigned int hashIndexKey(YangDecl nodeKind, const char *value) {
+    unsigned int h = 2166136261U;
+    for (; *value; value++) {
+        h = (h ^ (unsigned char) *value) * 16777619U;
+    }
+    h = (h ^ (unsigned int) nodeKind) * 16777619U;
+    return h ^ (h >> 16);
+}
+
+static _YangNode **findIndexSlot(_YangIndex *indexPtr, YangDecl nodeKind, const char *value) {
+    int i = hashIndexKey(nodeKind, value) & (indexPtr->size - 1);
+    while (indexPtr->slots[i]) {
+        _YangNode *nodePtr = indexPtr->slots[i];
+        if (indexKind(nodePtr) == nodeKind && !strcmp(nodePtr->export.value, value)) {
+            break;
+        }
+        i = (i + 1) & (indexPtr->size - 1);
+    }
+    return &indexPtr->slots[i];
+}
+
+static void growIndex(_YangIndex *indexPtr) {
+    _YangNode **oldSlots = indexPtr->slots;
+    int i, oldSize = indexPtr->size;
+
+    indexPtr->size = oldSize ? 2 * oldSize : 4 * YANG_INDEX_MIN_CHILDREN;
+    indexPtr->slots = smiMalloc(indexPtr->size * sizeof(_YangNode*));
+    for (i = 0; i < oldSize; i++) {
+        if (oldSlots[i]) {
+            *findIndexSlot(indexPtr, indexKind(oldSlots[i]), oldSlots[i]->export.value) = oldSlots[i];
+        }
+    }
+    smiFree(oldSlots);
+}
+
+/*
+ * Add the nodes appended to the list starting at firstPtr since the
+ * last update. The first of several nodes with the same kind and name
+ * is kept, so that a lookup finds the same node as a linear search.
+ */
+static void updateIndex(_YangIndex *indexPtr, _YangNode *firstPtr) {
+    _YangNode *nodePtr, **slotPtr;
+
+    nodePtr = indexPtr->lastIndexedPtr ? indexPtr->lastIndexedPtr->nextSiblingPtr : firstPtr;
+    for (; nodePtr; nodePtr = nodePtr->nextSiblingPtr) {
+        indexPtr->lastIndexedPtr = nodePtr;
+        if (!isIndexedKind(nodePtr->export.nodeKind) || !nodePtr->export.value) {
+            continue;
+        }
+        if (2 * (indexPtr->count + 1) > indexPtr->size) {
+            growIndex(indexPtr);
+        }
+        slotPtr = findIndexSlot(indexPtr, indexKind(nodePtr), nodePtr->export.value);
+        if (!*slotPtr) {
+            *slotPtr = nodePtr;
+            indexPtr->count++;
+        }
+    }
+}
+
+static _YangNode *lookupIndex(_YangIndex *indexPtr, YangDecl nodeKind, const char *value) {
+    if (!indexPtr->size) return NULL;
+    return *findIndexSlot(indexPtr, nodeKind, value);
+}
+
+static void freeIndex(_YangIndex *indexPtr) {
+    if (!indexPtr) return;
+    smiFree(indexPtr->slots);
+    smiFree(indexPtr);
+}
+
+/*
+ * Find a definition of the given kind and name among the children of
+ * nodePtr. Large scopes get an index at the first lookup. The children
+ * of a reference node are indexed with the node they are shared with.
+ * Both searches treat a module and a submodule as the same kind.
+ */
+static _YangNode *findDefinition(_YangNode *nodePtr, YangDecl nodeKind, const char *value) {
+    nodeKind = namespaceKind(nodeKind);
+    while (nodePtr->sharedPtr) {
+        nodePtr = nodePtr->sharedPtr;
+    }
+    if (!nodePtr->indexPtr) {
+        _YangNode *childPtr;
+        int count = 0;
+        for (childPtr = nodePtr->firstChildPtr; childPtr; childPtr = childPtr->nextSiblingPtr, count++) {
+            if (indexKind(childPtr) == nodeKind && childPtr->export.value
+                && !strcmp(childPtr->export.value, value)) {
+                return childPtr;
+            }
+        }
+        if (count < YANG_INDEX_MIN_CHILDREN) {
+            return NULL;
+        }
+        nodePtr->indexPtr = smiMalloc(sizeof(_YangIndex));
+    }
+    updateIndex(nodePtr->indexPtr, nodePtr->firstChildPtr);
+    return lookupIndex(nodePtr->indexPtr, nodeKind, value);
+}
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * addYangModule --
+ *
+ *      Append a module or submodule to the list of YANG modules.
+ *
+ * Side effects:
+ *      The module can be found by findYangModuleByName().
+ *
+ *----------------------------------------------------------------------
+ */
+void addYangModule(_YangNode *modulePtr)
+{
+    if (smiHandle->lastYangModulePtr) {
+        smiHandle->lastYangModulePtr->nextSiblingPtr = modulePtr;
+    } else {
+        smiHandle->firstYangModulePtr = modulePtr;
+    }
+    smiHandle->lastYangModulePtr = modulePtr;
+}
+
 /*
  *----------------------------------------------------------------------
  *
@@ -190,21 +363,18 @@ _YangNode *findYangModuleByName(const char *modulename, char* revision)
 {
     _YangNode	*modulePtr;
     
-    for (modulePtr = smiHandle->firstYangModulePtr; modulePtr; modulePtr = modulePtr->nextSiblingPtr) {
-        if ((modulePtr->export.value) && !strcmp(modulePtr->export.value, modulename)) {
-            if (!revision) {
-                return (modulePtr);
-            } else {
-                _YangNode* revisionNodePtr = findChildNodeByType(modulePtr, YANG_DECL_REVISION);
-                if (revisionNodePtr) {
-                    if (!strcmp(revision, revisionNodePtr->export.value)) {
-                        return modulePtr;
-                    }
-                }
-            }
+    if (!smiHandle->yangModuleIndexPtr) {
+        smiHandle->yangModuleIndexPtr = smiMalloc(sizeof(_YangIndex));
+    }
+    updateIndex(smiHandle->yangModuleIndexPtr, smiHandle->firstYangModulePtr);
+    modulePtr = lookupIndex(smiHandle->yangModuleIndexPtr, YANG_DECL_MODULE, modulename);
+    if (modulePtr && revision) {
+        _YangNode* revisionNodePtr = findChildNodeByType(modulePtr, YANG_DECL_REVISION);
+        if (!revisionNodePtr || strcmp(revision, revisionNodePtr->export.value)) {
+            return (NULL);
         }
     }
-    return (NULL);
+    return (modulePtr);
 }
 
 
@@ -235,6 +405,31 @@ _YangNode *findYangModuleByPrefix(_YangNode *module, const char *prefix)
     }
     return (NULL);
 }
+/*
+ *----------------------------------------------------------------------
+ *
+ * getFirstChildNode --
+ *
+ *      Get the first child of a node. A reference node created by the
+ *      expansion of a grouping or an augment shares the children of
+ *      the node it refers to until they are changed.
+ *
+ * Results:
+ *      A pointer to the _YangNode structure or
+ *      NULL if the node has no children.
+ *
+ * Side effects:
+ *      None.
+ *
+ *----------------------------------------------------------------------
+ */
+_YangNode *getFirstChildNode(_YangNode *nodePtr) {
+    while (nodePtr->sharedPtr) {
+        nodePtr = nodePtr->sharedPtr;
+    }
+    return nodePtr->firstChildPtr;
+}
+
 /*
  *----------------------------------------------------------------------
  *
@@ -253,7 +448,7 @@ _YangNode *findYangModuleByPrefix(_YangNode *module, const char *prefix)
  */
 _YangNode* findChildNodeByType(_YangNode *nodePtr, YangDecl nodeKind) {
     _YangNode *childPtr = NULL;
-    for (childPtr = nodePtr->firstChildPtr; childPtr; childPtr = childPtr->nextSiblingPtr) {
+    for (childPtr = getFirstChildNode(nodePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
         if (childPtr->export.nodeKind == nodeKind) {
             return childPtr;
         }
@@ -279,7 +474,10 @@ _YangNode* findChildNodeByType(_YangNode *nodePtr, YangDecl nodeKind) {
  */
 _YangNode* findChildNodeByTypeAndValue(_YangNode *nodePtr, YangDecl nodeKind, char* value) {
     _YangNode *childPtr = NULL;
-    for (childPtr = nodePtr->firstChildPtr; childPtr; childPtr = childPtr->nextSiblingPtr) {
+    if (isIndexedKind(nodeKind)) {
+        return findDefinition(nodePtr, nodeKind, value);
+    }
+    for (childPtr = getFirstChildNode(nodePtr); childPtr; childPtr = childPtr->nextSiblingPtr) {
         if (childPtr->export.nodeKind == nodeKind && !strcmp(childPtr->export.value, value)) {
             return childPtr;
         }
@@ -305,12 +503,8 @@ _YangNode* findChildNodeByTypeAndValue(_YangNode *nodePtr, YangDecl nodeKind, ch
  */
 _YangNode* resolveNodeByTypeAndValue(_YangNode *nodePtr, YangDecl nodeKind, char* value, int depth) {
     if (depth < 0) return NULL;
-    _YangNode *childPtr = NULL;
-    for (childPtr = nodePtr->firstChildPtr; childPtr; childPtr = childPtr->nextSiblingPtr) {
-        if (childPtr->export.nodeKind == nodeKind && !strcmp(childPtr->export.value, value)) {
-            return childPtr;
-        }
-    }
+    _YangNode *childPtr = findChildNodeByTypeAndValue(nodePtr, nodeKind, value);
+    if (childPtr) return childPtr;
     if (nodePtr->parentPtr) {
         _YangNode *ret = resolveNodeByTypeAndValue(nodePtr->parentPtr, nodeKind, value, depth);
         if (ret) return ret;
@@ -430,6 +624,7 @@ _YangNode *addYangNode(const char *value, YangDecl nodeKind, _YangNode *parentPt
     node->firstChildPtr         = NULL;
     node->lastChildPtr          = NULL;
     node->parentPtr             = parentPtr;
+    node->indexPtr              = NULL;
 
 	if(parentPtr)
 	{
@@ -459,14 +654,115 @@ _YangNode *addYangNode(const char *value, YangDecl nodeKind, _YangNode *parentPt
 }
 
 
+/*
+ *----------------------------------------------------------------------
+ *
+ * readYangModule --
+ *
+ *      Parse a YANG module from its text. The path is consumed, the
+ *	text is left to the caller.
+ *
+ *----------------------------------------------------------------------
+ */
+
+_YangNode *readYangModule(char *path, ModuleText *text, Parser *parserPtr)
+{
+#ifdef BACKEND_YANG
+    Parser      *parser;
+    Parser      *parentParserPtr;
+    int         depth;
+#endif
+
+    if (getLanguage(text->data, text->len) != SMI_LANGUAGE_YANG) {
+        smiPrintError(parserPtr, ERR_ILLEGAL_INPUTFILE, path);
+        smiFree(path);
+        return NULL;
+    }
+
+#ifdef BACKEND_YANG
+	parser = smiMalloc(sizeof(Parser));
+	parentParserPtr = smiHandle->parserPtr;
+	smiHandle->parserPtr = parser;
+    /* 
+     *  Initialization of the parser;
+     *  In YANG we don't use most of these fields of the Parser
+     */
+	parser->path			= path;
+	parser->flags			= smiHandle->flags;
+	parser->modulePtr		= NULL;
+	parser->complianceModulePtr	= NULL;
+	parser->capabilitiesModulePtr	= NULL;
+	parser->currentDecl              = SMI_DECL_UNKNOWN;
+	parser->firstStatementLine       = 0;
+	parser->firstNestedStatementLine = 0;
+	parser->firstRevisionLine        = 0;
+    parser->yangModulePtr            = NULL;
+	parser->file			= NULL;
+
+    
+	depth = yangEnterLexRecursion(text->data, text->len,
+				      text->storage != MODULE_TEXT_BORROWED);
+	if (depth < 0) {
+	    smiPrintError(parser, ERR_MAX_LEX_DEPTH);
+	}
+	smiDepth++;
+	parser->line			= 1;
+	yangparse(parser);
+	yangLeaveLexRecursion();
+	smiDepth--;
+	smiHandle->parserPtr = parentParserPtr;
+
+    if (parser->yangModulePtr) {
+        ((_YangModuleInfo*)(parser->yangModulePtr->info))->conformance = parser->modulePtr->export.conformance;
+        ((_YangModuleInfo*)(parser->yangModulePtr->info))->parser = parser;
+        return parser->yangModulePtr;
+    } else {
+        smiFree(path);
+        smiFree(parser);
+        return NULL;
+    }
+#else
+	smiPrintError(parserPtr, ERR_YANG_NOT_SUPPORTED, path);
+	smiFree(path);
+   
+	return NULL;
+#endif
+}
+
+
+/*
+ *----------------------------------------------------------------------
+ *
+ * loadYangModuleFromBuffer --
+ *
+ *      Load a YANG module from a memory buffer. The name is used in
+ *	place of a path in error messages and as the path of the module.
+ *
+ *----------------------------------------------------------------------
+ */
+
+_YangNode *loadYangModuleFromBuffer(const char *name, const char *data,
+                                    size_t len, Parser *parserPtr)
+{
+    ModuleText  text;
+
+    text.data = (char *) data;
+    text.len = len;
+    text.storage = MODULE_TEXT_BORROWED;
+    return readYangModule(smiStrdup(name), &text, parserPtr);
+}
+
+
 /*
  *----------------------------------------------------------------------
  *
  * loadYangModule --
  *
- *      Load a YANG module. If modulename is a plain name, the file is
- *	search along the SMIPATH environment variable. If modulename
- *	contains a `.' or DIR_SEPARATOR it is assumed to be the path.
+ *      Load a YANG module. The module resolver, if any, is asked
+ *	first. Otherwise, if modulename is a plain name, the file or
+ *	bundle entry is search along the SMIPATH environment variable.
+ *	If modulename contains a `.' or DIR_SEPARATOR it is assumed to
+ *	be the path.
  *
  *
  *----------------------------------------------------------------------
@@ -475,14 +771,19 @@ _YangNode *addYangNode(const char *value, YangDecl nodeKind, _YangNode *parentPt
 
 _YangNode *loadYangModule(const char *modulename, const char * revision, Parser *parserPtr)
 {
-    Parser	    *parser = smiMalloc(sizeof(Parser));
-    Parser      *parentParserPtr;
+    _YangNode   *yangModulePtr;
     char	    *path = NULL;
-    SmiLanguage lang = 0;
-    FILE	    *file;
+    ModuleText  text;
+    const char  *data;
+    size_t      len;
     char* name[2], *revisionPart = NULL;
     int index = 1;
 
+    memset(&text, 0, sizeof(text));
+    if (resolveModule(modulename, &data, &len)) {
+        return loadYangModuleFromBuffer(modulename, data, len, parserPtr);
+    }
+
     if (revision) {
         smiAsprintf(&name[0], "%s%s", modulename, "%s");
         smiAsprintf(&revisionPart, ".%s", revision);
@@ -492,7 +793,14 @@ _YangNode *loadYangModule(const char *modulename, const char * revision, Parser
     
     int nameIndex = 0;
     while (nameIndex < index) {        
-        path = getModulePath(name[nameIndex]);
+        path = locateModule(name[nameIndex], &data, &len);
+        if (data) {
+            /* found in a bundle */
+            text.data = (char *) data;
+            text.len = len;
+            text.storage = MODULE_TEXT_BORROWED;
+            break;
+        }
         if (path && revision) {
             smiAsprintf(&path, "%s%s", path, revisionPart);
         }
@@ -523,8 +831,7 @@ _YangNode *loadYangModule(const char *modulename, const char * revision, Parser
             }
         }
         if (path) {
-            file = fopen(path, "r");
-            if (file) {
+            if (readModuleText(path, &text) == 0) {
                 break;
             }
         }        
@@ -536,74 +843,15 @@ _YangNode *loadYangModule(const char *modulename, const char * revision, Parser
         return NULL;
     }
 
-    parser->path			= path;
-    file = fopen(path, "r");
-    if (! file) {
+    if (!text.data) {
         smiPrintError(parserPtr, ERR_OPENING_INPUTFILE, path, strerror(errno));
         smiFree(path);
         return NULL;
     }
-    lang = getLanguage(file);
-
-    if (lang != SMI_LANGUAGE_YANG) {
-        smiPrintError(parserPtr, ERR_ILLEGAL_INPUTFILE, path);
-        smiFree(path);
-        fclose(file);
-        return NULL;
-    }
-
-#ifdef BACKEND_YANG
-	parentParserPtr = smiHandle->parserPtr;
-	smiHandle->parserPtr = parser;
-    /* 
-     *  Initialization of the parser;
-     *  In YANG we don't use most of these fields of the Parser
-     */
-	parser->path			= path;
-	parser->flags			= smiHandle->flags;
-	parser->modulePtr		= NULL;
-	parser->complianceModulePtr	= NULL;
-	parser->capabilitiesModulePtr	= NULL;
-	parser->currentDecl              = SMI_DECL_UNKNOWN;
-	parser->firstStatementLine       = 0;
-	parser->firstNestedStatementLine = 0;
-	parser->firstRevisionLine        = 0;
-    parser->yangModulePtr            = NULL;
-	parser->file			= file;
 
-    
-	if (yangEnterLexRecursion(parser->file) < 0) {
-	    smiPrintError(parser, ERR_MAX_LEX_DEPTH);
-	    fclose(parser->file);
-	}
-	smiDepth++;
-	parser->line			= 1;
-	yangparse(parser);
-	yangLeaveLexRecursion();
-	smiDepth--;
-	fclose(parser->file);
-	smiHandle->parserPtr = parentParserPtr;
-
-    if (parser->yangModulePtr) {
-        ((_YangModuleInfo*)(parser->yangModulePtr->info))->conformance = parser->modulePtr->export.conformance;
-        ((_YangModuleInfo*)(parser->yangModulePtr->info))->parser = parser;
-        return parser->yangModulePtr;
-    } else {
-        smiFree(path);
-        smiFree(parser);
-        return NULL;
-    }
-#else
-	smiPrintError(parserPtr, ERR_YANG_NOT_SUPPORTED, path);
-	smiFree(path);
-    fclose(file);
-   
-	return NULL;
-#endif
-
-    smiFree(path);
-    fclose(file);
-    return NULL;
+    yangModulePtr = readYangModule(path, &text, parserPtr);
+    closeModuleText(&text);
+    return yangModulePtr;
 }
 
 /*
@@ -738,6 +986,7 @@ _YangNode *copyModule(_YangNode *nodePtr) {
     node->lastChildPtr          = NULL;
     node->parentPtr             = NULL;
     node->modulePtr             = NULL;
+    node->indexPtr              = NULL;
 
     _YangNode *childPtr         = nodePtr->firstChildPtr;
     while (childPtr) {
@@ -836,6 +1085,9 @@ void freeYangNode(_YangNode *nodePtr) {
          */
         nodePtr->export.description = NULL;
         nodePtr->export.reference = NULL;        
+    } else if (nodePtr->privateValue) {
+        smiFree(nodePtr->export.value);
+        nodePtr->export.value = NULL;
     }
 
     _YangNode *currentNode= nodePtr->firstChildPtr, *nextNode;
@@ -845,6 +1097,7 @@ void freeYangNode(_YangNode *nodePtr) {
         currentNode = nextNode;
     }
 
+    freeIndex(nodePtr->indexPtr);
     smiFree(nodePtr);
     nodePtr = NULL;
 }
@@ -862,10 +1115,15 @@ void freeYangNode(_YangNode *nodePtr) {
  *----------------------------------------------------------------------
  */
 void yangFreeData() {
-    _YangNode	*modulePtr;
-    for (modulePtr = smiHandle->firstYangModulePtr; modulePtr; modulePtr = modulePtr->nextSiblingPtr) {
+    _YangNode	*modulePtr, *nextModulePtr;
+    for (modulePtr = smiHandle->firstYangModulePtr; modulePtr; modulePtr = nextModulePtr) {
+        nextModulePtr = modulePtr->nextSiblingPtr;
         freeYangNode(modulePtr);
     }    
+    freeIndex(smiHandle->yangModuleIndexPtr);
+    smiHandle->yangModuleIndexPtr = NULL;
+    smiHandle->firstYangModulePtr = NULL;
+    smiHandle->lastYangModulePtr = NULL;
 }
 
 int isDataDefNode(_YangNode* nodePtr) {
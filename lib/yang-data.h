@@ -56,9 +56,26 @@ typedef struct _YangTypeInfo {
     struct _YangNode   *baseTypeNodePtr;
 } _YangTypeInfo;
 
+/*
+ * An index of nodes by statement kind and name, used to resolve the
+ * definitions of a scope and the loaded modules. Nodes are only ever
+ * appended to a list of siblings, so an index is brought up to date
+ * by adding the nodes behind lastIndexedPtr.
+ */
+typedef struct _YangIndex {
+    struct _YangNode    **slots;
+    int                 size;
+    int                 count;
+    struct _YangNode    *lastIndexedPtr;
+} _YangIndex;
+
 typedef struct _YangNode {
     YangNode            export;
     YangNodeType        nodeType;
+    /* set if a reference node no longer shares export.value */
+    int                 privateValue;
+    /* the node whose children a reference node shares, until it is changed */
+    struct _YangNode    *sharedPtr;
     void                *info;
     int                 line;
 
@@ -70,6 +87,9 @@ typedef struct _YangNode {
     struct _YangNode  	*nextSiblingPtr;
     struct _YangNode  	*parentPtr;
     struct _YangNode  	*modulePtr;
+
+    /* definitions among the children, created at the first lookup */
+    struct _YangIndex   *indexPtr;
 } _YangNode;
 
 /*
@@ -152,10 +172,14 @@ _YangModuleInfo *createModuleInfo(_YangNode *modulePtr);
 
 _YangTypeInfo createTypeInfo(_YangNode *node);
 
+void addYangModule(_YangNode *modulePtr);
+
 _YangNode *findYangModuleByName(const char *modulename, char* revision);
 
 _YangNode *findYangModuleByPrefix(_YangNode *module, const char *prefix);
 
+_YangNode *getFirstChildNode(_YangNode *nodePtr);
+
 _YangNode* findChildNodeByType(_YangNode *nodePtr, YangDecl nodeKind);
 
 _YangNode* findChildNodeByTypeAndValue(_YangNode *nodePtr, YangDecl nodeKind, char* value);
@@ -178,6 +202,8 @@ void setDescription(_YangNode *nodePtr, char *description);
 
 void setReference(_YangNode *nodePtr, char *reference);
 
+void setValue(_YangNode *nodePtr, char *value);
+
 /*
  * Node uniqueness validation
  */
@@ -134,7 +134,7 @@ YangNode* yangGetModule(char *modulename) {
 YangNode *yangGetFirstChildNode(YangNode *yangNodePtr) {
     _YangNode *nodePtr = (_YangNode *)yangNodePtr;
     if (!nodePtr) return NULL;
-    nodePtr = nodePtr->firstChildPtr;
+    nodePtr = getFirstChildNode(nodePtr);
 
     if (!nodePtr) {
         return NULL;
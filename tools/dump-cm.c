@@ -1118,10 +1118,7 @@ static void dumpCm(int modc, SmiModule **modv, int flags, char *output)
 
     if (flags & SMIDUMP_FLAG_UNITE) {
 	if (! graph) {
-	    graph = xmalloc(sizeof(Graph));
-	    graph->nodes = NULL;
-	    graph->edges = NULL;
-	    graph->components = NULL;
+	    graph = graphCreate();
 	}
 	
 	for (i = 0; i < modc; i++) {
@@ -1149,10 +1146,7 @@ static void dumpCm(int modc, SmiModule **modv, int flags, char *output)
     } else {
 	for (i = 0; i < modc; i++) {
 	    if (! graph) {
-		graph = xmalloc(sizeof(Graph));
-		graph->nodes = NULL;
-		graph->edges = NULL;
-		graph->components = NULL;
+		graph = graphCreate();
 	    }
 	    
 	    algCreateNodes(modv[i]);
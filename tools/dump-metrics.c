@@ -24,6 +24,7 @@
 #include <config.h>
 
 #include <stdio.h>
+#include <stddef.h>
 #include <string.h>
 
 #include "smi.h"
@@ -32,6 +33,8 @@
 
 static int raw = 0;
 
+static char *format = NULL;
+
 static int silent = 0;
 
 
@@ -133,7 +136,14 @@ typedef struct RowStatusCounter {
 
 
 
+/*
+ * All members of a Metrics structure are unsigned long counters so
+ * that the metrics of several modules can be summed up element-wise
+ * (see sumMetrics()).
+ */
+
 typedef struct Metrics {
+    unsigned long   size;
     BasetypeCounter basetypesColumns;
     BasetypeCounter basetypesScalars;
     BasetypeCounter basetypesAll;
@@ -160,6 +170,7 @@ typedef struct Metrics {
     LengthCounter   lengthScalars;
     LengthCounter   lengthNotifications;
     LengthCounter   lengthAll;
+    RowStatusCounter rowStatus;
 } Metrics;
 
 
@@ -169,14 +180,30 @@ typedef struct UsageCounter {
     char     *name;
     unsigned count;
     struct UsageCounter *nextPtr;
+    struct UsageCounter *nextHashPtr;
 } UsageCounter;
 
 
-static UsageCounter *typeList = NULL;
-static UsageCounter *extTypeList = NULL;
-static UsageCounter *extNodeList = NULL;
-static UsageCounter *extModuleList = NULL;
-static UsageCounter *indexComplexityList = NULL;
+
+/*
+ * The usage counters are kept in a list (for printing) and in a hash
+ * table keyed by the module and the name (for counting), which grows
+ * when it gets crowded.
+ */
+
+typedef struct UsageTable {
+    UsageCounter *list;
+    UsageCounter **buckets;
+    unsigned int size;
+    unsigned int count;
+} UsageTable;
+
+
+static UsageTable typeTable;
+static UsageTable extTypeTable;
+static UsageTable extNodeTable;
+static UsageTable extModuleTable;
+static UsageTable indexComplexityTable;
 
 #define INCR_NODE 0x01
 #define INCR_TYPE 0x02
@@ -211,41 +238,6 @@ language(SmiLanguage language)
 
 
 
-static int
-calcSize(SmiModule *smiModule)
-{
-    SmiNode *smiNode;
-    SmiType *smiType;
-    int size = 0;
-    
-    for (smiType = smiGetFirstType(smiModule);
-	 smiType;
-	 smiType = smiGetNextType(smiType)) {
-	if (smiType->name) {
-	    size++;
-	}
-    }
-    
-    for (smiNode = smiGetFirstNode(smiModule, SMI_NODEKIND_ANY);
-	 smiNode;
-	 smiNode = smiGetNextNode(smiNode, SMI_NODEKIND_ANY)) {
-
-	switch (smiNode->nodekind) {
-	case SMI_NODEKIND_SCALAR:
-	case SMI_NODEKIND_COLUMN:
-	case SMI_NODEKIND_NOTIFICATION:
-	    size++;
-	    break;
-	default:
-	    break;
-	}
-    }
-
-    return size;
-}
-
-
-
 typedef void	(*ForEachIndexFunc)	(FILE *f, SmiNode *groupNode, SmiNode *smiNode, void *data);
 
 static void
@@ -281,14 +273,59 @@ foreachIndexDo(FILE *f, SmiNode *smiNode, ForEachIndexFunc func, void *data)
 
 
 
-static UsageCounter*
-incrUsageCounter(UsageCounter *uCntList, char *module, char *name, int incr)
+static unsigned int
+hashUsage(const char *module, const char *name)
+{
+    unsigned int h = 0;
+    const char *p;
+
+    for (p = module; *p; p++) {
+	h = h * 31 + (unsigned char) *p;
+    }
+    if (name) {
+	h = h * 31 + ':';
+	for (p = name; *p; p++) {
+	    h = h * 31 + (unsigned char) *p;
+	}
+    }
+    return h;
+}
+
+
+
+static void
+resizeUsageTable(UsageTable *table, unsigned int size)
+{
+    UsageCounter *uCnt;
+    unsigned int h;
+
+    xfree(table->buckets);
+    table->buckets = (UsageCounter **) xcalloc(size, sizeof(UsageCounter *));
+    table->size = size;
+    for (uCnt = table->list; uCnt; uCnt = uCnt->nextPtr) {
+	h = hashUsage(uCnt->module, uCnt->name) % size;
+	uCnt->nextHashPtr = table->buckets[h];
+	table->buckets[h] = uCnt;
+    }
+}
+
+
+
+static void
+incrUsageCounter(UsageTable *table, char *module, char *name, int incr)
 {
     UsageCounter *uCnt;
+    unsigned int h;
 
-    for (uCnt = uCntList; uCnt; uCnt = uCnt->nextPtr) {
+    if (! table->size) {
+	resizeUsageTable(table, 64);
+    }
+
+    h = hashUsage(module, name) % table->size;
+    for (uCnt = table->buckets[h]; uCnt; uCnt = uCnt->nextHashPtr) {
 	if (strcmp(uCnt->module, module) == 0
-	    && (! name || strcmp(uCnt->name, name) == 0)) {
+	    && (name ? (uCnt->name && strcmp(uCnt->name, name) == 0)
+		: ! uCnt->name)) {
 	    break;
 	}
     }
@@ -298,12 +335,16 @@ incrUsageCounter(UsageCounter *uCntList, char *module, char *name, int incr)
 	uCnt->module = xstrdup(module);
 	uCnt->name = name ? xstrdup(name) : NULL;
 	uCnt->count = 0;
-	uCnt->nextPtr = uCntList;
-	uCntList = uCnt;
+	uCnt->nextPtr = table->list;
+	table->list = uCnt;
+	uCnt->nextHashPtr = table->buckets[h];
+	table->buckets[h] = uCnt;
+	if (++table->count > 2 * table->size) {
+	    resizeUsageTable(table, 4 * table->size);
+	}
     }
 
     uCnt->count += incr;
-    return uCntList;
 }
 
 
@@ -323,9 +364,8 @@ incrTypeAndNodeUsageCounter(SmiModule *smiModule, SmiNode *smiNode, int flags)
     if (extModule
 	&& strcmp(extModule, smiModule->name) != 0) {
 	if (flags & INCR_NODE) {
-	    extNodeList = incrUsageCounter(extNodeList,
-					   extModule, smiNode->name, 1);
-	    extModuleList = incrUsageCounter(extModuleList, extModule, NULL, 1);
+	    incrUsageCounter(&extNodeTable, extModule, smiNode->name, 1);
+	    incrUsageCounter(&extModuleTable, extModule, NULL, 1);
 	}
 	return;
     }
@@ -346,9 +386,8 @@ incrTypeAndNodeUsageCounter(SmiModule *smiModule, SmiNode *smiNode, int flags)
 	if (extModule /* && *extModule */
 	    && strcmp(extModule, smiModule->name) != 0) {
 	    if (flags & INCR_TYPE) {
-		extTypeList = incrUsageCounter(extTypeList,
-					       extModule, smiType->name, 1);
-		extModuleList = incrUsageCounter(extModuleList, extModule, NULL, 1);
+		incrUsageCounter(&extTypeTable, extModule, smiType->name, 1);
+		incrUsageCounter(&extModuleTable, extModule, NULL, 1);
 	    }
 	}
     }
@@ -362,8 +401,8 @@ incrTypeAndNodeUsageCounter(SmiModule *smiModule, SmiNode *smiNode, int flags)
     if (! smiType->name && smiGetParentType(smiType)) {
 	smiType = smiGetParentType(smiType);
     }
-    typeList = incrUsageCounter(typeList, smiGetTypeModule(smiType)->name,
-				smiType->name, 1);
+    incrUsageCounter(&typeTable, smiGetTypeModule(smiType)->name,
+		     smiType->name, 1);
 }
 
 
@@ -371,8 +410,8 @@ incrTypeAndNodeUsageCounter(SmiModule *smiModule, SmiNode *smiNode, int flags)
 static void
 incrIndexComplexityCounter(SmiModule *smiModule, SmiNode *smiNode, int complexity)
 {
-    indexComplexityList = incrUsageCounter(indexComplexityList,
-					   smiModule->name, smiNode->name, complexity);
+    incrUsageCounter(&indexComplexityTable,
+		     smiModule->name, smiNode->name, complexity);
 }
 
 
@@ -434,7 +473,7 @@ fprintRevisions(FILE *f, int modLen, SmiRevision *smiRevision,
 
 
 static void
-fprintRevision(FILE *f, int modc, SmiModule **modv)
+fprintRevision(FILE *f, int modc, SmiModule **modv, Metrics *metv)
 {
     int i;
     int modLen = 8;
@@ -449,7 +488,7 @@ fprintRevision(FILE *f, int modc, SmiModule **modv)
 
     for (i = 0; i < modc; i++) {
 	fprintRevisions(f, modLen, smiGetFirstRevision(modv[i]),
-			modv[i], calcSize(modv[i]));
+			modv[i], (int) metv[i].size);
     }
     fprintf(f, "\n");
  
@@ -742,16 +781,18 @@ fprintIndexComplexity(FILE *f, UsageCounter *modUsageList)
 
 
 static void
-freeUsageCounter(UsageCounter *usageCounterList)
+freeUsageCounter(UsageTable *table)
 {
     UsageCounter *uCnt, *p;
     
-    for (uCnt = usageCounterList; uCnt; ) {
+    for (uCnt = table->list; uCnt; ) {
 	p = uCnt, uCnt = uCnt->nextPtr;
 	xfree(p->module);
 	xfree(p->name);
 	xfree(p);
     }
+    xfree(table->buckets);
+    memset(table, 0, sizeof(UsageTable));
 }
 
 
@@ -954,54 +995,34 @@ incrLengthCounter(LengthCounter *cnt, char *description, char *reference,
 
 
 
-static void
-incrRowStatusCounter(SmiNode *rowNode)
-{
-    SmiNode *smiNode;
-    SmiType *smiType;
-    SmiModule *smiModule;
-
-    for (smiNode = smiGetFirstChildNode(rowNode);
-	 smiNode;
-	 smiNode = smiGetNextChildNode(smiNode)) {
-	smiType = smiGetNodeType(smiNode);
-	if (smiType && smiType->name) {
-	    smiModule = smiGetTypeModule(smiType);
-	    if (smiModule && smiModule->name
-		&& strcmp(smiType->name, "RowStatus") == 0
-		&& strcmp(smiModule->name, "SNMPv2-TC") == 0) {
-		break;
-	    }
-	}
-    }
-
-    if (smiNode) {
-#if 0
-	fprintf(stderr, "** %s\t%s\t%s\n", rowNode->name,
-		smiNode->name, smiType->name);
-	/* xxx count rows indexed by ifIndex, InterfaceIndex, InterfaceIndexOrZero, ... */
-#endif
-    }
-}
-
-
-
-static void
-count(FILE *f, SmiNode *row, SmiNode *col, void *data)
-{
-    int *cnt = (int *) data;
+/*
+ * The per-row data gathered while walking the index elements of a
+ * row once: the number of elements and their complexity. The index
+ * elements are also counted as node and type references.
+ */
 
-    (*cnt)++;
-}
+typedef struct IndexData {
+    SmiModule *smiModule;
+    int len;
+    int complexity;
+} IndexData;
 
 
 
 static void
-complexity(FILE *f, SmiNode *row, SmiNode *col, void *data)
+indexMetrics(FILE *f, SmiNode *row, SmiNode *col, void *data)
 {
-    int *cmplx = (int *) data;
+    IndexData *indexData = (IndexData *) data;
     SmiType *smiType;
     unsigned long min, max;
+    int flags = INCR_NODE;
+
+    indexData->len++;
+
+    if (col->access == SMI_ACCESS_NOT_ACCESSIBLE) {
+	flags |= INCR_TYPE;
+    }
+    incrTypeAndNodeUsageCounter(indexData->smiModule, col, flags);
 
     smiType = smiGetNodeType(col);
     if (! smiType) {
@@ -1012,16 +1033,16 @@ complexity(FILE *f, SmiNode *row, SmiNode *col, void *data)
     case SMI_BASETYPE_INTEGER32:
     case SMI_BASETYPE_UNSIGNED32:
     case SMI_BASETYPE_ENUM:
-	*cmplx += 1;
+	indexData->complexity += 1;
 	break;
     case SMI_BASETYPE_OCTETSTRING:
     case SMI_BASETYPE_OBJECTIDENTIFIER:
     case SMI_BASETYPE_BITS:
-	*cmplx += 2;
+	indexData->complexity += 2;
 	min = smiGetMinSize(smiType);
 	max = smiGetMaxSize(smiType);
 	if (min != max) {
-	    *cmplx += 1;
+	    indexData->complexity += 1;
 	}
 	break;
     default:				/* ignore everything else */
@@ -1032,32 +1053,23 @@ complexity(FILE *f, SmiNode *row, SmiNode *col, void *data)
 
 
 static void
-yadayada(FILE *f, SmiNode *row, SmiNode *col, void *data)
+addMetrics(Metrics *metrics, SmiModule *smiModule)
 {
-    SmiModule *smiModule = (SmiModule *) data;
-    int flags = 0;
+    SmiNode *smiNode, *childNode;
+    SmiType *smiType, *rowStatus = NULL, *storageType = NULL;
+    SmiModule *tcModule;
+    IndexData indexData;
+    int n, hasRowStatus, hasStorageType;
 
-    if (col->access == SMI_ACCESS_NOT_ACCESSIBLE) {
-	flags |= INCR_TYPE;
+    tcModule = smiGetModule("SNMPv2-TC");
+    if (tcModule) {
+	rowStatus = smiGetType(tcModule, "RowStatus");
+	storageType = smiGetType(tcModule, "StorageType");
     }
-    flags |= INCR_NODE;
-
-    incrTypeAndNodeUsageCounter(smiModule, col, flags);
-}
-
-
-
-static void
-addMetrics(Metrics *metrics, SmiModule *smiModule)
-{
-    SmiNode *smiNode;
-    SmiType *smiType;
-    size_t len;
 
     for (smiNode = smiGetFirstNode(smiModule, SMI_NODEKIND_ANY);
 	 smiNode;
 	 smiNode = smiGetNextNode(smiNode, SMI_NODEKIND_ANY)) {
-	len = smiNode->description ? strlen(smiNode->description) : 0;
 	switch (smiNode->nodekind) {
 	case SMI_NODEKIND_TABLE:
 	    incrStatusCounter(&metrics->statusTables, smiNode->status);
@@ -1077,42 +1089,38 @@ addMetrics(Metrics *metrics, SmiModule *smiModule)
 	    incrLengthCounter(&metrics->lengthAll,
 			      smiNode->description, smiNode->reference,
 			      smiNode->units, smiNode->format);
-	    incrRowStatusCounter(smiNode);
-	    {
-		int cnt = 0;
-		foreachIndexDo(NULL, smiNode, count, &cnt);
-		incrIndexLenCounter(&metrics->indexLenTables, cnt);
-		foreachIndexDo(NULL, smiNode, yadayada, smiModule);
-	    }
-	    {
-		int cmplx = 0;
-		foreachIndexDo(NULL, smiNode, complexity, &cmplx);
-		incrIndexComplexityCounter(smiModule, smiNode, cmplx);
-		incrIndexComplexityMetric(&metrics->indexComplexity, cmplx);
+	    indexData.smiModule = smiModule;
+	    indexData.len = 0;
+	    indexData.complexity = 0;
+	    foreachIndexDo(NULL, smiNode, indexMetrics, &indexData);
+	    incrIndexLenCounter(&metrics->indexLenTables, indexData.len);
+	    incrIndexComplexityCounter(smiModule, smiNode,
+				       indexData.complexity);
+	    incrIndexComplexityMetric(&metrics->indexComplexity,
+				      indexData.complexity);
+	    /* count the childs (including index elements not in table) */
+	    n = hasRowStatus = hasStorageType = 0;
+	    for (childNode = smiGetFirstChildNode(smiNode);
+		 childNode;
+		 childNode = smiGetNextChildNode(childNode)) {
+		n++;
+		smiType = smiGetNodeType(childNode);
+		if (smiType && smiType == rowStatus) {
+		    hasRowStatus = 1;
+		}
+		if (smiType && smiType == storageType) {
+		    hasStorageType = 1;
+		}
 	    }
-	    /* count the childs ... */
-	    {
-		    SmiModule *smiModule = smiGetModule("SNMPv2-TC");
-		    SmiNode *childNode;
-		    SmiType *rowStatus = smiGetType(smiModule, "RowStatus");
-		    SmiType *storageType = smiGetType(smiModule, "StorageType");
-		    /* include index elements not in table */
-		    int n = 0;
-		    for (childNode = smiGetFirstChildNode(smiNode);
-			 childNode;
-			 childNode = smiGetNextChildNode(childNode)) {
-			    n++;
-			    if (rowStatus == smiGetNodeType(childNode)) {
-				    fprintf(stderr, "**** GEEEEEE - ROWSTATUS\n");
-			    }
-			    if (storageType == smiGetNodeType(childNode)) {
-				    fprintf(stderr, "**** GEEEEEE - STORAGETYPE\n");
-			    }
-		    }
-		    incrTableLenCounter(&metrics->tableLength, n);
+	    incrTableLenCounter(&metrics->tableLength, n);
+	    if (smiNode->indexkind == SMI_INDEX_INDEX) {
+		metrics->rowStatus.basetables++;
 	    }
+	    metrics->rowStatus.rowstatus += hasRowStatus;
+	    metrics->rowStatus.storagetype += hasStorageType;
 	    break;
 	case SMI_NODEKIND_COLUMN:
+	    metrics->size++;
 	    incrBasetypeCounter(&metrics->basetypesColumns, smiNode);
 	    incrBasetypeCounter(&metrics->basetypesAll, smiNode);
 	    incrStatusCounter(&metrics->statusColumns, smiNode->status);
@@ -1128,6 +1136,7 @@ addMetrics(Metrics *metrics, SmiModule *smiModule)
 	    incrTypeAndNodeUsageCounter(smiModule, smiNode, INCR_TYPE);
 	    break;
 	case SMI_NODEKIND_SCALAR:
+	    metrics->size++;
 	    incrBasetypeCounter(&metrics->basetypesScalars, smiNode);
 	    incrBasetypeCounter(&metrics->basetypesAll, smiNode);
 	    incrStatusCounter(&metrics->statusScalars, smiNode->status);
@@ -1143,6 +1152,7 @@ addMetrics(Metrics *metrics, SmiModule *smiModule)
 	    incrTypeAndNodeUsageCounter(smiModule, smiNode, INCR_TYPE);
 	    break;
 	case SMI_NODEKIND_NOTIFICATION:
+	    metrics->size++;
 	    incrStatusCounter(&metrics->statusNotifications, smiNode->status);
 	    incrStatusCounter(&metrics->statusAll, smiNode->status);
 	    incrLengthCounter(&metrics->lengthNotifications,
@@ -1167,6 +1177,10 @@ addMetrics(Metrics *metrics, SmiModule *smiModule)
 	 smiType;
 	 smiType = smiGetNextType(smiType)) {
 
+	if (smiType->name) {
+	    metrics->size++;
+	}
+
 	/*
 	 * Ignore all types with empty descriptions coming from the
 	 * "SNMPv2-SMI" module since they are not really defined
@@ -1573,21 +1587,223 @@ fprintMetrics(FILE *f, Metrics *metrics)
     fprintf(f, "\n");
     fprintfComplexity(f, metrics);
     fprintf(f, "\n");
-    fprintTypeUsage(f, typeList);
-    freeUsageCounter(typeList), typeList = NULL;
+    fprintTypeUsage(f, typeTable.list);
+    freeUsageCounter(&typeTable);
+    fprintf(f, "\n");
+    fprintExtTypeUsage(f, extTypeTable.list);
+    freeUsageCounter(&extTypeTable);
     fprintf(f, "\n");
-    fprintExtTypeUsage(f, extTypeList);
-    freeUsageCounter(extTypeList), extTypeList = NULL;
+    fprintExtNodeUsage(f, extNodeTable.list);
+    freeUsageCounter(&extNodeTable);
     fprintf(f, "\n");
-    fprintExtNodeUsage(f, extNodeList);
-    freeUsageCounter(extNodeList), extNodeList = NULL;
+    fprintModuleUsage(f, extModuleTable.list);
+    freeUsageCounter(&extModuleTable);
     fprintf(f, "\n");
-    fprintModuleUsage(f, extModuleList);
-    freeUsageCounter(extModuleList), extModuleList = NULL;
+    fprintIndexComplexity(f, indexComplexityTable.list);
+    freeUsageCounter(&indexComplexityTable);
     fprintf(f, "\n");
-    fprintIndexComplexity(f, indexComplexityList);
-    freeUsageCounter(indexComplexityList), indexComplexityList = NULL;
+}
+
+
+
+static void
+sumMetrics(Metrics *sum, Metrics *metrics)
+{
+    unsigned long *p = (unsigned long *) sum;
+    unsigned long *q = (unsigned long *) metrics;
+    size_t i;
+
+    for (i = 0; i < sizeof(Metrics) / sizeof(unsigned long); i++) {
+	p[i] += q[i];
+    }
+}
+
+
+
+/*
+ * The columns of the machine readable (CSV and JSON) output. Each
+ * column is a counter of the Metrics structure.
+ */
+
+typedef struct MetricsColumn {
+    char   *name;
+    size_t offset;
+} MetricsColumn;
+
+#define METRICS_COLUMN(name, member) { name, offsetof(Metrics, member) }
+
+static MetricsColumn metricsColumns[] = {
+    METRICS_COLUMN("size",		size),
+    METRICS_COLUMN("types",		statusTypes.total),
+    METRICS_COLUMN("tables",		statusTables.total),
+    METRICS_COLUMN("columns",		statusColumns.total),
+    METRICS_COLUMN("scalars",		statusScalars.total),
+    METRICS_COLUMN("notifications",	statusNotifications.total),
+    METRICS_COLUMN("groups",		statusGroups.total),
+    METRICS_COLUMN("compliances",	statusCompliances.total),
+    METRICS_COLUMN("current",		statusAll.current),
+    METRICS_COLUMN("deprecated",	statusAll.deprecated),
+    METRICS_COLUMN("obsolete",		statusAll.obsolete),
+    METRICS_COLUMN("readwrite",		accessAll.readwrite),
+    METRICS_COLUMN("readonly",		accessAll.readonly),
+    METRICS_COLUMN("notify",		accessAll.notify),
+    METRICS_COLUMN("noaccess",		accessAll.noaccess),
+    METRICS_COLUMN("index",		indexTables.index),
+    METRICS_COLUMN("augment",		indexTables.augment),
+    METRICS_COLUMN("reorder",		indexTables.reorder),
+    METRICS_COLUMN("sparse",		indexTables.sparse),
+    METRICS_COLUMN("expand",		indexTables.expand),
+    METRICS_COLUMN("rowstatus",		rowStatus.rowstatus),
+    METRICS_COLUMN("storagetype",	rowStatus.storagetype),
+    METRICS_COLUMN("descriptions",	lengthAll.descr),
+    METRICS_COLUMN("description_bytes",	lengthAll.descr_len),
+    METRICS_COLUMN("references",	lengthAll.reference),
+    METRICS_COLUMN("reference_bytes",	lengthAll.reference_len),
+    METRICS_COLUMN("integer32",		basetypesAll.integer32),
+    METRICS_COLUMN("unsigned32",	basetypesAll.unsigned32),
+    METRICS_COLUMN("integer64",		basetypesAll.integer64),
+    METRICS_COLUMN("unsigned64",	basetypesAll.unsigned64),
+    METRICS_COLUMN("octetstring",	basetypesAll.octetstring),
+    METRICS_COLUMN("objectidentifier",	basetypesAll.objectidentifier),
+    METRICS_COLUMN("enums",		basetypesAll.enums),
+    METRICS_COLUMN("bits",		basetypesAll.bits),
+    { NULL, 0 }
+};
+
+#define METRICS_VALUE(metrics, column) \
+    (*(unsigned long *) ((char *) (metrics) + (column)->offset))
+
+
+
+static void
+fprintJsonString(FILE *f, const char *s)
+{
+    fputc('"', f);
+    for (; s && *s; s++) {
+	if (*s == '"' || *s == '\\') {
+	    fputc('\\', f);
+	    fputc(*s, f);
+	} else if ((unsigned char) *s < 0x20) {
+	    fprintf(f, "\\u%04x", (unsigned char) *s);
+	} else {
+	    fputc(*s, f);
+	}
+    }
+    fputc('"', f);
+}
+
+
+
+static void
+fprintCsv(FILE *f, int modc, SmiModule **modv, Metrics *metv, Metrics *sum)
+{
+    MetricsColumn *col;
+    SmiRevision *smiRevision;
+    int i, n;
+
+    fprintf(f, "module,language,revisions,last_revision");
+    for (col = metricsColumns; col->name; col++) {
+	fprintf(f, ",%s", col->name);
+    }
     fprintf(f, "\n");
+
+    for (i = 0; i <= modc; i++) {
+	if (i < modc) {
+	    smiRevision = smiGetFirstRevision(modv[i]);
+	    for (n = 0; smiRevision;
+		 smiRevision = smiGetNextRevision(smiRevision), n++) ;
+	    smiRevision = smiGetFirstRevision(modv[i]);
+	    fprintf(f, "%s,%s,%d,%s", modv[i]->name,
+		    language(modv[i]->language), n,
+		    smiRevision ? getDateString(smiRevision->date) : "");
+	} else {
+	    fprintf(f, "TOTAL,,,");
+	}
+	for (col = metricsColumns; col->name; col++) {
+	    fprintf(f, ",%lu", METRICS_VALUE(i < modc ? metv + i : sum, col));
+	}
+	fprintf(f, "\n");
+    }
+}
+
+
+
+static void
+fprintJsonUsage(FILE *f, const char *key, UsageCounter *usageList)
+{
+    UsageCounter *uCnt, **sortCnt;
+    int i, cnt;
+
+    for (uCnt = usageList, cnt = 0; uCnt; uCnt = uCnt->nextPtr, cnt++) ;
+    sortCnt = (UsageCounter **) xmalloc((cnt + 1) * sizeof(UsageCounter *));
+    for (uCnt = usageList, i = 0; uCnt; uCnt = uCnt->nextPtr, i++) {
+	sortCnt[i] = uCnt;
+    }
+    qsort(sortCnt, cnt, sizeof(UsageCounter *), cmp);
+
+    fprintf(f, ",\n  \"%s\": [", key);
+    for (i = 0; i < cnt; i++) {
+	fprintf(f, "%s\n    { \"module\": ", i ? "," : "");
+	fprintJsonString(f, sortCnt[i]->module);
+	if (sortCnt[i]->name) {
+	    fprintf(f, ", \"name\": ");
+	    fprintJsonString(f, sortCnt[i]->name);
+	}
+	fprintf(f, ", \"count\": %u }", sortCnt[i]->count);
+    }
+    fprintf(f, "%s]", cnt ? "\n  " : "");
+
+    xfree(sortCnt);
+}
+
+
+
+static void
+fprintJsonMetrics(FILE *f, Metrics *metrics)
+{
+    MetricsColumn *col;
+
+    for (col = metricsColumns; col->name; col++) {
+	fprintf(f, ", \"%s\": %lu", col->name, METRICS_VALUE(metrics, col));
+    }
+}
+
+
+
+static void
+fprintJson(FILE *f, int modc, SmiModule **modv, Metrics *metv, Metrics *sum)
+{
+    SmiRevision *smiRevision;
+    int i, n;
+
+    fprintf(f, "{\n  \"generator\": \"smidump " SMI_VERSION_STRING "\",\n");
+    fprintf(f, "  \"modules\": [");
+    for (i = 0; i < modc; i++) {
+	smiRevision = smiGetFirstRevision(modv[i]);
+	for (n = 0; smiRevision;
+	     smiRevision = smiGetNextRevision(smiRevision), n++) ;
+	smiRevision = smiGetFirstRevision(modv[i]);
+	fprintf(f, "%s\n    { \"module\": ", i ? "," : "");
+	fprintJsonString(f, modv[i]->name);
+	fprintf(f, ", \"language\": \"%s\", \"revisions\": %d",
+		language(modv[i]->language), n);
+	if (smiRevision) {
+	    fprintf(f, ", \"last_revision\": \"%s\"",
+		    getDateString(smiRevision->date));
+	}
+	fprintJsonMetrics(f, metv + i);
+	fprintf(f, " }");
+    }
+    fprintf(f, "%s],\n", modc ? "\n  " : "");
+    fprintf(f, "  \"total\": { \"modules\": %d", modc);
+    fprintJsonMetrics(f, sum);
+    fprintf(f, " }");
+    fprintJsonUsage(f, "type_usage", typeTable.list);
+    fprintJsonUsage(f, "ext_type_usage", extTypeTable.list);
+    fprintJsonUsage(f, "ext_node_usage", extNodeTable.list);
+    fprintJsonUsage(f, "ext_module_usage", extModuleTable.list);
+    fprintJsonUsage(f, "index_complexity", indexComplexityTable.list);
+    fprintf(f, "\n}\n");
 }
 
 
@@ -1595,12 +1811,18 @@ fprintMetrics(FILE *f, Metrics *metrics)
 static void
 dumpMetrics(int modc, SmiModule **modv, int flags, char *output)
 {
-    Metrics   metrics;
+    Metrics   metrics, *metv;
     int       i;
     FILE      *f = stdout;
 
     silent = (flags & SMIDUMP_FLAG_SILENT);
 
+    if (format && strcmp(format, "text") != 0
+	&& strcmp(format, "csv") != 0 && strcmp(format, "json") != 0) {
+	fprintf(stderr, "smidump: unknown metrics format `%s'\n", format);
+	exit(1);
+    }
+
     if (output) {
 	f = fopen(output, "w");
 	if (!f) {
@@ -1610,7 +1832,31 @@ dumpMetrics(int modc, SmiModule **modv, int flags, char *output)
 	}
     }
 
-    if (flags & SMIDUMP_FLAG_UNITE) {
+    /*
+     * The metrics of each module are computed in a single pass. The
+     * usage counters accumulate over all modules until they are
+     * printed.
+     */
+
+    metv = (Metrics *) xcalloc(modc + 1, sizeof(Metrics));
+    memset(&metrics, 0, sizeof(Metrics));
+
+    if (format && strcmp(format, "text") != 0) {
+	for (i = 0; i < modc; i++) {
+	    addMetrics(&metv[i], modv[i]);
+	    sumMetrics(&metrics, &metv[i]);
+	}
+	if (strcmp(format, "csv") == 0) {
+	    fprintCsv(f, modc, modv, metv, &metrics);
+	} else {
+	    fprintJson(f, modc, modv, metv, &metrics);
+	}
+	freeUsageCounter(&typeTable);
+	freeUsageCounter(&extTypeTable);
+	freeUsageCounter(&extNodeTable);
+	freeUsageCounter(&extModuleTable);
+	freeUsageCounter(&indexComplexityTable);
+    } else if (flags & SMIDUMP_FLAG_UNITE) {
 	if (! silent) {
 	    int pos = 8888;
 	    fprintf(f, "# united module metrics [%d modules] "
@@ -1628,14 +1874,11 @@ dumpMetrics(int modc, SmiModule **modv, int flags, char *output)
 	    fprintf(f, "%s\n", (pos == 8) ? "" : "\n");
 	}
 
-	fprintRevision(f, modc, modv);
-	    
-	for (i = 0; i < modc; i++) {
-	    memset(&metrics, 0, sizeof(Metrics));
-	}
 	for (i = 0; i < modc; i++) {
-	    addMetrics(&metrics, modv[i]);
+	    addMetrics(&metv[i], modv[i]);
+	    sumMetrics(&metrics, &metv[i]);
 	}
+	fprintRevision(f, modc, modv, metv);
 	fprintMetrics(f, &metrics);
     } else {
 	for (i = 0; i < modc; i++) {
@@ -1644,11 +1887,9 @@ dumpMetrics(int modc, SmiModule **modv, int flags, char *output)
 			SMI_VERSION_STRING ")\n\n", modv[i]->name);
 	    }
 
-	    fprintRevision(f, 1, modv+i);
-    
-	    memset(&metrics, 0, sizeof(Metrics));
-	    addMetrics(&metrics, modv[i]);
-	    fprintMetrics(f, &metrics);
+	    addMetrics(&metv[i], modv[i]);
+	    fprintRevision(f, 1, modv+i, metv+i);
+	    fprintMetrics(f, &metv[i]);
 	}
     }
 
@@ -1660,6 +1901,8 @@ dumpMetrics(int modc, SmiModule **modv, int flags, char *output)
     if (output) {
 	fclose(f);
     }
+
+    xfree(metv);
 }
 
 
@@ -1670,6 +1913,8 @@ initMetrics()
     static SmidumpDriverOption opt[] = {
 	{ "raw", OPT_FLAG, &raw, 0,
 	  "generate raw statistics (no percentages)"},
+	{ "format", OPT_STRING, &format, 0,
+	  "output format: text, csv or json (default=text)"},
         { 0, OPT_END, 0, 0 }
     };
 
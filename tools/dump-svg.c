@@ -22,6 +22,9 @@
 #include <string.h>
 #include <ctype.h>
 #include <math.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
 #ifdef HAVE_WIN_H
 #include "win.h"
 #endif
@@ -31,6 +34,16 @@
 #include "rea.h"
 #include "dump-svg-script.h"
 
+/*
+ * The components of the graph are laid out concurrently if we have
+ * threads. The layout of a component only touches its own nodes.
+ */
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#define SVG_THREADS
+#endif
+
 #define URL "http://www.ibr.cs.tu-bs.de/projects/libsmi/svg/mib2svg.cgi?"
 
 
@@ -58,8 +71,10 @@ static const int DYN_TEXT              =470;
 
 /* used by the springembedder */
 static const int ITERATIONS            =100;
+static const float THETA               = (float)0.5; /* Barnes-Hut */
+static const int QUADTREE_DEPTH        =24;
 
-static char *link;
+static char *linkUrl;
 static const char *linkcolor = "blue";
 
 
@@ -335,7 +350,7 @@ static void printSVGAttribute(SmiNode *node, SmiNode *tableNode, int index,
 	    }
 	    if (!target_exists) {
 		printf(" fill=\"%s\">\n", linkcolor);
-		printf("      <a xlink:href=\"%s", link);
+		printf("      <a xlink:href=\"%s", linkUrl);
 		for (i=0; i<modc; i++) {
 		    printf("&amp;mibs=%s", modv[i]->name);
 		}
@@ -1142,10 +1157,6 @@ static GraphNode *calcNodeSize(GraphNode *node, int *idCount)
     if (node->smiNode->nodekind == SMI_NODEKIND_SCALAR) return node;
 
     node->use = 1;
-    node->dia.x = (float) rand();
-    node->dia.y = (float) rand();
-    node->dia.x /= (float) RAND_MAX;
-    node->dia.y /= (float) RAND_MAX;
     node->dia.w = strlen(node->smiNode->name) * HEADFONTSIZETABLE
 	+ HEADSPACESIZETABLE;
     node->dia.h = TABLEHEIGHT + TABLEBOTTOMHEIGHT;
@@ -1906,7 +1917,7 @@ static void printComplianceNode(SmiNode *smiNode, int modc, SmiModule **modv,
 	}
 	if (!foreign_exists && !STATIC_OUTPUT) {
 	    printf("   <tspan fill=\"%s\" x=\"5\">\n", linkcolor);
-	    printf("    <a xlink:href=\"%s", link);
+	    printf("    <a xlink:href=\"%s", linkUrl);
 	    for (k=0; k<modc; k++) {
 		printf("&amp;mibs=%s", modv[k]->name);
 	    }
@@ -2800,89 +2811,381 @@ static float intersect(GraphNode *node, GraphEdge *edge)
     return intersect;
 }
 
+/*
+ * The additional repulsive force of an overlapping uNode on vNode.
+ */
+static void repelOverlap(GraphNode *vNode, GraphNode *uNode, float k)
+{
+    float xDelta, yDelta, absDelta;
+
+    xDelta = vNode->dia.x - uNode->dia.x;
+    yDelta = vNode->dia.y - uNode->dia.y;
+    absDelta = (float) (sqrt(xDelta*xDelta + yDelta*yDelta));
+    vNode->dia.xDisp += 4*(xDelta/absDelta)*fr(1/absDelta, k);
+    vNode->dia.yDisp += 4*(yDelta/absDelta)*fr(1/absDelta, k);
+}
+
+/*
+ * The repulsive force of uNode on vNode.
+ */
+static void repelNode(GraphNode *vNode, GraphNode *uNode,
+		      int nodeoverlap, float k)
+{
+    float xDelta, yDelta, absDelta;
+
+    xDelta = vNode->dia.x - uNode->dia.x;
+    yDelta = vNode->dia.y - uNode->dia.y;
+    absDelta = (float) (sqrt(xDelta*xDelta + yDelta*yDelta));
+    vNode->dia.xDisp += (xDelta/absDelta)*fr(absDelta, k);
+    vNode->dia.yDisp += (yDelta/absDelta)*fr(absDelta, k);
+    /* add another repulsive force if the nodes overlap */
+    if (nodeoverlap && overlap(vNode, uNode)) {
+	repelOverlap(vNode, uNode, k);
+    }
+}
+
+/*
+ * The repulsive forces between an edge and a node crossing it.
+ */
+static void repelEdge(GraphEdge *eEdge, GraphNode *vNode, float k)
+{
+    float xDelta, yDelta, absDelta, dist;
+
+    if (eEdge->startNode == vNode ||
+	eEdge->endNode == vNode ||
+	overlap(eEdge->startNode, vNode) ||
+	overlap(eEdge->endNode, vNode))
+	return;
+    if ((dist = intersect(vNode, eEdge))) {
+	if (eEdge->startNode->dia.x == eEdge->endNode->dia.x) {
+	    eEdge->startNode->dia.xDisp -=
+		8*(dist/fabsf(dist))*fr(1/dist, k);
+	    eEdge->endNode->dia.xDisp -=
+		8*(dist/fabsf(dist))*fr(1/dist, k);
+	    vNode->dia.xDisp +=
+		8*(dist/fabsf(dist))*fr(1/dist, k);
+	} else {
+	    xDelta = -1*(eEdge->endNode->dia.y
+			 -eEdge->startNode->dia.y)
+		       /(eEdge->endNode->dia.x
+			 -eEdge->startNode->dia.x);
+	    yDelta = 1;
+	    absDelta = (float) (sqrt(xDelta*xDelta
+				     + yDelta*yDelta));
+	    eEdge->startNode->dia.xDisp +=
+		8*(xDelta/absDelta)*fr(1/dist, k);
+	    eEdge->startNode->dia.yDisp +=
+		8*(yDelta/absDelta)*fr(1/dist, k);
+	    eEdge->endNode->dia.xDisp +=
+		8*(xDelta/absDelta)*fr(1/dist, k);
+	    eEdge->endNode->dia.yDisp +=
+		8*(yDelta/absDelta)*fr(1/dist, k);
+	    vNode->dia.xDisp -=
+		8*(xDelta/absDelta)*fr(1/dist, k);
+	    vNode->dia.yDisp -=
+		8*(yDelta/absDelta)*fr(1/dist, k);
+	}
+    }
+}
+
+/*
+ * A quadtree over the nodes of a component, rebuilt in every
+ * iteration of the springembedder. Each cell keeps the number and the
+ * center of its nodes to approximate the repulsive forces of distant
+ * cells (Barnes-Hut) and the bounding box of the node rectangles to
+ * find overlapping nodes and the nodes that may cross an edge.
+ */
+typedef struct QuadCell {
+    float x, y, size;		/* the square covered by the cell */
+    float cx, cy;		/* sum of the node coordinates */
+    float x0, y0, x1, y1;	/* bounding box of the node rectangles */
+    int   count;		/* number of nodes */
+    int   first;		/* first node of a leaf */
+    int   child;		/* first of four children, 0 for a leaf */
+} QuadCell;
+
+typedef struct QuadTree {
+    QuadCell  *cells;
+    int       numCells;
+    int       maxCells;
+    GraphNode **nodes;		/* the nodes of the component */
+    int       *next;		/* next node in the same leaf */
+    int       numNodes;
+} QuadTree;
+
+static int quadNewCell(QuadTree *tree, float x, float y, float size)
+{
+    QuadCell *cell;
+
+    if (tree->numCells == tree->maxCells) {
+	tree->maxCells = tree->maxCells ? 2 * tree->maxCells : 64;
+	tree->cells = xrealloc(tree->cells,
+			       tree->maxCells * sizeof(QuadCell));
+    }
+    cell = &tree->cells[tree->numCells];
+    memset(cell, 0, sizeof(QuadCell));
+    cell->x = x;
+    cell->y = y;
+    cell->size = size;
+    cell->first = -1;
+    return tree->numCells++;
+}
+
+static int quadChild(QuadTree *tree, int c, GraphNode *node)
+{
+    QuadCell *cell = &tree->cells[c];
+    float half = cell->size/2;
+
+    return cell->child
+	+ (node->dia.x >= cell->x + half ? 1 : 0)
+	+ (node->dia.y >= cell->y + half ? 2 : 0);
+}
+
+static void quadInsert(QuadTree *tree, int c, int i, int depth)
+{
+    QuadCell *cell;
+    GraphNode *node = tree->nodes[i];
+    float half;
+    int j, child;
+
+    cell = &tree->cells[c];
+    if (cell->count == 0 || node->dia.x - node->dia.w/2 < cell->x0)
+	cell->x0 = node->dia.x - node->dia.w/2;
+    if (cell->count == 0 || node->dia.x + node->dia.w/2 > cell->x1)
+	cell->x1 = node->dia.x + node->dia.w/2;
+    if (cell->count == 0 || node->dia.y - node->dia.h/2 < cell->y0)
+	cell->y0 = node->dia.y - node->dia.h/2;
+    if (cell->count == 0 || node->dia.y + node->dia.h/2 > cell->y1)
+	cell->y1 = node->dia.y + node->dia.h/2;
+    cell->cx += node->dia.x;
+    cell->cy += node->dia.y;
+    cell->count++;
+
+    if (!cell->child && (cell->first < 0 || depth >= QUADTREE_DEPTH)) {
+	tree->next[i] = cell->first;
+	cell->first = i;
+	return;
+    }
+
+    if (!cell->child) {
+	/* split the leaf and move its node into a child */
+	half = cell->size/2;
+	child = quadNewCell(tree, cell->x, cell->y, half);
+	quadNewCell(tree, cell->x + half, cell->y, half);
+	quadNewCell(tree, cell->x, cell->y + half, half);
+	quadNewCell(tree, cell->x + half, cell->y + half, half);
+	cell = &tree->cells[c];
+	cell->child = child;
+	j = cell->first;
+	cell->first = -1;
+	quadInsert(tree, quadChild(tree, c, tree->nodes[j]), j, depth+1);
+    }
+    quadInsert(tree, quadChild(tree, c, node), i, depth+1);
+}
+
+static void quadBuild(QuadTree *tree)
+{
+    float x0, y0, x1, y1;
+    int i;
+
+    x0 = x1 = tree->nodes[0]->dia.x;
+    y0 = y1 = tree->nodes[0]->dia.y;
+    for (i = 1; i < tree->numNodes; i++) {
+	x0 = min(x0, tree->nodes[i]->dia.x);
+	x1 = max(x1, tree->nodes[i]->dia.x);
+	y0 = min(y0, tree->nodes[i]->dia.y);
+	y1 = max(y1, tree->nodes[i]->dia.y);
+    }
+    tree->numCells = 0;
+    quadNewCell(tree, x0, y0, max(x1 - x0, y1 - y0) + 1);
+    for (i = 0; i < tree->numNodes; i++) {
+	quadInsert(tree, 0, i, 0);
+    }
+}
+
+static void quadOverlap(QuadTree *tree, int c, GraphNode *vNode, float k)
+{
+    QuadCell *cell = &tree->cells[c];
+    int i;
+
+    /* skip cells without a node overlapping vNode */
+    if (cell->count == 0
+	|| vNode->dia.x+vNode->dia.w/2 < cell->x0
+	|| vNode->dia.x-vNode->dia.w/2 > cell->x1
+	|| vNode->dia.y+vNode->dia.h/2 < cell->y0
+	|| vNode->dia.y-vNode->dia.h/2 > cell->y1)
+	return;
+    if (!cell->child) {
+	for (i = cell->first; i >= 0; i = tree->next[i]) {
+	    if (tree->nodes[i] != vNode && overlap(vNode, tree->nodes[i]))
+		repelOverlap(vNode, tree->nodes[i], k);
+	}
+	return;
+    }
+    for (i = 0; i < 4; i++) {
+	quadOverlap(tree, cell->child + i, vNode, k);
+    }
+}
+
+static void quadRepel(QuadTree *tree, int c, GraphNode *vNode,
+		      int nodeoverlap, float k)
+{
+    QuadCell *cell = &tree->cells[c];
+    float xDelta, yDelta, absDelta;
+    int i;
+
+    if (cell->count == 0)
+	return;
+    if (!cell->child) {
+	for (i = cell->first; i >= 0; i = tree->next[i]) {
+	    if (tree->nodes[i] != vNode)
+		repelNode(vNode, tree->nodes[i], nodeoverlap, k);
+	}
+	return;
+    }
+    xDelta = vNode->dia.x - cell->cx/cell->count;
+    yDelta = vNode->dia.y - cell->cy/cell->count;
+    absDelta = (float) (sqrt(xDelta*xDelta + yDelta*yDelta));
+    if (cell->size < THETA*absDelta) {
+	/* a distant cell acts like a single node of its weight */
+	vNode->dia.xDisp += cell->count*(xDelta/absDelta)*fr(absDelta, k);
+	vNode->dia.yDisp += cell->count*(yDelta/absDelta)*fr(absDelta, k);
+	/* but large nodes may still overlap vNode */
+	if (nodeoverlap)
+	    quadOverlap(tree, c, vNode, k);
+	return;
+    }
+    for (i = 0; i < 4; i++) {
+	quadRepel(tree, cell->child + i, vNode, nodeoverlap, k);
+    }
+}
+
+/*
+ * Test on which side of the line through the edge the point (x,y) is.
+ */
+static int side(GraphEdge *eEdge, float x, float y)
+{
+    float d = (eEdge->endNode->dia.y - eEdge->startNode->dia.y)
+	      * (x - eEdge->startNode->dia.x)
+	      - (eEdge->endNode->dia.x - eEdge->startNode->dia.x)
+	      * (y - eEdge->startNode->dia.y);
+
+    return d > 0 ? 1 : (d < 0 ? -1 : 0);
+}
+
+static void quadRepelEdge(QuadTree *tree, int c, GraphEdge *eEdge,
+			  float x0, float y0, float x1, float y1, float k)
+{
+    QuadCell *cell = &tree->cells[c];
+    int i, s;
+
+    /* skip cells without a node within the bounding box of the edge */
+    if (cell->count == 0
+	|| cell->x1 < x0 || cell->x0 > x1 || cell->y1 < y0 || cell->y0 > y1)
+	return;
+    /* skip cells entirely on one side of the edge */
+    s = side(eEdge, cell->x0, cell->y0);
+    if (s && s == side(eEdge, cell->x1, cell->y0)
+	&& s == side(eEdge, cell->x0, cell->y1)
+	&& s == side(eEdge, cell->x1, cell->y1))
+	return;
+    if (!cell->child) {
+	for (i = cell->first; i >= 0; i = tree->next[i]) {
+	    repelEdge(eEdge, tree->nodes[i], k);
+	}
+	return;
+    }
+    for (i = 0; i < 4; i++) {
+	quadRepelEdge(tree, cell->child + i, eEdge, x0, y0, x1, y1, k);
+    }
+}
+
 /*
  * Implements the springembedder. Look at LNCS 2025, pp. 71-86.
  * and: http://citeseer.ist.psu.edu/fruchterman91graph.html
  * Input: Graph with known width and height of nodes.
  * Output: Coordinates (x,y) for the nodes.
  * Only the nodes and edges with use==1 are considered.
+ *
+ * Unless EXACT_LAYOUT is set, the repulsive forces are approximated
+ * by a quadtree in O(V log V) and only the nodes within the bounding
+ * box of an edge are tested for crossing it. The exact algorithm
+ * takes O(V^2 + E*V) per iteration.
  */
 static void layoutComponent(GraphComponent *component,
 			int nodeoverlap, int edgeoverlap)
 {
-    int i;
-    float k, xDelta, yDelta, absDelta, absDisp, t, dist;
+    int i, j, numEdges = 0;
+    float k, xDelta, yDelta, absDelta, absDisp, t;
     GraphNode *vNode, *uNode;
-    GraphEdge *eEdge;
+    GraphEdge *eEdge, **edges;
+    QuadTree tree;
 
     k = 400;
     t = 200;
 
+    memset(&tree, 0, sizeof(QuadTree));
+    for (vNode = component->firstComponentNode; vNode;
+					vNode = vNode->nextComponentNode) {
+	tree.numNodes++;
+    }
+    if (!tree.numNodes)
+	return;
+    tree.nodes = xmalloc(tree.numNodes * sizeof(GraphNode *));
+    tree.next = xmalloc(tree.numNodes * sizeof(int));
+    for (vNode = component->firstComponentNode, j = 0; vNode;
+					vNode = vNode->nextComponentNode) {
+	tree.nodes[j++] = vNode;
+    }
+
+    /* the edges of this component */
+    for (eEdge = graph->edges; eEdge; eEdge = eEdge->nextPtr) {
+	if (eEdge->use && eEdge->startNode->component == component)
+	    numEdges++;
+    }
+    edges = xmalloc((numEdges + 1) * sizeof(GraphEdge *));
+    for (eEdge = graph->edges, j = 0; eEdge; eEdge = eEdge->nextPtr) {
+	if (eEdge->use && eEdge->startNode->component == component)
+	    edges[j++] = eEdge;
+    }
+
     for (i=0; i<ITERATIONS; i++) {
 	/* calculate repulsive forces */
-	for (vNode = component->firstComponentNode; vNode;
-					vNode = vNode->nextComponentNode) {
+	if (!EXACT_LAYOUT)
+	    quadBuild(&tree);
+	for (j = 0; j < tree.numNodes; j++) {
+	    vNode = tree.nodes[j];
 	    vNode->dia.xDisp = 0;
 	    vNode->dia.yDisp = 0;
+	    if (!EXACT_LAYOUT) {
+		quadRepel(&tree, 0, vNode, nodeoverlap, k);
+		continue;
+	    }
 	    for (uNode = component->firstComponentNode; uNode;
 					uNode = uNode->nextComponentNode) {
 		if (vNode==uNode)
 		    continue;
-		xDelta = vNode->dia.x - uNode->dia.x;
-		yDelta = vNode->dia.y - uNode->dia.y;
-		absDelta = (float) (sqrt(xDelta*xDelta + yDelta*yDelta));
-		vNode->dia.xDisp += (xDelta/absDelta)*fr(absDelta, k);
-		vNode->dia.yDisp += (yDelta/absDelta)*fr(absDelta, k);
-		/* add another repulsive force if the nodes overlap */
-		if (nodeoverlap && overlap(vNode, uNode)) {
-		    vNode->dia.xDisp += 4*(xDelta/absDelta)*fr(1/absDelta, k);
-		    vNode->dia.yDisp += 4*(yDelta/absDelta)*fr(1/absDelta, k);
-		}
+		repelNode(vNode, uNode, nodeoverlap, k);
 	    }
 	}
-	for (eEdge = graph->edges; eEdge; eEdge = eEdge->nextPtr) {
-	    if (!eEdge->use || eEdge->startNode->component != component)
-		continue;
+	for (j = 0; j < numEdges; j++) {
+	    eEdge = edges[j];
 	    /* add another repulsive force if edge and any node overlap */
-	    if (edgeoverlap) {
+	    if (edgeoverlap && EXACT_LAYOUT) {
 		for (vNode = component->firstComponentNode; vNode;
 					vNode = vNode->nextComponentNode) {
-		    if (eEdge->startNode == vNode ||
-			eEdge->endNode == vNode ||
-			overlap(eEdge->startNode, vNode) ||
-			overlap(eEdge->endNode, vNode))
-			continue;
-		    if ((dist = intersect(vNode, eEdge))) {
-			if (eEdge->startNode->dia.x == eEdge->endNode->dia.x) {
-			    eEdge->startNode->dia.xDisp -=
-				8*(dist/fabsf(dist))*fr(1/dist, k);
-			    eEdge->endNode->dia.xDisp -=
-				8*(dist/fabsf(dist))*fr(1/dist, k);
-			    vNode->dia.xDisp +=
-				8*(dist/fabsf(dist))*fr(1/dist, k);
-			} else {
-			    xDelta = -1*(eEdge->endNode->dia.y
-					 -eEdge->startNode->dia.y)
-				       /(eEdge->endNode->dia.x
-					 -eEdge->startNode->dia.x);
-			    yDelta = 1;
-			    absDelta = (float) (sqrt(xDelta*xDelta
-						     + yDelta*yDelta));
-			    eEdge->startNode->dia.xDisp +=
-				8*(xDelta/absDelta)*fr(1/dist, k);
-			    eEdge->startNode->dia.yDisp +=
-				8*(yDelta/absDelta)*fr(1/dist, k);
-			    eEdge->endNode->dia.xDisp +=
-				8*(xDelta/absDelta)*fr(1/dist, k);
-			    eEdge->endNode->dia.yDisp +=
-				8*(yDelta/absDelta)*fr(1/dist, k);
-			    vNode->dia.xDisp -=
-				8*(xDelta/absDelta)*fr(1/dist, k);
-			    vNode->dia.yDisp -=
-				8*(yDelta/absDelta)*fr(1/dist, k);
-			}
-		    }
+		    repelEdge(eEdge, vNode, k);
 		}
+	    } else if (edgeoverlap) {
+		quadRepelEdge(&tree, 0, eEdge,
+			      min(eEdge->startNode->dia.x,
+				  eEdge->endNode->dia.x),
+			      min(eEdge->startNode->dia.y,
+				  eEdge->endNode->dia.y),
+			      max(eEdge->startNode->dia.x,
+				  eEdge->endNode->dia.x),
+			      max(eEdge->startNode->dia.y,
+				  eEdge->endNode->dia.y), k);
 	    }
 	    /* calculate attractive forces */
 	    xDelta = eEdge->startNode->dia.x - eEdge->endNode->dia.x;
@@ -2904,6 +3207,11 @@ static void layoutComponent(GraphComponent *component,
 	/* reduce the temperature as the layout approaches a better configuration */
 	t *= 0.9;
     }
+
+    xfree(edges);
+    xfree(tree.nodes);
+    xfree(tree.next);
+    xfree(tree.cells);
 }
 
 
@@ -2915,7 +3223,9 @@ static void addNodeToComponent(GraphNode *tNode, GraphComponent *tComponent)
     GraphEdge *tEdge;
 
     tNode->component = tComponent;
-    for (tEdge = graph->edges; tEdge; tEdge = tEdge->nextPtr) {
+    for (tEdge = graphGetFirstEdgeByNode(graph, tNode);
+	 tEdge;
+	 tEdge = graphGetNextEdgeByNode(graph, tEdge, tNode)) {
 	if (!tEdge->use)
 	    continue;
 	if (tEdge->startNode == tNode && tEdge->endNode->component == NULL) {
@@ -2949,32 +3259,125 @@ static void splitGraphIntoComponents()
 }
 
 
-/* layout components (except first) and calculate bounding boxes and offsets */
+/*
+ * Returns a pseudo random number in [0,1] and advances the seed. Each
+ * component has its own seed, so its layout does not depend on the
+ * order in which the components are processed.
+ */
+static float nextRandom(unsigned long *seed)
+{
+    *seed = (*seed * 1103515245UL + 12345UL) & 0xffffffffUL;
+    return (float) ((*seed >> 16) & 0x7fff) / (float) 0x7fff;
+}
+
+/* place the nodes randomly, layout and calculate the bounding box */
+static void layoutOneComponent(GraphComponent *tComponent, unsigned long seed)
+{
+    GraphNode *tNode;
+
+    for (tNode = tComponent->firstComponentNode; tNode;
+					tNode = tNode->nextComponentNode) {
+	tNode->dia.x = nextRandom(&seed);
+	tNode->dia.y = nextRandom(&seed);
+    }
+
+    layoutComponent(tComponent, 0, 0);
+    /* FIXME do we need a stage with nodeoverlap and without edgeoverlap? */
+    layoutComponent(tComponent, 1, 0);
+    layoutComponent(tComponent, 1, 1);
+
+    for (tNode = tComponent->firstComponentNode; tNode;
+				    tNode = tNode->nextComponentNode) {
+	if (tNode->dia.x - tNode->dia.w/2 < tComponent->xMin)
+	    tComponent->xMin = tNode->dia.x - tNode->dia.w/2;
+	if (tNode->dia.x + tNode->dia.w/2 > tComponent->xMax)
+	    tComponent->xMax = tNode->dia.x + tNode->dia.w/2;
+	if (tNode->dia.y - tNode->dia.h/2 < tComponent->yMin)
+	    tComponent->yMin = tNode->dia.y - tNode->dia.h/2;
+	if (tNode->dia.y + tNode->dia.h/2 > tComponent->yMax)
+	    tComponent->yMax = tNode->dia.y + tNode->dia.h/2;
+    }
+}
+
+#ifdef SVG_THREADS
+
+static GraphComponent **layoutJobs = NULL;
+static int numLayoutJobs = 0;
+static int nextLayoutJob = 0;
+static pthread_mutex_t layoutMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void *layoutWorker(void *arg)
+{
+    int i;
+
+    while (1) {
+	pthread_mutex_lock(&layoutMutex);
+	i = nextLayoutJob++;
+	pthread_mutex_unlock(&layoutMutex);
+	if (i >= numLayoutJobs)
+	    break;
+	layoutOneComponent(layoutJobs[i], i + 1);
+    }
+    return NULL;
+}
+
+#endif
+
+/*
+ * layout components (except first) on LAYOUT_JOBS threads, then
+ * calculate the offsets to pack them from left to right
+ */
 static void layoutComponents(float *yMin, float *yMax, float *x)
 {
-    GraphNode      *tNode;
-    GraphComponent *tComponent;
+    GraphComponent *tComponent, **components;
+    int            i, num = 0, jobs;
+#ifdef SVG_THREADS
+    pthread_t      *threads;
+#endif
 
-    *x=10;
     for (tComponent = graph->components->nextPtr; tComponent;
 					    tComponent = tComponent->nextPtr) {
-	layoutComponent(tComponent, 0, 0);
-	/* FIXME do we need a stage with nodeoverlap and without edgeoverlap? */
-	layoutComponent(tComponent, 1, 0);
-	layoutComponent(tComponent, 1, 1);
+	num++;
+    }
+    components = xmalloc((num + 1) * sizeof(GraphComponent *));
+    for (tComponent = graph->components->nextPtr, i = 0; tComponent;
+					    tComponent = tComponent->nextPtr) {
+	components[i++] = tComponent;
+    }
 
-	for (tNode = tComponent->firstComponentNode; tNode;
-					tNode = tNode->nextComponentNode) {
-	    if (tNode->dia.x - tNode->dia.w/2 < tComponent->xMin)
-		tComponent->xMin = tNode->dia.x - tNode->dia.w/2;
-	    if (tNode->dia.x + tNode->dia.w/2 > tComponent->xMax)
-		tComponent->xMax = tNode->dia.x + tNode->dia.w/2;
-	    if (tNode->dia.y - tNode->dia.h/2 < tComponent->yMin)
-		tComponent->yMin = tNode->dia.y - tNode->dia.h/2;
-	    if (tNode->dia.y + tNode->dia.h/2 > tComponent->yMax)
-		tComponent->yMax = tNode->dia.y + tNode->dia.h/2;
+    jobs = LAYOUT_JOBS;
+#ifdef _SC_NPROCESSORS_ONLN
+    if (jobs <= 0)
+	jobs = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (jobs > num)
+	jobs = num;
+
+#ifdef SVG_THREADS
+    if (jobs > 1) {
+	layoutJobs = components;
+	numLayoutJobs = num;
+	nextLayoutJob = 0;
+	threads = xmalloc(jobs * sizeof(pthread_t));
+	for (i = 0; i < jobs; i++) {
+	    if (pthread_create(&threads[i], NULL, layoutWorker, NULL) != 0)
+		break;
 	}
+	/* fall back to the threads we got, possibly only this one */
+	if (i == 0)
+	    layoutWorker(NULL);
+	while (i-- > 0)
+	    pthread_join(threads[i], NULL);
+	xfree(threads);
+    } else
+#endif
+    for (i = 0; i < num; i++) {
+	layoutOneComponent(components[i], i + 1);
+    }
 
+    *x=10;
+    for (i = 0; i < num; i++) {
+	tComponent = components[i];
 	tComponent->xOffset = *x - tComponent->xMin;
 	*x += 10 + tComponent->xMax - tComponent->xMin;
 	tComponent->yOffset = -0.5*(tComponent->yMin+tComponent->yMax);
@@ -2983,6 +3386,8 @@ static void layoutComponents(float *yMin, float *yMax, float *x)
 	if (tComponent->yMax + tComponent->yOffset > *yMax)
 	    *yMax = tComponent->yMax + tComponent->yOffset;
     }
+
+    xfree(components);
 }
 
 
@@ -3229,17 +3634,17 @@ static void buildLink(int modc, SmiModule **modv)
     if (SHOW_DEPR_OBSOLETE) {
 	length += strlen(deprobsstr);
     }
-    link = xmalloc(length + 1);
-    strcpy(link, url);
-    strcat(link, widthstr);
-    strcat(link, width);
-    strcat(link, heightstr);
-    strcat(link, height);
+    linkUrl = xmalloc(length + 1);
+    strcpy(linkUrl, url);
+    strcat(linkUrl, widthstr);
+    strcat(linkUrl, width);
+    strcat(linkUrl, heightstr);
+    strcat(linkUrl, height);
     if (SHOW_DEPRECATED) {
-	strcat(link, deprstr);
+	strcat(linkUrl, deprstr);
     }
     if (SHOW_DEPR_OBSOLETE) {
-	strcat(link, deprobsstr);
+	strcat(linkUrl, deprobsstr);
     }
 }
 
@@ -3266,10 +3671,7 @@ static void dumpSvg(int modc, SmiModule **modv, int flags, char *output)
 
     if (flags & SMIDUMP_FLAG_UNITE) {
 	if (! graph) {
-	    graph = xmalloc(sizeof(Graph));
-	    graph->nodes = NULL;
-	    graph->edges = NULL;
-	    graph->components = NULL;
+	    graph = graphCreate();
 	}
 	
 	for (i = 0; i < modc; i++) {
@@ -3285,10 +3687,7 @@ static void dumpSvg(int modc, SmiModule **modv, int flags, char *output)
     } else {
 	for (i = 0; i < modc; i++) {
 	    if (! graph) {
-		graph = xmalloc(sizeof(Graph));
-		graph->nodes = NULL;
-		graph->edges = NULL;
-		graph->components = NULL;
+		graph = graphCreate();
 	    }
 	    
 	    algCreateNodes(modv[i]);
@@ -3307,7 +3706,7 @@ static void dumpSvg(int modc, SmiModule **modv, int flags, char *output)
 	exit(1);
     }
 
-    xfree(link);
+    xfree(linkUrl);
 }
 
 
@@ -3325,6 +3724,10 @@ void initSvg()
 	  "show deprecated and obsolete items"},
 	{ "static-output", OPT_FLAG, &STATIC_OUTPUT, 0,
 	  "disable all interactivity (e.g. for printing)"},
+	{ "exact-layout", OPT_FLAG, &EXACT_LAYOUT, 0,
+	  "compute the layout forces exactly (slow)"},
+	{ "jobs", OPT_INT, &LAYOUT_JOBS, 0,
+	  "number of threads laying out components (default=processors)"},
         { 0, OPT_END, 0, 0 }
     };
 
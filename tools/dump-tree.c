@@ -25,6 +25,24 @@
 static int pmodc = 0;
 static SmiModule **pmodv = NULL;
 
+/*
+ * The names of the pmodv modules are hashed, and the decisions of
+ * pruneSubTree() are cached per node while a tree is printed. Both
+ * tables have a power of two number of buckets.
+ */
+
+typedef struct PruneEntry {
+    SmiNode           *smiNode;
+    int               prune;
+    struct PruneEntry *nextPtr;
+} PruneEntry;
+
+static char **moduleTable = NULL;
+static int moduleTableSize = 0;
+static PruneEntry **pruneTable = NULL;
+static int pruneTableSize = 0;
+static int pruneTableCount = 0;
+
 static int ignoreconformance = 0;
 static int ignoreleafs = 0;
 static int full = 0;
@@ -154,15 +172,133 @@ static void fprintObjects(FILE *f, SmiNode *smiNode)
 
 
 
+static unsigned int hashName(const char *name)
+{
+    unsigned int h = 0;
+
+    for (; *name; name++) {
+	h = 31 * h + (unsigned char) *name;
+    }
+    return h;
+}
+
+
+
+static unsigned int hashNode(SmiNode *smiNode)
+{
+    unsigned long h = (unsigned long) smiNode;
+
+    h ^= h >> 16;
+    h *= 0x45d9f3bUL;
+    h ^= h >> 16;
+    return (unsigned int) h;
+}
+
+
+
+static void initPruning()
+{
+    unsigned int h;
+    int i;
+
+    for (moduleTableSize = 16; moduleTableSize < 2 * pmodc;
+	 moduleTableSize *= 2);
+    moduleTable = xmalloc(moduleTableSize * sizeof(char *));
+    memset(moduleTable, 0, moduleTableSize * sizeof(char *));
+    for (i = 0; i < pmodc; i++) {
+	for (h = hashName(pmodv[i]->name) & (moduleTableSize - 1);
+	     moduleTable[h] && strcmp(moduleTable[h], pmodv[i]->name);
+	     h = (h + 1) & (moduleTableSize - 1));
+	moduleTable[h] = pmodv[i]->name;
+    }
+
+    pruneTableSize = 1024;
+    pruneTableCount = 0;
+    pruneTable = xmalloc(pruneTableSize * sizeof(PruneEntry *));
+    memset(pruneTable, 0, pruneTableSize * sizeof(PruneEntry *));
+}
+
+
+
+static void exitPruning()
+{
+    PruneEntry *entry, *nextEntry;
+    int i;
+
+    for (i = 0; i < pruneTableSize; i++) {
+	for (entry = pruneTable[i]; entry; entry = nextEntry) {
+	    nextEntry = entry->nextPtr;
+	    xfree(entry);
+	}
+    }
+    xfree(pruneTable);
+    xfree(moduleTable);
+    pruneTable = NULL;
+    moduleTable = NULL;
+}
+
+
+
+static PruneEntry *findPruneEntry(SmiNode *smiNode)
+{
+    PruneEntry *entry;
+
+    for (entry = pruneTable[hashNode(smiNode) & (pruneTableSize - 1)];
+	 entry; entry = entry->nextPtr) {
+	if (entry->smiNode == smiNode) {
+	    return entry;
+	}
+    }
+    return NULL;
+}
+
+
+
+static void addPruneEntry(SmiNode *smiNode, int prune)
+{
+    PruneEntry *entry, *nextEntry, **oldTable;
+    int i, oldSize;
+    unsigned int h;
+
+    if (pruneTableCount >= pruneTableSize) {
+	oldTable = pruneTable;
+	oldSize = pruneTableSize;
+	pruneTableSize *= 2;
+	pruneTable = xmalloc(pruneTableSize * sizeof(PruneEntry *));
+	memset(pruneTable, 0, pruneTableSize * sizeof(PruneEntry *));
+	for (i = 0; i < oldSize; i++) {
+	    for (entry = oldTable[i]; entry; entry = nextEntry) {
+		nextEntry = entry->nextPtr;
+		h = hashNode(entry->smiNode) & (pruneTableSize - 1);
+		entry->nextPtr = pruneTable[h];
+		pruneTable[h] = entry;
+	    }
+	}
+	xfree(oldTable);
+    }
+
+    entry = xmalloc(sizeof(PruneEntry));
+    entry->smiNode = smiNode;
+    entry->prune = prune;
+    h = hashNode(smiNode) & (pruneTableSize - 1);
+    entry->nextPtr = pruneTable[h];
+    pruneTable[h] = entry;
+    pruneTableCount++;
+}
+
+
+
 static int isPartOfLoadedModules(SmiNode *smiNode)
 {
     SmiModule *smiModule;
-    int i;
+    unsigned int h;
     
     smiModule = smiGetNodeModule(smiNode);
 
-    for (i = 0; i < pmodc; i++) {
-	if (strcmp(pmodv[i]->name, smiModule->name) == 0) {
+    for (h = hashName(smiModule->name) & (moduleTableSize - 1);
+	 moduleTable[h];
+	 h = (h + 1) & (moduleTableSize - 1)) {
+	if (strcmp(moduleTable[h], smiModule->name) == 0) {
 	    return 1;
 	}
     }
@@ -170,18 +306,20 @@ static int isPartOfLoadedModules(SmiNode *smiNode)
 }
 
 /*
- * The following function pruneSubTree() is tricky. There are some
+ * The following function checkSubTree() is tricky. There are some
  * interactions between the supported options. See the detailed
  * comments below. Good examples to test the implemented behaviour
  * are:
  *
- * smidump -u -f tree --tree-no-leaf IF-MIB ETHER-CHIPSET-MIB
+ * smidump -u -f tree --tree-no-leafs IF-MIB ETHER-CHIPSET-MIB
  *
  * (And the example above does _not_ work in combination with
  * --tree-no-conformance so the code below is still broken.)
  */
 
-static int pruneSubTree(SmiNode *smiNode)
+static int pruneSubTree(SmiNode *smiNode);
+
+static int checkSubTree(SmiNode *smiNode)
 {
     SmiNode   *childNode;
 
@@ -266,6 +404,33 @@ static int pruneSubTree(SmiNode *smiNode)
 
 
 
+/*
+ * The decision for a node depends on the decisions for its subtree.
+ * Each node is checked only once while printing a tree, which keeps
+ * the whole dump linear in the size of the tree.
+ */
+
+static int pruneSubTree(SmiNode *smiNode)
+{
+    PruneEntry *entry;
+    int        prune;
+
+    if (! smiNode) {
+	return 1;
+    }
+
+    entry = findPruneEntry(smiNode);
+    if (entry) {
+	return entry->prune;
+    }
+
+    prune = checkSubTree(smiNode);
+    addPruneEntry(smiNode, prune);
+    return prune;
+}
+
+
+
 static void fprintSubTree(FILE *f, SmiNode *smiNode,
 			  char *prefix, size_t typefieldlen)
 {
@@ -425,6 +590,8 @@ static void fprintTree(FILE *f)
     SmiNode *nextNode;
     int cnt;
     
+    initPruning();
+
     smiNode = smiGetNode(NULL, "iso");
 
     if (! full) {
@@ -448,6 +615,8 @@ static void fprintTree(FILE *f)
     if (smiNode) {
 	fprintSubTree(f, smiNode, "", 0);
     }
+
+    exitPruning();
 }
 
 
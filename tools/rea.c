@@ -75,6 +75,10 @@ int       SHOW_DEPRECATED       = 0; /* false, show deprecated objects */
 int       SHOW_DEPR_OBSOLETE    = 0; /* false, show deprecated and
 					obsolete objects */
 int       STATIC_OUTPUT         = 0; /* false, enable interactivity */
+int       EXACT_LAYOUT          = 0; /* false, approximate the forces of
+					the springembedder */
+int       LAYOUT_JOBS           = 0; /* threads laying out components,
+					0 for one per processor */
 /* variables for cm-driver */
 int       XPLAIN                = 0; /* false, generates ASCII output */
 int       XPLAIN_DEBUG          = 0; /* false, generates additional
@@ -148,6 +152,112 @@ static int strpfxlen(const char *s1, const char *s2)
 
 
 
+/*
+ * graphHashPointer
+ *
+ * Returns the bucket of a pointer in a hash table of size buckets
+ * (a power of two).
+ */
+static unsigned int graphHashPointer(const void *ptr, int size)
+{
+    unsigned long h = (unsigned long) ptr;
+
+    h ^= h >> 16;
+    h *= 0x45d9f3bUL;
+    h ^= h >> 16;
+    return (unsigned int) (h & (size - 1));
+}
+
+/*
+ * graphHashString
+ *
+ * Returns the bucket of a string in a hash table of size buckets
+ * (a power of two).
+ */
+static unsigned int graphHashString(const char *str, int size)
+{
+    unsigned int h = 0;
+
+    for (; *str; str++) {
+	h = 31 * h + (unsigned char) *str;
+    }
+    return h & (size - 1);
+}
+
+/*
+ * graphHashNode
+ *
+ * Adds a node to the hash table of the graph, which is keyed by the
+ * name pointer of the node's smiNode (see graphGetNode). The table
+ * is doubled when it gets too full.
+ */
+static void graphHashNode(Graph *graph, GraphNode *node)
+{
+    GraphNode    *tNode, *nextNode, **oldTable;
+    int          i, oldSize;
+    unsigned int h;
+
+    if (graph->numNodes > graph->nodeTableSize) {
+	oldTable = graph->nodeTable;
+	oldSize = graph->nodeTableSize;
+	graph->nodeTableSize = oldSize ? 2 * oldSize : 64;
+	graph->nodeTable = xmalloc(graph->nodeTableSize * sizeof(GraphNode *));
+	memset(graph->nodeTable, 0, graph->nodeTableSize * sizeof(GraphNode *));
+	for (i = 0; i < oldSize; i++) {
+	    for (tNode = oldTable[i]; tNode; tNode = nextNode) {
+		nextNode = tNode->nextHashNode;
+		h = graphHashPointer(tNode->smiNode->name,
+				     graph->nodeTableSize);
+		tNode->nextHashNode = graph->nodeTable[h];
+		graph->nodeTable[h] = tNode;
+	    }
+	}
+	xfree(oldTable);
+    }
+
+    h = graphHashPointer(node->smiNode->name, graph->nodeTableSize);
+    node->nextHashNode = graph->nodeTable[h];
+    graph->nodeTable[h] = node;
+}
+
+/*
+ * graphFreeTypes
+ *
+ * Frees the index of the types used by the tables (see algGetTypeTable).
+ */
+static void graphFreeTypes(Graph *graph)
+{
+    GraphType *tType, *nextType;
+    int       i;
+
+    for (i = 0; i < graph->typeTableSize; i++) {
+	for (tType = graph->typeTable[i]; tType; tType = nextType) {
+	    nextType = tType->nextPtr;
+	    xfree(tType);
+	}
+    }
+    xfree(graph->typeTable);
+    graph->typeTable = NULL;
+    graph->typeTableSize = 0;
+}
+
+/*
+ * graphCreate
+ *
+ *          Creates a new empty graph.
+ *
+ * Result : pointer to the new graph
+ */
+Graph *graphCreate(void)
+{
+    Graph *newGraph;
+
+    newGraph = xmalloc(sizeof(Graph));
+    memset(newGraph, 0, sizeof(Graph));
+
+    return newGraph;
+}
+
 /*
  * graphInsertNode
  *
@@ -158,24 +268,25 @@ static int strpfxlen(const char *s1, const char *s2)
 GraphNode *graphInsertNode(Graph *graph, SmiNode *smiNode)
 {
     GraphNode *newNode;
-    GraphNode *tNode;
-    GraphNode *lastNode;
 
     newNode = xmalloc(sizeof(GraphNode));
     memset(newNode, 0, sizeof(GraphNode));
     newNode->smiNode = smiNode;
+    newNode->seq = graph->numNodes++;
 
-    if (graph->nodes == NULL) {
+    if (graph->lastNode == NULL) {
 	graph->nodes = newNode;
-	return newNode;
+    } else {
+	graph->lastNode->nextPtr = newNode;
     }
+    graph->lastNode = newNode;
 
-    lastNode = NULL; 
-    for (tNode = graph->nodes; tNode; tNode = tNode->nextPtr) {
-	lastNode = tNode;
-    }
+    graphHashNode(graph, newNode);
 
-    lastNode->nextPtr = newNode;
+    /* a new table may use any type, rebuild the index on demand */
+    if (graph->typeTable) {
+	graphFreeTypes(graph);
+    }
 
     return newNode;
 }
@@ -190,26 +301,83 @@ GraphNode *graphInsertNode(Graph *graph, SmiNode *smiNode)
 GraphComponent *graphInsertComponent(Graph *graph)
 {
     GraphComponent *newComponent;
-    GraphComponent *tComponent;
-    GraphComponent *lastComponent;
 
     newComponent = xmalloc(sizeof(GraphComponent));
     memset(newComponent, 0, sizeof(GraphComponent));
 
-    if (graph->components == NULL) {
+    if (graph->lastComponent == NULL) {
 	graph->components = newComponent;
-	return newComponent;
+    } else {
+	graph->lastComponent->nextPtr = newComponent;
     }
+    graph->lastComponent = newComponent;
+
+    return newComponent;
+}
+
+/*
+ * graphNextEdgePtr
+ *
+ * Returns the link to the edge following edge in the list of edges
+ * adjacent to node. A loop is only linked as an edge of its startNode.
+ */
+static GraphEdge **graphNextEdgePtr(GraphEdge *edge, GraphNode *node)
+{
+    return (edge->startNode == node)
+	? &edge->nextStartEdge : &edge->nextEndEdge;
+}
 
-    lastComponent = NULL;
-    for (tComponent = graph->components; tComponent;
-					    tComponent = tComponent->nextPtr) {
-	lastComponent = tComponent;
+/*
+ * graphLinkEdgeToNode, graphLinkEdge
+ *
+ * Inserts an edge into the lists of edges adjacent to its start and
+ * end node. The lists are ordered like the list of all edges.
+ */
+static void graphLinkEdgeToNode(GraphEdge *edge, GraphNode *node)
+{
+    GraphEdge **link;
+
+    for (link = &node->firstEdge;
+	 *link && (*link)->seq < edge->seq;
+	 link = graphNextEdgePtr(*link, node));
+
+    *graphNextEdgePtr(edge, node) = *link;
+    *link = edge;
+}
+
+static void graphLinkEdge(GraphEdge *edge)
+{
+    graphLinkEdgeToNode(edge, edge->startNode);
+    if (edge->endNode != edge->startNode) {
+	graphLinkEdgeToNode(edge, edge->endNode);
     }
+}
+
+/*
+ * graphUnlinkEdgeFromNode, graphUnlinkEdge
+ *
+ * Removes an edge from the lists of edges adjacent to its start and
+ * end node.
+ */
+static void graphUnlinkEdgeFromNode(GraphEdge *edge, GraphNode *node)
+{
+    GraphEdge **link;
 
-    lastComponent->nextPtr = newComponent;
+    for (link = &node->firstEdge;
+	 *link && *link != edge;
+	 link = graphNextEdgePtr(*link, node));
 
-    return newComponent;
+    if (*link) {
+	*link = *graphNextEdgePtr(edge, node);
+    }
+}
+
+static void graphUnlinkEdge(GraphEdge *edge)
+{
+    graphUnlinkEdgeFromNode(edge, edge->startNode);
+    if (edge->endNode != edge->startNode) {
+	graphUnlinkEdgeFromNode(edge, edge->endNode);
+    }
 }
 
 /*
@@ -230,11 +398,10 @@ static GraphEdge *graphInsertEdge(Graph *graph, GraphNode *startNode,
 			      GraphEnhIndex enhancedindex)
 {
     GraphEdge *newEdge;
-    GraphEdge *tEdge;
-    GraphEdge *lastEdge;
 
     newEdge = xmalloc(sizeof(GraphEdge));
     memset(newEdge, 0, sizeof(GraphEdge));
+    newEdge->seq = graph->numEdges++;
     newEdge->startNode = startNode;
     newEdge->endNode = endNode;
     newEdge->indexkind = indexkind;
@@ -262,17 +429,14 @@ static GraphEdge *graphInsertEdge(Graph *graph, GraphNode *startNode,
 	break;
     }
 
-    if (graph->edges == NULL) {
+    if (graph->lastEdge == NULL) {
 	graph->edges = newEdge;
-	return newEdge;
+    } else {
+	graph->lastEdge->nextPtr = newEdge;
     }
+    graph->lastEdge = newEdge;
 
-    lastEdge = NULL; 
-    for (tEdge = graph->edges; tEdge; tEdge = tEdge->nextPtr) {
-	lastEdge = tEdge;
-    }
-
-    lastEdge->nextPtr = newEdge;
+    graphLinkEdge(newEdge);
 
     return newEdge;
 }
@@ -316,7 +480,9 @@ void graphExit(Graph *graph)
       
 	    xfree(dummyComponent);
 	}
-    
+
+	graphFreeTypes(graph);
+	xfree(graph->nodeTable);
 	xfree(graph);
     }
 }
@@ -328,20 +494,11 @@ void graphExit(Graph *graph)
  */
 GraphEdge *graphGetFirstEdgeByNode(Graph *graph, GraphNode *node)
 {
-    GraphEdge *tEdge;
-
     if (!graph || !node) {
 	return NULL;
     }
-    
-    for (tEdge = graph->edges; tEdge; tEdge = tEdge->nextPtr) {
-	/*if (tEdge->startNode->smiNode->name == node->smiNode->name ||
-	  tEdge->endNode->smiNode->name == node->smiNode->name) break;*/
-	if (cmpSmiNodes(tEdge->startNode->smiNode, node->smiNode) ||
-	    cmpSmiNodes(tEdge->endNode->smiNode, node->smiNode)) break;
-    }
 
-    return tEdge;
+    return node->firstEdge;
 }
 
 /*
@@ -354,30 +511,11 @@ GraphEdge *graphGetNextEdgeByNode(Graph *graph,
 					 GraphEdge *edge,
 					 GraphNode *node) 
 {
-    GraphEdge *tEdge;
-
-    if (!graph || !node) {
+    if (!graph || !edge || !node) {
 	return NULL;
     }
-    
-    for (tEdge = graph->edges; tEdge; tEdge = tEdge->nextPtr) {
-	/*if (tEdge->startNode->smiNode->name ==
-	    edge->startNode->smiNode->name &&
-	    tEdge->endNode->smiNode->name ==
-	    edge->endNode->smiNode->name) break;*/
-	if (cmpSmiNodes(tEdge->startNode->smiNode,edge->startNode->smiNode) &&
-	    cmpSmiNodes(tEdge->endNode->smiNode,edge->endNode->smiNode))
-	    break;
-    }
-  
-    for (tEdge = tEdge->nextPtr; tEdge; tEdge = tEdge->nextPtr) {
-	/*if (tEdge->startNode->smiNode->name == node->smiNode->name ||
-	  tEdge->endNode->smiNode->name == node->smiNode->name) break;*/
-	if (cmpSmiNodes(tEdge->startNode->smiNode, node->smiNode) ||
-	    cmpSmiNodes(tEdge->endNode->smiNode, node->smiNode)) break;
-    }
 
-    return tEdge;
+    return *graphNextEdgePtr(edge, node);
 }
 
 /*
@@ -395,12 +533,9 @@ static int graphCheckForRedundantEdge(Graph *graph,
 	return 0;
     }
     
-    for (tEdge = graph->edges; tEdge; tEdge = tEdge->nextPtr) {
-	/*if (tEdge->startNode->smiNode->name == startNode->smiNode->name &&
-	  tEdge->endNode->smiNode->name == endNode->smiNode->name) {*/
-	if (cmpSmiNodes(tEdge->startNode->smiNode, startNode->smiNode) &&
-	    cmpSmiNodes(tEdge->endNode->smiNode, endNode->smiNode)) {
-	    
+    for (tEdge = startNode->firstEdge; tEdge;
+	 tEdge = *graphNextEdgePtr(tEdge, startNode)) {
+	if (tEdge->startNode == startNode && tEdge->endNode == endNode) {
 	    return 1;
 	}
     }
@@ -417,11 +552,13 @@ static GraphNode *graphGetNode(Graph *graph, SmiNode *smiNode)
 {
     GraphNode *tNode;
 
-    if (!smiNode || !graph) {
+    if (!smiNode || !graph || !graph->nodeTable) {
 	return NULL;
     }
     
-    for (tNode = graph->nodes; tNode; tNode = tNode->nextPtr) {
+    for (tNode = graph->nodeTable[graphHashPointer(smiNode->name,
+						   graph->nodeTableSize)];
+	 tNode; tNode = tNode->nextHashNode) {
 	if (tNode->smiNode->name == smiNode->name) {
 	    break;
 	}
@@ -854,46 +991,89 @@ int isBaseType(SmiNode *node)
     return 0;
 }
 
+/*
+ * algGetTypeTable
+ *
+ * Returns the first table (in the order of the nodes) using the type
+ * typeName in its index. The index from type names to tables is built
+ * on the first call and dropped when a node is added to the graph.
+ */
+static GraphNode *algGetTypeTable(const char *typeName)
+{
+    SmiElement   *smiElement;
+    GraphNode    *tNode;
+    GraphType    *tType;
+    char         *name;
+    unsigned int h;
+
+    if (!graph->typeTable) {
+	for (graph->typeTableSize = 64;
+	     graph->typeTableSize < 2 * graph->numNodes;
+	     graph->typeTableSize *= 2);
+	graph->typeTable = xmalloc(graph->typeTableSize * sizeof(GraphType *));
+	memset(graph->typeTable, 0, graph->typeTableSize * sizeof(GraphType *));
+
+	for (tNode = graph->nodes; tNode; tNode = tNode->nextPtr) {
+	    if (tNode->smiNode->nodekind != SMI_NODEKIND_TABLE) continue;
+
+	    for (smiElement = smiGetFirstElement(
+		smiGetFirstChildNode(tNode->smiNode));
+		 smiElement;
+		 smiElement = smiGetNextElement(smiElement)) {
+		name = algGetTypeName(smiGetElementNode(smiElement));
+		if (!name) continue;
+
+		h = graphHashString(name, graph->typeTableSize);
+		for (tType = graph->typeTable[h]; tType;
+		     tType = tType->nextPtr) {
+		    if (strcmp(tType->name, name) == 0) break;
+		}
+		if (tType) continue;
+
+		tType = xmalloc(sizeof(GraphType));
+		tType->name = name;
+		tType->table = tNode;
+		tType->nextPtr = graph->typeTable[h];
+		graph->typeTable[h] = tType;
+	    }
+	}
+    }
+
+    h = graphHashString(typeName, graph->typeTableSize);
+    for (tType = graph->typeTable[h]; tType; tType = tType->nextPtr) {
+	if (strcmp(tType->name, typeName) == 0) {
+	    return tType->table;
+	}
+    }
+
+    return NULL;
+}
+
 /*
  * algFindEqualType
  *
  * Looks in all tables indices for an equal type to the type used in typeNode.
- * It returns the first table found which is different to startTable.
+ * It returns the first table found which precedes startTable.
  *
  * Subroutine for algCheckForDependency. 
  */
 static SmiNode *algFindEqualType(SmiNode *startTable, SmiNode *typeNode)
 {
-    SmiElement *smiElement;
-    SmiNode    *tSmiNode;
     char       *typeName;
-    GraphNode  *tNode;
+    GraphNode  *tNode, *startNode;
     
     typeName = algGetTypeName(typeNode);
     /* if (isBaseType(typeNode)) return NULL; */
+    if (!typeName) return NULL;
 
-    for (tNode = graph->nodes; tNode; tNode = tNode->nextPtr) {
-	if (tNode->smiNode->nodekind == SMI_NODEKIND_TABLE) {
+    tNode = algGetTypeTable(typeName);
+    if (!tNode) return NULL;
 
-	    tSmiNode = tNode->smiNode;
-	    if (cmpSmiNodes(tSmiNode, startTable) == 1) break;
-	    
-	    for (smiElement = smiGetFirstElement(
-		smiGetFirstChildNode(tSmiNode));
-		 smiElement;
-		 smiElement = smiGetNextElement(smiElement)) {
-		/* found type matching ? */
-		if (strcmp(typeName,
-			       algGetTypeName(smiGetElementNode
-					      (smiElement))) == 0) {
-		    return tSmiNode;
-		}
-	    }
-	    
-	}
-    }
-    
-    return NULL;
+    /* only the tables in front of startTable are searched */
+    startNode = graphGetNode(graph, startTable);
+    if (startNode && startNode->seq <= tNode->seq) return NULL;
+
+    return tNode->smiNode;
 }
 
 /*
@@ -1359,7 +1539,9 @@ void algCheckLinksByName()
       
 	    /* better connection found -> changing the edge */
 	    if (newEdge) {
+		graphUnlinkEdge(tEdge);
 		tEdge->startNode = newEdge->endNode;
+		graphLinkEdge(tEdge);
 	    }
 	}
     }
@@ -1370,16 +1552,40 @@ void algCheckLinksByName()
     }
 }
 
+/*
+ * algCmpNodeNames, algCmpNodeSeqs
+ *
+ * qsort() helpers ordering graph nodes by name or by their position
+ * in the list of nodes.
+ */
+static int algCmpNodeNames(const void *p1, const void *p2)
+{
+    GraphNode *n1 = *(GraphNode **) p1, *n2 = *(GraphNode **) p2;
+    int       c;
+
+    c = strcmp(n1->smiNode->name, n2->smiNode->name);
+    return c ? c : n1->seq - n2->seq;
+}
+
+static int algCmpNodeSeqs(const void *p1, const void *p2)
+{
+    return (*(GraphNode **) p1)->seq - (*(GraphNode **) p2)->seq;
+}
+
 /*
  * algLinkObjectsByNames
  *
  * Links Scalars to Tables using the prefix
  * Links Tables to Tables using the prefix
+ *
+ * The nodes are sorted by name, so the nodes sharing a prefix of a
+ * given length with a node are its neighbours in the sorted array.
  */
 static void algLinkObjectsByNames()
 {
-    GraphNode *tNode, *tNode2;
+    GraphNode *tNode, *tNode2, **sorted, **found;
     int       overlap,minoverlap,new;
+    int       *rank, i, j, dir, numFound;
 
     /* getting the minimum overlap for all nodes */
     minoverlap = 10000;
@@ -1395,17 +1601,32 @@ static void algLinkObjectsByNames()
      * prefix overlap of one is too short to create any usefull edges
      */
     if (minoverlap == 1) return;
+
+    sorted = xmalloc((graph->numNodes + 1) * sizeof(GraphNode *));
+    found = xmalloc((graph->numNodes + 1) * sizeof(GraphNode *));
+    rank = xmalloc((graph->numNodes + 1) * sizeof(int));
+    for (tNode = graph->nodes, i = 0; tNode; tNode = tNode->nextPtr) {
+	sorted[i++] = tNode;
+    }
+    qsort(sorted, graph->numNodes, sizeof(GraphNode *), algCmpNodeNames);
+    for (i = 0; i < graph->numNodes; i++) {
+	rank[sorted[i]->seq] = i;
+    }
     
     for (tNode = graph->nodes; tNode; tNode = tNode->nextPtr) {    
 	if (!graphGetFirstEdgeByNode(graph, tNode)) {
 	    overlap = minoverlap;
 
-	    for (tNode2 = graph->nodes; tNode2; tNode2 = tNode2->nextPtr) {
-		if (cmpSmiNodes(tNode->smiNode, tNode2->smiNode)) continue;
-		
-		new = strpfxlen(tNode->smiNode->name, tNode2->smiNode->name);
-		
-		if (new >= overlap) {
+	    /* the overlap only shrinks with the distance in sorted */
+	    for (dir = -1; dir <= 1; dir += 2) {
+		for (j = rank[tNode->seq] + dir;
+		     j >= 0 && j < graph->numNodes; j += dir) {
+		    tNode2 = sorted[j];
+		    new = strpfxlen(tNode->smiNode->name,
+				    tNode2->smiNode->name);
+		    if (new <= overlap) break;
+
+		    if (cmpSmiNodes(tNode->smiNode, tNode2->smiNode)) continue;
 
 		    /*
 		     * no scalar - scalar edges
@@ -1430,44 +1651,59 @@ static void algLinkObjectsByNames()
 	    }
 
 	    if (overlap == minoverlap) continue;
-	    
-	    new = 0;
-	    for (tNode2 = graph->nodes; tNode2; tNode2 = tNode2->nextPtr) {
-		if (cmpSmiNodes(tNode->smiNode, tNode2->smiNode)) continue;
 
-		new = strpfxlen(tNode->smiNode->name, tNode2->smiNode->name);
-		
-		if (new == overlap && new > minoverlap) {
+	    /* the candidates are linked in the order of the nodes */
+	    numFound = 0;
+	    for (dir = -1; dir <= 1; dir += 2) {
+		for (j = rank[tNode->seq] + dir;
+		     j >= 0 && j < graph->numNodes; j += dir) {
+		    tNode2 = sorted[j];
+		    new = strpfxlen(tNode->smiNode->name,
+				    tNode2->smiNode->name);
+		    if (new < overlap) break;
+		    if (new == overlap &&
+			!cmpSmiNodes(tNode->smiNode, tNode2->smiNode)) {
+			found[numFound++] = tNode2;
+		    }
+		}
+	    }
+	    qsort(found, numFound, sizeof(GraphNode *), algCmpNodeSeqs);
+	    
+	    for (i = 0; i < numFound; i++) {
+		tNode2 = found[i];
 
-		    /*
-		     * a scalar should only be adjacent to one node
-		     */
-		    if (tNode2->smiNode->nodekind == SMI_NODEKIND_SCALAR &&
-			graphGetFirstEdgeByNode(graph,tNode2)) continue;
-		    if (tNode->smiNode->nodekind == SMI_NODEKIND_SCALAR &&
-			graphGetFirstEdgeByNode(graph,tNode)) continue;    
+		/*
+		 * a scalar should only be adjacent to one node
+		 */
+		if (tNode2->smiNode->nodekind == SMI_NODEKIND_SCALAR &&
+		    graphGetFirstEdgeByNode(graph,tNode2)) continue;
+		if (tNode->smiNode->nodekind == SMI_NODEKIND_SCALAR &&
+		    graphGetFirstEdgeByNode(graph,tNode)) continue;    
 
-		    /*
-		     * adding only table -> scalar edges
-		     */
-		    if (tNode->smiNode->nodekind == SMI_NODEKIND_SCALAR &&
-			tNode2->smiNode->nodekind == SMI_NODEKIND_SCALAR) {
-			continue;
-		    }
+		/*
+		 * adding only table -> scalar edges
+		 */
+		if (tNode->smiNode->nodekind == SMI_NODEKIND_SCALAR &&
+		    tNode2->smiNode->nodekind == SMI_NODEKIND_SCALAR) {
+		    continue;
+		}
 		    
-		    if (tNode->smiNode->nodekind == SMI_NODEKIND_SCALAR) {
-			algInsertEdge(tNode2->smiNode, tNode->smiNode,
-				      SMI_INDEX_UNKNOWN,
-				      GRAPH_ENHINDEX_NAMES);
-		    } else {
-			algInsertEdge(tNode->smiNode, tNode2->smiNode,
-				      SMI_INDEX_UNKNOWN,
-				      GRAPH_ENHINDEX_NAMES);
-		    }
+		if (tNode->smiNode->nodekind == SMI_NODEKIND_SCALAR) {
+		    algInsertEdge(tNode2->smiNode, tNode->smiNode,
+				  SMI_INDEX_UNKNOWN,
+				  GRAPH_ENHINDEX_NAMES);
+		} else {
+		    algInsertEdge(tNode->smiNode, tNode2->smiNode,
+				  SMI_INDEX_UNKNOWN,
+				  GRAPH_ENHINDEX_NAMES);
 		}
 	    }
 	}
     }
+
+    xfree(sorted);
+    xfree(found);
+    xfree(rank);
 }
 
 
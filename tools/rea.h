@@ -116,6 +116,9 @@ typedef struct GraphNode {
     GraphComponent   *component;	/* component the node belongs to */
     struct GraphNode *nextComponentNode;
     DiaNode          dia;
+    int              seq;		/* position in the list of nodes */
+    struct GraphNode *nextHashNode;	/* next node in the same bucket */
+    struct GraphEdge *firstEdge;	/* adjacent edges, ordered by seq */
 } GraphNode;
 
 typedef struct GraphEdge {
@@ -128,12 +131,35 @@ typedef struct GraphEdge {
     GraphEnhIndex    enhancedindex;
     int              use;		/* use edge in the layout-algorithm */
     DiaEdge	     dia;
+    int              seq;		/* position in the list of edges */
+    struct GraphEdge *nextStartEdge;	/* next edge adjacent to startNode */
+    struct GraphEdge *nextEndEdge;	/* next edge adjacent to endNode */
 } GraphEdge;
 
+/*
+ * An entry of the index from type names to the tables which use the
+ * type in their index.
+ */
+
+typedef struct GraphType {
+    struct GraphType *nextPtr;
+    char             *name;
+    GraphNode        *table;
+} GraphType;
+
 typedef struct Graph {
     GraphNode      *nodes;
     GraphEdge      *edges;
     GraphComponent *components;
+    GraphNode      *lastNode;
+    GraphEdge      *lastEdge;
+    GraphComponent *lastComponent;
+    int            numNodes;
+    int            numEdges;
+    GraphNode      **nodeTable;		/* nodes hashed by smiNode->name */
+    int            nodeTableSize;
+    GraphType      **typeTable;		/* built on demand, see graphGetTypes */
+    int            typeTableSize;
 } Graph;
 
 
@@ -146,6 +172,8 @@ extern int CANVASWIDTH;
 extern int SHOW_DEPRECATED;
 extern int SHOW_DEPR_OBSOLETE;
 extern int STATIC_OUTPUT;
+extern int EXACT_LAYOUT;
+extern int LAYOUT_JOBS;
 extern int XPLAIN;
 extern int XPLAIN_DEBUG;
 extern int SUPPRESS_DEPRECATED;
@@ -182,6 +210,8 @@ extern GraphNode *graphInsertNode(Graph *graph, SmiNode *smiNode);
 
 extern GraphComponent *graphInsertComponent(Graph *graph);
 
+extern Graph *graphCreate(void);
+
 extern void graphExit(Graph *graph);
 
 extern GraphEdge *graphGetFirstEdgeByNode(Graph *graph, GraphNode *node);
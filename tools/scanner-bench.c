@@ -0,0 +1,220 @@
+/*
+ * scanner-bench.c --
+ *
+ *      Scanner benchmark. Reads the given module files into memory
+ *      and runs the SMIv2 and the SMIng scanner (as far as they are
+ *      configured) over all of them without parsing, reporting the
+ *      number of tokens and the throughput of each scanner in MB/s.
+ *
+ * See the file "COPYING" for information on usage and redistribution
+ * of this file, and for a DISCLAIMER OF ALL WARRANTIES.
+ */
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "smi.h"
+#include "data.h"
+#include "shhopt.h"
+
+
+
+/*
+ * The scanners are called directly. Both parsers define their own
+ * YYSTYPE, so the token value is kept in a union that is large enough
+ * for either of them. Identifiers are duplicated by the scanners and
+ * not freed here.
+ */
+
+typedef union Value {
+    char	*text;
+    char	pad[64];
+} Value;
+
+#ifdef BACKEND_SMI
+extern void *smiEnterLexBuffer(char *data, size_t len, int inPlace);
+extern void smiLeaveLexBuffer(void *outerBuffer);
+extern int smilex(void *lvalp, void *parser);
+#endif
+
+#ifdef BACKEND_SMING
+extern void *smingEnterLexBuffer(char *data, size_t len, int inPlace);
+extern void smingLeaveLexBuffer(void *outerBuffer);
+extern int sminglex(void *lvalp, void *parser);
+#endif
+
+typedef struct Scanner {
+    const char *name;
+    void *(*enter)(char *data, size_t len, int inPlace);
+    void (*leave)(void *outerBuffer);
+    int (*lex)(void *lvalp, void *parser);
+} Scanner;
+
+static Scanner scanners[] = {
+#ifdef BACKEND_SMI
+    { "smi",   smiEnterLexBuffer,   smiLeaveLexBuffer,   smilex },
+#endif
+#ifdef BACKEND_SMING
+    { "sming", smingEnterLexBuffer, smingLeaveLexBuffer, sminglex },
+#endif
+    { NULL, NULL, NULL, NULL }
+};
+
+static int rounds = 5;
+
+
+
+static double now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+
+
+static char *readFile(const char *path, size_t *len)
+{
+    FILE *file;
+    char *data = NULL;
+    size_t size = 0, n;
+
+    *len = 0;
+    file = fopen(path, "r");
+    if (! file) {
+	return NULL;
+    }
+    do {
+	if (*len == size) {
+	    size = size ? 2 * size : 65536;
+	    data = realloc(data, size);
+	    if (! data) {
+		fclose(file);
+		return NULL;
+	    }
+	}
+	n = fread(data + *len, 1, size - *len, file);
+	*len += n;
+    } while (n > 0);
+    fclose(file);
+    return data;
+}
+
+
+
+static void ignoreErrors(char *path, int line, int severity,
+			 char *msg, char *tag)
+{
+}
+
+
+
+static void usage()
+{
+    fprintf(stderr,
+	    "Usage: scanner-bench [options] file [file ...]\n"
+	    "  -h, --help                show usage information\n"
+	    "  -n, --rounds=number       scans of all files (default 5)\n");
+}
+
+
+
+static void help() { usage(); exit(0); }
+
+
+
+int main(int argc, char *argv[])
+{
+    char **data;
+    size_t *len, bytes;
+    unsigned long tokens;
+    double start, elapsed;
+    Scanner *scannerPtr;
+    Parser parser;
+    Module module;
+    Value value;
+    void *outerBuffer;
+    int i, j, numFiles;
+
+    static optStruct opt[] = {
+	/* short long              type        var/func       special       */
+	{ 'h', "help",           OPT_FLAG,   help,          OPT_CALLFUNC },
+	{ 'n', "rounds",         OPT_INT,    &rounds,       0 },
+	{ 0, 0, OPT_END, 0, 0 }  /* no more options */
+    };
+
+    optParseOptions(&argc, argv, opt, 0);
+
+    if (argc < 2 || rounds < 1) {
+	usage();
+	exit(1);
+    }
+    numFiles = argc - 1;
+
+    data = calloc(numFiles, sizeof(char *));
+    len = calloc(numFiles, sizeof(size_t));
+    if (! data || ! len) {
+	fprintf(stderr, "scanner-bench: out of memory\n");
+	exit(1);
+    }
+    for (i = 0, bytes = 0; i < numFiles; i++) {
+	data[i] = readFile(argv[i+1], &len[i]);
+	if (! data[i]) {
+	    fprintf(stderr, "scanner-bench: cannot read `%s'\n", argv[i+1]);
+	    exit(1);
+	}
+	bytes += len[i];
+    }
+
+    smiInit("scanner-bench");
+    smiSetErrorLevel(0);
+    smiSetErrorHandler(ignoreErrors);
+
+    /*
+     * Some actions of the SMIv2 scanner look at the module being
+     * parsed, e.g. to check the range of numbers.
+     */
+
+    memset(&module, 0, sizeof(Module));
+    module.export.name = "";
+    module.export.language = SMI_LANGUAGE_SMIV2;
+    memset(&parser, 0, sizeof(Parser));
+    parser.modulePtr = &module;
+
+    printf("files:        %d\n", numFiles);
+    printf("bytes:        %lu\n", (unsigned long) bytes);
+    for (scannerPtr = scanners; scannerPtr->name; scannerPtr++) {
+	tokens = 0;
+	start = now();
+	for (j = 0; j < rounds; j++) {
+	    for (i = 0; i < numFiles; i++) {
+		parser.path = argv[i+1];
+		parser.line = 1;
+		outerBuffer = scannerPtr->enter(data[i], len[i], 0);
+		while (scannerPtr->lex(&value, &parser)) {
+		    tokens++;
+		}
+		scannerPtr->leave(outerBuffer);
+	    }
+	}
+	elapsed = now() - start;
+	printf("%-6s tokens: %lu, %.3f s, %.1f MB/s\n", scannerPtr->name,
+	       tokens / rounds, elapsed,
+	       elapsed > 0 ? bytes * (double) rounds / elapsed / 1e6 : 0.0);
+    }
+
+    smiExit();
+
+    for (i = 0; i < numFiles; i++) {
+	free(data[i]);
+    }
+    free(data);
+    free(len);
+
+    return 0;
+}
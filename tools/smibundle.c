@@ -0,0 +1,383 @@
+/*
+ * smibundle.c --
+ *
+ *      Build a bundle file from directories of modules.
+ *
+ * Copyright (c) 1999 Frank Strauss, Technical University of Braunschweig.
+ *
+ * See the file "COPYING" for information on usage and redistribution
+ * of this file, and for a DISCLAIMER OF ALL WARRANTIES.
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef HAVE_DIRENT_H
+#include <dirent.h>
+#endif
+#ifdef HAVE_WIN_H
+#include "win.h"
+#endif
+
+#include "smi.h"
+#include "shhopt.h"
+#include "bundle.h"
+
+
+
+typedef struct Entry {
+    char	*name;
+    char	*path;
+    char	*data;
+    size_t	len;
+} Entry;
+
+static Entry *entries = NULL;
+static int numEntries = 0;
+
+static char *output = NULL;
+static int verbose = 0;
+
+
+
+static void *
+xmalloc(size_t size)
+{
+    void *p = malloc(size);
+
+    if (! p) {
+	fprintf(stderr, "smibundle: out of memory\n");
+	exit(1);
+    }
+    return p;
+}
+
+
+
+static void *
+xrealloc(void *ptr, size_t size)
+{
+    void *p = realloc(ptr, size);
+
+    if (! p) {
+	fprintf(stderr, "smibundle: out of memory\n");
+	exit(1);
+    }
+    return p;
+}
+
+
+
+static int
+cmpEntries(const void *a, const void *b)
+{
+    return strcmp(((const Entry *) a)->name, ((const Entry *) b)->name);
+}
+
+
+
+static int
+cmpNames(const void *a, const void *b)
+{
+    return strcmp(*(char * const *) a, *(char * const *) b);
+}
+
+
+
+static char *
+readFile(const char *path, size_t *len)
+{
+    FILE *file;
+    char *data;
+    long size;
+
+    file = fopen(path, "rb");
+    if (! file) {
+	return NULL;
+    }
+    if (fseek(file, 0, SEEK_END) < 0 || (size = ftell(file)) < 0) {
+	fclose(file);
+	return NULL;
+    }
+    rewind(file);
+    data = xmalloc(size ? size : 1);
+    if (fread(data, 1, size, file) != (size_t) size) {
+	free(data);
+	fclose(file);
+	return NULL;
+    }
+    fclose(file);
+    *len = size;
+    return data;
+}
+
+
+
+/*
+ * Add the module in the given file. Files that do not contain a
+ * module are skipped silently. If a module is found twice, the
+ * first file wins, just like in a search along the module path.
+ */
+
+static void
+addFile(const char *path)
+{
+    SmiModuleSummary *summary;
+    Entry *entryPtr;
+    int i;
+
+    summary = smiScanModule(path);
+    if (! summary) {
+	if (verbose) {
+	    fprintf(stderr, "smibundle: skipping `%s'\n", path);
+	}
+	return;
+    }
+
+    if (strlen(summary->name) > 255) {
+	fprintf(stderr, "smibundle: module name `%s' too long, "
+		"skipping `%s'\n", summary->name, path);
+	smiFreeModuleSummary(summary);
+	return;
+    }
+
+    for (i = 0; i < numEntries; i++) {
+	if (! strcmp(entries[i].name, summary->name)) {
+	    fprintf(stderr, "smibundle: module `%s' in `%s' ignored, "
+		    "already taken from `%s'\n",
+		    summary->name, path, entries[i].path);
+	    smiFreeModuleSummary(summary);
+	    return;
+	}
+    }
+
+    entries = xrealloc(entries, (numEntries + 1) * sizeof(Entry));
+    entryPtr = &entries[numEntries];
+    entryPtr->data = readFile(path, &entryPtr->len);
+    if (! entryPtr->data) {
+	fprintf(stderr, "smibundle: cannot read `%s': %s\n",
+		path, strerror(errno));
+	smiFreeModuleSummary(summary);
+	return;
+    }
+    entryPtr->name = strdup(summary->name);
+    entryPtr->path = strdup(path);
+    numEntries++;
+
+    if (verbose) {
+	fprintf(stderr, "smibundle: adding module `%s' from `%s'\n",
+		summary->name, path);
+    }
+    smiFreeModuleSummary(summary);
+}
+
+
+
+static void
+addDirectory(const char *dir)
+{
+#ifdef HAVE_DIRENT_H
+    DIR *d;
+    struct dirent *de;
+    struct stat st;
+    char **names = NULL, *path;
+    int i, num = 0;
+
+    d = opendir(dir);
+    if (! d) {
+	fprintf(stderr, "smibundle: cannot read directory `%s'\n", dir);
+	return;
+    }
+    while ((de = readdir(d))) {
+	if (de->d_name[0] == '.') {
+	    continue;
+	}
+	path = xmalloc(strlen(dir) + strlen(de->d_name) + 2);
+	sprintf(path, "%s%c%s", dir, DIR_SEPARATOR, de->d_name);
+	if (stat(path, &st) < 0 || ! S_ISREG(st.st_mode)) {
+	    free(path);
+	    continue;
+	}
+	names = xrealloc(names, (num + 1) * sizeof(char *));
+	names[num++] = path;
+    }
+    closedir(d);
+
+    if (num) {
+	qsort(names, num, sizeof(char *), cmpNames);
+    }
+    for (i = 0; i < num; i++) {
+	addFile(names[i]);
+	free(names[i]);
+    }
+    free(names);
+#else
+    fprintf(stderr, "smibundle: cannot read directory `%s'\n", dir);
+#endif
+}
+
+
+
+static void
+putUInt32(unsigned char *p, unsigned long value)
+{
+    p[0] = (value >> 24) & 0xff;
+    p[1] = (value >> 16) & 0xff;
+    p[2] = (value >> 8) & 0xff;
+    p[3] = value & 0xff;
+}
+
+
+
+/*
+ * Write the bundle: the header, the index sorted by module names and
+ * the module texts in the same order.
+ */
+
+static int
+writeBundle(const char *path)
+{
+    FILE *file;
+    unsigned char buf[BUNDLE_ENTRY_LEN];
+    unsigned long offset, dataOffset;
+    size_t nameLen;
+    int i;
+
+    qsort(entries, numEntries, sizeof(Entry), cmpEntries);
+
+    dataOffset = BUNDLE_HEADER_LEN;
+    for (i = 0; i < numEntries; i++) {
+	dataOffset += BUNDLE_ENTRY_LEN + strlen(entries[i].name);
+    }
+    for (i = 0, offset = dataOffset; i < numEntries; i++) {
+	if (entries[i].len > 0xffffffffUL - offset) {
+	    fprintf(stderr, "smibundle: bundle too large\n");
+	    return -1;
+	}
+	offset += entries[i].len;
+    }
+
+    file = fopen(path, "wb");
+    if (! file) {
+	fprintf(stderr, "smibundle: cannot open `%s' for writing: %s\n",
+		path, strerror(errno));
+	return -1;
+    }
+
+    fwrite(BUNDLE_MAGIC, 1, BUNDLE_MAGIC_LEN, file);
+    putUInt32(buf, numEntries);
+    fwrite(buf, 1, 4, file);
+
+    for (i = 0, offset = dataOffset; i < numEntries; i++) {
+	nameLen = strlen(entries[i].name);
+	putUInt32(buf, offset);
+	putUInt32(buf + 4, entries[i].len);
+	buf[8] = BUNDLE_ENCODING_STORED;
+	buf[9] = nameLen;
+	fwrite(buf, 1, BUNDLE_ENTRY_LEN, file);
+	fwrite(entries[i].name, 1, nameLen, file);
+	offset += entries[i].len;
+    }
+    for (i = 0; i < numEntries; i++) {
+	fwrite(entries[i].data, 1, entries[i].len, file);
+    }
+
+    if (ferror(file) | fclose(file)) {
+	fprintf(stderr, "smibundle: cannot write `%s': %s\n",
+		path, strerror(errno));
+	return -1;
+    }
+    return 0;
+}
+
+
+
+static void
+usage()
+{
+    fprintf(stderr,
+	    "Usage: smibundle [options] -o file directory-or-file ...\n"
+	    "  -V, --version         show version and license information\n"
+	    "  -h, --help            show usage information\n"
+	    "  -c, --config=file     load a specific configuration file\n"
+	    "  -o, --output=file     write the bundle to file\n"
+	    "  -v, --verbose         report the files added and skipped\n");
+}
+
+
+
+static void help() { usage(); exit(0); }
+static void version() { printf("smibundle " SMI_VERSION_STRING "\n"); exit(0); }
+static void config(char *filename) { smiReadConfig(filename, "smibundle"); }
+
+
+
+int
+main(int argc, char *argv[])
+{
+    struct stat st;
+    int i;
+
+    static optStruct opt[] = {
+	/* short long              type        var/func       special       */
+	{ 'h', "help",           OPT_FLAG,   help,          OPT_CALLFUNC },
+	{ 'V', "version",        OPT_FLAG,   version,       OPT_CALLFUNC },
+	{ 'c', "config",         OPT_STRING, config,        OPT_CALLFUNC },
+	{ 'o', "output",         OPT_STRING, &output,       0 },
+	{ 'v', "verbose",        OPT_FLAG,   &verbose,      0 },
+	{ 0, 0, OPT_END, 0, 0 }  /* no more options */
+    };
+
+    for (i = 1; i < argc; i++)
+	if ((strstr(argv[i], "-c") == argv[i]) ||
+	    (strstr(argv[i], "--config") == argv[i])) break;
+    if (i == argc)
+	smiInit("smibundle");
+    else
+	smiInit(NULL);
+
+    optParseOptions(&argc, argv, opt, 0);
+
+    if (! output || argc < 2) {
+	usage();
+	smiExit();
+	exit(1);
+    }
+
+    for (i = 1; i < argc; i++) {
+	if (stat(argv[i], &st) == 0 && S_ISDIR(st.st_mode)) {
+	    addDirectory(argv[i]);
+	} else {
+	    addFile(argv[i]);
+	}
+    }
+
+    if (writeBundle(output) < 0) {
+	smiExit();
+	exit(1);
+    }
+
+    if (verbose) {
+	fprintf(stderr, "smibundle: %d modules written to `%s'\n",
+		numEntries, output);
+    }
+
+    for (i = 0; i < numEntries; i++) {
+	free(entries[i].name);
+	free(entries[i].path);
+	free(entries[i].data);
+    }
+    free(entries);
+
+    smiExit();
+
+    return 0;
+}
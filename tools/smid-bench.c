@@ -0,0 +1,467 @@
+/*
+ * smid-bench.c --
+ *
+ *      Load generator for smid. Opens a number of connections, keeps
+ *      a number of pipelined node lookups in flight on each of them
+ *      and reports the lookup rate and the latency distribution.
+ *      Requests are single node lookups, text batches, or binary
+ *      batches of numeric OIDs.
+ *
+ * See the file "COPYING" for information on usage and redistribution
+ * of this file, and for a DISCLAIMER OF ALL WARRANTIES.
+ */
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+
+#include "shhopt.h"
+
+
+
+typedef struct Conn {
+    int		   fd;
+    double	   *sent;	/* send times of requests in flight (ring) */
+    int		   head;	/* oldest request in flight               */
+    int		   inflight;
+    unsigned long  issued;
+    char	   *out;	/* requests to be sent                    */
+    char	   *buf;	/* responses received                     */
+    size_t	   len;
+    size_t	   size;
+} Conn;
+
+
+
+static char *host = "localhost";
+static char *path = NULL;		/* Unix domain socket */
+static int port = 2578;
+static int numConns = 4;
+static int depth = 16;
+static unsigned long numRequests = 100000;
+static int batchSize = 1;
+static int xFlag = 0;			/* use the binary protocol */
+
+static char **names = NULL;
+static int numNames = 0;
+static unsigned char **oids = NULL;	/* binary encoded names */
+static size_t *oidsLen = NULL;
+static double *latencies = NULL;
+static unsigned long numLatencies = 0;
+
+
+
+static double now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+
+
+static int compare(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+
+    return (x < y) ? -1 : (x > y) ? 1 : 0;
+}
+
+
+
+static int connectTo(const char *hostname, int portnumber)
+{
+    struct hostent *he;
+    struct sockaddr_in addr;
+    int fd, one = 1;
+
+    he = gethostbyname(hostname);
+    if (!he) {
+	fprintf(stderr, "smid-bench: unknown host `%s'\n", hostname);
+	return -1;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(portnumber);
+    memcpy(&addr.sin_addr, he->h_addr, sizeof(addr.sin_addr));
+
+    fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
+	perror("smid-bench: cannot connect");
+	if (fd >= 0) close(fd);
+	return -1;
+    }
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    return fd;
+}
+
+
+
+static int connectLocal(const char *pathname)
+{
+    struct sockaddr_un addr;
+    int fd;
+
+    if (strlen(pathname) >= sizeof(addr.sun_path)) {
+	fprintf(stderr, "smid-bench: socket path `%s' too long\n", pathname);
+	return -1;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, pathname);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
+	perror("smid-bench: cannot connect");
+	if (fd >= 0) close(fd);
+	return -1;
+    }
+    return fd;
+}
+
+
+
+/*
+ * Encode a numeric OID as used in binary requests: an octet with the
+ * number of subids followed by the subids in network byte order.
+ */
+
+static size_t encode(const char *name, unsigned char *p)
+{
+    const char *s = name;
+    char *end;
+    unsigned long subid;
+    size_t len = 1;
+
+    p[0] = 0;
+    while (*s && p[0] < 128) {
+	subid = strtoul(s, &end, 10);
+	if (end == s) {
+	    break;
+	}
+	p[len++] = (subid >> 24) & 0xff;
+	p[len++] = (subid >> 16) & 0xff;
+	p[len++] = (subid >> 8) & 0xff;
+	p[len++] = subid & 0xff;
+	p[0]++;
+	s = (*end == '.') ? end + 1 : end;
+    }
+    if (*s) {
+	fprintf(stderr, "smid-bench: `%s' is not a numeric OID\n", name);
+	exit(1);
+    }
+    return len;
+}
+
+
+
+/*
+ * Append one request carrying batchSize lookups to out.
+ */
+
+static size_t request(Conn *conn, char *out)
+{
+    unsigned char *p = (unsigned char *) out;
+    size_t len;
+    int i;
+
+    if (xFlag) {
+	len = 8;
+	for (i = 0; i < batchSize; i++, conn->issued++) {
+	    memcpy(p + len, oids[conn->issued % numNames],
+		   oidsLen[conn->issued % numNames]);
+	    len += oidsLen[conn->issued % numNames];
+	}
+	p[0] = 0x80;
+	p[1] = 0x01;
+	p[2] = (batchSize >> 8) & 0xff;
+	p[3] = batchSize & 0xff;
+	p[4] = ((len - 8) >> 24) & 0xff;
+	p[5] = ((len - 8) >> 16) & 0xff;
+	p[6] = ((len - 8) >> 8) & 0xff;
+	p[7] = (len - 8) & 0xff;
+	return len;
+    }
+
+    if (batchSize == 1) {
+	return sprintf(out, "node %s oid\n", names[conn->issued++ % numNames]);
+    }
+
+    len = sprintf(out, "batch");
+    for (i = 0; i < batchSize; i++, conn->issued++) {
+	len += sprintf(out + len, " %s", names[conn->issued % numNames]);
+    }
+    out[len++] = '\n';
+    return len;
+}
+
+
+
+/*
+ * Send as many requests as the pipeline depth permits. All requests
+ * are written with a single write() call.
+ */
+
+static int issue(Conn *conn, unsigned long *remaining)
+{
+    char *out = conn->out;
+    size_t len = 0;
+    double t = now();
+
+    while (conn->inflight < depth && *remaining > 0) {
+	len += request(conn, out + len);
+	conn->sent[(conn->head + conn->inflight) % depth] = t;
+	conn->inflight++;
+	(*remaining)--;
+    }
+
+    if (len && write(conn->fd, out, len) != (ssize_t) len) {
+	perror("smid-bench: write failed");
+	return -1;
+    }
+    return 0;
+}
+
+
+
+static void complete(Conn *conn, double t)
+{
+    if (conn->inflight > 0) {
+	latencies[numLatencies++] = t - conn->sent[conn->head];
+	conn->head = (conn->head + 1) % depth;
+	conn->inflight--;
+    }
+}
+
+
+
+/*
+ * Consume responses. A text response is complete when we see a line
+ * with a blank after the three digit code. A binary response is
+ * complete when the header and all records have been received.
+ */
+
+static int collect(Conn *conn)
+{
+    ssize_t n;
+    unsigned char *p;
+    char *q, *line;
+    size_t length;
+    double t;
+
+    n = read(conn->fd, conn->buf + conn->len, conn->size - conn->len);
+    if (n <= 0) {
+	fprintf(stderr, "smid-bench: connection closed by server\n");
+	return -1;
+    }
+    conn->len += n;
+    t = now();
+
+    line = conn->buf;
+    while (line < conn->buf + conn->len) {
+	if (xFlag) {
+	    p = (unsigned char *) line;
+	    if (conn->buf + conn->len - line < 8) {
+		break;
+	    }
+	    length = (p[4] << 24) | (p[5] << 16) | (p[6] << 8) | p[7];
+	    if (p[1] != 0x81) {
+		fprintf(stderr, "smid-bench: error response from server\n");
+		return -1;
+	    }
+	    if ((size_t) (conn->buf + conn->len - line) < 8 + length) {
+		break;
+	    }
+	    complete(conn, t);
+	    line += 8 + length;
+	} else {
+	    q = memchr(line, '\n', conn->len - (line - conn->buf));
+	    if (!q) {
+		break;
+	    }
+	    if (q - line > 3 && line[3] == ' ') {
+		complete(conn, t);
+	    }
+	    line = q + 1;
+	}
+    }
+    conn->len -= line - conn->buf;
+    memmove(conn->buf, line, conn->len);
+    return 0;
+}
+
+
+
+static void usage()
+{
+    fprintf(stderr,
+	    "Usage: smid-bench [options] name [name ...]\n"
+	    "  -h, --help                show usage information\n"
+	    "  -H, --host=host           connect to host (default localhost)\n"
+	    "  -P, --port=port           connect to TCP port (default 2578)\n"
+	    "  -u, --unix=path           connect to a Unix domain socket\n"
+	    "  -c, --connections=number  number of connections (default 4)\n"
+	    "  -d, --depth=number        requests in flight per connection (default 16)\n"
+	    "  -n, --requests=number     total number of requests (default 100000)\n"
+	    "  -b, --batch=number        lookups per request (default 1)\n"
+	    "  -x, --binary              use the binary protocol (numeric OIDs only)\n");
+}
+
+
+
+static void help() { usage(); exit(0); }
+
+
+
+int main(int argc, char *argv[])
+{
+    Conn *conns;
+    struct pollfd *pfds;
+    unsigned long remaining;
+    double start, elapsed;
+    int i, active;
+    size_t maxlen;
+
+    static optStruct opt[] = {
+	/* short long              type        var/func       special       */
+	{ 'h', "help",           OPT_FLAG,   help,          OPT_CALLFUNC },
+	{ 'H', "host",           OPT_STRING, &host,         0 },
+	{ 'u', "unix",           OPT_STRING, &path,         0 },
+	{ 'P', "port",           OPT_INT,    &port,         0 },
+	{ 'c', "connections",    OPT_INT,    &numConns,     0 },
+	{ 'd', "depth",          OPT_INT,    &depth,        0 },
+	{ 'n', "requests",       OPT_ULONG,  &numRequests,  0 },
+	{ 'b', "batch",          OPT_INT,    &batchSize,    0 },
+	{ 'x', "binary",         OPT_FLAG,   &xFlag,        0 },
+	{ 0, 0, OPT_END, 0, 0 }  /* no more options */
+    };
+
+    optParseOptions(&argc, argv, opt, 0);
+
+    if (argc < 2 || numConns < 1 || depth < 1 || numRequests < 1
+	|| batchSize < 1 || batchSize > 65535) {
+	usage();
+	exit(1);
+    }
+    names = &argv[1];
+    numNames = argc - 1;
+
+    maxlen = 0;
+    oids = calloc(numNames, sizeof(unsigned char *));
+    oidsLen = calloc(numNames, sizeof(size_t));
+    for (i = 0; i < numNames; i++) {
+	if (xFlag) {
+	    oids[i] = malloc(1 + 4 * 128);
+	    oidsLen[i] = encode(names[i], oids[i]);
+	}
+	if (strlen(names[i]) + 1 > maxlen) maxlen = strlen(names[i]) + 1;
+	if (oidsLen[i] > maxlen) maxlen = oidsLen[i];
+    }
+    /* the largest request and the largest response */
+    maxlen = 16 + batchSize * (maxlen > 136 ? maxlen : 136);
+
+    conns = calloc(numConns, sizeof(Conn));
+    pfds = calloc(numConns, sizeof(struct pollfd));
+    latencies = malloc(numRequests * sizeof(double));
+    if (!conns || !pfds || !latencies) {
+	fprintf(stderr, "smid-bench: out of memory\n");
+	exit(1);
+    }
+
+    for (i = 0; i < numConns; i++) {
+	conns[i].fd = path ? connectLocal(path) : connectTo(host, port);
+	conns[i].sent = malloc(depth * sizeof(double));
+	conns[i].out = malloc(depth * maxlen);
+	conns[i].size = depth * maxlen;
+	conns[i].buf = malloc(conns[i].size);
+	if (conns[i].fd < 0 || !conns[i].sent
+	    || !conns[i].out || !conns[i].buf) {
+	    exit(1);
+	}
+	conns[i].issued = i * batchSize;
+	pfds[i].fd = conns[i].fd;
+	pfds[i].events = POLLIN;
+    }
+
+    remaining = numRequests;
+    start = now();
+    for (i = 0; i < numConns; i++) {
+	if (issue(&conns[i], &remaining) < 0) {
+	    exit(1);
+	}
+    }
+
+    do {
+	if (poll(pfds, numConns, -1) < 0) {
+	    if (errno == EINTR) continue;
+	    perror("smid-bench: poll failed");
+	    exit(1);
+	}
+	active = 0;
+	for (i = 0; i < numConns; i++) {
+	    if (pfds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+		if (collect(&conns[i]) < 0) {
+		    exit(1);
+		}
+		if (issue(&conns[i], &remaining) < 0) {
+		    exit(1);
+		}
+	    }
+	    active += conns[i].inflight;
+	}
+    } while (active > 0);
+    elapsed = now() - start;
+
+    qsort(latencies, numLatencies, sizeof(double), compare);
+
+    printf("connections:  %d\n", numConns);
+    printf("depth:        %d\n", depth);
+    printf("batch:        %d%s\n", batchSize, xFlag ? " (binary)" : "");
+    printf("requests:     %lu\n", numLatencies);
+    printf("lookups:      %lu\n", numLatencies * batchSize);
+    printf("elapsed:      %.3f s\n", elapsed);
+    printf("lookups/s:    %.0f\n",
+	   elapsed > 0 ? numLatencies * batchSize / elapsed : 0.0);
+    if (numLatencies) {
+	printf("latency p50:  %.1f us\n",
+	       latencies[numLatencies / 2] * 1e6);
+	printf("latency p99:  %.1f us\n",
+	       latencies[(numLatencies * 99) / 100] * 1e6);
+	printf("latency max:  %.1f us\n",
+	       latencies[numLatencies - 1] * 1e6);
+    }
+
+    for (i = 0; i < numConns; i++) {
+	close(conns[i].fd);
+	free(conns[i].sent);
+	free(conns[i].out);
+	free(conns[i].buf);
+    }
+    for (i = 0; i < numNames; i++) {
+	free(oids[i]);
+    }
+    free(oids);
+    free(oidsLen);
+    free(conns);
+    free(pfds);
+    free(latencies);
+
+    return 0;
+}
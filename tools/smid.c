@@ -1,47 +1,195 @@
 /*
- * Brainstorming....
+ * smid.c --
  *
- * command name
- * command element name
- * command element name
+ *      SMI lookup daemon. Answers node lookup requests of many
+ *      clients over TCP or a Unix domain socket. One or more worker
+ *      threads, each running its own epoll(7) event loop, share the
+ *      set of loaded modules, which is not modified while it is in
+ *      use. A reload loads a new set in the background and swaps it
+ *      in without interrupting the clients.
  *
- * command: node, type
+ * Copyright (c) 1999 Frank Strauss, Technical University of Braunschweig.
  *
- * element: name, module, oid, type, basetype, declaration, nodekind, access
- *	    status, description, reference
+ * See the file "COPYING" for information on usage and redistribution
+ * of this file, and for a DISCLAIMER OF ALL WARRANTIES.
+ */
+
+/*
+ * Protocol:
+ *
+ * A request is a single line:
+ *
+ *   help
+ *   quit
+ *   node <name> [<element> ...]
+ *   batch <name> [<name> ...]
+ *   reload
+ *
+ * element: name, oid, type, nodekind, format, status, access
+ *
+ * name: name, module::name, module.name, oid, each optionally followed
+ *	 by an instance identifier (e.g. IF-MIB::ifDescr.3)
+ *
+ * Each request is answered by one or more lines of the form
+ * "XXX-text" where the last line of a response has the form
+ * "XXX text". The three digit code XXX indicates the kind of the
+ * information (1xx) or an error (4xx, 5xx). Clients may send any
+ * number of requests without waiting for the responses (pipelining).
+ * Responses are sent in the order of the requests.
  *
- * name: name, module.name, oid
+ * A batch request is answered by one line per name, in the order of
+ * the names: "120 <oid> <module>::<name>[.<instance>]" if the name is
+ * known and "504 <name>" otherwise.
  *
+ * Binary requests may be mixed with text requests on the same
+ * connection. A binary message starts with the octet 0x80, which can
+ * never start a text request. All integers are in network byte order:
  *
- * response: XXXYZZZZZZ....
+ *   header:  uint8  magic (0x80)
+ *            uint8  type
+ *            uint16 count (number of OIDs or records)
+ *            uint32 length (number of octets following the header)
  *
+ * A request of type 0x01 carries count OIDs, each encoded as an uint8
+ * number of subids followed by the uint32 subids. The response of
+ * type 0x81 carries count records of SMID_RECORD_SIZE octets:
+ *
+ *            uint8  result (0 = known, 1 = unknown)
+ *            uint8  prefix (number of subids that identify the node,
+ *                           the remaining subids are the instance)
+ *            uint8  access
+ *            uint8  status
+ *            uint16 nodekind
+ *            uint16 basetype
+ *            char   module[64] (NUL padded)
+ *            char   name[64]   (NUL padded)
+ *
+ * A malformed binary request is answered by a header of type 0xff
+ * and the connection is closed.
  */
 
+#include <config.h>
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdarg.h>
 #include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
 #include <sys/types.h>
-#include <sys/fcntl.h>
-#include <sys/errno.h>
-#include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/un.h>
 #include <netinet/in.h>
-#include <netdb.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
 #include <syslog.h>
+#include <pthread.h>
+
+#include "smi.h"
+#include "shhopt.h"
+
+/*
+ * The workers select the current data set through the libsmi handle,
+ * which has to be specific to each thread. Otherwise a reload would
+ * change the data set under the feet of the other workers.
+ */
+#ifndef HAVE_THREAD_LOCAL
+#error "smid needs thread local storage (see configure)"
+#endif
+
+
 
+#define SMID_PORT		2578
+#define SMID_MAX_CLIENTS	1024	/* default connection limit          */
+#define SMID_MAX_WORKERS	64	/* max number of worker threads      */
+#define SMID_MAX_EVENTS		256	/* events handled per epoll_wait()   */
+#define SMID_MAX_REQUEST	262144	/* max length of a request           */
+#define SMID_MAX_PENDING	1048576	/* stop reading if more output queued */
+#define SMID_READ_SIZE		16384
 
-#include <smi.h>
+#define SMID_BINARY_MAGIC	0x80
+#define SMID_BINARY_LOOKUP	0x01
+#define SMID_BINARY_RESULT	0x81
+#define SMID_BINARY_ERROR	0xff
+#define SMID_HEADER_SIZE	8
+#define SMID_RECORD_SIZE	136
+#define SMID_RECORD_NAME	64
 
 
 
-#define SMID_PORT	 2578
-#define SMID_MAX_CLIENTS 8
+typedef struct Buffer {
+    char	*data;
+    size_t	len;		/* number of valid octets in data        */
+    size_t	off;		/* number of octets already consumed     */
+    size_t	size;		/* allocated size of data                */
+} Buffer;
 
+typedef struct Listener {
+    int		fd;
+    int		family;		/* AF_INET or AF_UNIX                    */
+} Listener;
 
+typedef struct Worker {
+    pthread_t	thread;
+    int		epfd;
+    int		wakeup[2];	/* pipe used to announce a reload        */
+    unsigned int generation;	/* of the data set used by this worker   */
+    Listener	tcp;		/* own socket if SO_REUSEPORT is used    */
+    Listener	local;		/* shared by all workers                 */
+} Worker;
 
-char *smiStringStatus(SmiStatus status)
+typedef struct Client {
+    Worker	*worker;
+    int		fd;
+    int		local;		/* connected via the Unix domain socket  */
+    char	addr[64];
+    Buffer	in;
+    Buffer	out;
+    size_t	last;		/* offset of the last response line      */
+    int		closing;	/* close as soon as out has been flushed */
+    int		eof;		/* the client will not send more requests */
+    int		reading;	/* EPOLLIN is enabled                    */
+    int		writing;	/* EPOLLOUT is enabled                   */
+} Client;
+
+
+
+static int flags;
+static int errorLevel = -1;
+static char *configFile = NULL;
+static char **modules = NULL;
+static int numModules = 0;
+static int dFlag = 0;				/* log each request  */
+static int port = SMID_PORT;
+static char *path = NULL;			/* Unix domain socket */
+static int maxClients = SMID_MAX_CLIENTS;
+static int numWorkers = 1;
+static Worker *workers = NULL;
+
+static int numClients = 0;			/* of all workers    */
+static pthread_mutex_t clientsMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * The loaded modules form the libsmi data set "smid:<generation>".
+ * Each worker selects the current data set for its thread. A reload
+ * loads the next generation, waits until all workers have switched to
+ * it and frees the previous one. The mutex also serializes all calls
+ * of smiInit() and smiExit().
+ */
+
+static unsigned int generation = 0;
+static pthread_mutex_t reloadMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t reloadCond = PTHREAD_COND_INITIALIZER;
+
+
+
+static char *stringStatus(SmiStatus status)
 {
     return
 	(status == SMI_STATUS_CURRENT)     ? "current" :
@@ -52,7 +200,9 @@ char *smiStringStatus(SmiStatus status)
 					     "<unknown>";
 }
 
-char *smiStringAccess(SmiAccess access)
+
+
+static char *stringAccess(SmiAccess access)
 {
     return
 	(access == SMI_ACCESS_NOT_ACCESSIBLE) ? "not-accessible" :
@@ -62,46 +212,9 @@ char *smiStringAccess(SmiAccess access)
 						"<unknown>";
 }
 
-char *smiStringLanguage(SmiLanguage language)
-{
-    return
-	(language == SMI_LANGUAGE_UNKNOWN)    ? "<UNKNOWN>" :
-	(language == SMI_LANGUAGE_SMIV1)      ? "SMIv1" :
-	(language == SMI_LANGUAGE_SMIV2)      ? "SMIv2" :
-	(language == SMI_LANGUAGE_SMING)      ? "SMIng" :
-						"<unknown>";
-}
 
-char *smiStringDecl(SmiDecl macro)
-{
-    return
-        (macro == SMI_DECL_UNKNOWN)           ? "<UNKNOWN>" :
-        (macro == SMI_DECL_TYPEASSIGNMENT)    ? "<TYPE-ASSIGNMENT>" :
-        (macro == SMI_DECL_VALUEASSIGNMENT)   ? "<VALUE-ASSIGNMENT>" :
-        (macro == SMI_DECL_OBJECTTYPE)        ? "OBJECT-TYPE" :
-        (macro == SMI_DECL_OBJECTIDENTITY)    ? "OBJECT-IDENTITY" :
-        (macro == SMI_DECL_MODULEIDENTITY)    ? "MODULE-IDENTITY" :
-        (macro == SMI_DECL_NOTIFICATIONTYPE)  ? "NOTIFICATIONTYPE" :
-        (macro == SMI_DECL_TRAPTYPE)          ? "TRAP-TYPE" :
-        (macro == SMI_DECL_OBJECTGROUP)       ? "OBJECT-GROUP" :
-        (macro == SMI_DECL_NOTIFICATIONGROUP) ? "NOTIFICATION-GROUP" :
-        (macro == SMI_DECL_MODULECOMPLIANCE)  ? "MODULE-COMPLIANCE" :
-        (macro == SMI_DECL_AGENTCAPABILITIES) ? "AGENT-CAPABILITIES" :
-        (macro == SMI_DECL_TEXTUALCONVENTION) ? "TEXTUAL-CONVENTION" :
-        (macro == SMI_DECL_MODULE)	      ? "module" :
-        (macro == SMI_DECL_TYPEDEF)	      ? "typedef" :
-        (macro == SMI_DECL_NODE)	      ? "node" :
-        (macro == SMI_DECL_SCALAR)	      ? "scalar" :
-        (macro == SMI_DECL_TABLE)	      ? "table" :
-        (macro == SMI_DECL_ROW)		      ? "row" :
-        (macro == SMI_DECL_COLUMN)	      ? "column" :
-        (macro == SMI_DECL_NOTIFICATION)      ? "notification" :
-        (macro == SMI_DECL_GROUP)	      ? "group" :
-        (macro == SMI_DECL_COMPLIANCE)	      ? "compliance" :
-                                                "<unknown>";
-}
-
-char *smiStringNodekind(SmiNodekind nodekind)
+
+static char *stringNodekind(SmiNodekind nodekind)
 {
     return
         (nodekind == SMI_NODEKIND_UNKNOWN)      ? "<UNKNOWN>" :
@@ -113,296 +226,1243 @@ char *smiStringNodekind(SmiNodekind nodekind)
         (nodekind == SMI_NODEKIND_NOTIFICATION) ? "notification" :
         (nodekind == SMI_NODEKIND_GROUP)        ? "group" :
         (nodekind == SMI_NODEKIND_COMPLIANCE)   ? "compliance" :
+        (nodekind == SMI_NODEKIND_CAPABILITIES) ? "capabilities" :
                                                   "<unknown>";
 }
 
-char *smiStringBasetype(SmiBasetype basetype)
+
+
+/*
+ * An abbreviation of a keyword is accepted, e.g. "n" or "no" for
+ * "node".
+ */
+
+static int prefix(const char *keyword, const char *s)
 {
-    return
-        (basetype == SMI_BASETYPE_UNKNOWN)           ? "<UNKNOWN>" :
-        (basetype == SMI_BASETYPE_OCTETSTRING)       ? "OctetString" :
-        (basetype == SMI_BASETYPE_OBJECTIDENTIFIER)  ? "ObjectIdentifier" :
-        (basetype == SMI_BASETYPE_UNSIGNED32)        ? "Unsigned32" :
-        (basetype == SMI_BASETYPE_INTEGER32)         ? "Integer32" :
-        (basetype == SMI_BASETYPE_UNSIGNED64)        ? "Unsigned64" :
-        (basetype == SMI_BASETYPE_INTEGER64)         ? "Integer64" :
-        (basetype == SMI_BASETYPE_FLOAT32)           ? "Float32" :
-        (basetype == SMI_BASETYPE_FLOAT64)           ? "Float64" :
-        (basetype == SMI_BASETYPE_FLOAT128)          ? "Float128" :
-        (basetype == SMI_BASETYPE_ENUM)              ? "Enumeration" :
-        (basetype == SMI_BASETYPE_BITS)              ? "Bits" :
-                                                   "<unknown>";
+    size_t len = strlen(s);
+
+    if (!len) {
+	return 0;
+    }
+
+    return len <= strlen(keyword) && strncasecmp(keyword, s, len) == 0;
 }
 
 
 
-int prefix(char *gaga, char *ga)
+static int bufferReserve(Buffer *buf, size_t len)
 {
-    char *g;
-    int i, len; rc;
-    
-    g = strdup(ga);
-    len = strlen(g);
-    for (i=0; i < len; i++) {
-	g[i] = (char)tolower((int)g[i]);
+    size_t size;
+    char *data;
+
+    if (buf->off && buf->off == buf->len) {
+	buf->off = buf->len = 0;
+    }
+
+    if (buf->len + len <= buf->size) {
+	return 0;
     }
-    rc = (strstr(gaga, g) == gaga);
-    free(g);
-    return rc;
+
+    if (buf->off) {
+	memmove(buf->data, buf->data + buf->off, buf->len - buf->off);
+	buf->len -= buf->off;
+	buf->off = 0;
+	if (buf->len + len <= buf->size) {
+	    return 0;
+	}
+    }
+
+    for (size = buf->size ? buf->size : 4096; size < buf->len + len;
+	 size *= 2);
+    data = realloc(buf->data, size);
+    if (!data) {
+	return -1;
+    }
+    buf->data = data;
+    buf->size = size;
+    return 0;
 }
 
 
 
-void print(int fd, int code, char *fmt, ...)
+static void bufferFree(Buffer *buf)
+{
+    free(buf->data);
+    buf->data = NULL;
+    buf->len = buf->off = buf->size = 0;
+}
+
+
+
+static void print(Client *client, int code, const char *fmt, ...)
 {
     va_list ap;
-    char s[200], ss[200];
-    char *p;
-    
-    va_start(ap, fmt);
-    vsprintf(s, fmt, ap);
-    va_end(ap);
+    int n;
 
-    
-    sprintf(ss, "%03d %s\n", code, s);
-    
-    syslog(LOG_NOTICE, "fd %d -> %s", fd, ss);
-    write(fd, ss, strlen(ss));
+    if (bufferReserve(&client->out, 128)) {
+	client->closing = 1;
+	return;
+    }
+
+    while (1) {
+	size_t avail = client->out.size - client->out.len;
+	n = snprintf(client->out.data + client->out.len, avail,
+		     "%03d-", code);
+	va_start(ap, fmt);
+	n += vsnprintf(client->out.data + client->out.len + n,
+		       avail > (size_t) n ? avail - n : 0, fmt, ap);
+	va_end(ap);
+	if ((size_t) n + 1 < avail) {
+	    break;
+	}
+	if (bufferReserve(&client->out, n + 2)) {
+	    client->closing = 1;
+	    return;
+	}
+    }
+    client->last = client->out.len;
+    client->out.len += n;
+    client->out.data[client->out.len++] = '\n';
 }
 
 
 
-char *formatoid(unsigned int oidlen, SmiSubid *oid)
+/*
+ * Mark the last line of a response by turning the "XXX-" prefix
+ * into "XXX ".
+ */
+
+static void done(Client *client)
 {
-    static char ss[2000];
-    int i;
-    
-    ss[0] = 0;
-    for (i=0; i < oidlen; i++) {
-        if (i) strcat(ss, ".");
-        sprintf(&ss[strlen(ss)], "%u", oid[i]);
+    if (client->out.len > client->last + 3) {
+	client->out.data[client->last + 3] = ' ';
     }
-    return ss;
 }
 
 
 
-void work(int fd, char *buf)
+static void printName(Client *client, SmiNode *smiNode)
 {
-    char *cmd, *elem, *name;
-    SmiNode *smiNode;
+    SmiModule *smiModule = smiGetNodeModule(smiNode);
+
+    if (smiModule && smiModule->name && smiModule->name[0]) {
+	print(client, 110, "%s::%s", smiModule->name, smiNode->name);
+    } else {
+	print(client, 110, "%s", smiNode->name);
+    }
+}
+
+
+
+static void printOid(Client *client, SmiSubid *oid, unsigned int oidlen)
+{
+    char s[128 * 11];
+    unsigned int i;
+    int n = 0;
+
+    s[0] = 0;
+    for (i = 0; i < oidlen && n < (int) sizeof(s) - 12; i++) {
+	n += sprintf(s + n, i ? ".%u" : "%u", oid[i]);
+    }
+    print(client, 111, "%s", s);
+}
+
+
+
+static int printType(Client *client, SmiNode *smiNode)
+{
+    SmiType *smiType = smiGetNodeType(smiNode);
     SmiModule *smiModule;
-    int all;
-    
-    syslog(LOG_NOTICE, "fd %d <- %s", fd, buf);
-
-    cmd = strtok(buf, " ");
-    if (cmd) name = strtok(NULL, " ");
-    if (name) elem = strtok(NULL, " "); else elem = NULL;
-
-    if (prefix("help", cmd)) {
-	print(fd, 001, "This is smid - (c) 1999 Frank Strauss, Technical University of Braunschweig.");
-    } else if (prefix("module", cmd)) {
-	smiModule = smiGetModule(name);
-	
-    } else if (prefix("node", cmd)) {
-	if (name) {
-	    smiNode = smiGetNode(name, NULL);
-	    if (!smiNode) {
-		print(fd, 504, "unknown name");
+
+    if (!smiType || !smiType->name) {
+	return 0;
+    }
+
+    smiModule = smiGetTypeModule(smiType);
+    if (smiModule && smiModule->name && smiModule->name[0]) {
+	print(client, 112, "%s::%s", smiModule->name, smiType->name);
+    } else {
+	print(client, 112, "%s", smiType->name);
+    }
+    return 1;
+}
+
+
+
+static void node(Client *client, char *name, char *elem, char **last)
+{
+    SmiNode *smiNode;
+    SmiSubid oid[128];
+    unsigned int oidlen = sizeof(oid)/sizeof(oid[0]);
+
+    if (!name) {
+	print(client, 503, "need a name");
+	return;
+    }
+
+    if (smiParseOID(name, oid, &oidlen) != 0
+	|| !(smiNode = smiGetNodeByOID(oidlen, oid))) {
+	print(client, 504, "unknown name");
+	return;
+    }
+
+    if (!elem) {
+	printName(client, smiNode);
+	printOid(client, oid, oidlen);
+	printType(client, smiNode);
+	if (smiNode->nodekind != SMI_NODEKIND_UNKNOWN) {
+	    print(client, 113, "%s", stringNodekind(smiNode->nodekind));
+	}
+	if (smiNode->format) {
+	    print(client, 114, "%s", smiNode->format);
+	}
+	if (smiNode->status != SMI_STATUS_UNKNOWN) {
+	    print(client, 115, "%s", stringStatus(smiNode->status));
+	}
+	if (smiNode->access != SMI_ACCESS_UNKNOWN) {
+	    print(client, 116, "%s", stringAccess(smiNode->access));
+	}
+	return;
+    }
+
+    for (; elem; elem = strtok_r(NULL, " \t", last)) {
+	if (prefix("name", elem)) {
+	    printName(client, smiNode);
+	} else if (prefix("oid", elem)) {
+	    printOid(client, oid, oidlen);
+	} else if (prefix("type", elem)) {
+	    if (!printType(client, smiNode)) {
+		print(client, 412, "no type");
+	    }
+	} else if (prefix("nodekind", elem)) {
+	    if (smiNode->nodekind != SMI_NODEKIND_UNKNOWN) {
+		print(client, 113, "%s", stringNodekind(smiNode->nodekind));
 	    } else {
-		if (!elem) {
-		    if (smiNode->module) {
-			print(fd, 110, "%s.%s",
-			      smiNode->module, smiNode->name);
-		    } else {
-			print(fd, 110, "%s", smiNode->name);
-		    }
-		    print(fd, 111, "%s",
-			  formatoid(smiNode->oidlen, smiNode->oid));
-		    if (smiNode->typename) {
-			if (smiNode->typemodule) {
-			    print(fd, 112, "%s.%s",
-				  smiNode->typemodule,
-				  smiNode->typename);
-			} else {
-			    print(fd, 112, "%s",
-				  smiNode->typename);
-			}
-		    }
-		    if (smiNode->nodekind != SMI_NODEKIND_UNKNOWN) {
-			print(fd, 113, "%s",
-			      smiStringNodekind(smiNode->nodekind));
-		    }
-		    if (smiNode->format) {
-			print(fd, 114, "%s", smiNode->format);
-		    }
-		    if (smiNode->status != SMI_STATUS_UNKNOWN) {
-			print(fd, 115, "%s",
-			      smiStringStatus(smiNode->status));
-		    }
-		    if (smiNode->access != SMI_ACCESS_UNKNOWN) {
-			print(fd, 116, "%s",
-			      smiStringAccess(smiNode->access));
-		    }
-		} else {
-		    while (elem) {
-			if (prefix("name", elem)) {
-			    if (smiNode->module) {
-				print(fd, 110, "%s.%s",
-				      smiNode->module, smiNode->name);
-			    } else {
-				print(fd, 110, "%s", smiNode->name);
-			    }
-			} else if (prefix("oid", elem)) {
-			    print(fd, 111, "%s",
-				  formatoid(smiNode->oidlen, smiNode->oid));
-			} else if (prefix("type", elem)) {
-			    if (smiNode->typename) {
-				if (smiNode->typemodule) {
-				    print(fd, 112, "%s.%s",
-					  smiNode->typemodule,
-					  smiNode->typename);
-				} else {
-				    print(fd, 112, "%s",
-					  smiNode->typename);
-				}
-			    } else {
-				print(fd, 412, "no type");
-			    }
-			} else if (prefix("nodekind", elem)) {
-			    if (smiNode->nodekind != SMI_NODEKIND_UNKNOWN) {
-				print(fd, 113, "%s",
-				      smiStringNodekind(smiNode->nodekind));
-			    } else {
-				print(fd, 413, "no nodekind");
-			    }
-			} else if (prefix("format", elem)) {
-			    if (smiNode->format) {
-				print(fd, 114, "%s", smiNode->format);
-			    } else {
-				print(fd, 414, "no format");
-			    }
-			} else if (prefix("status", elem)) {
-			    if (smiNode->status != SMI_STATUS_UNKNOWN) {
-				print(fd, 115, "%s",
-				      smiStringStatus(smiNode->status));
-			    } else {
-				print(fd, 415, "no status");
-			    }
-			} else if (prefix("access", elem)) {
-			    if (smiNode->access != SMI_ACCESS_UNKNOWN) {
-				print(fd, 116, "%s",
-				      smiStringAccess(smiNode->access));
-			    } else {
-				print(fd, 416, "no access");
-			    }
-			} else {
-			    print(fd, 410, "unknown element");
-			}
-			elem = strtok(NULL, " ");
-		    }
-		}
+		print(client, 413, "no nodekind");
 	    }
+	} else if (prefix("format", elem)) {
+	    if (smiNode->format) {
+		print(client, 114, "%s", smiNode->format);
+	    } else {
+		print(client, 414, "no format");
+	    }
+	} else if (prefix("status", elem)) {
+	    if (smiNode->status != SMI_STATUS_UNKNOWN) {
+		print(client, 115, "%s", stringStatus(smiNode->status));
+	    } else {
+		print(client, 415, "no status");
+	    }
+	} else if (prefix("access", elem)) {
+	    if (smiNode->access != SMI_ACCESS_UNKNOWN) {
+		print(client, 116, "%s", stringAccess(smiNode->access));
+	    } else {
+		print(client, 416, "no access");
+	    }
+	} else {
+	    print(client, 410, "unknown element");
+	}
+    }
+}
+
+
+
+static void lookup(Client *client, char *name)
+{
+    SmiNode *smiNode;
+    SmiModule *smiModule;
+    SmiSubid oid[128];
+    unsigned int oidlen = sizeof(oid)/sizeof(oid[0]);
+    unsigned int i;
+    char num[128 * 11], inst[128 * 11];
+    int n;
+
+    if (smiParseOID(name, oid, &oidlen) != 0
+	|| !(smiNode = smiGetNodeByOID(oidlen, oid))) {
+	print(client, 504, "%s", name);
+	return;
+    }
+
+    for (i = 0, n = 0; i < oidlen; i++) {
+	n += sprintf(num + n, i ? ".%u" : "%u", oid[i]);
+    }
+    inst[0] = 0;
+    for (i = smiNode->oidlen, n = 0; i < oidlen; i++) {
+	n += sprintf(inst + n, ".%u", oid[i]);
+    }
+
+    smiModule = smiGetNodeModule(smiNode);
+    if (smiModule && smiModule->name && smiModule->name[0]) {
+	print(client, 120, "%s %s::%s%s", num,
+	      smiModule->name, smiNode->name, inst);
+    } else {
+	print(client, 120, "%s %s%s", num, smiNode->name, inst);
+    }
+}
+
+
+
+static void batch(Client *client, char *name, char *next, char **last)
+{
+    if (!name) {
+	print(client, 503, "need a name");
+	return;
+    }
+
+    lookup(client, name);
+    for (; next; next = strtok_r(NULL, " \t", last)) {
+	lookup(client, next);
+    }
+}
+
+
+
+static void work(Client *client, char *buf)
+{
+    char *cmd, *name = NULL, *elem = NULL, *last;
+
+    if (dFlag) {
+	syslog(LOG_DEBUG, "fd %d <- %s", client->fd, buf);
+    }
+
+    cmd = strtok_r(buf, " \t", &last);
+    if (cmd) name = strtok_r(NULL, " \t", &last);
+    if (name) elem = strtok_r(NULL, " \t", &last);
+
+    if (!cmd) {
+	print(client, 502, "empty request");
+    } else if (prefix("help", cmd)) {
+	print(client, 100, "This is smid " SMI_VERSION_STRING
+	      " - (c) 1999 Frank Strauss, Technical University of Braunschweig.");
+	print(client, 100, "node <name> [name|oid|type|nodekind|format|status|access ...]");
+	print(client, 100, "batch <name> [<name> ...]");
+	print(client, 100, "reload");
+	print(client, 100, "quit");
+    } else if (prefix("node", cmd)) {
+	node(client, name, elem, &last);
+    } else if (prefix("batch", cmd)) {
+	batch(client, name, elem, &last);
+    } else if (prefix("reload", cmd)) {
+	if (!client->local) {
+	    print(client, 530, "reload only permitted for local clients");
+	} else if (kill(getpid(), SIGHUP) < 0) {
+	    print(client, 531, "reload failed");
 	} else {
-	    print(fd, 503, "need a name");
+	    print(client, 201, "reload started");
 	}
+    } else if (prefix("quit", cmd)) {
+	print(client, 200, "bye");
+	client->closing = 1;
     } else {
-	print(fd, 501, "unknown command");
+	print(client, 501, "unknown command");
     }
+
+    done(client);
 }
 
 
 
-main(int argc, char *argv[])
+static void update(Client *client)
+{
+    struct epoll_event ev;
+    int reading, writing;
+
+    reading = !client->closing && !client->eof
+	&& client->out.len - client->out.off < SMID_MAX_PENDING;
+    writing = client->out.len > client->out.off;
+
+    if (reading == client->reading && writing == client->writing) {
+	return;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = (reading ? EPOLLIN : 0) | (writing ? EPOLLOUT : 0);
+    ev.data.ptr = client;
+    if (epoll_ctl(client->worker->epfd, EPOLL_CTL_MOD, client->fd, &ev) == 0) {
+	client->reading = reading;
+	client->writing = writing;
+    }
+}
+
+
+
+/*
+ * The connection limit applies to all workers. admit() returns 0 if
+ * another client may be accepted.
+ */
+
+static int admit(void)
+{
+    int full;
+
+    pthread_mutex_lock(&clientsMutex);
+    full = numClients >= maxClients;
+    if (!full) {
+	numClients++;
+    }
+    pthread_mutex_unlock(&clientsMutex);
+    return full ? -1 : 0;
+}
+
+
+
+static void release(void)
+{
+    pthread_mutex_lock(&clientsMutex);
+    numClients--;
+    pthread_mutex_unlock(&clientsMutex);
+}
+
+
+
+static void drop(Client *client)
+{
+    epoll_ctl(client->worker->epfd, EPOLL_CTL_DEL, client->fd, NULL);
+    close(client->fd);
+    syslog(LOG_NOTICE, "dropped client %s on fd %d",
+	   client->addr, client->fd);
+    bufferFree(&client->in);
+    bufferFree(&client->out);
+    free(client);
+    release();
+}
+
+
+
+/*
+ * Write as much of the pending output as the socket accepts. Returns
+ * -1 if the connection has to be dropped.
+ */
+
+static int flush(Client *client)
+{
+    ssize_t n;
+
+    while (client->out.len > client->out.off) {
+	n = write(client->fd, client->out.data + client->out.off,
+		  client->out.len - client->out.off);
+	if (n < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+		return 0;
+	    }
+	    return -1;
+	}
+	client->out.off += n;
+    }
+
+    client->out.len = client->out.off = 0;
+    return client->closing ? -1 : 0;
+}
+
+
+
+/*
+ * Read whatever is available. Returns -1 if the connection has to be
+ * dropped and 1 if the client has closed its side of the connection.
+ */
+
+static int receive(Client *client)
+{
+    ssize_t n;
+
+    if (bufferReserve(&client->in, SMID_READ_SIZE)) {
+	return -1;
+    }
+
+    n = read(client->fd, client->in.data + client->in.len,
+	     client->in.size - client->in.len);
+    if (n == 0) {
+	return 1;
+    }
+    if (n < 0) {
+	return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+	    ? 0 : -1;
+    }
+    client->in.len += n;
+    return 0;
+}
+
+
+
+static unsigned int get16(const unsigned char *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+
+
+static unsigned long get32(const unsigned char *p)
+{
+    return ((unsigned long) p[0] << 24) | ((unsigned long) p[1] << 16)
+	| ((unsigned long) p[2] << 8) | (unsigned long) p[3];
+}
+
+
+
+static void put16(unsigned char *p, unsigned int v)
+{
+    p[0] = (v >> 8) & 0xff;
+    p[1] = v & 0xff;
+}
+
+
+
+static void put32(unsigned char *p, unsigned long v)
+{
+    p[0] = (v >> 24) & 0xff;
+    p[1] = (v >> 16) & 0xff;
+    p[2] = (v >> 8) & 0xff;
+    p[3] = v & 0xff;
+}
+
+
+
+static void binaryError(Client *client)
+{
+    unsigned char *h;
+
+    if (bufferReserve(&client->out, SMID_HEADER_SIZE) == 0) {
+	h = (unsigned char *) client->out.data + client->out.len;
+	memset(h, 0, SMID_HEADER_SIZE);
+	h[0] = SMID_BINARY_MAGIC;
+	h[1] = SMID_BINARY_ERROR;
+	client->out.len += SMID_HEADER_SIZE;
+    }
+    client->closing = 1;
+}
+
+
+
+/*
+ * Answer a binary lookup request. The request is validated before
+ * any output is generated so that a malformed request does not
+ * leave a partial response in the output buffer.
+ */
+
+static void binary(Client *client, const unsigned char *msg)
+{
+    const unsigned char *p, *end;
+    unsigned char *r;
+    unsigned int count, i, j, oidlen;
+    unsigned long length;
+    SmiSubid oid[128];
+    SmiNode *smiNode;
+    SmiModule *smiModule;
+    SmiType *smiType;
+
+    count = get16(msg + 2);
+    length = get32(msg + 4);
+    p = msg + SMID_HEADER_SIZE;
+    end = p + length;
+
+    if (msg[1] != SMID_BINARY_LOOKUP) {
+	binaryError(client);
+	return;
+    }
+
+    for (i = 0; i < count; i++) {
+	if (p >= end || p[0] > sizeof(oid)/sizeof(oid[0])
+	    || p + 1 + 4 * p[0] > end) {
+	    binaryError(client);
+	    return;
+	}
+	p += 1 + 4 * p[0];
+    }
+    if (p != end) {
+	binaryError(client);
+	return;
+    }
+
+    if (bufferReserve(&client->out,
+		      SMID_HEADER_SIZE + count * SMID_RECORD_SIZE)) {
+	client->closing = 1;
+	return;
+    }
+
+    r = (unsigned char *) client->out.data + client->out.len;
+    r[0] = SMID_BINARY_MAGIC;
+    r[1] = SMID_BINARY_RESULT;
+    put16(r + 2, count);
+    put32(r + 4, count * SMID_RECORD_SIZE);
+    r += SMID_HEADER_SIZE;
+
+    for (i = 0, p = msg + SMID_HEADER_SIZE; i < count;
+	 i++, r += SMID_RECORD_SIZE) {
+	oidlen = *p++;
+	for (j = 0; j < oidlen; j++, p += 4) {
+	    oid[j] = get32(p);
+	}
+	memset(r, 0, SMID_RECORD_SIZE);
+	smiNode = oidlen ? smiGetNodeByOID(oidlen, oid) : NULL;
+	if (!smiNode || !smiNode->name) {
+	    r[0] = 1;
+	    continue;
+	}
+	smiModule = smiGetNodeModule(smiNode);
+	smiType = smiGetNodeType(smiNode);
+	r[1] = smiNode->oidlen;
+	r[2] = smiNode->access;
+	r[3] = smiNode->status;
+	put16(r + 4, smiNode->nodekind);
+	put16(r + 6, smiType ? smiType->basetype : SMI_BASETYPE_UNKNOWN);
+	if (smiModule && smiModule->name) {
+	    strncpy((char *) r + 8, smiModule->name, SMID_RECORD_NAME);
+	}
+	strncpy((char *) r + 8 + SMID_RECORD_NAME, smiNode->name,
+		SMID_RECORD_NAME);
+    }
+
+    client->out.len += SMID_HEADER_SIZE + count * SMID_RECORD_SIZE;
+}
+
+
+
+/*
+ * Process the complete requests in the input buffer as long as the
+ * amount of queued output is below the limit.
+ */
+
+static void process(Client *client)
+{
+    unsigned char *msg;
+    char *p, *line;
+    size_t avail;
+    unsigned long length;
+
+    while (!client->closing
+	   && client->out.len - client->out.off < SMID_MAX_PENDING) {
+	avail = client->in.len - client->in.off;
+	if (!avail) {
+	    break;
+	}
+	msg = (unsigned char *) client->in.data + client->in.off;
+	if (msg[0] == SMID_BINARY_MAGIC) {
+	    if (avail < SMID_HEADER_SIZE) {
+		break;
+	    }
+	    length = get32(msg + 4);
+	    if (length > SMID_MAX_REQUEST) {
+		binaryError(client);
+		break;
+	    }
+	    if (avail < SMID_HEADER_SIZE + length) {
+		break;
+	    }
+	    client->in.off += SMID_HEADER_SIZE + length;
+	    binary(client, msg);
+	    continue;
+	}
+	line = client->in.data + client->in.off;
+	p = memchr(line, '\n', avail);
+	if (!p) {
+	    if (avail > SMID_MAX_REQUEST) {
+		print(client, 505, "request too long");
+		done(client);
+		client->closing = 1;
+	    }
+	    break;
+	}
+	client->in.off += p - line + 1;
+	*p = 0;
+	if (p > line && p[-1] == '\r') {
+	    p[-1] = 0;
+	}
+	work(client, line);
+    }
+
+    /*
+     * After the client has closed its side, we close as soon as all
+     * complete requests have been answered.
+     */
+
+    if (client->eof
+	&& client->out.len - client->out.off < SMID_MAX_PENDING) {
+	client->closing = 1;
+    }
+}
+
+
+
+static void accepting(Worker *worker, Listener *listener)
+{
+    struct sockaddr_storage addr;
+    socklen_t addrlen;
+    struct epoll_event ev;
+    Client *client;
+    char name[64];
+    int fd, one = 1;
+
+    while (1) {
+	addrlen = sizeof(addr);
+	fd = accept(listener->fd, (struct sockaddr *) &addr, &addrlen);
+	if (fd < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    if (errno != EAGAIN && errno != EWOULDBLOCK) {
+		syslog(LOG_WARNING, "accept failed: %s", strerror(errno));
+	    }
+	    return;
+	}
+
+	if (listener->family == AF_INET) {
+	    inet_ntop(AF_INET, &((struct sockaddr_in *) &addr)->sin_addr,
+		      name, sizeof(name));
+	} else {
+	    strcpy(name, "local");
+	}
+
+	if (admit() < 0) {
+	    static const char msg[] = "421 too many connections\n";
+	    (void) write(fd, msg, sizeof(msg) - 1);
+	    close(fd);
+	    syslog(LOG_WARNING, "rejected client %s: connection limit %d",
+		   name, maxClients);
+	    continue;
+	}
+
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+	if (listener->family == AF_INET) {
+	    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	}
+
+	client = calloc(1, sizeof(Client));
+	if (!client) {
+	    close(fd);
+	    release();
+	    continue;
+	}
+	client->worker = worker;
+	client->fd = fd;
+	client->local = (listener->family == AF_UNIX);
+	client->reading = 1;
+	strcpy(client->addr, name);
+
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN;
+	ev.data.ptr = client;
+	if (epoll_ctl(worker->epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+	    close(fd);
+	    free(client);
+	    release();
+	    continue;
+	}
+	syslog(LOG_NOTICE, "accepted client %s on fd %d", client->addr, fd);
+    }
+}
+
+
+
+static int tcpListener(int reuseport)
 {
-    int sock;
-    int sopt_val, sopt_len;
-    struct sockaddr_in srv_addr;
-    int client[FD_SETSIZE];
-    int n, i, fd;
-    fd_set fds, fdmask;
     struct sockaddr_in addr;
-    int addr_len = sizeof(addr);
-    char buf[100];
-    char *p;
+    int fd, one = 1;
 
-    smiInit("smid");
+    if ((fd = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+	perror("smid: cannot create socket");
+	return -1;
+    }
 
-    for (i=1; i < argc; i++) {
-	smiLoadModule(argv[i]);
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) < 0) {
+	perror("smid: cannot set SO_REUSEADDR");
+	close(fd);
+	return -1;
     }
-	
-    smiLoadModule("SNMPv2-SMI");
-    smiLoadModule("SNMPv2-MIB");
-	
-    
-    if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
-	perror("cannot create socket");
+
+#ifdef SO_REUSEPORT
+    if (reuseport
+	&& setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)) < 0) {
+	perror("smid: cannot set SO_REUSEPORT");
+	close(fd);
 	return -1;
     }
+#endif
 
-    sopt_val = 1;
-    sopt_len = sizeof(sopt_val);
-    if (setsockopt(sock, SOL_SOCKET, SO_REUSEADDR,
-		   (char *)&sopt_val, sopt_len) < 0) {
-	perror("cannot set SO_REUSEADDR");
-	close(sock);
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = INADDR_ANY;
+
+    if (bind(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
+	perror("smid: cannot bind socket");
+	close(fd);
+	return -1;
+    }
+
+    if (listen(fd, SOMAXCONN) < 0) {
+	perror("smid: cannot listen to socket");
+	close(fd);
 	return -1;
     }
 
-    srv_addr.sin_family = AF_INET;
-    srv_addr.sin_port = htons (SMID_PORT);
-    srv_addr.sin_addr.s_addr = INADDR_ANY;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    return fd;
+}
+
+
+
+static int unixListener(void)
+{
+    struct sockaddr_un addr;
+    int fd;
 
-    if (bind(sock, (struct sockaddr *)&srv_addr, sizeof(srv_addr)) < 0) {
-	perror("cannot bind socket");
-	close(sock);
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+	fprintf(stderr, "smid: socket path `%s' too long\n", path);
 	return -1;
     }
 
-    if (listen(sock, SMID_MAX_CLIENTS) < 0) {
-	perror("cannot listen to socket");
-	close(sock);
+    if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+	perror("smid: cannot create socket");
 	return -1;
     }
 
-    for (i=0; i < SMID_MAX_CLIENTS; i++) client[i] = -1;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
 
-    FD_ZERO(&fdmask);
-    FD_SET(sock, &fdmask);
+    /* remove a stale socket left behind by a previous instance */
+    unlink(path);
 
-    openlog("smid", LOG_PID, LOG_DAEMON);
-    
-    while (1) {
-	fds = fdmask;
-	n = select(32, &fds, NULL, NULL, NULL);
-	if (FD_ISSET(sock, &fds)) {
-	    if ((fd = accept(sock, (struct sockaddr *)&addr, &addr_len)) < 0) {
-		perror("accept failed");
-		fd = -1;
+    if (bind(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
+	perror("smid: cannot bind socket");
+	close(fd);
+	return -1;
+    }
+
+    if (listen(fd, SOMAXCONN) < 0) {
+	perror("smid: cannot listen to socket");
+	close(fd);
+	return -1;
+    }
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    return fd;
+}
+
+
+
+/*
+ * Register a listening socket with the epoll instance of a worker.
+ * A socket shared by several workers wakes up only one of them.
+ */
+
+static int watch(Worker *worker, Listener *listener, int shared)
+{
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+#ifdef EPOLLEXCLUSIVE
+    if (shared) {
+	ev.events |= EPOLLEXCLUSIVE;
+    }
+#endif
+    ev.data.ptr = listener;
+    if (epoll_ctl(worker->epfd, EPOLL_CTL_ADD, listener->fd, &ev) < 0) {
+	perror("smid: cannot register listening socket");
+	return -1;
+    }
+    return 0;
+}
+
+
+
+/*
+ * Set up the workers and their listening sockets. If the system
+ * supports SO_REUSEPORT, each worker gets its own TCP socket and the
+ * kernel distributes new connections among them. Otherwise, all
+ * workers accept from one TCP socket. The Unix domain socket is
+ * always shared.
+ */
+
+static int listening(void)
+{
+    struct epoll_event ev;
+    Worker *worker;
+    int i, reuseport = 0, local = -1;
+
+#ifdef SO_REUSEPORT
+    reuseport = (numWorkers > 1);
+#endif
+
+    workers = calloc(numWorkers, sizeof(Worker));
+    if (!workers) {
+	perror("smid: cannot allocate workers");
+	return -1;
+    }
+
+    if (path && (local = unixListener()) < 0) {
+	return -1;
+    }
+
+    for (i = 0; i < numWorkers; i++) {
+	worker = &workers[i];
+	worker->tcp.fd = -1;
+	worker->tcp.family = AF_INET;
+	worker->local.fd = local;
+	worker->local.family = AF_UNIX;
+
+	if ((worker->epfd = epoll_create(SMID_MAX_EVENTS)) < 0) {
+	    perror("smid: cannot create epoll instance");
+	    return -1;
+	}
+
+	if (pipe(worker->wakeup) < 0) {
+	    perror("smid: cannot create pipe");
+	    return -1;
+	}
+	fcntl(worker->wakeup[0], F_SETFL,
+	      fcntl(worker->wakeup[0], F_GETFL, 0) | O_NONBLOCK);
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN;
+	ev.data.ptr = worker->wakeup;
+	if (epoll_ctl(worker->epfd, EPOLL_CTL_ADD,
+		      worker->wakeup[0], &ev) < 0) {
+	    perror("smid: cannot register pipe");
+	    return -1;
+	}
+
+	if (port) {
+	    if (i == 0 || reuseport) {
+		worker->tcp.fd = tcpListener(reuseport);
+		if (worker->tcp.fd < 0) {
+		    return -1;
+		}
 	    } else {
-		client[fd] = fd;
-		FD_SET(fd, &fdmask);
-		syslog(LOG_NOTICE,
-		       "accepted client %s on fd %d",
-		       inet_ntoa(addr.sin_addr), fd);
+		worker->tcp.fd = workers[0].tcp.fd;
 	    }
-	} else {
-	    for (fd=0; fd < FD_SETSIZE; fd++) {
-		if (FD_ISSET(fd, &fds)) {
-		    n = read(fd, buf, 99);
-		    if (!n) {
-			close(fd);
-			syslog(LOG_NOTICE,
-			       "dropped client %s on fd %d",
-			       inet_ntoa(addr.sin_addr), fd);
-		    } else {
-			strtok(buf, "\015\012");
-			work(fd, buf);
-		    }
+	    if (watch(worker, &worker->tcp,
+		      numWorkers > 1 && !reuseport) < 0) {
+		return -1;
+	    }
+	}
+
+	if (local >= 0 && watch(worker, &worker->local, numWorkers > 1) < 0) {
+	    return -1;
+	}
+    }
+
+    return 0;
+}
+
+
+
+static void dataset(char *tag, size_t len, unsigned int gen)
+{
+    snprintf(tag, len, "%s:%u", configFile ? "" : "smid", gen);
+}
+
+
+
+/*
+ * Load the modules into the current data set. Returns NULL on
+ * success or the name of a module that cannot be located.
+ */
+
+static char *load(void)
+{
+    int i;
+
+    for (i = 0; i < numModules; i++) {
+	if (smiLoadModule(modules[i]) == NULL) {
+	    return modules[i];
+	}
+    }
+    smiLoadModule("SNMPv2-SMI");
+    smiLoadModule("SNMPv2-MIB");
+    return NULL;
+}
+
+
+
+/*
+ * Switch the calling worker to the current data set. Requests are
+ * handled completely before a worker switches, so no request sees
+ * two data sets.
+ */
+
+static void switching(Worker *worker)
+{
+    char tag[32];
+
+    pthread_mutex_lock(&reloadMutex);
+    if (worker->generation != generation) {
+	dataset(tag, sizeof(tag), generation);
+	smiInit(tag);
+	worker->generation = generation;
+	pthread_cond_broadcast(&reloadCond);
+    }
+    pthread_mutex_unlock(&reloadMutex);
+}
+
+
+
+static int switched(void)
+{
+    int i;
+
+    for (i = 0; i < numWorkers; i++) {
+	if (workers[i].generation != generation) {
+	    return 0;
+	}
+    }
+    return 1;
+}
+
+
+
+/*
+ * Load the next generation of the data set while the workers keep
+ * serving the current one, then swap it in and free the old one.
+ */
+
+static void reload(void)
+{
+    char tag[32], old[32];
+    char *missing;
+    int i;
+
+    pthread_mutex_lock(&reloadMutex);
+    dataset(old, sizeof(old), generation);
+    dataset(tag, sizeof(tag), generation + 1);
+    smiInit(tag);
+    pthread_mutex_unlock(&reloadMutex);
+
+    if (configFile) {
+	smiReadConfig(configFile, "smid");
+    }
+    smiSetFlags(flags);
+    if (errorLevel >= 0) {
+	smiSetErrorLevel(errorLevel);
+    }
+
+    missing = load();
+
+    pthread_mutex_lock(&reloadMutex);
+    if (missing) {
+	smiExit();
+	pthread_mutex_unlock(&reloadMutex);
+	syslog(LOG_ERR, "reload failed: cannot locate module `%s'", missing);
+	return;
+    }
+    generation++;
+    for (i = 0; i < numWorkers; i++) {
+	(void) write(workers[i].wakeup[1], "", 1);
+    }
+    while (!switched()) {
+	pthread_cond_wait(&reloadCond, &reloadMutex);
+    }
+    smiInit(old);
+    smiExit();
+    pthread_mutex_unlock(&reloadMutex);
+
+    syslog(LOG_NOTICE, "reloaded modules, generation %u", generation);
+}
+
+
+
+/*
+ * Reloads are requested by SIGHUP, which is blocked in all other
+ * threads. Requests arriving during a reload are merged into one.
+ */
+
+static void *reloader(void *arg)
+{
+    sigset_t *set = (sigset_t *) arg;
+    int sig;
+
+    while (1) {
+	if (sigwait(set, &sig) == 0) {
+	    reload();
+	}
+    }
+    return NULL;
+}
+
+
+
+static void *loop(void *arg)
+{
+    Worker *worker = (Worker *) arg;
+    struct epoll_event events[SMID_MAX_EVENTS];
+    Client *client;
+    char drain[64];
+    int i, n, eof;
+
+    switching(worker);
+
+    while (1) {
+	n = epoll_wait(worker->epfd, events, SMID_MAX_EVENTS, -1);
+	if (n < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    syslog(LOG_ERR, "epoll_wait failed: %s", strerror(errno));
+	    return NULL;
+	}
+
+	for (i = 0; i < n; i++) {
+	    if (events[i].data.ptr == &worker->tcp
+		|| events[i].data.ptr == &worker->local) {
+		accepting(worker, events[i].data.ptr);
+		continue;
+	    }
+	    if (events[i].data.ptr == worker->wakeup) {
+		while (read(worker->wakeup[0], drain, sizeof(drain)) > 0) ;
+		switching(worker);
+		continue;
+	    }
+	    client = events[i].data.ptr;
+	    if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+		eof = receive(client);
+		if (eof < 0) {
+		    drop(client);
+		    continue;
 		}
+		client->eof |= eof;
+	    }
+	    if (flush(client) < 0) {
+		drop(client);
+		continue;
 	    }
+	    process(client);
+	    if (flush(client) < 0) {
+		drop(client);
+		continue;
+	    }
+	    update(client);
+	}
+    }
+}
+
+
+
+static void usage()
+{
+    fprintf(stderr,
+	    "Usage: smid [options] [module or path ...]\n"
+	    "  -V, --version                show version and license information\n"
+	    "  -h, --help                   show usage information\n"
+	    "  -c, --config=file            load a specific configuration file\n"
+	    "  -l, --level=level            set maximum level of errors and warnings\n"
+	    "  -P, --port=port              listen on TCP port (default 2578, 0: none)\n"
+	    "  -u, --unix=path              listen on a Unix domain socket\n"
+	    "  -w, --workers=number         number of worker threads (default 1)\n"
+	    "  -m, --max-connections=number limit the number of clients (default 1024)\n"
+	    "  -d, --debug                  log each request\n");
+}
+
+
+
+static void help() { usage(); exit(0); }
+static void version() { printf("smid " SMI_VERSION_STRING "\n"); exit(0); }
+static void config(char *filename)
+{
+    configFile = filename;
+    smiReadConfig(filename, "smid");
+}
+
+static void level(int lev)
+{
+    errorLevel = lev;
+    smiSetErrorLevel(lev);
+}
+
+
+
+int main(int argc, char *argv[])
+{
+    static sigset_t hup;
+    pthread_t thread;
+    char *missing;
+    int i;
+
+    static optStruct opt[] = {
+	/* short long              type        var/func       special       */
+	{ 'h', "help",           OPT_FLAG,   help,          OPT_CALLFUNC },
+	{ 'V', "version",        OPT_FLAG,   version,       OPT_CALLFUNC },
+	{ 'c', "config",         OPT_STRING, config,        OPT_CALLFUNC },
+	{ 'l', "level",          OPT_INT,    level,         OPT_CALLFUNC },
+	{ 'P', "port",           OPT_INT,    &port,         0 },
+	{ 'u', "unix",           OPT_STRING, &path,         0 },
+	{ 'w', "workers",        OPT_INT,    &numWorkers,   0 },
+	{ 'm', "max-connections",OPT_INT,    &maxClients,   0 },
+	{ 'd', "debug",          OPT_FLAG,   &dFlag,        0 },
+	{ 0, 0, OPT_END, 0, 0 }  /* no more options */
+    };
+
+    for (i = 1; i < argc; i++)
+	if ((strstr(argv[i], "-c") == argv[i]) ||
+	    (strstr(argv[i], "--config") == argv[i])) break;
+    if (i == argc)
+	smiInit("smid:1");
+    else
+	smiInit(":1");
+
+    flags = smiGetFlags();
+    flags |= SMI_FLAG_ERRORS;
+    flags |= SMI_FLAG_NODESCR;
+    smiSetFlags(flags);
+
+    optParseOptions(&argc, argv, opt, 0);
+
+    if (numWorkers < 1 || numWorkers > SMID_MAX_WORKERS
+	|| port < 0 || port > 65535 || (!port && !path)) {
+	usage();
+	exit(1);
+    }
+
+    modules = &argv[1];
+    numModules = argc - 1;
+    missing = load();
+    if (missing) {
+	fprintf(stderr, "smid: cannot locate module `%s'\n", missing);
+	smiExit();
+	exit(1);
+    }
+    generation = 1;
+
+    signal(SIGPIPE, SIG_IGN);
+
+    if (listening() < 0) {
+	smiExit();
+	exit(1);
+    }
+
+    openlog("smid", LOG_PID, LOG_DAEMON);
+
+    sigemptyset(&hup);
+    sigaddset(&hup, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &hup, NULL);
+    if (pthread_create(&thread, NULL, reloader, &hup) != 0) {
+	perror("smid: cannot create reload thread");
+	smiExit();
+	exit(1);
+    }
+
+    /*
+     * The workers only read the libsmi data set, which is never
+     * modified after it has been published.
+     */
+
+    for (i = 1; i < numWorkers; i++) {
+	if (pthread_create(&workers[i].thread, NULL,
+			   loop, &workers[i]) != 0) {
+	    perror("smid: cannot create worker thread");
+	    smiExit();
+	    exit(1);
 	}
     }
+
+    loop(&workers[0]);
+
+    if (path) {
+	unlink(path);
+    }
+
+    smiExit();
+
+    return 1;
 }
@@ -28,10 +28,32 @@
 #include <string.h>
 #include <stdarg.h>
 #include <ctype.h>
+#include <time.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_DIRENT_H
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#endif
 #ifdef HAVE_WIN_H
 #include "win.h"
 #endif
 
+/*
+ * Module pairs are diffed concurrently if we have threads and each
+ * thread can have its own current libsmi handle.
+ */
+
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_THREAD_LOCAL)
+#include <pthread.h>
+#define SMIDIFF_THREADS
+#define THREAD_LOCAL __thread
+#else
+#define THREAD_LOCAL
+#endif
+
 #include "smi.h"
 #include "shhopt.h"
 
@@ -41,11 +63,54 @@ static int mFlag = 0;		/* show the name for error messages */
 static int sFlag = 0;		/* show the severity for error messages */
 static char *oldCompl = NULL;	/* name of old compliance statement */
 static char *newCompl = NULL;	/* name of new compliance statement */
+static int rFlag = 0;		/* compare two repositories */
+static int numThreads = 0;	/* worker threads in repository mode */
+
+static THREAD_LOCAL FILE *out = NULL;	/* messages, stdout if NULL */
+static THREAD_LOCAL int numMessages = 0;	/* messages written to out */
 
 /* the `:' separates the view identifier */
 static const char *oldTag = "smidiff:old";
 static const char *newTag = "smidiff:new";
 
+#ifdef SMIDIFF_THREADS
+static pthread_mutex_t handleMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+
+
+/*
+ * Select the handle of a tag for the calling thread. The workers of
+ * the repository mode switch between the old and the new handle, and
+ * smiInit() and smiExit() must not run concurrently (see smi_config(3)).
+ */
+
+static void
+initHandle(const char *tag)
+{
+#ifdef SMIDIFF_THREADS
+    pthread_mutex_lock(&handleMutex);
+#endif
+    smiInit(tag);
+#ifdef SMIDIFF_THREADS
+    pthread_mutex_unlock(&handleMutex);
+#endif
+}
+
+
+
+static void
+exitHandle(void)
+{
+#ifdef SMIDIFF_THREADS
+    pthread_mutex_lock(&handleMutex);
+#endif
+    smiExit();
+#ifdef SMIDIFF_THREADS
+    pthread_mutex_unlock(&handleMutex);
+#endif
+}
+
 
 #define CODE_SHOW_PREVIOUS		0x01
 #define CODE_SHOW_PREVIOUS_IMPLICIT	0x02
@@ -59,6 +124,39 @@ typedef struct Error {
     char *description;	/* description of the error message */
 } Error;
 
+/*
+ * An entry of a stream of definitions, see join() below.
+ */
+
+typedef struct Entry {
+    void	 *ptr;		/* the definition (node, type, ...)      */
+    const char	 *name;		/* key of name ordered streams           */
+    SmiSubid	 *oid;		/* key of OID ordered streams            */
+    unsigned int oidlen;
+    int		 index;		/* position in definition order          */
+} Entry;
+
+typedef struct Stream {
+    Entry	*entries;	/* in definition order                   */
+    int		*peer;		/* index of the matching entry in the
+				   other stream or -1                    */
+    int		num;
+    int		size;
+} Stream;
+
+/*
+ * A pair of modules with the same name in repository mode. One of
+ * the modules is NULL if the module has been added or removed.
+ */
+
+typedef struct Job {
+    const char	*name;
+    SmiModule	*oldModule;
+    SmiModule	*newModule;
+    FILE	*out;		/* messages of this module pair          */
+    int		count;		/* number of messages                    */
+} Job;
+
 
 #define ERR_INTERNAL				0
 #define ERR_TYPE_REMOVED			1
@@ -435,29 +533,32 @@ printError(SmiModule *smiModule, int id, int line, va_list ap)
     }
     
     if (errors[i].level <= errorLevel) {
-	fprintf(stdout, "%s", smiModule->path);
+	FILE *f = out ? out : stdout;
+
+	fprintf(f, "%s", smiModule->path);
 
     	if (line >= 0) {
-	    fprintf(stdout, ":%d", line);
+	    fprintf(f, ":%d", line);
 	}
-	fprintf(stdout, " ");
+	fprintf(f, " ");
 	if (sFlag) {
-	    fprintf(stdout, "[%d] ", errors[i].level);
+	    fprintf(f, "[%d] ", errors[i].level);
 	}
 	if (mFlag) {
-	    fprintf(stdout, "{%s} ", errors[i].tag);
+	    fprintf(f, "{%s} ", errors[i].tag);
 	}
 	switch (errors[i].level) {
 	case 4:
 	case 5:
-	    fprintf(stdout, "warning: ");
+	    fprintf(f, "warning: ");
 	    break;
 	case 6:	
-	    fprintf(stdout, "info: ");
+	    fprintf(f, "info: ");
 	    break;
 	}
-	vfprintf(stdout, errors[i].fmt, ap);
-	fprintf(stdout, "\n");
+	vfprintf(f, errors[i].fmt, ap);
+	fprintf(f, "\n");
+	numMessages++;
     }
 }
 
@@ -478,10 +579,15 @@ printErrorAtLine(SmiModule *smiModule, int id, int line, ...)
 static char*
 getStringTime(time_t t)
 {
-    static char   s[27];
+    static THREAD_LOCAL char s[27];
     struct tm	  *tm;
+#ifdef HAVE_GMTIME_R
+    struct tm	  tmbuf;
 
+    tm = gmtime_r(&t, &tmbuf);
+#else
     tm = gmtime(&t);
+#endif
     sprintf(s, "%04d-%02d-%02d %02d:%02d",
 	    tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday,
 	    tm->tm_hour, tm->tm_min);
@@ -949,7 +1055,7 @@ iterateTypeImports(char *typeName,
 
 static char *getValueString(SmiValue *valuePtr, SmiType *typePtr)
 {
-    static char    s[1024];
+    static THREAD_LOCAL char s[1024];
     char           ss[9];
     int		   n;
     unsigned int   i;
@@ -1655,51 +1761,274 @@ checkTypes(SmiModule *oldModule, SmiNode *oldNode, SmiType *oldType,
 
 
 
+/*
+ * The definitions of the old and the new module are compared by a
+ * merge-join: the definitions of each module are collected once into
+ * a stream, both streams are sorted by their key (the OID or the
+ * name) and matching definitions are paired in a single linear pass.
+ * The streams keep the definition order, so that the messages are
+ * still reported in definition order.
+ */
+
+static void
+addEntry(Stream *stream, void *ptr, const char *name,
+	 unsigned int oidlen, SmiSubid *oid)
+{
+    Entry *entry;
+
+    if (stream->num == stream->size) {
+	stream->size = stream->size ? 2 * stream->size : 64;
+	stream->entries = realloc(stream->entries,
+				  stream->size * sizeof(Entry));
+	if (! stream->entries) {
+	    fprintf(stderr, "smidiff: out of memory\n");
+	    exit(1);
+	}
+    }
+    entry = &stream->entries[stream->num];
+    entry->ptr = ptr;
+    entry->name = name ? name : "";
+    entry->oid = oid;
+    entry->oidlen = oidlen;
+    entry->index = stream->num++;
+}
+
+
+
+static void
+freeStream(Stream *stream)
+{
+    free(stream->entries);
+    free(stream->peer);
+    memset(stream, 0, sizeof(Stream));
+}
+
+
+
+static void
+addNodes(Stream *stream, SmiModule *smiModule, SmiNodekind nodekinds)
+{
+    SmiNode *smiNode;
+
+    for (smiNode = smiGetFirstNode(smiModule, nodekinds);
+	 smiNode;
+	 smiNode = smiGetNextNode(smiNode, nodekinds)) {
+	addEntry(stream, smiNode, smiNode->name,
+		 smiNode->oidlen, smiNode->oid);
+    }
+}
+
+
+
+static void
+addTypes(Stream *stream, SmiModule *smiModule)
+{
+    SmiType *smiType;
+
+    for (smiType = smiGetFirstType(smiModule);
+	 smiType;
+	 smiType = smiGetNextType(smiType)) {
+	addEntry(stream, smiType, smiType->name, 0, NULL);
+    }
+}
+
+
+
+static void
+addElements(Stream *stream, SmiNode *smiNode)
+{
+    SmiElement *smiElement;
+    SmiNode *elemNode;
+
+    for (smiElement = smiGetFirstElement(smiNode);
+	 smiElement;
+	 smiElement = smiGetNextElement(smiElement)) {
+	elemNode = smiGetElementNode(smiElement);
+	addEntry(stream, elemNode, elemNode->name, 0, NULL);
+    }
+}
+
+
+
+static void
+addOptions(Stream *stream, SmiNode *smiNode)
+{
+    SmiOption *smiOption;
+
+    for (smiOption = smiGetFirstOption(smiNode);
+	 smiOption;
+	 smiOption = smiGetNextOption(smiOption)) {
+	addEntry(stream, smiOption, smiGetOptionNode(smiOption)->name,
+		 0, NULL);
+    }
+}
+
+
+
+static void
+addRefinements(Stream *stream, SmiNode *smiNode)
+{
+    SmiRefinement *smiRefinement;
+
+    for (smiRefinement = smiGetFirstRefinement(smiNode);
+	 smiRefinement;
+	 smiRefinement = smiGetNextRefinement(smiRefinement)) {
+	addEntry(stream, smiRefinement,
+		 smiGetRefinementNode(smiRefinement)->name, 0, NULL);
+    }
+}
+
+
+
+static int
+cmpOids(const void *a, const void *b)
+{
+    const Entry *x = (const Entry *) a, *y = (const Entry *) b;
+    unsigned int i;
+
+    for (i = 0; i < x->oidlen && i < y->oidlen; i++) {
+	if (x->oid[i] != y->oid[i]) {
+	    return x->oid[i] < y->oid[i] ? -1 : 1;
+	}
+    }
+    return (x->oidlen < y->oidlen) ? -1 : (x->oidlen > y->oidlen) ? 1 : 0;
+}
+
+
+
+static int
+cmpNames(const void *a, const void *b)
+{
+    return strcmp(((const Entry *) a)->name, ((const Entry *) b)->name);
+}
+
+
+
+/*
+ * Pair the entries of both streams that have equal keys. Afterwards,
+ * oldStream->peer[i] is the index of the entry of the new stream that
+ * matches entry i of the old stream (or -1) and vice versa.
+ */
+
+static void
+join(Stream *oldStream, Stream *newStream,
+     int (*cmp)(const void *, const void *))
+{
+    Entry *a, *b;
+    int i, j, c;
+
+    oldStream->peer = malloc((oldStream->num + 1) * sizeof(int));
+    newStream->peer = malloc((newStream->num + 1) * sizeof(int));
+    a = malloc((oldStream->num + 1) * sizeof(Entry));
+    b = malloc((newStream->num + 1) * sizeof(Entry));
+    if (! oldStream->peer || ! newStream->peer || ! a || ! b) {
+	fprintf(stderr, "smidiff: out of memory\n");
+	exit(1);
+    }
+
+    for (i = 0; i < oldStream->num; i++) {
+	oldStream->peer[i] = -1;
+    }
+    for (j = 0; j < newStream->num; j++) {
+	newStream->peer[j] = -1;
+    }
+
+    if (oldStream->num) {
+	memcpy(a, oldStream->entries, oldStream->num * sizeof(Entry));
+	qsort(a, oldStream->num, sizeof(Entry), cmp);
+    }
+    if (newStream->num) {
+	memcpy(b, newStream->entries, newStream->num * sizeof(Entry));
+	qsort(b, newStream->num, sizeof(Entry), cmp);
+    }
+
+    for (i = 0, j = 0; i < oldStream->num && j < newStream->num; ) {
+	c = cmp(&a[i], &b[j]);
+	if (c < 0) {
+	    i++;
+	} else if (c > 0) {
+	    j++;
+	} else {
+	    oldStream->peer[a[i].index] = b[j].index;
+	    newStream->peer[b[j].index] = a[i].index;
+	    i++, j++;
+	}
+    }
+
+    free(a);
+    free(b);
+}
+
+
+
+/*
+ * Collect the nodes of the given kinds of both modules and join them
+ * by their OIDs. This is the only place where the handles are
+ * switched. The new handle is current afterwards.
+ */
+
+static void
+joinNodes(SmiModule *oldModule, const char *oldTag,
+	  SmiModule *newModule, const char *newTag,
+	  SmiNodekind nodekinds, Stream *oldStream, Stream *newStream)
+{
+    initHandle(oldTag);
+    addNodes(oldStream, oldModule, nodekinds);
+    initHandle(newTag);
+    addNodes(newStream, newModule, nodekinds);
+    join(oldStream, newStream, cmpOids);
+}
+
+
+
 static void
 diffTypes(SmiModule *oldModule, const char *oldTag,
 	  SmiModule *newModule, const char *newTag)
 {
+    Stream oldTypes, newTypes;
     SmiType *oldType, *newType;
+    int i;
+
+    memset(&oldTypes, 0, sizeof(Stream));
+    memset(&newTypes, 0, sizeof(Stream));
+
+    initHandle(oldTag);
+    addTypes(&oldTypes, oldModule);
+    initHandle(newTag);
+    addTypes(&newTypes, newModule);
+    join(&oldTypes, &newTypes, cmpNames);
 
     /*
      * First check whether the old type definitions still exist and
      * whether the updates (if any) are consistent with the SMI rules.
      */
     
-    smiInit(oldTag);
-    for (oldType = smiGetFirstType(oldModule);
-	 oldType;
-	 oldType = smiGetNextType(oldType)) {
-	
-	smiInit(newTag);
-	newType = smiGetType(newModule, oldType->name);
-	if (newType) {
+    for (i = 0; i < oldTypes.num; i++) {
+	oldType = oldTypes.entries[i].ptr;
+	if (oldTypes.peer[i] >= 0) {
+	    newType = newTypes.entries[oldTypes.peer[i]].ptr;
 	    checkTypes(oldModule, NULL, oldType,
 		       newModule, NULL, newType);
 	} else {
 	    printErrorAtLine(oldModule, ERR_TYPE_REMOVED,
 			     smiGetTypeLine(oldType), oldType->name);
 	}
-	smiInit(oldTag);
     }
 
     /*
      * Let's see if there are any new definitions.
      */
 
-    smiInit(newTag);
-    for (newType = smiGetFirstType(newModule);
-	 newType;
-	 newType = smiGetNextType(newType)) {
-	
-	smiInit(oldTag);
-	oldType = smiGetType(oldModule, newType->name);
-	if (! oldType) {
+    for (i = 0; i < newTypes.num; i++) {
+	if (newTypes.peer[i] < 0) {
+	    newType = newTypes.entries[i].ptr;
 	    printErrorAtLine(newModule, ERR_TYPE_ADDED,
 			     smiGetTypeLine(newType), newType->name);
 	}
-	smiInit(newTag);
     }
+
+    freeStream(&oldTypes);
+    freeStream(&newTypes);
 }
 
 
@@ -1955,65 +2284,53 @@ static void
 diffObjects(SmiModule *oldModule, const char *oldTag,
 	    SmiModule *newModule, const char *newTag)
 {
+    Stream oldNodes, newNodes;
     SmiNode *oldNode, *newNode;
+    int i;
     SmiNodekind nodekinds;
 
     nodekinds =  SMI_NODEKIND_NODE | SMI_NODEKIND_TABLE |
 	SMI_NODEKIND_ROW | SMI_NODEKIND_COLUMN | SMI_NODEKIND_SCALAR;
-    
+
+    memset(&oldNodes, 0, sizeof(Stream));
+    memset(&newNodes, 0, sizeof(Stream));
+    joinNodes(oldModule, oldTag, newModule, newTag,
+	      nodekinds, &oldNodes, &newNodes);
+
     /*
      * First check whether the old node definitions still exist and
      * whether the updates (if any) are consistent with the SMI rules.
      */
     
-    smiInit(oldTag);
-    for(oldNode = smiGetFirstNode(oldModule, nodekinds);
-	oldNode;
-        oldNode = smiGetNextNode(oldNode, nodekinds)) {
-	
-	smiInit(newTag);
-	newNode = smiGetNodeByOID(oldNode->oidlen, oldNode->oid);
-	if (newNode
-	    && newNode->oidlen == oldNode->oidlen
-	    && smiGetNodeModule(newNode) == newModule) {
+    for (i = 0; i < oldNodes.num; i++) {
+	oldNode = oldNodes.entries[i].ptr;
+	if (oldNodes.peer[i] >= 0) {
+	    newNode = newNodes.entries[oldNodes.peer[i]].ptr;
 	    checkObject(oldModule, oldNode, newModule, newNode);
 	} else {
-	    switch (oldNode->nodekind) {
-	    case SMI_NODEKIND_NODE:
-	    case SMI_NODEKIND_TABLE:
-	    case SMI_NODEKIND_ROW:
-	    case SMI_NODEKIND_COLUMN:
-	    case SMI_NODEKIND_SCALAR:
-		printErrorAtLine(oldModule, ERR_NODE_REMOVED,
-				 smiGetNodeLine(oldNode),
-				 getStringNodekind(oldNode->nodekind),
-				 oldNode->name);
-	    }
+	    printErrorAtLine(oldModule, ERR_NODE_REMOVED,
+			     smiGetNodeLine(oldNode),
+			     getStringNodekind(oldNode->nodekind),
+			     oldNode->name);
 	}
-	smiInit(oldTag);
     }
 
     /*
      * Let's see if there are any new definitions.
      */
 
-    smiInit(newTag);
-    for (newNode = smiGetFirstNode(newModule, nodekinds);
-	 newNode;
-	 newNode = smiGetNextNode(newNode, nodekinds)) {
-	
-	smiInit(oldTag);
-	oldNode = smiGetNodeByOID(newNode->oidlen, newNode->oid);
-	if (! oldNode
-	    || newNode->oidlen != oldNode->oidlen
-	    || smiGetNodeModule(oldNode) != oldModule) {
+    for (i = 0; i < newNodes.num; i++) {
+	if (newNodes.peer[i] < 0) {
+	    newNode = newNodes.entries[i].ptr;
 	    printErrorAtLine(newModule, ERR_NODE_ADDED,
 			     smiGetNodeLine(newNode),
 			     getStringNodekind(newNode->nodekind),
 			     newNode->name);
 	}
-	smiInit(newTag);
     }
+
+    freeStream(&oldNodes);
+    freeStream(&newNodes);
 }
 
 
@@ -2023,49 +2340,32 @@ checkObjects(SmiModule *oldModule, const char *oldTag,
 	     SmiModule *newModule, const char *newTag,
 	     SmiNode *oldNode, SmiNode *newNode)
 {
-    SmiElement *oldElem, *newElem;
-    SmiNode *oldElemNode, *newElemNode;
-    int code = 0;
+    Stream oldElems, newElems;
+    int i, code = 0;
 
-    smiInit(oldTag);
-    for (oldElem = smiGetFirstElement(oldNode);
-	 oldElem; oldElem = smiGetNextElement(oldElem)) {
-	oldElemNode = smiGetElementNode(oldElem);
-	smiInit(newTag);
-	for (newElem = smiGetFirstElement(newNode);
-	     newElem; newElem = smiGetNextElement(newElem)) {
-	    newElemNode = smiGetElementNode(newElem);
-	    if (strcmp(oldElemNode->name, newElemNode->name) == 0) {
-		break;
-	    }
-	}
-	if (! newElem) {
+    memset(&oldElems, 0, sizeof(Stream));
+    memset(&newElems, 0, sizeof(Stream));
+    addElements(&oldElems, oldNode);
+    addElements(&newElems, newNode);
+    join(&oldElems, &newElems, cmpNames);
+
+    for (i = 0; i < oldElems.num; i++) {
+	if (oldElems.peer[i] < 0) {
 	    printErrorAtLine(oldModule, ERR_OBJECT_REMOVED,
 			     smiGetNodeLine(oldNode), oldNode->name);
 	    code |= CODE_SHOW_PREVIOUS;
 	}
-	smiInit(oldTag);
     }
 
-    smiInit(newTag);
-    for (newElem = smiGetFirstElement(newNode);
-	 newElem; newElem = smiGetNextElement(newElem)) {
-	newElemNode = smiGetElementNode(newElem);
-	smiInit(oldTag);
-	for (oldElem = smiGetFirstElement(oldNode);
-	     oldElem; oldElem = smiGetNextElement(oldElem)) {
-	    oldElemNode = smiGetElementNode(oldElem);
-	    if (strcmp(oldElemNode->name, newElemNode->name) == 0) {
-		break;
-	    }
-	}
-	if (! oldElem) {
+    for (i = 0; i < newElems.num; i++) {
+	if (newElems.peer[i] < 0) {
 	    printErrorAtLine(newModule, ERR_OBJECT_ADDED,
 			     smiGetNodeLine(newNode), newNode->name);
 	}
-	smiInit(newTag);
     }
 
+    freeStream(&oldElems);
+    freeStream(&newElems);
     return code;
 }
 
@@ -2113,25 +2413,26 @@ checkNotification(SmiModule *oldModule, const char *oldTag,
 
 static void
 diffNotifications(SmiModule *oldModule, const char *oldTag,
-		  SmiModule *newModule, const char *newTag)
+	          SmiModule *newModule, const char *newTag)
 {
+    Stream oldNodes, newNodes;
     SmiNode *oldNode, *newNode;
+    int i;
+
+    memset(&oldNodes, 0, sizeof(Stream));
+    memset(&newNodes, 0, sizeof(Stream));
+    joinNodes(oldModule, oldTag, newModule, newTag,
+	      SMI_NODEKIND_NOTIFICATION, &oldNodes, &newNodes);
 
     /*
      * First check whether the old node definitions still exist and
      * whether the updates (if any) are consistent with the SMI rules.
      */
     
-    smiInit(oldTag);
-    for(oldNode = smiGetFirstNode(oldModule, SMI_NODEKIND_NOTIFICATION);
-	oldNode;
-        oldNode = smiGetNextNode(oldNode, SMI_NODEKIND_NOTIFICATION)) {
-	
-	smiInit(newTag);
-	newNode = smiGetNodeByOID(oldNode->oidlen, oldNode->oid);
-	if (newNode
-	    && newNode->oidlen == oldNode->oidlen
-	    && smiGetNodeModule(newNode) == newModule) {
+    for (i = 0; i < oldNodes.num; i++) {
+	oldNode = oldNodes.entries[i].ptr;
+	if (oldNodes.peer[i] >= 0) {
+	    newNode = newNodes.entries[oldNodes.peer[i]].ptr;
 	    checkNotification(oldModule, oldTag, newModule, newTag,
 			      oldNode, newNode);
 	} else {
@@ -2140,30 +2441,24 @@ diffNotifications(SmiModule *oldModule, const char *oldTag,
 			     getStringNodekind(oldNode->nodekind),
 			     oldNode->name);
 	}
-	smiInit(oldTag);
     }
 
     /*
      * Let's see if there are any new definitions.
      */
 
-    smiInit(newTag);
-    for (newNode = smiGetFirstNode(newModule, SMI_NODEKIND_NOTIFICATION);
-	 newNode;
-	 newNode = smiGetNextNode(newNode, SMI_NODEKIND_NOTIFICATION)) {
-	
-	smiInit(oldTag);
-	oldNode = smiGetNodeByOID(newNode->oidlen, newNode->oid);
-	if (! oldNode
-	    || newNode->oidlen != oldNode->oidlen
-	    || smiGetNodeModule(oldNode) != oldModule) {
+    for (i = 0; i < newNodes.num; i++) {
+	if (newNodes.peer[i] < 0) {
+	    newNode = newNodes.entries[i].ptr;
 	    printErrorAtLine(newModule, ERR_NODE_ADDED,
 			     smiGetNodeLine(newNode),
 			     getStringNodekind(newNode->nodekind),
 			     newNode->name);
 	}
-	smiInit(newTag);
     }
+
+    freeStream(&oldNodes);
+    freeStream(&newNodes);
 }
 
 
@@ -2270,10 +2565,10 @@ diffModules(SmiModule *oldModule, const char *oldTag,
      * whether there are any updates.
      */
 
-    smiInit(oldTag);
+    initHandle(oldTag);
     for (oldRev = smiGetFirstRevision(oldModule);
 	 oldRev; oldRev = smiGetNextRevision(oldRev)) {
-	smiInit(newTag);
+	initHandle(newTag);
 	for (newRev = smiGetFirstRevision(newModule);
 	     newRev; newRev = smiGetNextRevision(newRev)) {
 	    if (oldRev->date == newRev->date) {
@@ -2297,17 +2592,17 @@ diffModules(SmiModule *oldModule, const char *oldTag,
 			     smiGetRevisionLine(oldRev),
 			     getStringTime(oldRev->date));
 	}
-	smiInit(oldTag);
+	initHandle(oldTag);
     }
 
     /*
      * Let's see if there are any new revisions.
      */
 
-    smiInit(newTag);
+    initHandle(newTag);
     for (newRev = smiGetFirstRevision(newModule);
 	 newRev; newRev = smiGetNextRevision(newRev)) {
-	smiInit(oldTag);
+	initHandle(oldTag);
 	for (oldRev = smiGetFirstRevision(oldModule);
 	     oldRev; oldRev = smiGetNextRevision(oldRev)) {
 	    if (oldRev->date == newRev->date) {
@@ -2319,7 +2614,7 @@ diffModules(SmiModule *oldModule, const char *oldTag,
 			     smiGetRevisionLine(newRev),
 			     getStringTime(newRev->date));
 	}
-	smiInit(newTag);
+	initHandle(newTag);
     }
 
     if (code & CODE_SHOW_PREVIOUS && oldLine >= 0) {
@@ -2339,48 +2634,36 @@ checkMember(SmiModule *oldModule, const char *oldTag,
 	    SmiModule *newModule, const char *newTag,
 	    SmiNode *oldNode, SmiNode *newNode)
 {
-    SmiElement *oldElem, *newElem;
+    Stream oldElems, newElems;
     SmiNode *oldElemNode, *newElemNode;
+    int i;
 
-    smiInit(oldTag);
-    for (oldElem = smiGetFirstElement(oldNode);
-	 oldElem; oldElem = smiGetNextElement(oldElem)) {
-	oldElemNode = smiGetElementNode(oldElem);
-	smiInit(newTag);
-	for (newElem = smiGetFirstElement(newNode);
-	     newElem; newElem = smiGetNextElement(newElem)) {
-	    newElemNode = smiGetElementNode(newElem);
-	    if (strcmp(oldElemNode->name, newElemNode->name) == 0) {
-		break;
-	    }
-	}
-	if (! newElem) {
+    memset(&oldElems, 0, sizeof(Stream));
+    memset(&newElems, 0, sizeof(Stream));
+    addElements(&oldElems, oldNode);
+    addElements(&newElems, newNode);
+    join(&oldElems, &newElems, cmpNames);
+
+    for (i = 0; i < oldElems.num; i++) {
+	if (oldElems.peer[i] < 0) {
+	    oldElemNode = oldElems.entries[i].ptr;
 	    printErrorAtLine(oldModule, ERR_MEMBER_REMOVED,
 			     smiGetNodeLine(oldNode),
 			     oldElemNode->name, oldNode->name);
 	}
-	smiInit(oldTag);
     }
 
-    smiInit(newTag);
-    for (newElem = smiGetFirstElement(newNode);
-	 newElem; newElem = smiGetNextElement(newElem)) {
-	newElemNode = smiGetElementNode(newElem);
-	smiInit(oldTag);
-	for (oldElem = smiGetFirstElement(oldNode);
-	     oldElem; oldElem = smiGetNextElement(oldElem)) {
-	    oldElemNode = smiGetElementNode(oldElem);
-	    if (strcmp(oldElemNode->name, newElemNode->name) == 0) {
-		break;
-	    }
-	}
-	if (! oldElem) {
+    for (i = 0; i < newElems.num; i++) {
+	if (newElems.peer[i] < 0) {
+	    newElemNode = newElems.entries[i].ptr;
 	    printErrorAtLine(newModule, ERR_MEMBER_ADDED,
 			     smiGetNodeLine(newNode),
 			     newElemNode->name, newNode->name);
 	}
-	smiInit(newTag);
     }
+
+    freeStream(&oldElems);
+    freeStream(&newElems);
 }
 
 
@@ -2432,22 +2715,24 @@ static void
 diffGroups(SmiModule *oldModule, const char *oldTag,
 	   SmiModule *newModule, const char *newTag)
 {
+    Stream oldNodes, newNodes;
     SmiNode *oldNode, *newNode;
-    
+    int i;
+
+    memset(&oldNodes, 0, sizeof(Stream));
+    memset(&newNodes, 0, sizeof(Stream));
+    joinNodes(oldModule, oldTag, newModule, newTag,
+	      SMI_NODEKIND_GROUP, &oldNodes, &newNodes);
+
     /*
      * First check whether the old node definitions still exist and
      * whether the updates (if any) are consistent with the SMI rules.
      */
     
-    smiInit(oldTag);
-    for(oldNode = smiGetFirstNode(oldModule, SMI_NODEKIND_GROUP);
-	oldNode;
-        oldNode = smiGetNextNode(oldNode, SMI_NODEKIND_GROUP)) {
-	smiInit(newTag);
-	newNode = smiGetNodeByOID(oldNode->oidlen, oldNode->oid);
-	if (newNode
-	    && newNode->oidlen == oldNode->oidlen
-	    && smiGetNodeModule(newNode) == newModule) {
+    for (i = 0; i < oldNodes.num; i++) {
+	oldNode = oldNodes.entries[i].ptr;
+	if (oldNodes.peer[i] >= 0) {
+	    newNode = newNodes.entries[oldNodes.peer[i]].ptr;
 	    checkGroup(oldModule, oldTag, newModule, newTag, oldNode, newNode);
 	} else {
 	    printErrorAtLine(oldModule, ERR_NODE_REMOVED,
@@ -2455,30 +2740,24 @@ diffGroups(SmiModule *oldModule, const char *oldTag,
 			     getStringNodekind(oldNode->nodekind),
 			     oldNode->name);
 	}
-	smiInit(oldTag);
     }
 
     /*
      * Let's see if there are any new definitions.
      */
 
-    smiInit(newTag);
-    for (newNode = smiGetFirstNode(newModule, SMI_NODEKIND_GROUP);
-	 newNode;
-	 newNode = smiGetNextNode(newNode, SMI_NODEKIND_GROUP)) {
-	
-	smiInit(oldTag);
-	oldNode = smiGetNodeByOID(newNode->oidlen, newNode->oid);
-	if (! oldNode
-	    || newNode->oidlen != oldNode->oidlen
-	    || smiGetNodeModule(oldNode) != oldModule) {
+    for (i = 0; i < newNodes.num; i++) {
+	if (newNodes.peer[i] < 0) {
+	    newNode = newNodes.entries[i].ptr;
 	    printErrorAtLine(newModule, ERR_NODE_ADDED,
 			     smiGetNodeLine(newNode),
 			     getStringNodekind(newNode->nodekind),
 			     newNode->name);
 	}
-	smiInit(newTag);
     }
+
+    freeStream(&oldNodes);
+    freeStream(&newNodes);
 }
 
 
@@ -2488,63 +2767,53 @@ checkComplMandatory(SmiModule *oldModule, const char *oldTag,
 		    SmiModule *newModule, const char *newTag,
 		    SmiNode *oldNode, SmiNode *newNode)
 {
-    SmiElement *oldElem, *newElem;
+    Stream oldElems, newElems;
     SmiNode *oldElemNode, *newElemNode;
+    int i;
 
-    smiInit(oldTag);
-    for (oldElem = smiGetFirstElement(oldNode);
-	 oldElem; oldElem = smiGetNextElement(oldElem)) {
-	oldElemNode = smiGetElementNode(oldElem);
-	smiInit(newTag);
-	for (newElem = smiGetFirstElement(newNode);
-	     newElem; newElem = smiGetNextElement(newElem)) {
-	    newElemNode = smiGetElementNode(newElem);
-	    if (strcmp(oldElemNode->name, newElemNode->name) == 0) {
-		break;
-	    }
+    memset(&oldElems, 0, sizeof(Stream));
+    memset(&newElems, 0, sizeof(Stream));
+    addElements(&oldElems, oldNode);
+    addElements(&newElems, newNode);
+    join(&oldElems, &newElems, cmpNames);
+
+    for (i = 0; i < oldElems.num; i++) {
+	if (oldElems.peer[i] >= 0) {
+	    continue;
 	}
-	if (! newElem) {
-	    if (strcmp(smiGetNodeModule(oldElemNode)->name, oldModule->name)) {
-		printErrorAtLine(oldModule, ERR_MANDATORY_EXT_GROUP_REMOVED,
-				 smiGetNodeLine(oldNode),
-				 oldModule->name, oldElemNode->name,
-				 oldNode->name);
-	    } else {
-		printErrorAtLine(oldModule, ERR_MANDATORY_GROUP_REMOVED,
-				 smiGetNodeLine(oldNode),
-				 oldElemNode->name,
-				 oldNode->name);
-	    }
+	oldElemNode = oldElems.entries[i].ptr;
+	if (strcmp(smiGetNodeModule(oldElemNode)->name, oldModule->name)) {
+	    printErrorAtLine(oldModule, ERR_MANDATORY_EXT_GROUP_REMOVED,
+			     smiGetNodeLine(oldNode),
+			     oldModule->name, oldElemNode->name,
+			     oldNode->name);
+	} else {
+	    printErrorAtLine(oldModule, ERR_MANDATORY_GROUP_REMOVED,
+			     smiGetNodeLine(oldNode),
+			     oldElemNode->name,
+			     oldNode->name);
 	}
-	smiInit(oldTag);
     }
 
-    smiInit(newTag);
-    for (newElem = smiGetFirstElement(newNode);
-	 newElem; newElem = smiGetNextElement(newElem)) {
-	newElemNode = smiGetElementNode(newElem);
-	smiInit(oldTag);
-	for (oldElem = smiGetFirstElement(oldNode);
-	     oldElem; oldElem = smiGetNextElement(oldElem)) {
-	    oldElemNode = smiGetElementNode(oldElem);
-	    if (strcmp(oldElemNode->name, newElemNode->name) == 0) {
-		break;
-	    }
+    for (i = 0; i < newElems.num; i++) {
+	if (newElems.peer[i] >= 0) {
+	    continue;
 	}
-	if (! oldElem) {
-	    if (strcmp(smiGetNodeModule(newElemNode)->name, newModule->name)) {
-		printErrorAtLine(newModule, ERR_MANDATORY_EXT_GROUP_ADDED,
-				 smiGetNodeLine(newNode),
-				 newModule->name, newElemNode->name,
-				 newNode->name);
-	    } else {
-		printErrorAtLine(newModule, ERR_MANDATORY_GROUP_ADDED,
-				 smiGetNodeLine(newNode),
-				 newElemNode->name, newNode->name);
-	    }
+	newElemNode = newElems.entries[i].ptr;
+	if (strcmp(smiGetNodeModule(newElemNode)->name, newModule->name)) {
+	    printErrorAtLine(newModule, ERR_MANDATORY_EXT_GROUP_ADDED,
+			     smiGetNodeLine(newNode),
+			     newModule->name, newElemNode->name,
+			     newNode->name);
+	} else {
+	    printErrorAtLine(newModule, ERR_MANDATORY_GROUP_ADDED,
+			     smiGetNodeLine(newNode),
+			     newElemNode->name, newNode->name);
 	}
-	smiInit(newTag);
     }
+
+    freeStream(&oldElems);
+    freeStream(&newElems);
 }
 
 
@@ -2554,23 +2823,21 @@ checkComplOptions(SmiModule *oldModule, const char *oldTag,
 		  SmiModule *newModule, const char *newTag,
 		  SmiNode *oldNode, SmiNode *newNode)
 {
-    int code;
+    int code, i;
+    Stream oldOptions, newOptions;
     SmiOption *oldOption, *newOption;
     SmiNode *oldOptionNode, *newOptionNode;
 
-    smiInit(oldTag);
-    for (oldOption = smiGetFirstOption(oldNode);
-	 oldOption; oldOption = smiGetNextOption(oldOption)) {
+    memset(&oldOptions, 0, sizeof(Stream));
+    memset(&newOptions, 0, sizeof(Stream));
+    addOptions(&oldOptions, oldNode);
+    addOptions(&newOptions, newNode);
+    join(&oldOptions, &newOptions, cmpNames);
+
+    for (i = 0; i < oldOptions.num; i++) {
+	oldOption = oldOptions.entries[i].ptr;
 	oldOptionNode = smiGetOptionNode(oldOption);
-	smiInit(newTag);
-	for (newOption = smiGetFirstOption(newNode);
-	     newOption; newOption = smiGetNextOption(newOption)) {
-	    newOptionNode = smiGetOptionNode(newOption);
-	    if (strcmp(oldOptionNode->name, newOptionNode->name) == 0) {
-		break;
-	    }
-	}
-	if (! newOption) {
+	if (oldOptions.peer[i] < 0) {
 	    if (strcmp(smiGetNodeModule(oldOptionNode)->name,
 		       oldModule->name)) {
 		printErrorAtLine(oldModule, ERR_EXT_OPTION_REMOVED,
@@ -2584,6 +2851,8 @@ checkComplOptions(SmiModule *oldModule, const char *oldTag,
 				 oldNode->name);
 	    }
 	} else {
+	    newOption = newOptions.entries[oldOptions.peer[i]].ptr;
+	    newOptionNode = smiGetOptionNode(newOption);
 	    code = 0;
 	    code |= checkDescription(oldModule, smiGetOptionLine(oldOption),
 				     newModule, smiGetOptionLine(newOption),
@@ -2596,37 +2865,30 @@ checkComplOptions(SmiModule *oldModule, const char *oldTag,
 				 oldOptionNode->name);
 	    }
 	}
-	smiInit(oldTag);
     }
 
-    smiInit(newTag);
-    for (newOption = smiGetFirstOption(newNode);
-	 newOption; newOption = smiGetNextOption(newOption)) {
-	newOptionNode = smiGetOptionNode(newOption);
-	smiInit(oldTag);
-	for (oldOption = smiGetFirstOption(oldNode);
-	     oldOption; oldOption = smiGetNextOption(oldOption)) {
-	    oldOptionNode = smiGetOptionNode(oldOption);
-	    if (strcmp(oldOptionNode->name, newOptionNode->name) == 0) {
-		break;
-	    }
+    for (i = 0; i < newOptions.num; i++) {
+	if (newOptions.peer[i] >= 0) {
+	    continue;
 	}
-	if (! oldOption) {
-	    if (strcmp(smiGetNodeModule(newOptionNode)->name,
-		       newModule->name)) {
-		printErrorAtLine(newModule, ERR_EXT_OPTION_ADDED,
-				 smiGetOptionLine(newOption),
-				 newModule->name, newOptionNode->name,
-				 newNode->name);
-	    } else {
-		printErrorAtLine(newModule, ERR_OPTION_ADDED,
-				 smiGetOptionLine(newOption),
-				 newOptionNode->name,
-				 newNode->name);
-	    }
+	newOption = newOptions.entries[i].ptr;
+	newOptionNode = smiGetOptionNode(newOption);
+	if (strcmp(smiGetNodeModule(newOptionNode)->name,
+		   newModule->name)) {
+	    printErrorAtLine(newModule, ERR_EXT_OPTION_ADDED,
+			     smiGetOptionLine(newOption),
+			     newModule->name, newOptionNode->name,
+			     newNode->name);
+	} else {
+	    printErrorAtLine(newModule, ERR_OPTION_ADDED,
+			     smiGetOptionLine(newOption),
+			     newOptionNode->name,
+			     newNode->name);
 	}
-	smiInit(newTag);
     }
+
+    freeStream(&oldOptions);
+    freeStream(&newOptions);
 }
 
 
@@ -2636,23 +2898,21 @@ checkComplRefinements(SmiModule *oldModule, const char *oldTag,
 		  SmiModule *newModule, const char *newTag,
 		  SmiNode *oldNode, SmiNode *newNode)
 {
-    int code;
+    int code, i;
+    Stream oldRefinements, newRefinements;
     SmiRefinement *oldRefinement, *newRefinement;
     SmiNode *oldRefinementNode, *newRefinementNode;
 
-    smiInit(oldTag);
-    for (oldRefinement = smiGetFirstRefinement(oldNode);
-	 oldRefinement; oldRefinement = smiGetNextRefinement(oldRefinement)) {
+    memset(&oldRefinements, 0, sizeof(Stream));
+    memset(&newRefinements, 0, sizeof(Stream));
+    addRefinements(&oldRefinements, oldNode);
+    addRefinements(&newRefinements, newNode);
+    join(&oldRefinements, &newRefinements, cmpNames);
+
+    for (i = 0; i < oldRefinements.num; i++) {
+	oldRefinement = oldRefinements.entries[i].ptr;
 	oldRefinementNode = smiGetRefinementNode(oldRefinement);
-	smiInit(newTag);
-	for (newRefinement = smiGetFirstRefinement(newNode);
-	     newRefinement; newRefinement = smiGetNextRefinement(newRefinement)) {
-	    newRefinementNode = smiGetRefinementNode(newRefinement);
-	    if (strcmp(oldRefinementNode->name, newRefinementNode->name) == 0) {
-		break;
-	    }
-	}
-	if (! newRefinement) {
+	if (oldRefinements.peer[i] < 0) {
 	    if (strcmp(smiGetNodeModule(oldRefinementNode)->name,
 		       oldModule->name)) {
 		printErrorAtLine(oldModule, ERR_EXT_REFINEMENT_REMOVED,
@@ -2666,6 +2926,8 @@ checkComplRefinements(SmiModule *oldModule, const char *oldTag,
 				 oldNode->name);
 	    }
 	} else {
+	    newRefinement = newRefinements.entries[oldRefinements.peer[i]].ptr;
+	    newRefinementNode = smiGetRefinementNode(newRefinement);
 	    code = 0;
 	    code |= checkDescription(oldModule, smiGetRefinementLine(oldRefinement),
 				     newModule, smiGetRefinementLine(newRefinement),
@@ -2697,37 +2959,30 @@ checkComplRefinements(SmiModule *oldModule, const char *oldTag,
 				 oldRefinementNode->name);
 	    }
 	}
-	smiInit(oldTag);
     }
 
-    smiInit(newTag);
-    for (newRefinement = smiGetFirstRefinement(newNode);
-	 newRefinement; newRefinement = smiGetNextRefinement(newRefinement)) {
-	newRefinementNode = smiGetRefinementNode(newRefinement);
-	smiInit(oldTag);
-	for (oldRefinement = smiGetFirstRefinement(oldNode);
-	     oldRefinement; oldRefinement = smiGetNextRefinement(oldRefinement)) {
-	    oldRefinementNode = smiGetRefinementNode(oldRefinement);
-	    if (strcmp(oldRefinementNode->name, newRefinementNode->name) == 0) {
-		break;
-	    }
+    for (i = 0; i < newRefinements.num; i++) {
+	if (newRefinements.peer[i] >= 0) {
+	    continue;
 	}
-	if (! oldRefinement) {
-	    if (strcmp(smiGetNodeModule(newRefinementNode)->name,
-		       newModule->name)) {
-		printErrorAtLine(newModule, ERR_EXT_REFINEMENT_ADDED,
-				 smiGetRefinementLine(newRefinement),
-				 newModule->name, newRefinementNode->name,
-				 newNode->name);
-	    } else {
-		printErrorAtLine(newModule, ERR_REFINEMENT_ADDED,
-				 smiGetRefinementLine(newRefinement),
-				 newRefinementNode->name,
-				 newNode->name);
-	    }
+	newRefinement = newRefinements.entries[i].ptr;
+	newRefinementNode = smiGetRefinementNode(newRefinement);
+	if (strcmp(smiGetNodeModule(newRefinementNode)->name,
+		   newModule->name)) {
+	    printErrorAtLine(newModule, ERR_EXT_REFINEMENT_ADDED,
+			     smiGetRefinementLine(newRefinement),
+			     newModule->name, newRefinementNode->name,
+			     newNode->name);
+	} else {
+	    printErrorAtLine(newModule, ERR_REFINEMENT_ADDED,
+			     smiGetRefinementLine(newRefinement),
+			     newRefinementNode->name,
+			     newNode->name);
 	}
-	smiInit(newTag);
     }
+
+    freeStream(&oldRefinements);
+    freeStream(&newRefinements);
 }
 
 
@@ -2784,24 +3039,26 @@ checkCompliance(SmiModule *oldModule, const char *oldTag,
 
 static void
 diffCompliances(SmiModule *oldModule, const char *oldTag,
-		SmiModule *newModule, const char *newTag)
+	        SmiModule *newModule, const char *newTag)
 {
+    Stream oldNodes, newNodes;
     SmiNode *oldNode, *newNode;
-    
+    int i;
+
+    memset(&oldNodes, 0, sizeof(Stream));
+    memset(&newNodes, 0, sizeof(Stream));
+    joinNodes(oldModule, oldTag, newModule, newTag,
+	      SMI_NODEKIND_COMPLIANCE, &oldNodes, &newNodes);
+
     /*
      * First check whether the old node definitions still exist and
      * whether the updates (if any) are consistent with the SMI rules.
      */
     
-    smiInit(oldTag);
-    for(oldNode = smiGetFirstNode(oldModule, SMI_NODEKIND_COMPLIANCE);
-	oldNode;
-        oldNode = smiGetNextNode(oldNode, SMI_NODEKIND_COMPLIANCE)) {
-	smiInit(newTag);
-	newNode = smiGetNodeByOID(oldNode->oidlen, oldNode->oid);
-	if (newNode
-	    && newNode->oidlen == oldNode->oidlen
-	    && smiGetNodeModule(newNode) == newModule) {
+    for (i = 0; i < oldNodes.num; i++) {
+	oldNode = oldNodes.entries[i].ptr;
+	if (oldNodes.peer[i] >= 0) {
+	    newNode = newNodes.entries[oldNodes.peer[i]].ptr;
 	    checkCompliance(oldModule, oldTag, newModule, newTag,
 			    oldNode, newNode);
 	} else {
@@ -2810,30 +3067,24 @@ diffCompliances(SmiModule *oldModule, const char *oldTag,
 			     getStringNodekind(oldNode->nodekind),
 			     oldNode->name);
 	}
-	smiInit(oldTag);
     }
 
     /*
      * Let's see if there are any new definitions.
      */
 
-    smiInit(newTag);
-    for (newNode = smiGetFirstNode(newModule, SMI_NODEKIND_COMPLIANCE);
-	 newNode;
-	 newNode = smiGetNextNode(newNode, SMI_NODEKIND_COMPLIANCE)) {
-	
-	smiInit(oldTag);
-	oldNode = smiGetNodeByOID(newNode->oidlen, newNode->oid);
-	if (! oldNode
-	    || newNode->oidlen != oldNode->oidlen
-	    || smiGetNodeModule(oldNode) != oldModule) {
+    for (i = 0; i < newNodes.num; i++) {
+	if (newNodes.peer[i] < 0) {
+	    newNode = newNodes.entries[i].ptr;
 	    printErrorAtLine(newModule, ERR_NODE_ADDED,
 			     smiGetNodeLine(newNode),
 			     getStringNodekind(newNode->nodekind),
 			     newNode->name);
 	}
-	smiInit(newTag);
     }
+
+    freeStream(&oldNodes);
+    freeStream(&newNodes);
 }
 
 
@@ -2884,7 +3135,7 @@ diffOldNewComplianceMandatory(SmiModule *oldModule, const char *oldTag,
     SmiElement *oldGroupElement, *newGroupElement, *oldElement, *newElement;
     SmiNode *oldGroupNode, *newGroupNode, *oldNode, *newNode;
 
-    smiInit(oldTag);
+    initHandle(oldTag);
     for (oldGroupElement = smiGetFirstElement(oldComplNode);
 	 oldGroupElement;
 	 oldGroupElement = smiGetNextElement(oldGroupElement)) {
@@ -2893,7 +3144,7 @@ diffOldNewComplianceMandatory(SmiModule *oldModule, const char *oldTag,
 	     oldElement;
 	     oldElement = smiGetNextElement(oldElement)) {
 	    oldNode = smiGetElementNode(oldElement);
-	    smiInit(newTag);
+	    initHandle(newTag);
 	    newNode = findGroupsElement(newComplNode, oldNode->name);
 	    if (! newNode) {
 		if (strcmp(smiGetNodeModule(oldNode)->name, oldModule->name)) {
@@ -2912,11 +3163,11 @@ diffOldNewComplianceMandatory(SmiModule *oldModule, const char *oldTag,
 				     newComplNode->name);
 		}
 	    }
-	    smiInit(oldTag);
+	    initHandle(oldTag);
 	}
     }
 
-    smiInit(newTag);
+    initHandle(newTag);
     for (newGroupElement = smiGetFirstElement(newComplNode);
 	 newGroupElement;
 	 newGroupElement = smiGetNextElement(newGroupElement)) {
@@ -2925,7 +3176,7 @@ diffOldNewComplianceMandatory(SmiModule *oldModule, const char *oldTag,
 	     newElement;
 	     newElement = smiGetNextElement(newElement)) {
 	    newNode = smiGetElementNode(newElement);
-	    smiInit(oldTag);
+	    initHandle(oldTag);
 	    oldNode = findGroupsElement(oldComplNode, newNode->name);
 	    if (! oldNode) {
 		if (strcmp(smiGetNodeModule(newNode)->name, newModule->name)) {
@@ -2944,7 +3195,7 @@ diffOldNewComplianceMandatory(SmiModule *oldModule, const char *oldTag,
 				     newComplNode->name);
 		}
 	    }
-	    smiInit(newTag);
+	    initHandle(newTag);
 	}
     }
 }
@@ -2960,7 +3211,7 @@ diffOldNewComplianceOptional(SmiModule *oldModule, const char *oldTag,
     SmiOption *oldOption, *newOption;
     SmiNode *oldGroupNode, *newGroupNode, *oldNode, *newNode;
 
-    smiInit(oldTag);
+    initHandle(oldTag);
     for (oldOption = smiGetFirstOption(oldComplNode);
 	 oldOption;
 	 oldOption = smiGetNextOption(oldOption)) {
@@ -2969,7 +3220,7 @@ diffOldNewComplianceOptional(SmiModule *oldModule, const char *oldTag,
 	     oldElement;
 	     oldElement = smiGetNextElement(oldElement)) {
 	    oldNode = smiGetElementNode(oldElement);
-	    smiInit(newTag);
+	    initHandle(newTag);
 	    newNode = findGroupsElement(newComplNode, oldNode->name);
 	    if (! newNode) {
 		if (strcmp(smiGetNodeModule(oldNode)->name, oldModule->name)) {
@@ -2990,11 +3241,11 @@ diffOldNewComplianceOptional(SmiModule *oldModule, const char *oldTag,
 	    } else {
 		/* xxx compare group condition description here? xxx */
 	    }
-	    smiInit(oldTag);
+	    initHandle(oldTag);
 	}
     }
 
-    smiInit(newTag);
+    initHandle(newTag);
     for (newOption = smiGetFirstOption(newComplNode);
 	 newOption;
 	 newOption = smiGetNextOption(newOption)) {
@@ -3003,7 +3254,7 @@ diffOldNewComplianceOptional(SmiModule *oldModule, const char *oldTag,
 	     newElement;
 	     newElement = smiGetNextElement(newElement)) {
 	    newNode = smiGetElementNode(newElement);
-	    smiInit(oldTag);
+	    initHandle(oldTag);
 	    oldNode = findGroupsElement(oldComplNode, newNode->name);
 	    if (! oldNode) {
 		if (strcmp(smiGetNodeModule(newNode)->name, newModule->name)) {
@@ -3022,7 +3273,7 @@ diffOldNewComplianceOptional(SmiModule *oldModule, const char *oldTag,
 				     newComplNode->name);
 		}
 	    }
-	    smiInit(newTag);
+	    initHandle(newTag);
 	}
     }
 }
@@ -3077,11 +3328,277 @@ diffOldNewCompliance(SmiModule *oldModule, const char *oldTag,
 
 
 
+#ifdef HAVE_DIRENT_H
+
+static int
+cmpFiles(const void *a, const void *b)
+{
+    return strcmp(*(char * const *) a, *(char * const *) b);
+}
+
+
+
+static int
+cmpJobs(const void *a, const void *b)
+{
+    return strcmp(((const Job *) a)->name, ((const Job *) b)->name);
+}
+
+
+
+/*
+ * Load all module files of a directory into the handle identified by
+ * tag. The directory is searched first for imported modules. Returns
+ * -1 if the directory cannot be read.
+ */
+
+static int
+loadRepository(const char *tag, const char *dir, Stream *stream)
+{
+    DIR *d;
+    struct dirent *de;
+    struct stat st;
+    char **files = NULL, *path, *smiPath, *name;
+    SmiModule *smiModule;
+    int i, j, numFiles = 0, maxFiles = 0;
+
+    d = opendir(dir);
+    if (! d) {
+	fprintf(stderr, "smidiff: cannot read directory `%s'\n", dir);
+	return -1;
+    }
+    while ((de = readdir(d))) {
+	if (de->d_name[0] == '.') {
+	    continue;
+	}
+	if (numFiles == maxFiles) {
+	    maxFiles = maxFiles ? 2 * maxFiles : 256;
+	    files = realloc(files, maxFiles * sizeof(char *));
+	}
+	files[numFiles++] = strdup(de->d_name);
+    }
+    closedir(d);
+
+    /* the load order determines which file wins for duplicate modules */
+    if (numFiles) {
+	qsort(files, numFiles, sizeof(char *), cmpFiles);
+    }
+
+    initHandle(tag);
+    smiPath = smiGetPath();
+    path = malloc(strlen(dir) + (smiPath ? strlen(smiPath) : 0) + 2);
+    if (smiPath) {
+	sprintf(path, "%s%c%s", dir, PATH_SEPARATOR, smiPath);
+    } else {
+	strcpy(path, dir);
+    }
+    smiSetPath(path);
+    free(path);
+    free(smiPath);
+
+    for (i = 0; i < numFiles; i++) {
+	path = malloc(strlen(dir) + strlen(files[i]) + 2);
+	sprintf(path, "%s%c%s", dir, DIR_SEPARATOR, files[i]);
+	if (stat(path, &st) == 0 && S_ISREG(st.st_mode)) {
+	    name = smiLoadModule(path);
+	    smiModule = name ? smiGetModule(name) : NULL;
+	    if (! smiModule) {
+		fprintf(stderr, "smidiff: cannot load `%s'\n", path);
+	    } else {
+		for (j = 0; j < stream->num; j++) {
+		    if (stream->entries[j].ptr == smiModule) break;
+		}
+		if (j == stream->num) {
+		    addEntry(stream, smiModule, smiModule->name, 0, NULL);
+		}
+	    }
+	}
+	free(path);
+	free(files[i]);
+    }
+    free(files);
+
+    return 0;
+}
+
+
+
+static void
+runJob(Job *job)
+{
+    out = tmpfile();
+    if (! out) {
+	perror("smidiff: cannot create temporary file");
+	exit(1);
+    }
+    numMessages = 0;
+
+    if (job->oldModule && job->newModule) {
+	diffModules(job->oldModule, oldTag, job->newModule, newTag);
+	diffTypes(job->oldModule, oldTag, job->newModule, newTag);
+	diffObjects(job->oldModule, oldTag, job->newModule, newTag);
+	diffNotifications(job->oldModule, oldTag, job->newModule, newTag);
+	diffGroups(job->oldModule, oldTag, job->newModule, newTag);
+	diffCompliances(job->oldModule, oldTag, job->newModule, newTag);
+    }
+
+    job->out = out;
+    job->count = numMessages;
+    out = NULL;
+}
+
+
+
+#ifdef SMIDIFF_THREADS
+
+static Job *jobs = NULL;
+static int numJobs = 0;
+static int nextJob = 0;
+static pthread_mutex_t jobMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void*
+worker(void *arg)
+{
+    int i;
+
+    while (1) {
+	pthread_mutex_lock(&jobMutex);
+	i = nextJob++;
+	pthread_mutex_unlock(&jobMutex);
+	if (i >= numJobs) {
+	    break;
+	}
+	runJob(&jobs[i]);
+    }
+    return NULL;
+}
+
+#endif
+
+
+
+/*
+ * Compare all modules of two repositories. The modules of each
+ * repository are loaded once, the module pairs are matched by name
+ * and diffed on numThreads worker threads. The messages are written
+ * ordered by module name, followed by a summary with a status per
+ * module: 0 if there are no messages, 1 if there are messages and 2
+ * if the module has been removed. The largest status is returned.
+ */
+
+static int
+diffRepositories(const char *oldDir, const char *newDir)
+{
+    Stream oldModules, newModules;
+    Job *job, *jobList;
+    char buf[8192];
+    size_t n;
+    int i, num = 0, status, rc = 0;
+#ifdef SMIDIFF_THREADS
+    pthread_t *threads;
+#endif
+
+    memset(&oldModules, 0, sizeof(Stream));
+    memset(&newModules, 0, sizeof(Stream));
+    if (loadRepository(oldTag, oldDir, &oldModules) < 0
+	|| loadRepository(newTag, newDir, &newModules) < 0) {
+	return 2;
+    }
+    join(&oldModules, &newModules, cmpNames);
+
+    jobList = calloc(oldModules.num + newModules.num + 1, sizeof(Job));
+    if (! jobList) {
+	fprintf(stderr, "smidiff: out of memory\n");
+	exit(1);
+    }
+    for (i = 0; i < oldModules.num; i++) {
+	job = &jobList[num++];
+	job->name = oldModules.entries[i].name;
+	job->oldModule = oldModules.entries[i].ptr;
+	if (oldModules.peer[i] >= 0) {
+	    job->newModule = newModules.entries[oldModules.peer[i]].ptr;
+	}
+    }
+    for (i = 0; i < newModules.num; i++) {
+	if (newModules.peer[i] < 0) {
+	    job = &jobList[num++];
+	    job->name = newModules.entries[i].name;
+	    job->newModule = newModules.entries[i].ptr;
+	}
+    }
+    if (num) {
+	qsort(jobList, num, sizeof(Job), cmpJobs);
+    }
+
+#ifdef SMIDIFF_THREADS
+    if (numThreads > num) {
+	numThreads = num;
+    }
+    if (numThreads > 1) {
+	jobs = jobList;
+	numJobs = num;
+	threads = malloc(numThreads * sizeof(pthread_t));
+	for (i = 0; i < numThreads; i++) {
+	    if (pthread_create(&threads[i], NULL, worker, NULL) != 0) {
+		fprintf(stderr, "smidiff: cannot create worker thread\n");
+		exit(1);
+	    }
+	}
+	for (i = 0; i < numThreads; i++) {
+	    pthread_join(threads[i], NULL);
+	}
+	free(threads);
+    } else
+#endif
+    for (i = 0; i < num; i++) {
+	runJob(&jobList[i]);
+    }
+
+    for (i = 0; i < num; i++) {
+	rewind(jobList[i].out);
+	while ((n = fread(buf, 1, sizeof(buf), jobList[i].out)) > 0) {
+	    fwrite(buf, 1, n, stdout);
+	}
+	fclose(jobList[i].out);
+    }
+
+    for (i = 0; i < num; i++) {
+	job = &jobList[i];
+	if (! job->newModule) {
+	    status = 2;
+	    printf("%-31s %d removed\n", job->name, status);
+	} else if (! job->oldModule) {
+	    status = 0;
+	    printf("%-31s %d added\n", job->name, status);
+	} else if (job->count) {
+	    status = 1;
+	    printf("%-31s %d changed (%d messages)\n",
+		   job->name, status, job->count);
+	} else {
+	    status = 0;
+	    printf("%-31s %d unchanged\n", job->name, status);
+	}
+	if (status > rc) {
+	    rc = status;
+	}
+    }
+
+    free(jobList);
+    freeStream(&oldModules);
+    freeStream(&newModules);
+    return rc;
+}
+
+#endif
+
+
+
 static void
 usage()
 {
     fprintf(stderr,
 	    "Usage: smidiff [options] oldmodule newmodule\n"
+	    "       smidiff [options] -r olddir newdir\n"
 	    "  -V, --version             show version and license information\n"
 	    "  -c, --config=file         load a specific configuration file\n"
 	    "  -h, --help                show usage information\n"
@@ -3091,7 +3608,9 @@ usage()
 	    "  -p, --preload=module      preload <module>\n"
 	    "  -s, --severity            print the severity of errors in brackets\n"
 	    "      --old-compliance=name name of the old compliance statement\n"
-	    "      --new-compliance=name name of the new compliance statement\n");
+	    "      --new-compliance=name name of the new compliance statement\n"
+	    "  -r, --repository          compare all modules of two directories\n"
+	    "  -j, --jobs=number         number of worker threads with -r\n");
 }
 
 
@@ -3107,9 +3626,9 @@ static void ignore(char *ign)
 }
 
 static void preload(char *module) {
-    smiInit(oldTag);
+    initHandle(oldTag);
     smiLoadModule(module);
-    smiInit(newTag);
+    initHandle(newTag);
     smiLoadModule(module);
 }
 
@@ -3132,16 +3651,18 @@ main(int argc, char *argv[])
 	{ 'i', "ignore",	 OPT_STRING, ignore,	    OPT_CALLFUNC },
 	{   0, "old-compliance", OPT_STRING, &oldCompl,	    0 },
 	{   0, "new-compliance", OPT_STRING, &newCompl,	    0 },
+	{ 'r', "repository",     OPT_FLAG,   &rFlag,        0 },
+	{ 'j', "jobs",           OPT_INT,    &numThreads,   0 },
 	{ 0, 0, OPT_END, 0, 0 }  /* no more options */
     };
     
-    smiInit(oldTag);
+    initHandle(oldTag);
     flags = smiGetFlags();
     flags |= SMI_FLAG_ERRORS;
     smiSetFlags(flags);
     smiSetErrorLevel(errorLevel);
 
-    smiInit(newTag);
+    initHandle(newTag);
     flags = smiGetFlags();
     flags |= SMI_FLAG_ERRORS;
     smiSetFlags(flags);
@@ -3164,23 +3685,56 @@ main(int argc, char *argv[])
 	return 1;
     }
 
-    smiInit(oldTag);
+    if (rFlag) {
+#ifdef HAVE_DIRENT_H
+	int rc;
+
+	if (oldCompl) {
+	    fprintf(stderr, "smidiff: compliance statements cannot be "
+		    "compared in repository mode\n");
+	    return 1;
+	}
+	if (numThreads <= 0) {
+#if defined(SMIDIFF_THREADS) && defined(_SC_NPROCESSORS_ONLN)
+	    numThreads = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	    if (numThreads <= 0) {
+		numThreads = 1;
+	    }
+	}
+	rc = diffRepositories(argv[1], argv[2]);
+	initHandle(oldTag);
+	exitHandle();
+	initHandle(newTag);
+	exitHandle();
+	if (fflush(stdout) || ferror(stdout)) {
+	    perror("smidiff: write error");
+	    exit(1);
+	}
+	return rc;
+#else
+	fprintf(stderr, "smidiff: repository mode is not supported\n");
+	return 1;
+#endif
+    }
+
+    initHandle(oldTag);
     smiSetErrorLevel(errorLevel);
     oldModule = smiGetModule(smiLoadModule(argv[1]));
     if (! oldModule) {
         fprintf(stderr, "smidiff: cannot locate module `%s'\n", argv[1]);
-        smiExit();
+        exitHandle();
         exit(1);
     }
 
-    smiInit(newTag);
+    initHandle(newTag);
     smiSetErrorLevel(errorLevel);
     newModule = smiGetModule(smiLoadModule(argv[2]));
     if (! newModule) {
         fprintf(stderr, "smidiff: cannot locate module `%s'\n", argv[2]);
-        smiExit();
-        smiInit(oldTag);
-        smiExit();
+        exitHandle();
+        initHandle(oldTag);
+        exitHandle();
         exit(2);
     }
 
@@ -3196,11 +3750,11 @@ main(int argc, char *argv[])
 	diffCompliances(oldModule, oldTag, newModule, newTag);
     }
 
-    smiInit(oldTag);
-    smiExit();
+    initHandle(oldTag);
+    exitHandle();
 
-    smiInit(newTag);
-    smiExit();
+    initHandle(newTag);
+    exitHandle();
 
     if (fflush(stdout) || ferror(stdout)) {
 	perror("smidiff: write error");
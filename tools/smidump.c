@@ -20,6 +20,14 @@
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
+#ifdef HAVE_DIRENT_H
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#endif
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
 #ifdef HAVE_WIN_H
 #include "win.h"
 #endif
@@ -29,6 +37,11 @@
 #include "smidump.h"
 
 
+#if defined(HAVE_DIRENT_H) && defined(HAVE_SYS_WAIT_H) && defined(HAVE_FORK)
+#define SMIDUMP_BATCH
+#endif
+
+
 
 static void help(void);
 static void usage(void);
@@ -49,7 +62,11 @@ static SmidumpDriver *driver;
 static SmidumpDriver *firstDriver;
 static SmidumpDriver *lastDriver;
 static SmidumpDriver *defaultDriver;
+static SmidumpDriver **drivers;	/* the drivers selected by -f */
+static int numDrivers;
 static char *output;
+static char *outputTemplate = NULL;
+static int jFlag = 0;	/* number of parallel jobs in batch mode */
 
 static int opts;
 static optStruct *opt;
@@ -68,6 +85,8 @@ static optStruct genericOpt[] = {
     { 'f', "format",         OPT_STRING, format,        OPT_CALLFUNC },
     { 'o', "output",         OPT_STRING, &output,       0            },
     { 'k', "keep-going",     OPT_FLAG,	 &kFlag,	0 },
+    { 'O', "output-template", OPT_STRING, &outputTemplate, 0 },
+    { 'j', "jobs",           OPT_INT,    &jFlag,        0 },
     { 0, 0, OPT_END, 0, 0 }  /* no more options */
 };
 
@@ -201,7 +220,11 @@ static void usage()
 	    "  -f, --format=format  use <format> when dumping (default %s)\n"
 	    "  -o, --output=name    use <name> when creating names for output files\n"
 	    "  -u, --unified        print a single unified output of all modules\n"
-	    "  -k, --keep-going     continue after serious parse errors\n\n",
+	    "  -k, --keep-going     continue after serious parse errors\n"
+	    "  -O, --output-template=template\n"
+	    "                       write each module in each format to a file\n"
+	    "                       named by <template> (%%m module, %%f format)\n"
+	    "  -j, --jobs=number    number of parallel jobs for -O\n\n",
 	    defaultDriver ? defaultDriver->name : "none");
 
     fprintf(stderr, "Supported formats are:\n");
@@ -262,17 +285,26 @@ static void unified() { flags |= SMIDUMP_FLAG_UNITE; }
 
 static void format(char *form)
 {
-    for (driver = firstDriver; driver; driver = driver->next) {
-	if (strcasecmp(driver->name, form) == 0) {
-	    break;
+    char *list, *name;
+
+    numDrivers = 0;
+    list = xstrdup(form);
+    for (name = strtok(list, ","); name; name = strtok(NULL, ",")) {
+	for (driver = firstDriver; driver; driver = driver->next) {
+	    if (strcasecmp(driver->name, name) == 0) {
+		break;
+	    }
 	}
+	if (!driver) {
+	    fprintf(stderr, "smidump: invalid dump format `%s'"
+		    " - supported formats are:\n", name);
+	    formats();
+	    exit(1);
+	}
+	drivers = xrealloc(drivers, (numDrivers + 1) * sizeof(SmidumpDriver *));
+	drivers[numDrivers++] = driver;
     }
-    if (!driver) {
-	fprintf(stderr, "smidump: invalid dump format `%s'"
-		" - supported formats are:\n", form);
-	formats();
-	exit(1);
-    }
+    xfree(list);
 }
 
 
@@ -307,11 +339,336 @@ errorHandler(char *path, int line, int severity, char *msg, char *tag)
 
 
 
+#ifdef HAVE_DIRENT_H
+
+static int
+cmpNames(const void *a, const void *b)
+{
+    return strcmp(*(char * const *) a, *(char * const *) b);
+}
+
+
+
+static void
+addName(char ***names, int *num, int *size, char *name)
+{
+    if (*num >= *size) {
+	*size = *size ? 2 * *size : 64;
+	*names = xrealloc(*names, *size * sizeof(char *));
+    }
+    (*names)[(*num)++] = name;
+}
+
+
+
+/*
+ * Expand directory arguments to the sorted list of files they
+ * contain. The directories are prepended to the module path.
+ */
+
+static char **
+collectModules(int argc, char *argv[], int *num)
+{
+    DIR *d;
+    struct dirent *de;
+    struct stat st;
+    char **names = NULL, *path, *smiPath;
+    int i, first, size = 0;
+
+    *num = 0;
+    for (i = 1; i < argc; i++) {
+	if (stat(argv[i], &st) < 0 || ! S_ISDIR(st.st_mode)) {
+	    addName(&names, num, &size, xstrdup(argv[i]));
+	    continue;
+	}
+	d = opendir(argv[i]);
+	if (! d) {
+	    fprintf(stderr, "smidump: cannot read directory `%s'\n", argv[i]);
+	    continue;
+	}
+	first = *num;
+	while ((de = readdir(d))) {
+	    if (de->d_name[0] == '.') {
+		continue;
+	    }
+	    path = xmalloc(strlen(argv[i]) + strlen(de->d_name) + 2);
+	    sprintf(path, "%s%c%s", argv[i], DIR_SEPARATOR, de->d_name);
+	    if (stat(path, &st) < 0 || ! S_ISREG(st.st_mode)) {
+		xfree(path);
+		continue;
+	    }
+	    addName(&names, num, &size, path);
+	}
+	closedir(d);
+	if (*num > first) {
+	    qsort(names + first, *num - first, sizeof(char *), cmpNames);
+	}
+
+	smiPath = smiGetPath();
+	path = xmalloc(strlen(argv[i]) + (smiPath ? strlen(smiPath) : 0) + 2);
+	if (smiPath) {
+	    sprintf(path, "%s%c%s", argv[i], PATH_SEPARATOR, smiPath);
+	} else {
+	    strcpy(path, argv[i]);
+	}
+	smiSetPath(path);
+	xfree(path);
+	xfree(smiPath);
+    }
+    
+    return names;
+}
+
+
+
+#endif
+
+
+
+#ifdef SMIDUMP_BATCH
+
+/*
+ * The batch mode loads all modules once and then runs each selected
+ * driver on each module, writing to a file named by the output
+ * template. Every module/driver pair is run by a process forked from
+ * the loaded state, so the drivers' static state is private to one
+ * run and up to jFlag runs proceed in parallel. The error output of
+ * each run is collected and reported in the order of the pairs.
+ */
+
+typedef struct Job {
+    SmiModule *module;
+    SmidumpDriver *driver;
+    char *output;
+    FILE *err;
+    int pid;
+    int status;			/* -2 not started, -1 running, else exit code */
+} Job;
+
+
+
+static char *
+expandTemplate(const char *template, const char *module, const char *format)
+{
+    const char *p;
+    char *s, *q;
+
+    s = xmalloc(strlen(template) + 1
+		+ (strlen(module) + strlen(format)) * strlen(template) / 2);
+    for (p = template, q = s; *p; p++) {
+	if (p[0] == '%' && p[1] == 'm') {
+	    strcpy(q, module);
+	    q += strlen(q);
+	    p++;
+	} else if (p[0] == '%' && p[1] == 'f') {
+	    strcpy(q, format);
+	    q += strlen(q);
+	    p++;
+	} else if (p[0] == '%' && p[1] == '%') {
+	    *q++ = '%';
+	    p++;
+	} else {
+	    *q++ = *p;
+	}
+    }
+    *q = 0;
+    return s;
+}
+
+
+
+/*
+ * Create the missing directories leading to a file.
+ */
+
+static void
+createDirs(char *path)
+{
+    char *p;
+
+    for (p = path + 1; *p; p++) {
+	if (*p == DIR_SEPARATOR) {
+	    *p = 0;
+	    mkdir(path, 0777);
+	    *p = DIR_SEPARATOR;
+	}
+    }
+}
+
+
+
+static void
+startJob(Job *job, int flags)
+{
+    int pid;
+
+    job->err = tmpfile();
+    if (! job->err) {
+	perror("smidump: cannot create temporary file");
+	exit(1);
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+    pid = fork();
+    if (pid < 0) {
+	perror("smidump: cannot fork");
+	exit(1);
+    }
+    if (pid == 0) {
+	dup2(fileno(job->err), 2);
+	createDirs(job->output);
+	if (job->driver->ignflags & SMIDUMP_DRIVER_CANT_OUTPUT) {
+	    if (! freopen(job->output, "w", stdout)) {
+		fprintf(stderr, "smidump: cannot open %s for writing: ",
+			job->output);
+		perror(NULL);
+		_exit(1);
+	    }
+	    (job->driver->func)(1, &job->module, flags, NULL);
+	} else {
+	    (job->driver->func)(1, &job->module, flags, job->output);
+	}
+	fflush(stdout);
+	fflush(stderr);
+	_exit(0);
+    }
+
+    job->pid = pid;
+    job->status = -1;
+}
+
+
+
+static void
+finishJob(Job *job)
+{
+    char buf[4096];
+    size_t n;
+
+    rewind(job->err);
+    while ((n = fread(buf, 1, sizeof(buf), job->err)) > 0) {
+	fwrite(buf, 1, n, stderr);
+    }
+    fclose(job->err);
+    if (job->status) {
+	fprintf(stderr, "smidump: %s output of module `%s' failed\n",
+		job->driver->name, job->module->name);
+    }
+}
+
+
+
+static int
+dumpBatch(int argc, char *argv[], int flags)
+{
+    SmiModule **modv;
+    Job *jobs;
+    char *modulename, **names;
+    int i, j, k, modc, numNames, numJobs = 0;
+    int next, done, running, pid, status, rc = 0;
+
+    names = collectModules(argc, argv, &numNames);
+    if (numNames > 1 && ! strstr(outputTemplate, "%m")) {
+	fprintf(stderr, "smidump: output template `%s' lacks %%m\n",
+		outputTemplate);
+	return 1;
+    }
+    if (numDrivers > 1 && ! strstr(outputTemplate, "%f")) {
+	fprintf(stderr, "smidump: output template `%s' lacks %%f\n",
+		outputTemplate);
+	return 1;
+    }
+
+    modv = xmalloc((numNames + 1) * sizeof(SmiModule *));
+    for (i = 0, modc = 0; i < numNames; i++) {
+	modulename = smiLoadModule(names[i]);
+	modv[modc] = modulename ? smiGetModule(modulename) : NULL;
+	if (! modv[modc]) {
+	    fprintf(stderr, "smidump: cannot locate module `%s'\n", names[i]);
+	    rc = 1;
+	    continue;
+	}
+	for (j = 0; j < modc && modv[j] != modv[modc]; j++) ;
+	if (j < modc) {
+	    continue;
+	}
+	if (modv[modc]->conformance && modv[modc]->conformance < 3) {
+	    if (! (flags & SMIDUMP_FLAG_SILENT)) {
+		fprintf(stderr, "smidump: module `%s' contains errors, %s\n",
+			names[i], kFlag ? "expect flawed output" : "skipped");
+	    }
+	    if (! kFlag) {
+		rc = 1;
+		continue;
+	    }
+	}
+	modc++;
+    }
+
+    jobs = xcalloc(modc * numDrivers + 1, sizeof(Job));
+    for (i = 0; i < modc; i++) {
+	for (j = 0; j < numDrivers; j++) {
+	    jobs[numJobs].module = modv[i];
+	    jobs[numJobs].driver = drivers[j];
+	    jobs[numJobs].output = expandTemplate(outputTemplate,
+						  modv[i]->name,
+						  drivers[j]->name);
+	    jobs[numJobs].status = -2;
+	    numJobs++;
+	}
+    }
+
+    for (next = 0, done = 0, running = 0; done < numJobs; ) {
+	while (next < numJobs && running < jFlag) {
+	    startJob(&jobs[next++], flags);
+	    running++;
+	}
+	if (jobs[done].status >= 0) {
+	    finishJob(&jobs[done]);
+	    if (jobs[done].status) {
+		rc = 1;
+	    }
+	    done++;
+	    continue;
+	}
+	pid = wait(&status);
+	if (pid < 0) {
+	    perror("smidump: wait failed");
+	    exit(1);
+	}
+	for (k = done; k < next; k++) {
+	    if (jobs[k].pid == pid && jobs[k].status == -1) {
+		jobs[k].status = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+		running--;
+		break;
+	    }
+	}
+    }
+
+    for (i = 0; i < numJobs; i++) {
+	xfree(jobs[i].output);
+    }
+    xfree(jobs);
+    for (i = 0; i < numNames; i++) {
+	xfree(names[i]);
+    }
+    xfree(names);
+    xfree(modv);
+
+    return rc;
+}
+
+#endif
+
+
+
 int main(int argc, char *argv[])
 {
     char *modulename;
     SmiModule *smiModule;
-    int smiflags, i;
+    char **names;
+    int smiflags, i, numNames;
     SmiModule **modv = NULL;
     int modc = 0;
 
@@ -371,11 +728,55 @@ int main(int argc, char *argv[])
 	smiExit();
 	exit(1);
     }
+    if (! numDrivers) {
+	drivers = xmalloc(sizeof(SmidumpDriver *));
+	drivers[numDrivers++] = driver;
+    }
     
     if (sFlag || mFlag) {
 	smiSetErrorHandler(errorHandler);
     }
 
+    if (outputTemplate) {
+#ifdef SMIDUMP_BATCH
+	int j;
+	
+	smiflags = smiGetFlags();
+	smiflags |= SMI_FLAG_ERRORS;
+	for (i = 0, j = ~0; i < numDrivers; i++) {
+	    j &= drivers[i]->smiflags;
+	}
+	smiflags |= j;
+	smiSetFlags(smiflags);
+	if (flags & SMIDUMP_FLAG_UNITE) {
+	    fprintf(stderr, "smidump: ignoring -u with -O\n");
+	    flags &= ~SMIDUMP_FLAG_UNITE;
+	}
+	if (jFlag <= 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+	    jFlag = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	    if (jFlag <= 0) {
+		jFlag = 1;
+	    }
+	}
+	i = dumpBatch(argc, argv, flags);
+	smiExit();
+	if (drivers) xfree(drivers);
+	return i;
+#else
+	fprintf(stderr, "smidump: output templates are not supported\n");
+	smiExit();
+	exit(1);
+#endif
+    }
+
+    if (numDrivers > 1) {
+	fprintf(stderr, "smidump: multiple formats require -O\n");
+	smiExit();
+	exit(1);
+    }
+
     smiflags = smiGetFlags();
     smiflags |= SMI_FLAG_ERRORS;
     smiflags |= driver->smiflags;
@@ -393,11 +794,17 @@ int main(int argc, char *argv[])
 	output = NULL;
     }
 
-    modv = (SmiModule **) xmalloc((argc) * sizeof(SmiModule *));
+#ifdef HAVE_DIRENT_H
+    names = collectModules(argc, argv, &numNames);
+#else
+    names = argv + 1;
+    numNames = argc - 1;
+#endif
+    modv = (SmiModule **) xmalloc((numNames + 1) * sizeof(SmiModule *));
     modc = 0;
     
-    for (i = 1; i < argc; i++) {
-        modulename = smiLoadModule(argv[i]);
+    for (i = 0; i < numNames; i++) {
+        modulename = smiLoadModule(names[i]);
         
         smiModule = modulename ? smiGetModule(modulename) : NULL;
         if (smiModule) {
@@ -407,13 +814,13 @@ int main(int argc, char *argv[])
                     fprintf(stderr,
                         "smidump: module `%s' contains errors, "
                         "expect flawed output\n",
-                        argv[i]);
+                        names[i]);
                 }
             }
             modv[modc++] = smiModule;
         } else {
             fprintf(stderr, "smidump: cannot locate module `%s'\n",
-                argv[i]);
+                names[i]);
         }
     }
 
@@ -429,7 +836,14 @@ int main(int argc, char *argv[])
 
     smiExit();
 
+#ifdef HAVE_DIRENT_H
+    for (i = 0; i < numNames; i++) {
+        xfree(names[i]);
+    }
+    if (names) xfree(names);
+#endif
     if (modv) xfree(modv);
+    if (drivers) xfree(drivers);
     
     return 0;
 }
@@ -16,9 +16,18 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <ctype.h>
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
+#ifdef HAVE_DIRENT_H
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#endif
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
 #ifdef HAVE_WIN_H
 #include "win.h"
 #endif
@@ -27,6 +36,11 @@
 #include "shhopt.h"
 
 
+#if defined(HAVE_DIRENT_H) && defined(HAVE_SYS_WAIT_H) && defined(HAVE_FORK)
+#define SMILINT_BATCH
+#endif
+
+
 
 /*
  * These are functions that are not officially exported by the libsmi.
@@ -42,7 +56,15 @@ extern char* smiGetErrorDescription(int id);
 static int mFlag = 0;	/* show the name for error messages */
 static int sFlag = 0;	/* show the severity for error messages */
 static int eFlag = 0;	/* print the list of possible error messages */
+static int jFlag = 0;	/* number of parallel jobs in batch mode */
 static int flags;
+static char **preloads = NULL;
+static int numPreloads = 0;
+static char *cacheDir = NULL;	/* directory of cached results */
+static char *cacheKey = NULL;	/* options that affect the diagnostics */
+
+#define FNV_OFFSET	((SmiUnsigned64) 0xcbf29ce4 << 32 | 0x84222325)
+#define FNV_PRIME	((SmiUnsigned64) 0x100 << 32 | 0x1b3)
 
 
 typedef struct Error {
@@ -195,51 +217,182 @@ static void usage()
 	    "  -r, --recursive       print errors also for imported modules\n"
 	    "  -l, --level=level     set maximum level of errors and warnings\n"
 	    "  -i, --ignore=prefix   ignore errors matching prefix pattern\n"
-	    "  -I, --noignore=prefix do not ignore errors matching prefix pattern\n");
+	    "  -I, --noignore=prefix do not ignore errors matching prefix pattern\n"
+	    "  -j, --jobs=number     check files and directories by parallel jobs\n"
+	    "  -C, --cache=dir       reuse results of unchanged files cached in dir\n");
+}
+
+
+
+/*
+ * The 64 bit FNV-1a hash of some data, continuing a previous hash h.
+ */
+
+static SmiUnsigned64
+hash(SmiUnsigned64 h, const char *data, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+	h ^= (unsigned char) data[i];
+	h *= FNV_PRIME;
+    }
+    return h;
+}
+
+
+
+static int
+hashFile(const char *path, SmiUnsigned64 *h)
+{
+    FILE *f;
+    char buf[8192];
+    size_t n;
+
+    f = fopen(path, "rb");
+    if (! f) {
+	return -1;
+    }
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+	*h = hash(*h, buf, n);
+    }
+    fclose(f);
+    return 0;
+}
+
+
+
+/*
+ * Remember an option that affects the diagnostics, so that cached
+ * results are only reused for the same options.
+ */
+
+static void
+addKey(int opt, const char *value)
+{
+    size_t len = cacheKey ? strlen(cacheKey) : 0;
+
+    cacheKey = realloc(cacheKey, len + strlen(value) + 3);
+    if (! cacheKey) {
+	fprintf(stderr, "smilint: out of memory\n");
+	exit(1);
+    }
+    sprintf(cacheKey + len, "%c%s\n", opt, value);
+}
+
+
+
+/*
+ * Remember the error level and the severities of all errors, as set
+ * by the configuration files and the -l, -i and -I options.
+ */
+
+static void
+addSeverities(void)
+{
+    SmiUnsigned64 h = FNV_OFFSET;
+    char buf[20];
+    int i, severity;
+
+    sprintf(buf, "%d", smiGetErrorLevel());
+    addKey('l', buf);
+    for (i = 0; (severity = smiGetErrorSeverity(i)) >= 0; i++) {
+	sprintf(buf, "%d,", severity);
+	h = hash(h, buf, strlen(buf));
+    }
+    sprintf(buf, "%08lx%08lx",
+	    (unsigned long) (h >> 32), (unsigned long) (h & 0xffffffff));
+    addKey('s', buf);
+}
+
+
+
+static void
+preload(char *module)
+{
+    preloads = realloc(preloads, (numPreloads + 1) * sizeof(char *));
+    if (! preloads) {
+	fprintf(stderr, "smilint: out of memory\n");
+	exit(1);
+    }
+    preloads[numPreloads++] = module;
+    addKey('p', module);
+}
+
+
+
+static void
+config(char *filename)
+{
+    SmiUnsigned64 h = FNV_OFFSET;
+    char buf[20];
+
+    smiReadConfig(filename, "smilint");
+    hashFile(filename, &h);
+    sprintf(buf, "%08lx%08lx",
+	    (unsigned long) (h >> 32), (unsigned long) (h & 0xffffffff));
+    addKey('c', buf);
+}
+
+
+
+static void
+level(int lev)
+{
+    smiSetErrorLevel(lev);
 }
 
 
 
 static void help() { usage(); exit(0); }
 static void version() { printf("smilint " SMI_VERSION_STRING "\n"); exit(0); }
-static void config(char *filename) { smiReadConfig(filename, "smilint"); }
-static void preload(char *module) { smiLoadModule(module); }
 static void recursive() { flags |= SMI_FLAG_RECURSIVE; smiSetFlags(flags); }
-static void level(int lev) { smiSetErrorLevel(lev); }
 static void ignore(char *ign) { smiSetSeverity(ign, 128); }
 static void noignore(char *ign) { smiSetSeverity(ign, -1); }
 
 
 
-static void
-errorHandler(char *path, int line, int severity, char *msg, char *tag)
+static char *
+formatError(char *path, int line, int severity, char *msg, char *tag)
 {
-    int i;
-    
+    char *text, *p;
+
+    text = malloc((path ? strlen(path) : 0) + strlen(tag) + strlen(msg) + 64);
+    if (! text) {
+	fprintf(stderr, "smilint: malloc failed - running out of memory\n");
+	exit(1);
+    }
+    p = text;
     if (path) {
-	fprintf(stderr, "%s:%d: ", path, line);
+	p += sprintf(p, "%s:%d: ", path, line);
     }
     if (sFlag) {
-	fprintf(stderr, "[%d] ", severity);
+	p += sprintf(p, "[%d] ", severity);
     }
     if (mFlag) {
-	fprintf(stderr, "{%s} ", tag);
+	p += sprintf(p, "{%s} ", tag);
     }
     switch (severity) {
     case 4:
     case 5:
-	fprintf(stderr, "warning: ");
+	p += sprintf(p, "warning: ");
 	break;
     case 6:	
-	fprintf(stderr, "info: ");
+	p += sprintf(p, "info: ");
 	break;
     }
-    fprintf(stderr, "%s\n", msg);
+    strcpy(p, msg);
+
+    return text;
+}
 
-    if (severity <= 0) {
-	exit(1);
-    }
 
+
+static void
+countError(char *tag)
+{
+    int i;
+    
     /* If we are supposed to generate error descriptions, locate this
      * error in our error list and increment its usage counter. Note
      * that we assume that error tags are unique (and we should better
@@ -257,6 +410,968 @@ errorHandler(char *path, int line, int severity, char *msg, char *tag)
 
 
 
+#ifdef SMILINT_BATCH
+
+/*
+ * The batch mode checks many files at once. The modules imported by
+ * more than one of them are loaded once, the files are then checked
+ * by forked processes that share this preloaded state. Each process
+ * writes its diagnostics as "tag<TAB>text" lines to a temporary file
+ * which is replayed by the parent in the order of the files.
+ */
+
+typedef struct Count {
+    char *name;
+    int count;
+} Count;
+
+typedef struct Table {
+    Count *entries;
+    int num;
+    int size;
+} Table;
+
+typedef struct Record {
+    SmiDiagnostic *diag;	/* collected by the library while preloading */
+    char *path;			/* the file the diagnostic refers to */
+    char *line;			/* "tag<TAB>text", built on first use */
+    int seq;
+    int used;
+} Record;
+
+typedef struct Loaded {
+    SmiModule *module;
+    dev_t dev;
+    ino_t ino;
+} Loaded;
+
+typedef struct Job {
+    char *path;
+    FILE *out;			/* diagnostics written by the child */
+    SmiModule *module;		/* the file has been loaded while preloading */
+    char *entry;		/* cache entry to replay */
+    long offset;		/* of the diagnostics within the entry */
+    SmiUnsigned64 key;		/* of the cache entry */
+    int keyed;
+    int pid;
+    int status;			/* -2 not started, -1 running, else exit code */
+} Job;
+
+typedef struct Digest {
+    char *path;
+    SmiUnsigned64 hash;
+    int ok;
+} Digest;
+
+static FILE *out = NULL;	/* diagnostics of the child's job */
+static Record *records = NULL;
+static int numRecords = 0, maxRecords = 0;
+static Job *jobs = NULL;
+static int numJobs = 0, maxJobs = 0;
+static char *dirs = NULL;	/* directories to prepend to the path */
+static Table tags = { NULL, 0, 0 };
+static int numMessages = 0;
+static Digest *digests = NULL;
+static int numDigests = 0, maxDigests = 0;
+static SmiUnsigned64 baseKey;
+static int numCached = 0;
+
+#define CACHE_MAGIC "smilint-cache 1"
+
+#endif
+
+
+
+static void
+errorHandler(char *path, int line, int severity, char *msg, char *tag)
+{
+    char *text;
+
+    if (! tag) {
+	tag = "";
+    }
+
+    text = formatError(path, line, severity, msg, tag);
+
+#ifdef SMILINT_BATCH
+    if (out) {
+	fprintf(out, "%s\t%s\n", tag, text);
+	free(text);
+	if (severity <= 0) {
+	    exit(1);
+	}
+	return;
+    }
+#endif
+
+    fprintf(stderr, "%s\n", text);
+    free(text);
+
+    if (severity <= 0) {
+	exit(1);
+    }
+
+    countError(tag);
+}
+
+
+
+#ifdef SMILINT_BATCH
+
+static int
+addCount(Table *table, const char *name, int len)
+{
+    int i;
+
+    for (i = 0; i < table->num; i++) {
+	if (strncmp(table->entries[i].name, name, len) == 0
+	    && table->entries[i].name[len] == 0) {
+	    return ++table->entries[i].count;
+	}
+    }
+    if (table->num == table->size) {
+	table->size = table->size ? 2 * table->size : 64;
+	table->entries = realloc(table->entries, table->size * sizeof(Count));
+	if (! table->entries) {
+	    fprintf(stderr, "smilint: out of memory\n");
+	    exit(1);
+	}
+    }
+    table->entries[i].name = malloc(len + 1);
+    memcpy(table->entries[i].name, name, len);
+    table->entries[i].name[len] = 0;
+    table->entries[i].count = 1;
+    table->num++;
+
+    return 1;
+}
+
+
+
+static int
+cmpNames(const void *a, const void *b)
+{
+    return strcmp(*(char * const *) a, *(char * const *) b);
+}
+
+
+
+static int
+cmpCounts(const void *a, const void *b)
+{
+    const Count *c1 = a, *c2 = b;
+
+    if (c1->count != c2->count) {
+	return c2->count - c1->count;
+    }
+    return strcmp(c1->name, c2->name);
+}
+
+
+
+/*
+ * Turn the diagnostics collected by the library while preloading into
+ * records. The records refer to the library's copies of the paths,
+ * their lines are only formatted when they are reported.
+ */
+
+static void
+collectRecords(void)
+{
+    SmiDiagnostic *diag;
+
+    for (diag = smiGetFirstDiagnostic(); diag;
+	 diag = smiGetNextDiagnostic(diag)) {
+	if (diag->severity <= 0 || ! diag->path) {
+	    continue;
+	}
+	if (numRecords == maxRecords) {
+	    maxRecords = maxRecords ? 2 * maxRecords : 256;
+	    records = realloc(records, maxRecords * sizeof(Record));
+	    if (! records) {
+		fprintf(stderr, "smilint: out of memory\n");
+		exit(1);
+	    }
+	}
+	records[numRecords].diag = diag;
+	records[numRecords].path = diag->path;
+	records[numRecords].line = NULL;
+	records[numRecords].seq = numRecords;
+	records[numRecords].used = 0;
+	numRecords++;
+    }
+}
+
+
+
+static char *
+recordLine(Record *record)
+{
+    SmiDiagnostic *diag = record->diag;
+    char *tag, *text;
+
+    if (! record->line) {
+	tag = diag->tag ? diag->tag : "";
+	text = formatError(diag->path, diag->line, diag->severity,
+			   smiGetDiagnosticMessage(diag), tag);
+	record->line = malloc(strlen(tag) + strlen(text) + 2);
+	if (! record->line) {
+	    fprintf(stderr, "smilint: out of memory\n");
+	    exit(1);
+	}
+	sprintf(record->line, "%s\t%s", tag, text);
+	free(text);
+    }
+    return record->line;
+}
+
+
+
+static int
+cmpRecords(const void *a, const void *b)
+{
+    const Record *r1 = a, *r2 = b;
+    int c;
+
+    c = strcmp(r1->path, r2->path);
+    return c ? c : r1->seq - r2->seq;
+}
+
+
+
+static void
+addJob(char *path)
+{
+    if (numJobs == maxJobs) {
+	maxJobs = maxJobs ? 2 * maxJobs : 256;
+	jobs = realloc(jobs, maxJobs * sizeof(Job));
+	if (! jobs) {
+	    fprintf(stderr, "smilint: out of memory\n");
+	    exit(1);
+	}
+    }
+    memset(&jobs[numJobs], 0, sizeof(Job));
+    jobs[numJobs].path = path;
+    jobs[numJobs].status = -2;
+    numJobs++;
+}
+
+
+
+/*
+ * Add a file or module name to the list of jobs. Directories are
+ * traversed recursively in lexical order and remembered so that
+ * modules import each other from the tree that is being checked.
+ */
+
+static void
+collect(const char *path)
+{
+    DIR *d;
+    struct dirent *de;
+    struct stat st;
+    char **names = NULL, *name;
+    int i, num = 0, size = 0;
+
+    if (stat(path, &st) < 0 || ! S_ISDIR(st.st_mode)) {
+	addJob(strdup(path));
+	return;
+    }
+
+    d = opendir(path);
+    if (! d) {
+	fprintf(stderr, "smilint: cannot read directory `%s'\n", path);
+	return;
+    }
+    while ((de = readdir(d))) {
+	if (de->d_name[0] == '.') {
+	    continue;
+	}
+	if (num == size) {
+	    size = size ? 2 * size : 64;
+	    names = realloc(names, size * sizeof(char *));
+	}
+	names[num++] = strdup(de->d_name);
+    }
+    closedir(d);
+
+    name = malloc(strlen(path) + (dirs ? strlen(dirs) : 0) + 2);
+    if (dirs) {
+	sprintf(name, "%s%c%s", dirs, PATH_SEPARATOR, path);
+	free(dirs);
+    } else {
+	strcpy(name, path);
+    }
+    dirs = name;
+
+    if (num) {
+	qsort(names, num, sizeof(char *), cmpNames);
+    }
+    for (i = 0; i < num; i++) {
+	name = malloc(strlen(path) + strlen(names[i]) + 2);
+	sprintf(name, "%s%c%s", path, DIR_SEPARATOR, names[i]);
+	if (stat(name, &st) == 0 && S_ISDIR(st.st_mode)) {
+	    collect(name);
+	    free(name);
+	} else if (S_ISREG(st.st_mode)) {
+	    addJob(name);
+	} else {
+	    free(name);
+	}
+	free(names[i]);
+    }
+    free(names);
+}
+
+
+
+/*
+ * Count the modules imported by an SMIv1/v2 file. Only the header of
+ * the file is scanned, which is way cheaper than parsing it.
+ */
+
+static void
+scanImports(const char *path, Table *imports)
+{
+    SmiModuleSummary *summary;
+    int i;
+
+    summary = smiScanModule(path);
+    if (! summary) {
+	return;
+    }
+    if (summary->language != SMI_LANGUAGE_SMING
+	&& summary->language != SMI_LANGUAGE_YANG) {
+	for (i = 0; i < summary->numImports; i++) {
+	    addCount(imports, summary->imports[i],
+		     strlen(summary->imports[i]));
+	}
+    }
+    smiFreeModuleSummary(summary);
+}
+
+
+
+static void
+report(char *line)
+{
+    char *text;
+
+    text = strchr(line, '\t');
+    if (! text) {
+	return;
+    }
+    *text = 0;
+    fprintf(stderr, "%s\n", text + 1);
+    if (*line) {
+	countError(line);
+	addCount(&tags, line, strlen(line));
+	numMessages++;
+    }
+    *text = '\t';
+}
+
+
+
+static char *
+readLine(FILE *f)
+{
+    static char *buf = NULL;
+    static int size = 0;
+    int c, n = 0;
+
+    while ((c = getc(f)) != EOF && c != '\n') {
+	if (n + 1 >= size) {
+	    size = size ? 2 * size : 256;
+	    buf = realloc(buf, size);
+	    if (! buf) {
+		fprintf(stderr, "smilint: out of memory\n");
+		exit(1);
+	    }
+	}
+	buf[n++] = c;
+    }
+    if (c == EOF && n == 0) {
+	return NULL;
+    }
+    buf[n] = 0;
+    return buf;
+}
+
+
+
+static void
+append(Table *table, const char *name)
+{
+    if (table->num == table->size) {
+	table->size = table->size ? 2 * table->size : 64;
+	table->entries = realloc(table->entries, table->size * sizeof(Count));
+	if (! table->entries) {
+	    fprintf(stderr, "smilint: out of memory\n");
+	    exit(1);
+	}
+    }
+    table->entries[table->num].name = strdup(name);
+    table->entries[table->num].count = 0;
+    table->num++;
+}
+
+
+
+static void
+clear(Table *table)
+{
+    int i;
+
+    for (i = 0; i < table->num; i++) {
+	free(table->entries[i].name);
+    }
+    free(table->entries);
+    table->entries = NULL;
+    table->num = table->size = 0;
+}
+
+
+
+static SmiModule *
+findLoaded(const char *name)
+{
+    SmiModule *smiModule;
+
+    for (smiModule = smiGetFirstModule(); smiModule;
+	 smiModule = smiGetNextModule(smiModule)) {
+	if (strcmp(smiModule->name, name) == 0) {
+	    return smiModule;
+	}
+    }
+    return NULL;
+}
+
+
+
+/*
+ * Add the files of all modules imported directly or indirectly by a
+ * module to deps. Returns -1 if an import has not been resolved.
+ */
+
+static int
+dependencies(SmiModule *smiModule, Table *deps)
+{
+    Table names = { NULL, 0, 0 };
+    SmiImport *smiImport;
+    int i, rc = 0;
+
+    addCount(&names, smiModule->name, strlen(smiModule->name));
+    for (i = 0; i < names.num; i++) {
+	smiModule = findLoaded(names.entries[i].name);
+	if (! smiModule || ! smiModule->path) {
+	    rc = -1;
+	    break;
+	}
+	if (i) {
+	    append(deps, smiModule->path);
+	}
+	for (smiImport = smiGetFirstImport(smiModule); smiImport;
+	     smiImport = smiGetNextImport(smiImport)) {
+	    addCount(&names, smiImport->module, strlen(smiImport->module));
+	}
+    }
+    clear(&names);
+
+    return rc;
+}
+
+
+
+/*
+ * The hash of a file's contents, computed once per run.
+ */
+
+static int
+digest(const char *path, SmiUnsigned64 *h)
+{
+    int i;
+
+    for (i = 0; i < numDigests; i++) {
+	if (strcmp(digests[i].path, path) == 0) {
+	    *h = digests[i].hash;
+	    return digests[i].ok;
+	}
+    }
+    if (numDigests == maxDigests) {
+	maxDigests = maxDigests ? 2 * maxDigests : 64;
+	digests = realloc(digests, maxDigests * sizeof(Digest));
+	if (! digests) {
+	    fprintf(stderr, "smilint: out of memory\n");
+	    exit(1);
+	}
+    }
+    digests[i].path = strdup(path);
+    digests[i].hash = FNV_OFFSET;
+    digests[i].ok = hashFile(path, &digests[i].hash);
+    numDigests++;
+
+    *h = digests[i].hash;
+    return digests[i].ok;
+}
+
+
+
+static char *
+entryName(Job *job, int pid)
+{
+    char *name;
+
+    name = malloc(strlen(cacheDir) + 40);
+    if (! name) {
+	fprintf(stderr, "smilint: out of memory\n");
+	exit(1);
+    }
+    sprintf(name, "%s%c%08lx%08lx", cacheDir, DIR_SEPARATOR,
+	    (unsigned long) (job->key >> 32),
+	    (unsigned long) (job->key & 0xffffffff));
+    if (pid) {
+	sprintf(name + strlen(name), ".%d", pid);
+    }
+    return name;
+}
+
+
+
+/*
+ * A cache entry is named by the hash of the options, the path and the
+ * contents of a file. It holds the exit status of the check, the hash
+ * of every file the module depends on and the diagnostics. The entry
+ * is reused if none of these files has changed.
+ */
+
+static void
+lookup(Job *job)
+{
+    FILE *f;
+    char *line;
+    SmiUnsigned64 h;
+    unsigned long hi, lo;
+    long offset;
+    int status;
+
+    job->key = hash(baseKey, job->path, strlen(job->path) + 1);
+    if (hashFile(job->path, &job->key) < 0) {
+	return;
+    }
+    job->keyed = 1;
+
+    job->entry = entryName(job, 0);
+    f = fopen(job->entry, "r");
+    if (! f) {
+	goto miss;
+    }
+    line = readLine(f);
+    if (! line || strcmp(line, CACHE_MAGIC) != 0) {
+	goto miss;
+    }
+    line = readLine(f);
+    if (! line || sscanf(line, "status %d", &status) != 1) {
+	goto miss;
+    }
+    for (offset = ftell(f); (line = readLine(f)); offset = ftell(f)) {
+	if (strncmp(line, "dep ", 4) != 0) {
+	    break;
+	}
+	if (strlen(line) < 22 || line[20] != ' '
+	    || sscanf(line + 4, "%8lx%8lx", &hi, &lo) != 2
+	    || digest(line + 21, &h) < 0
+	    || (unsigned long) (h >> 32) != hi
+	    || (unsigned long) (h & 0xffffffff) != lo) {
+	    goto miss;
+	}
+    }
+    fclose(f);
+    job->offset = offset;
+    job->status = status;
+    numCached++;
+    return;
+
+ miss:
+    if (f) {
+	fclose(f);
+    }
+    free(job->entry);
+    job->entry = NULL;
+}
+
+
+
+static void
+store(Job *job, Table *deps, Table *lines)
+{
+    FILE *f;
+    char *name, *tmp;
+    SmiUnsigned64 h;
+    int i;
+
+    name = entryName(job, 0);
+    tmp = entryName(job, getpid());
+    f = fopen(tmp, "w");
+    if (! f) {
+	free(tmp);
+	free(name);
+	return;
+    }
+    fprintf(f, "%s\nstatus %d\n", CACHE_MAGIC, job->status);
+    for (i = 0; i < deps->num; i++) {
+	if (digest(deps->entries[i].name, &h) < 0) {
+	    break;
+	}
+	fprintf(f, "dep %08lx%08lx %s\n", (unsigned long) (h >> 32),
+		(unsigned long) (h & 0xffffffff), deps->entries[i].name);
+    }
+    for (i = 0; i < lines->num; i++) {
+	fprintf(f, "%s\n", lines->entries[i].name);
+    }
+    if (fclose(f) != 0 || i < lines->num || rename(tmp, name) != 0) {
+	remove(tmp);
+    }
+    free(tmp);
+    free(name);
+}
+
+
+
+/*
+ * Return the index of the first recorded diagnostic of a file. The
+ * records are sorted by path at this point.
+ */
+
+static int
+findRecords(char *path)
+{
+    Record key;
+    int lo, hi, mid;
+
+    key.path = path;
+    key.seq = -1;
+    for (lo = 0, hi = numRecords; lo < hi; ) {
+	mid = (lo + hi) / 2;
+	if (cmpRecords(&records[mid], &key) < 0) {
+	    lo = mid + 1;
+	} else {
+	    hi = mid;
+	}
+    }
+    return lo;
+}
+
+
+
+/*
+ * Report the diagnostics of a job. Lines with the tag "=" list the
+ * files the module depends on, an empty one says that some imports
+ * have not been resolved. These are only used for the cache entry.
+ */
+
+static void
+replay(Job *job)
+{
+    Table deps = { NULL, 0, 0 }, lines = { NULL, 0, 0 };
+    FILE *f;
+    char *line;
+    int i, cacheable = cacheDir && job->keyed && ! job->entry;
+
+    if (job->entry) {
+	f = fopen(job->entry, "r");
+	if (f && fseek(f, job->offset, SEEK_SET) == 0) {
+	    while ((line = readLine(f))) {
+		report(line);
+	    }
+	}
+	if (f) {
+	    fclose(f);
+	}
+    } else if (job->out) {
+	rewind(job->out);
+	while ((line = readLine(job->out))) {
+	    if (line[0] == '=' && line[1] == '\t') {
+		if (! line[2]) {
+		    cacheable = 0;
+		} else if (cacheable) {
+		    append(&deps, line + 2);
+		}
+		continue;
+	    }
+	    report(line);
+	    if (cacheable) {
+		append(&lines, line);
+	    }
+	}
+	fclose(job->out);
+	job->out = NULL;
+    } else if (job->module) {
+	for (i = findRecords(job->module->path); i < numRecords
+		 && strcmp(records[i].path, job->module->path) == 0; i++) {
+	    report(recordLine(&records[i]));
+	    if (cacheable) {
+		append(&lines, recordLine(&records[i]));
+	    }
+	}
+	if (cacheable && dependencies(job->module, &deps) < 0) {
+	    cacheable = 0;
+	}
+    }
+
+    if (cacheable) {
+	store(job, &deps, &lines);
+    }
+    clear(&deps);
+    clear(&lines);
+}
+
+
+
+static void
+start(Job *job)
+{
+    int pid;
+
+    job->out = tmpfile();
+    if (! job->out) {
+	perror("smilint: cannot create temporary file");
+	exit(1);
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+    pid = fork();
+    if (pid < 0) {
+	perror("smilint: cannot fork");
+	exit(1);
+    }
+    if (pid == 0) {
+	Table deps = { NULL, 0, 0 };
+	SmiModule *smiModule;
+	char *name;
+	int i;
+	
+	out = job->out;
+	name = smiLoadModule(job->path);
+	if (! name) {
+	    fprintf(out, "\tsmilint: cannot locate module `%s'\n", job->path);
+	    fflush(out);
+	    _exit(1);
+	}
+	if (cacheDir) {
+	    smiModule = findLoaded(name);
+	    if (! smiModule || dependencies(smiModule, &deps) < 0) {
+		fprintf(out, "=\t\n");
+	    } else {
+		for (i = 0; i < deps.num; i++) {
+		    fprintf(out, "=\t%s\n", deps.entries[i].name);
+		}
+	    }
+	}
+	fflush(out);
+	_exit(0);
+    }
+
+    job->pid = pid;
+    job->status = -1;
+}
+
+
+
+/*
+ * Check all files in the given files and directories. Returns the
+ * exit status of the program.
+ */
+
+static int
+lintBatch(int argc, char *argv[])
+{
+    Table imports = { NULL, 0, 0 };
+    Loaded *loaded = NULL;
+    SmiModule *smiModule;
+    struct stat st;
+    char *path;
+    int i, j, numLoaded = 0, maxLoaded = 0;
+    int next, done, running, pid, status, rc = 0;
+
+    for (i = 1; i < argc; i++) {
+	collect(argv[i]);
+    }
+
+    if (dirs) {
+	path = smiGetPath();
+	if (path) {
+	    dirs = realloc(dirs, strlen(dirs) + strlen(path) + 2);
+	    sprintf(dirs + strlen(dirs), "%c%s", PATH_SEPARATOR, path);
+	    free(path);
+	}
+	smiSetPath(dirs);
+    }
+
+    if (cacheDir) {
+	char buf[20];
+	
+	mkdir(cacheDir, 0777);
+	path = smiGetPath();
+	addKey('P', path ? path : "");
+	free(path);
+	sprintf(buf, "%d%d%d", sFlag, mFlag, (flags & SMI_FLAG_RECURSIVE) != 0);
+	addKey('f', buf);
+	addSeverities();
+	addKey('V', SMI_VERSION_STRING);
+	baseKey = hash(FNV_OFFSET, cacheKey, strlen(cacheKey));
+	for (i = 0, j = 0; i < numJobs; i++) {
+	    lookup(&jobs[i]);
+	    if (jobs[i].entry) {
+		j++;
+	    }
+	}
+	if (j == numJobs) {
+	    goto run;
+	}
+    }
+
+    /*
+     * Preload the modules imported by at least two files and those
+     * named by -p options. Diagnostics of all modules loaded this way
+     * are recorded, so that they can be reported for the files that
+     * are themselves part of the preloaded set.
+     */
+
+    for (i = 0; i < numJobs; i++) {
+	if (jobs[i].status == -2) {
+	    scanImports(jobs[i].path, &imports);
+	}
+    }
+    if (imports.num) {
+	qsort(imports.entries, imports.num, sizeof(Count), cmpCounts);
+    }
+
+    smiCollectDiagnostics(1);
+    smiSetFlags(flags | SMI_FLAG_RECURSIVE);
+    for (i = 0; i < numPreloads; i++) {
+	smiLoadModule(preloads[i]);
+    }
+    for (i = 0; i < imports.num && imports.entries[i].count > 1; i++) {
+	smiLoadModule(imports.entries[i].name);
+    }
+    smiSetFlags(flags);
+    smiCollectDiagnostics(0);
+    clear(&imports);
+    collectRecords();
+
+    if (numRecords) {
+	qsort(records, numRecords, sizeof(Record), cmpRecords);
+    }
+
+    for (smiModule = smiGetFirstModule(); smiModule;
+	 smiModule = smiGetNextModule(smiModule)) {
+	if (! smiModule->path || stat(smiModule->path, &st) < 0) {
+	    continue;
+	}
+	if (numLoaded == maxLoaded) {
+	    maxLoaded = maxLoaded ? 2 * maxLoaded : 64;
+	    loaded = realloc(loaded, maxLoaded * sizeof(Loaded));
+	}
+	loaded[numLoaded].module = smiModule;
+	loaded[numLoaded].dev = st.st_dev;
+	loaded[numLoaded].ino = st.st_ino;
+	numLoaded++;
+    }
+
+    /*
+     * Files that have been loaded while preloading are not checked
+     * again, their recorded diagnostics are replayed instead.
+     */
+    
+    for (i = 0; i < numJobs; i++) {
+	if (jobs[i].status != -2) {
+	    continue;
+	}
+	if (stat(jobs[i].path, &st) == 0) {
+	    for (j = 0; j < numLoaded; j++) {
+		if (loaded[j].dev == st.st_dev && loaded[j].ino == st.st_ino) {
+		    break;
+		}
+	    }
+	} else {
+	    for (j = 0; j < numLoaded; j++) {
+		if (strcmp(loaded[j].module->name, jobs[i].path) == 0) {
+		    break;
+		}
+	    }
+	}
+	if (j < numLoaded) {
+	    jobs[i].module = loaded[j].module;
+	    jobs[i].status = 0;
+	    for (j = findRecords(jobs[i].module->path); j < numRecords
+		     && strcmp(records[j].path, jobs[i].module->path) == 0;
+		 j++) {
+		records[j].used = 1;
+	    }
+	}
+    }
+    free(loaded);
+
+    if (flags & SMI_FLAG_RECURSIVE) {
+	for (i = 0; i < numRecords; i++) {
+	    if (! records[i].used) {
+		report(recordLine(&records[i]));
+	    }
+	}
+    }
+
+run:
+    for (next = 0, done = 0, running = 0; done < numJobs; ) {
+	while (next < numJobs && (jobs[next].status >= 0 || running < jFlag)) {
+	    if (jobs[next].status == -2) {
+		start(&jobs[next]);
+		running++;
+	    }
+	    next++;
+	}
+	if (jobs[done].status >= 0) {
+	    replay(&jobs[done]);
+	    if (jobs[done].status > rc) {
+		rc = jobs[done].status;
+	    }
+	    done++;
+	    continue;
+	}
+	pid = wait(&status);
+	if (pid < 0) {
+	    perror("smilint: wait failed");
+	    exit(1);
+	}
+	for (i = done; i < next; i++) {
+	    if (jobs[i].pid == pid && jobs[i].status == -1) {
+		jobs[i].status = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+		running--;
+		break;
+	    }
+	}
+    }
+
+    fprintf(stderr, "\nsmilint: %d files checked", numJobs);
+    if (cacheDir) {
+	fprintf(stderr, " (%d cached)", numCached);
+    }
+    fprintf(stderr, ", %d messages\n", numMessages);
+    if (tags.num) {
+	qsort(tags.entries, tags.num, sizeof(Count), cmpCounts);
+    }
+    for (i = 0; i < tags.num; i++) {
+	fprintf(stderr, "%8d %s\n", tags.entries[i].count, tags.entries[i].name);
+    }
+
+    return rc;
+}
+
+#endif
+
+
+
 int main(int argc, char *argv[])
 {
     int i;
@@ -274,6 +1389,8 @@ int main(int argc, char *argv[])
 	{ 'l', "level",          OPT_INT,    level,         OPT_CALLFUNC },
 	{ 'i', "ignore",         OPT_STRING, ignore,        OPT_CALLFUNC },
 	{ 'I', "noignore",       OPT_STRING, noignore,      OPT_CALLFUNC },
+	{ 'j', "jobs",           OPT_INT,    &jFlag,        0 },
+	{ 'C', "cache",          OPT_STRING, &cacheDir,     0 },
 	{ 0, 0, OPT_END, 0, 0 }  /* no more options */
     };
     
@@ -297,10 +1414,6 @@ int main(int argc, char *argv[])
 	errors = errors_new();
     }
 
-    if (sFlag || mFlag) {
-	smiSetErrorHandler(errorHandler);
-    }
-
     if (eFlag && argc == 1) {
 	if (errors) {
 	    display_all(errors);
@@ -309,6 +1422,53 @@ int main(int argc, char *argv[])
 	smiExit();
 	return 0;
     }
+
+    /*
+     * Directory arguments or the -j option select the batch mode.
+     */
+
+    for (i = 1; i < argc && ! jFlag; i++) {
+#ifdef SMILINT_BATCH
+	struct stat st;
+	if (stat(argv[i], &st) == 0 && S_ISDIR(st.st_mode)) {
+	    break;
+	}
+#endif
+    }
+    if (jFlag || cacheDir || i < argc) {
+#ifdef SMILINT_BATCH
+	int rc;
+	
+	if (jFlag <= 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+	    jFlag = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	    if (jFlag <= 0) {
+		jFlag = 1;
+	    }
+	}
+	smiSetErrorHandler(errorHandler);
+	rc = lintBatch(argc, argv);
+	if (errors) {
+	    display_used(errors);
+	    free(errors);
+	}
+	smiExit();
+	return rc;
+#else
+	fprintf(stderr, "smilint: batch mode is not supported\n");
+	smiExit();
+	return 1;
+#endif
+    }
+
+    if (sFlag || mFlag) {
+	smiSetErrorHandler(errorHandler);
+    }
+
+    for (i = 0; i < numPreloads; i++) {
+	smiLoadModule(preloads[i]);
+    }
     
     for (i = 1; i < argc; i++) {
 	if (smiLoadModule(argv[i]) == NULL) {
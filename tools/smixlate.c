@@ -32,6 +32,7 @@
 static int flags;
 static int aFlag = 0;	/* translate all OIDs */
 static int fFlag = 0;	/* preserve formatting */
+static int xFlag = 0;	/* reverse translation of names into OIDs */
 
 static void translate(dstring_t *token, dstring_t *subst)
 {
@@ -67,6 +68,98 @@ static void translate(dstring_t *token, dstring_t *subst)
 }
 
 
+static void xlate(dstring_t *token, dstring_t *subst)
+{
+    SmiSubid oid[128];
+    unsigned int oidlen = sizeof(oid)/sizeof(oid[0]);
+    unsigned int i;
+    size_t len;
+    char *s, c;
+
+    assert(token && subst);
+
+    dstring_truncate(subst, 0);
+
+    /*
+     * Leave trailing punctuation characters alone so that names at
+     * the end of a sentence or in a list are still translated.
+     */
+
+    s = dstring_str(token);
+    for (len = dstring_len(token);
+	 len > 0 && strchr(",;:)]}", s[len-1]); len--);
+    c = s[len];
+    s[len] = 0;
+    
+    if (!isalpha((int) s[0]) || smiParseOID(s, oid, &oidlen) != 0) {
+	s[len] = c;
+	dstring_assign(subst, s);
+	return;
+    }
+    s[len] = c;
+
+    for (i = 0; i < oidlen; i++) {
+	dstring_append_printf(subst, "%s%u", i ? "." : "", oid[i]);
+    }
+    dstring_append(subst, s + len);
+}
+
+
+
+static void xprocess(FILE *stream)
+{
+    int c, quoted = 0;
+    dstring_t *token, *subst;
+
+    token = dstring_new();
+    subst = dstring_new();
+    
+    if (! token || ! subst) {
+	return;
+    }
+
+    /*
+     * A token is a sequence of non white space characters. White
+     * space characters inside of quoted string index values do not
+     * terminate a token.
+     */
+
+    while ((c = fgetc(stream)) != EOF) {
+	if (quoted || !isspace(c)) {
+	    if (c == '"') {
+		quoted = !quoted;
+	    } else if (c == '\\' && quoted) {
+		dstring_append_char(token, (char) c);
+		if ((c = fgetc(stream)) == EOF) {
+		    break;
+		}
+	    }
+	    dstring_append_char(token, (char) c);
+	    continue;
+	}
+	if (dstring_len(token)) {
+	    xlate(token, subst);
+	    fputs(dstring_str(subst), stdout);
+	    dstring_truncate(token, 0);
+	}
+	fputc(c, stdout);
+	if (c == '\n') {
+	    fflush(stdout);
+	}
+    }
+
+    if (dstring_len(token)) {
+	xlate(token, subst);
+	fputs(dstring_str(subst), stdout);
+    }
+    fflush(stdout);
+
+    dstring_delete(token);
+    dstring_delete(subst);
+}
+
+
+
 static void process(FILE *stream)
 {
     int c, space = 0;
@@ -87,8 +180,6 @@ static void process(FILE *stream)
      * TODO: - translate instance identifier to something meaningful
      *         (e.g. foobar["name",32]) where possible
      *       - generate warnings if instance identifier are incomplete
-     *       - provide a reverse translation service (-x) (but this is
-     *         more complex since it is unclear how to identify names
      *	     - make the white space magic optional
      */
 
@@ -260,7 +351,8 @@ static void usage()
 	    "  -i, --ignore=prefix   ignore errors matching prefix pattern\n"
 	    "  -I, --noignore=prefix do not ignore errors matching prefix pattern\n"
 	    "  -a, --all             replace all OIDs (including OID prefixes)\n"
-	    "  -f, --format          preserve formatting as much as possible\n");
+	    "  -f, --format          preserve formatting as much as possible\n"
+	    "  -x, --reverse         translate names into numeric OIDs\n");
 }
 
 
@@ -284,6 +376,7 @@ int main(int argc, char *argv[])
 	/* short long              type        var/func       special       */
 	{ 'a', "all",		 OPT_FLAG,   &aFlag,        0 },
 	{ 'f', "format",         OPT_FLAG,   &fFlag,	    0 },
+	{ 'x', "reverse",        OPT_FLAG,   &xFlag,	    0 },
 	{ 'h', "help",           OPT_FLAG,   help,          OPT_CALLFUNC },
 	{ 'V', "version",        OPT_FLAG,   version,       OPT_CALLFUNC },
 	{ 'c', "config",         OPT_STRING, config,        OPT_CALLFUNC },
@@ -320,7 +413,11 @@ int main(int argc, char *argv[])
     }
 
 
-    process(stdin);
+    if (xFlag) {
+	xprocess(stdin);
+    } else {
+	process(stdin);
+    }
 
     smiExit();
 
@@ -13,7 +13,7 @@
 /* The default error level at libsmi initialization. */
 #define DEFAULT_ERRORLEVEL 3
 
-/* The maximum module import recursion depth. */
+/* The maximum YANG module import recursion depth. */
 #define MAX_LEX_DEPTH 30
 
 /* The full pathname of the global configuration file. */